@@ -0,0 +1,105 @@
+// Microbenchmark for per-operation handle overhead.
+//
+// Compares the previous tensor storage scheme (counter-based names in an
+// std::unordered_map) with HandleTable. Each simulated op does what a typical
+// command does: allocate a result handle, store the value, resolve two operand
+// handles, and release a temporary created a few ops earlier.
+//
+// Build and run from the repository root:
+//   g++ -std=c++17 -O2 -Isrc scripts/bench/handle_table_bench.cpp -o /tmp/handle_table_bench
+//   /tmp/handle_table_bench [ops] [live]
+
+#include "handle_table.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// Stand-in for torch::Tensor: one reference-counted pointer
+using Value = std::shared_ptr<int>;
+
+struct MapStorage {
+    std::unordered_map<std::string, Value> map;
+    std::atomic<int> counter{0};
+
+    std::string Allocate() { return "tensor" + std::to_string(counter.fetch_add(1)); }
+    Value& operator[](const std::string& name) { return map[name]; }
+    Value* Find(const std::string& name) {
+        auto it = map.find(name);
+        return it == map.end() ? nullptr : &it->second;
+    }
+    void Erase(const std::string& name) { map.erase(name); }
+};
+
+struct SlotStorage {
+    HandleTable<Value> table{"tensor"};
+
+    std::string Allocate() { return table.Reserve(); }
+    Value& operator[](const std::string& name) { return table[name]; }
+    Value* Find(const std::string& name) {
+        auto it = table.find(name);
+        return it == table.end() ? nullptr : &it->second;
+    }
+    void Erase(const std::string& name) { table.erase(name); }
+};
+
+template <typename Storage>
+double Run(long ops, long live) {
+    Storage storage;
+    Value shared = std::make_shared<int>(0);
+    std::deque<std::string> window;
+
+    // Long-lived handles (parameters, datasets) the working set is spread over
+    for (long i = 0; i < live; i++) {
+        std::string name = storage.Allocate();
+        storage[name] = shared;
+        window.push_back(name);
+    }
+
+    long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < ops; i++) {
+        const std::string& a = window[window.size() - 1];
+        const std::string& b = window[window.size() / 2];
+        // Commands check existence and then index again
+        if (storage.Find(a) != nullptr && storage.Find(b) != nullptr) {
+            checksum += storage[a].use_count() + storage[b].use_count();
+        }
+
+        std::string result = storage.Allocate();
+        storage[result] = shared;
+        window.push_back(result);
+
+        storage.Erase(window.front());
+        window.pop_front();
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    if (checksum == 42) {
+        std::puts("");  // keep the loop observable
+    }
+    return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+int main(int argc, char** argv) {
+    long ops = argc > 1 ? std::atol(argv[1]) : 2000000;
+    long live = argc > 2 ? std::atol(argv[2]) : 100000;
+
+    // Best of three to damp scheduler noise
+    double before = 1e300;
+    double after = 1e300;
+    for (int round = 0; round < 3; round++) {
+        before = std::min(before, Run<MapStorage>(ops, live));
+        after = std::min(after, Run<SlotStorage>(ops, live));
+    }
+    std::printf("ops=%ld live=%ld\n", ops, live);
+    std::printf("unordered_map: %.1f ns/op\n", before);
+    std::printf("HandleTable:   %.1f ns/op\n", after);
+    return 0;
+}
@@ -0,0 +1,53 @@
+#!/usr/bin/env tclsh
+# Benchmark for lazy elementwise fusion.
+#
+# Evaluates the same elementwise chain eagerly (one full-size tensor per
+# operation) and inside torch::lazy_begin / torch::lazy_end (one blocked,
+# vectorized pass), and checks that both give the same result.
+#
+# Run from the repository root after building:
+#   tclsh scripts/bench/lazy_fusion_bench.tcl ?numel? ?iterations?
+
+load [file join [file dirname [info script]] .. .. build libtorchtcl.so]
+
+set numel [expr {$argc > 0 ? [lindex $argv 0] : 4000000}]
+set iterations [expr {$argc > 1 ? [lindex $argv 1] : 20}]
+
+set x [torch::randn -shape [list $numel]]
+set w [torch::randn -shape [list $numel]]
+set b [torch::randn -shape [list $numel]]
+
+# gelu(x * w + b) * sigmoid(x) - 0.5 * exp(-|b|)
+proc chain {x w b} {
+    set h [torch::gelu [torch::tensor_add [torch::tensor_mul $x $w] $b]]
+    set g [torch::tensor_sigmoid $x]
+    set d [torch::tensor_exp [torch::tensor_mul [torch::tensor_abs $b] -1.0]]
+    return [torch::tensor_sub [torch::tensor_mul $h $g] $d 0.5]
+}
+
+proc run_eager {x w b} {
+    return [chain $x $w $b]
+}
+
+proc run_lazy {x w b} {
+    torch::lazy_begin
+    set y [chain $x $w $b]
+    torch::lazy_end
+    return $y
+}
+
+# Warm up the allocator and thread pool, and compare results
+set eager [run_eager $x $w $b]
+set lazy [run_lazy $x $w $b]
+if {![torch::allclose $eager $lazy 1e-5 1e-6]} {
+    puts "Results differ between eager and lazy evaluation"
+    exit 1
+}
+
+# Each iteration releases everything it allocated
+set eager_us [lindex [time {torch::scope {run_eager $x $w $b; list}} $iterations] 0]
+set lazy_us [lindex [time {torch::scope {run_lazy $x $w $b; list}} $iterations] 0]
+
+puts [format "numel %d, %d iterations" $numel $iterations]
+puts [format "eager: %10.1f us/iter" $eager_us]
+puts [format "lazy:  %10.1f us/iter  (%.2fx)" $lazy_us [expr {double($eager_us) / $lazy_us}]]
@@ -10,6 +10,7 @@ static int ActivationUnaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     // ------------------------------------------------------------------
 
     std::string name;
+    Tcl_Obj* nameObj = nullptr;
 
     // Detect positional vs named based on first argument
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
@@ -19,6 +20,7 @@ static int ActivationUnaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
             return TCL_ERROR;
         }
         name = Tcl_GetString(objv[1]);
+        nameObj = objv[1];
     } else {
         // Named parameter syntax expects an odd number of arguments (command + pairs)
         if (objc < 3 || (objc % 2) == 0) {
@@ -38,6 +40,7 @@ static int ActivationUnaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 
             if (key == "-input" || key == "-tensor") {
                 name = value;
+                nameObj = objv[i + 1];
             } else {
                 std::string msg = "Unknown parameter: " + key;
                 Tcl_SetResult(interp, const_cast<char*>(msg.c_str()), TCL_VOLATILE);
@@ -52,12 +55,16 @@ static int ActivationUnaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     }
 
     try {
-        if (tensor_storage.find(name) == tensor_storage.end()) {
+        if (strcmp(op, "gelu") == 0 && LazyModeEnabled() && LazyRecord(interp, LazyOp::Gelu, {name})) {
+            return TCL_OK;
+        }
+        torch::Tensor* input = FindTensorFromObj(nameObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[name];
+        auto& tensor = *input;
         torch::Tensor result;
         
         if (strcmp(op, "gelu") == 0) {
@@ -93,10 +100,9 @@ static int ActivationUnaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
             return TCL_ERROR;
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -116,6 +122,7 @@ int TensorGelu_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 
 struct SeluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -131,6 +138,7 @@ SeluArgs ParseSeluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("torch::selu: wrong # args: should be \"torch::selu tensor\"");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax: torch::selu -input tensor
         if (objc < 3 || objc % 2 == 0) {
@@ -146,6 +154,7 @@ SeluArgs ParseSeluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (key == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("torch::selu: unknown option " + key);
             }
@@ -163,18 +172,18 @@ int TensorSelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         SeluArgs args = ParseSeluArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::selu(tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -189,6 +198,7 @@ int TensorSelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 
 struct EluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double alpha = 1.0;
     
     bool IsValid() const {
@@ -205,6 +215,7 @@ EluArgs ParseEluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("torch::elu: wrong # args: should be \"torch::elu tensor ?alpha?\"");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.alpha) != TCL_OK) {
@@ -226,6 +237,7 @@ EluArgs ParseEluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (key == "-input" || key == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (key == "-alpha") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.alpha) != TCL_OK) {
                     throw std::runtime_error("torch::elu: invalid alpha value");
@@ -247,18 +259,18 @@ int TensorElu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
     try {
         EluArgs args = ParseEluArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::elu(tensor, args.alpha);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -269,6 +281,7 @@ int TensorElu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
 // Parameter structure for leaky_relu command
 struct LeakyReluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double negative_slope = 0.01;
     
     bool IsValid() const {
@@ -286,6 +299,7 @@ LeakyReluArgs ParseLeakyReluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::leaky_relu tensor ?negative_slope?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.negative_slope) != TCL_OK) {
@@ -304,6 +318,7 @@ LeakyReluArgs ParseLeakyReluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-negativeSlope" || param == "-negative_slope" || param == "-slope") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.negative_slope) != TCL_OK) {
                     throw std::runtime_error("Invalid negative_slope");
@@ -326,18 +341,18 @@ int TensorLeakyRelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         LeakyReluArgs args = ParseLeakyReluArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::leaky_relu(tensor, args.negative_slope);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -349,6 +364,8 @@ int TensorLeakyRelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct PreluArgs {
     std::string input;
     std::string weight;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !weight.empty();
@@ -366,7 +383,9 @@ PreluArgs ParsePreluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.weight = Tcl_GetString(objv[2]);
+        args.weightObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -378,8 +397,10 @@ PreluArgs ParsePreluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = Tcl_GetString(objv[i + 1]);
+                args.weightObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -398,23 +419,24 @@ int TensorPrelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         auto args = ParsePreluArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.weight) == tensor_storage.end()) {
+        torch::Tensor* weight = FindTensorFromObj(args.weightObj);
+        if (weight == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid weight tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
-        auto& weight_tensor = tensor_storage[args.weight];
+        auto& input_tensor = *input;
+        auto& weight_tensor = *weight;
         torch::Tensor result = torch::prelu(input_tensor, weight_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -425,6 +447,7 @@ int TensorPrelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for relu6 command
 struct Relu6Args {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -441,6 +464,7 @@ Relu6Args ParseRelu6Args(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("Usage: torch::relu6 tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -453,6 +477,7 @@ Relu6Args ParseRelu6Args(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -471,18 +496,18 @@ int TensorRelu6_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         Relu6Args args = ParseRelu6Args(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::relu6(tensor);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -493,6 +518,7 @@ int TensorRelu6_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for hardtanh command
 struct HardtanhArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double min_val = -1.0;
     double max_val = 1.0;
     
@@ -511,6 +537,7 @@ HardtanhArgs ParseHardtanhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Usage: torch::hardtanh tensor ?min_val? ?max_val?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.min_val) != TCL_OK) {
@@ -534,6 +561,7 @@ HardtanhArgs ParseHardtanhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-min" || param == "-minVal") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.min_val) != TCL_OK) {
                     throw std::runtime_error("Invalid min_val");
@@ -560,18 +588,18 @@ int TensorHardtanh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
     try {
         HardtanhArgs args = ParseHardtanhArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::hardtanh(tensor, args.min_val, args.max_val);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -587,6 +615,7 @@ int TensorHardswish_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* co
 // Parameter structure for hardsigmoid command
 struct HardsigmoidArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -603,6 +632,7 @@ HardsigmoidArgs ParseHardsigmoidArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::hardsigmoid tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -615,6 +645,7 @@ HardsigmoidArgs ParseHardsigmoidArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -633,18 +664,18 @@ int TensorHardsigmoid_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         HardsigmoidArgs args = ParseHardsigmoidArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::hardsigmoid(tensor);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -658,6 +689,7 @@ int TensorHardsigmoid_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj*
 
 struct SiluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -673,6 +705,7 @@ SiluArgs ParseSiluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("torch::silu: wrong # args: should be \"torch::silu tensor\"");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax: torch::silu -input tensor
         if (objc == 1) {
@@ -688,6 +721,7 @@ SiluArgs ParseSiluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (key == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("torch::silu: unknown option " + key);
             }
@@ -705,19 +739,22 @@ SiluArgs ParseSiluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
 int TensorSilu_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         SiluArgs args = ParseSiluArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Silu, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::silu(tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -731,6 +768,7 @@ int TensorSilu_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 
 struct MishArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -746,6 +784,7 @@ MishArgs ParseMishArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("torch::mish: wrong # args: should be \"torch::mish tensor\"");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax: torch::mish -input tensor
         if (objc < 3 || objc % 2 == 0) {
@@ -761,6 +800,7 @@ MishArgs ParseMishArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (key == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("torch::mish: unknown option " + key);
             }
@@ -778,18 +818,18 @@ int TensorMish_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         MishArgs args = ParseMishArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::mish(tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -805,6 +845,7 @@ int TensorSoftplus_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
 // torch::softsign - Softsign activation
 struct SoftsignArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -820,6 +861,7 @@ SoftsignArgs ParseSoftsignArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("wrong # args: should be \"torch::softsign tensor | -input tensor\"");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax: torch::softsign -input tensor
         if (objc < 3 || objc % 2 == 0) {
@@ -835,6 +877,7 @@ SoftsignArgs ParseSoftsignArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (key == "-input" || key == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + key);
             }
@@ -852,18 +895,18 @@ int TensorSoftsign_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         SoftsignArgs args = ParseSoftsignArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::nn::functional::softsign(tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -877,6 +920,7 @@ int TensorSoftsign_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 
 struct TanhshrinkArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -892,6 +936,7 @@ TanhshrinkArgs ParseTanhshrinkArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("torch::tanhshrink: wrong # args: should be \"torch::tanhshrink tensor\"");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax: torch::tanhshrink -input tensor
         if (objc < 3 || objc % 2 == 0) {
@@ -907,6 +952,7 @@ TanhshrinkArgs ParseTanhshrinkArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (key == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("torch::tanhshrink: unknown option " + key);
             }
@@ -924,18 +970,18 @@ int TensorTanhshrink_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         TanhshrinkArgs args = ParseTanhshrinkArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::nn::functional::tanhshrink(tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -946,6 +992,7 @@ int TensorTanhshrink_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for threshold command
 struct ThresholdArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double threshold;
     double value;
     
@@ -966,6 +1013,7 @@ static ThresholdArgs ParseThresholdArgs(Tcl_Interp* interp, int objc, Tcl_Obj* c
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.threshold) != TCL_OK) {
             throw std::runtime_error("Invalid threshold value");
@@ -985,6 +1033,7 @@ static ThresholdArgs ParseThresholdArgs(Tcl_Interp* interp, int objc, Tcl_Obj* c
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-threshold") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.threshold) != TCL_OK) {
                     throw std::runtime_error("Invalid threshold value");
@@ -1011,18 +1060,18 @@ int TensorThreshold_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         ThresholdArgs args = ParseThresholdArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::threshold(tensor, args.threshold, args.value);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1033,6 +1082,7 @@ int TensorThreshold_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for rrelu
 struct RreluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double lower = 1.0 / 8.0;
     double upper = 1.0 / 3.0;
     
@@ -1060,6 +1110,7 @@ RreluArgs ParseRreluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         
         // Parse required parameter
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse optional parameters
         if (objc > 2) {
@@ -1083,6 +1134,7 @@ RreluArgs ParseRreluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-lower") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lower) != TCL_OK) {
                     throw std::runtime_error("Invalid lower value");
@@ -1110,18 +1162,18 @@ int TensorRrelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         // Parse arguments using dual syntax
         RreluArgs args = ParseRreluArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::rrelu(tensor, args.lower, args.upper);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1132,6 +1184,7 @@ int TensorRrelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for celu command
 struct CeluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double alpha = 1.0;  // Default alpha value for CELU
     
     bool IsValid() const {
@@ -1149,6 +1202,7 @@ CeluArgs ParseCeluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("Usage: torch::celu tensor ?alpha?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.alpha) != TCL_OK) {
@@ -1166,6 +1220,7 @@ CeluArgs ParseCeluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-alpha") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.alpha) != TCL_OK) {
                     throw std::runtime_error("Invalid alpha parameter");
@@ -1188,18 +1243,18 @@ int TensorCelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         CeluArgs args = ParseCeluArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::celu(tensor, args.alpha);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1210,6 +1265,7 @@ int TensorCelu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for softmin
 struct SoftminArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // Default to last dimension
     
     bool IsValid() const {
@@ -1232,6 +1288,7 @@ SoftminArgs ParseSoftminArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -1249,6 +1306,7 @@ SoftminArgs ParseSoftminArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
@@ -1272,18 +1330,18 @@ int TensorSoftmin_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
         // Parse arguments using dual syntax
         SoftminArgs args = ParseSoftminArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::nn::functional::softmin(tensor, torch::nn::functional::SoftminFuncOptions(args.dim));
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1294,6 +1352,7 @@ int TensorSoftmin_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for softmax2d
 struct Softmax2dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 1;  // Default to channel dimension for 2D softmax
     
     bool IsValid() const {
@@ -1320,6 +1379,7 @@ Softmax2dArgs ParseSoftmax2dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         
         // Parse required parameter
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse optional dimension parameter
         if (objc > 2) {
@@ -1338,6 +1398,7 @@ Softmax2dArgs ParseSoftmax2dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
@@ -1361,18 +1422,18 @@ int TensorSoftmax2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         Softmax2dArgs args = ParseSoftmax2dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::softmax(tensor, args.dim); // Apply along specified dimension
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1382,6 +1443,7 @@ int TensorSoftmax2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 
 struct TensorLogsoftmaxArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // Default to last dimension
     
     bool IsValid() const {
@@ -1395,6 +1457,7 @@ TensorLogsoftmaxArgs ParseTensorLogsoftmaxArgs(Tcl_Interp* interp, int objc, Tcl
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             int dim;
@@ -1415,6 +1478,7 @@ TensorLogsoftmaxArgs ParseTensorLogsoftmaxArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 int dim;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &dim) != TCL_OK) {
@@ -1444,18 +1508,18 @@ int TensorLogsoftmax_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         TensorLogsoftmaxArgs args = ParseTensorLogsoftmaxArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::log_softmax(tensor, args.dim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
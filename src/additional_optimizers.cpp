@@ -106,12 +106,13 @@ int OptimizerAdamW_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_
             Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
             std::string param_name = Tcl_GetString(param_obj);
             
-            if (tensor_storage.find(param_name) == tensor_storage.end()) {
+            torch::Tensor* param_obj_tensor = FindTensorFromObj(param_obj);
+            if (param_obj_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + param_name).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
             
-            parameters.push_back(tensor_storage[param_name]);
+            parameters.push_back(*param_obj_tensor);
         }
         
         // Create AdamW optimizer
@@ -128,7 +129,7 @@ int OptimizerAdamW_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -228,11 +229,12 @@ int OptimizerRMSprop_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
             Tcl_Obj* param_obj;
             Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
             std::string name = Tcl_GetString(param_obj);
-            if (tensor_storage.find(name) == tensor_storage.end()) {
+            torch::Tensor* param_obj_tensor = FindTensorFromObj(param_obj);
+            if (param_obj_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + name).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            parameters.push_back(tensor_storage[name]);
+            parameters.push_back(*param_obj_tensor);
         }
 
         auto optimizer = std::make_shared<torch::optim::RMSprop>(
@@ -242,7 +244,7 @@ int OptimizerRMSprop_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
 
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -342,12 +344,13 @@ int OptimizerMomentumSGD_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
             Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
             std::string param_name = Tcl_GetString(param_obj);
 
-            if (tensor_storage.find(param_name) == tensor_storage.end()) {
+            torch::Tensor* param_obj_tensor = FindTensorFromObj(param_obj);
+            if (param_obj_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + param_name).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
 
-            parameters.push_back(tensor_storage[param_name]);
+            parameters.push_back(*param_obj_tensor);
         }
 
         // Create SGD optimizer with momentum
@@ -360,7 +363,7 @@ int OptimizerMomentumSGD_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
 
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -452,12 +455,13 @@ int OptimizerAdagrad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
             Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
             std::string param_name = Tcl_GetString(param_obj);
             
-            if (tensor_storage.find(param_name) == tensor_storage.end()) {
+            torch::Tensor* param_obj_tensor = FindTensorFromObj(param_obj);
+            if (param_obj_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + param_name).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
             
-            parameters.push_back(tensor_storage[param_name]);
+            parameters.push_back(*param_obj_tensor);
         }
         
         // Create Adagrad optimizer
@@ -470,7 +474,7 @@ int OptimizerAdagrad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
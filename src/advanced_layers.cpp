@@ -219,7 +219,7 @@ int BatchNorm1d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj
                             .track_running_stats(args.trackRunningStats);
         auto layer = std::make_shared<ConcreteBatchNorm1d>(options);
         std::string handle = StoreModule("batchnorm1d", layer);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -334,7 +334,7 @@ int LayerNorm_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         
         // Store and return handle
         std::string handle = StoreModule("layernorm", layer);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -425,7 +425,7 @@ int GroupNorm_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         
         // Store and return handle
         std::string handle = StoreModule("groupnorm", layer);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -534,7 +534,7 @@ int ConvTranspose2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         
         // Store and return handle
         std::string handle = StoreModule("convtranspose2d", layer);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -549,6 +549,7 @@ int ConvTranspose2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 
 struct LocalResponseNormArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int size = 5;
     double alpha = 1e-4;
     double beta = 0.75;
@@ -568,6 +569,7 @@ LocalResponseNormArgs ParseLocalResponseNormArgs(Tcl_Interp* interp, int objc, T
             throw std::runtime_error("Wrong number of arguments for positional syntax. Expected: torch::local_response_norm tensor size alpha beta k");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.size) != TCL_OK) {
             throw std::runtime_error("Invalid size parameter");
@@ -592,6 +594,7 @@ LocalResponseNormArgs ParseLocalResponseNormArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-size") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.size) != TCL_OK) {
                     throw std::runtime_error("Invalid size parameter");
@@ -628,13 +631,13 @@ int LocalResponseNorm_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
     try {
         LocalResponseNormArgs args = ParseLocalResponseNormArgs(interp, objc, objv);
         
-        auto tensor_it = tensor_storage.find(args.input);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.inputObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
-        torch::Tensor tensor = tensor_it->second;
+        torch::Tensor tensor = *tensor_entry;
         if (tensor.numel() == 0) {
             Tcl_SetResult(interp, const_cast<char*>("Input tensor is empty"), TCL_STATIC);
             return TCL_ERROR;
@@ -656,6 +659,7 @@ int LocalResponseNorm_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
 
 struct CrossMapLRN2DArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int size = 5;
     double alpha = 1e-4;
     double beta = 0.75;
@@ -675,6 +679,7 @@ CrossMapLRN2DArgs ParseCrossMapLRN2DArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Wrong number of arguments for positional syntax. Expected: torch::cross_map_lrn2d tensor size alpha beta k");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.size) != TCL_OK) {
             throw std::runtime_error("Invalid size parameter");
@@ -699,6 +704,7 @@ CrossMapLRN2DArgs ParseCrossMapLRN2DArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-size") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.size) != TCL_OK) {
                     throw std::runtime_error("Invalid size parameter");
@@ -735,13 +741,13 @@ int CrossMapLRN2D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_O
     try {
         CrossMapLRN2DArgs args = ParseCrossMapLRN2DArgs(interp, objc, objv);
         
-        auto tensor_it = tensor_storage.find(args.input);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.inputObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
-        torch::Tensor tensor = tensor_it->second;
+        torch::Tensor tensor = *tensor_entry;
         if (tensor.numel() == 0) {
             Tcl_SetResult(interp, const_cast<char*>("Input tensor is empty"), TCL_STATIC);
             return TCL_ERROR;
@@ -376,10 +376,9 @@ int TensorBartlettWindow_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
         auto options = torch::TensorOptions().dtype(dtype).device(device);
         auto window = torch::bartlett_window(args.window_length, args.periodic, options);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = window;
+        std::string handle = StoreTensor(window);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -571,10 +570,9 @@ int TensorHammingWindow_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
         auto options = torch::TensorOptions().dtype(dtype).device(device);
         auto window = torch::hamming_window(args.window_length, args.periodic, options);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = window;
+        std::string handle = StoreTensor(window);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in hamming_window: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -675,10 +673,9 @@ int TensorHannWindow_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
         auto options = torch::TensorOptions().dtype(dtype).device(device);
         auto window = torch::hann_window(args.window_length, args.periodic, options);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = window;
+        std::string handle = StoreTensor(window);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in hann_window: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -1033,6 +1030,7 @@ int TensorMelscaleFbanks_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
 // Parameter structure for mfcc command
 struct MFCCArgs {
     std::string spectrogram;
+    Tcl_Obj* spectrogramObj = nullptr;
     int n_mfcc = 13;
     int dct_type = 2;
     
@@ -1052,6 +1050,7 @@ MFCCArgs ParseMFCCArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         }
         
         args.spectrogram = Tcl_GetString(objv[1]);
+        args.spectrogramObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.n_mfcc) != TCL_OK) {
@@ -1075,6 +1074,7 @@ MFCCArgs ParseMFCCArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-spectrogram") {
                 args.spectrogram = Tcl_GetString(objv[i + 1]);
+                args.spectrogramObj = objv[i + 1];
             } else if (param == "-nMfcc" || param == "-n_mfcc") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.n_mfcc) != TCL_OK) {
                     throw std::runtime_error("Invalid n_mfcc value");
@@ -1104,11 +1104,12 @@ int TensorMFCC_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         MFCCArgs args = ParseMFCCArgs(interp, objc, objv);
         
         // Get the spectrogram tensor
-        if (tensor_storage.find(args.spectrogram) == tensor_storage.end()) {
+        torch::Tensor* spectrogram_tensor = FindTensorFromObj(args.spectrogramObj);
+        if (spectrogram_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid spectrogram tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        torch::Tensor spectrogram = tensor_storage[args.spectrogram];
+        torch::Tensor spectrogram = *spectrogram_tensor;
         
         // Apply log to mel spectrogram
         auto log_mel = torch::log(torch::clamp(spectrogram, 1e-10));
@@ -1126,10 +1127,9 @@ int TensorMFCC_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         auto mfcc = torch::matmul(dct_matrix, log_mel);
         
         // Create a new tensor handle and store the result
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = mfcc;
+        std::string handle = StoreTensor(mfcc);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in mfcc: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -2,9 +2,9 @@
 #include <torch/torch.h>
 
 // Forward declarations of global variables
-extern std::unordered_map<std::string, torch::Tensor> tensor_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::nn::Module>> module_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
+extern thread_local HandleTable<torch::Tensor> tensor_storage;
+extern thread_local std::unordered_map<std::string, ModuleRef> module_storage;
+extern thread_local std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
 
 
 extern "C" {
@@ -16,6 +16,7 @@ extern "C" {
 // Parameter structure for tensor_slice command
 struct TensorSliceArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int dim;
     int start;
     int end = -1;
@@ -40,6 +41,7 @@ TensorSliceArgs ParseTensorSliceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dimension value");
@@ -74,6 +76,7 @@ TensorSliceArgs ParseTensorSliceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-tensor" || param == "-input") {
                 args.tensor = value;
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
@@ -111,13 +114,13 @@ int Torch_TensorSlice_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, T
     try {
         TensorSliceArgs args = ParseTensorSliceArgs(interp, objc, objv);
         
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
-        auto tensor = tensor_it->second;
+        auto tensor = *tensor_entry;
         torch::Tensor result;
         
         if (args.has_end) {
@@ -126,10 +129,9 @@ int Torch_TensorSlice_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, T
             result = tensor.slice(args.dim, args.start);
         }
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -141,7 +143,9 @@ int Torch_TensorSlice_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, T
 // Parameter structure for tensor_advanced_index command
 struct TensorAdvancedIndexArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::vector<std::string> indices;
+    std::vector<Tcl_Obj*> indexObjs;
     
     bool IsValid() const {
         return !tensor.empty() && !indices.empty();
@@ -162,6 +166,7 @@ TensorAdvancedIndexArgs ParseTensorAdvancedIndexArgs(Tcl_Interp* interp, int obj
             throw std::runtime_error("Usage: torch::tensor_advanced_index tensor indices_list");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         // Parse indices list
         int list_length;
@@ -172,6 +177,7 @@ TensorAdvancedIndexArgs ParseTensorAdvancedIndexArgs(Tcl_Interp* interp, int obj
         
         for (int i = 0; i < list_length; i++) {
             args.indices.push_back(Tcl_GetString(list_items[i]));
+            args.indexObjs.push_back(list_items[i]);
         }
     } else {
         // Named parameter syntax
@@ -184,6 +190,7 @@ TensorAdvancedIndexArgs ParseTensorAdvancedIndexArgs(Tcl_Interp* interp, int obj
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-indices") {
                 // Parse indices list
                 int list_length;
@@ -194,6 +201,7 @@ TensorAdvancedIndexArgs ParseTensorAdvancedIndexArgs(Tcl_Interp* interp, int obj
                 
                 for (int j = 0; j < list_length; j++) {
                     args.indices.push_back(Tcl_GetString(list_items[j]));
+                    args.indexObjs.push_back(list_items[j]);
                 }
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -tensor, -indices");
@@ -214,20 +222,20 @@ int Torch_TensorAdvancedIndex_Cmd(ClientData clientData, Tcl_Interp *interp, int
     try {
         TensorAdvancedIndexArgs args = ParseTensorAdvancedIndexArgs(interp, objc, objv);
         
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
         std::vector<torch::Tensor> indices;
-        for (const auto& index_name : args.indices) {
-            auto index_it = tensor_storage.find(index_name);
-            if (index_it == tensor_storage.end()) {
+        for (Tcl_Obj* index_obj : args.indexObjs) {
+            torch::Tensor* index = FindTensorFromObj(index_obj);
+            if (index == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Index tensor not found"), TCL_STATIC);
                 return TCL_ERROR;
             }
-            indices.push_back(index_it->second);
+            indices.push_back(*index);
         }
 
         // Real advanced indexing implementation using LibTorch indexing
@@ -241,12 +249,11 @@ int Torch_TensorAdvancedIndex_Cmd(ClientData clientData, Tcl_Interp *interp, int
         for (const auto& idx : indices) {
             tensor_indices.push_back(torch::indexing::TensorIndex(idx));
         }
-        auto result = tensor_it->second.index(tensor_indices);
+        auto result = tensor_entry->index(tensor_indices);
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -263,6 +270,8 @@ int Torch_TensorAdvancedIndex_Cmd(ClientData clientData, Tcl_Interp *interp, int
 struct SparseTensorCreateArgs {
     std::string indices;
     std::string values;
+    Tcl_Obj* indicesObj = nullptr;
+    Tcl_Obj* valuesObj = nullptr;
     std::vector<int64_t> size;
     
     bool IsValid() const {
@@ -283,7 +292,9 @@ SparseTensorCreateArgs ParseSparseTensorCreateArgs(Tcl_Interp* interp, int objc,
             throw std::runtime_error("Usage: torch::sparse_tensor_create indices values size");
         }
         args.indices = Tcl_GetString(objv[1]);
+        args.indicesObj = objv[1];
         args.values = Tcl_GetString(objv[2]);
+        args.valuesObj = objv[2];
         args.size = TclListToShape(interp, objv[3]);
     } else {
         // Named parameter syntax
@@ -296,8 +307,10 @@ SparseTensorCreateArgs ParseSparseTensorCreateArgs(Tcl_Interp* interp, int objc,
             
             if (param == "-indices") {
                 args.indices = Tcl_GetString(objv[i + 1]);
+                args.indicesObj = objv[i + 1];
             } else if (param == "-values") {
                 args.values = Tcl_GetString(objv[i + 1]);
+                args.valuesObj = objv[i + 1];
             } else if (param == "-size") {
                 args.size = TclListToShape(interp, objv[i + 1]);
             } else {
@@ -324,16 +337,16 @@ int Torch_SparseTensorCreate_Cmd(ClientData clientData, Tcl_Interp *interp, int
     try {
         SparseTensorCreateArgs args = ParseSparseTensorCreateArgs(interp, objc, objv);
         
-        auto indices_it = tensor_storage.find(args.indices);
-        auto values_it = tensor_storage.find(args.values);
+        torch::Tensor* indices_entry = FindTensorFromObj(args.indicesObj);
+        torch::Tensor* values_entry = FindTensorFromObj(args.valuesObj);
         
-        if (indices_it == tensor_storage.end() || values_it == tensor_storage.end()) {
+        if (indices_entry == nullptr || values_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        torch::Tensor indices_tensor = indices_it->second;
-        torch::Tensor values_tensor  = values_it->second;
+        torch::Tensor indices_tensor = *indices_entry;
+        torch::Tensor values_tensor  = *values_entry;
 
         // If indices are given in (nnz, ndim) form, transpose to (ndim, nnz)
         if (indices_tensor.dim() == 2 &&
@@ -349,10 +362,9 @@ int Torch_SparseTensorCreate_Cmd(ClientData clientData, Tcl_Interp *interp, int
 
         auto result = torch::sparse_coo_tensor(indices_tensor, values_tensor, args.size);
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -371,18 +383,17 @@ int Torch_SparseTensorDense_Cmd(ClientData clientData, Tcl_Interp *interp, int o
     try {
         std::string tensor_name = Tcl_GetString(objv[1]);
         
-        auto tensor_it = tensor_storage.find(tensor_name);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(objv[1]);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
-        auto result = tensor_it->second.to_dense();
+        auto result = tensor_entry->to_dense();
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -398,6 +409,7 @@ int Torch_SparseTensorDense_Cmd(ClientData clientData, Tcl_Interp *interp, int o
 // Parameter structure for model_summary command
 struct ModelSummaryArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
     
     bool IsValid() const {
         return !model.empty();
@@ -415,6 +427,7 @@ ModelSummaryArgs ParseModelSummaryArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -426,6 +439,7 @@ ModelSummaryArgs ParseModelSummaryArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-model") {
                 args.model = Tcl_GetString(objv[i + 1]);
+                args.modelObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -445,8 +459,8 @@ int Torch_ModelSummary_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
     try {
         ModelSummaryArgs args = ParseModelSummaryArgs(interp, objc, objv);
         
-        auto model_it = module_storage.find(args.model);
-        if (model_it == module_storage.end()) {
+        ModuleRef* model_entry = FindModuleFromObj(args.modelObj);
+        if (model_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -455,7 +469,7 @@ int Torch_ModelSummary_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
         int64_t total_params = 0;
         int64_t trainable_params = 0;
         
-        for (const auto& param : model_it->second->parameters()) {
+        for (const auto& param : (*model_entry)->parameters()) {
             total_params += param.numel();
             if (param.requires_grad()) {
                 trainable_params += param.numel();
@@ -482,6 +496,7 @@ int Torch_ModelSummary_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
 
 struct CountParametersArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
     
     bool IsValid() const {
         return !model.empty();
@@ -497,6 +512,7 @@ CountParametersArgs ParseCountParametersArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Wrong number of arguments for positional syntax. Expected: torch::count_parameters model");
         }
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
     } else {
         // Named parameter syntax: torch::count_parameters -model model_name
         for (int i = 1; i < objc; i += 2) {
@@ -509,6 +525,7 @@ CountParametersArgs ParseCountParametersArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-model") {
                 args.model = value;
+                args.modelObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
     }
@@ -528,14 +545,14 @@ int Torch_CountParameters_Cmd(ClientData clientData, Tcl_Interp *interp, int obj
     try {
         CountParametersArgs args = ParseCountParametersArgs(interp, objc, objv);
         
-        auto model_it = module_storage.find(args.model);
-        if (model_it == module_storage.end()) {
+        ModuleRef* model_entry = FindModuleFromObj(args.modelObj);
+        if (model_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
         int64_t total_params = 0;
-        for (const auto& param : model_it->second->parameters()) {
+        for (const auto& param : (*model_entry)->parameters()) {
             total_params += param.numel();
         }
 
@@ -573,6 +590,7 @@ int Torch_Broadcast_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl
 // Parameter structure for tensor_norm command
 struct TensorNormArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     double p = 2.0;  // Default L2 norm
     c10::optional<int64_t> dim = c10::nullopt;
     
@@ -595,6 +613,7 @@ TensorNormArgs ParseTensorNormArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::tensor_norm tensor ?p? ?dim?");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.p) != TCL_OK) {
@@ -620,6 +639,7 @@ TensorNormArgs ParseTensorNormArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-p") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.p) != TCL_OK) {
                     throw std::runtime_error("Invalid p value");
@@ -650,23 +670,22 @@ int Torch_TensorNorm_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tc
         // Parse arguments using dual syntax parser
         TensorNormArgs args = ParseTensorNormArgs(interp, objc, objv);
 
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
         torch::Tensor result;
         if (args.dim.has_value()) {
-            result = torch::norm(tensor_it->second, args.p, {args.dim.value()});
+            result = torch::norm(*tensor_entry, args.p, {args.dim.value()});
         } else {
-            result = torch::norm(tensor_it->second, args.p);
+            result = torch::norm(*tensor_entry, args.p);
         }
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -678,6 +697,7 @@ int Torch_TensorNorm_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tc
 // Parameter structure for tensor_normalize command
 struct TensorNormalizeArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     double p = 2.0;  // Default L2 norm
     c10::optional<int64_t> dim = c10::nullopt;  // Default to all dimensions
     
@@ -700,6 +720,7 @@ TensorNormalizeArgs ParseTensorNormalizeArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::tensor_normalize tensor ?p? ?dim?");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.p) != TCL_OK) {
@@ -725,6 +746,7 @@ TensorNormalizeArgs ParseTensorNormalizeArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-p") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.p) != TCL_OK) {
                     throw std::runtime_error("Invalid p value");
@@ -755,8 +777,8 @@ int Torch_TensorNormalize_Cmd(ClientData clientData, Tcl_Interp *interp, int obj
         // Parse arguments using dual syntax parser
         TensorNormalizeArgs args = ParseTensorNormalizeArgs(interp, objc, objv);
 
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -765,21 +787,20 @@ int Torch_TensorNormalize_Cmd(ClientData clientData, Tcl_Interp *interp, int obj
         
         if (args.dim.has_value()) {
             // Normalize along specific dimension
-            auto norm_tensor = torch::norm(tensor_it->second, args.p, {args.dim.value()}, true);
+            auto norm_tensor = torch::norm(*tensor_entry, args.p, {args.dim.value()}, true);
             // Add small epsilon to avoid division by zero
             norm_tensor = norm_tensor + 1e-8;
-            result = tensor_it->second / norm_tensor;
+            result = *tensor_entry / norm_tensor;
         } else {
             // Normalize the entire tensor (flatten first)
-            auto flat_tensor = tensor_it->second.flatten();
+            auto flat_tensor = tensor_entry->flatten();
             auto norm_val = torch::norm(flat_tensor, args.p);
-            result = tensor_it->second / (norm_val + 1e-8);
+            result = *tensor_entry / (norm_val + 1e-8);
         }
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -791,6 +812,7 @@ int Torch_TensorNormalize_Cmd(ClientData clientData, Tcl_Interp *interp, int obj
 // Parameter structure for tensor_unique
 struct TensorUniqueArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     bool sorted = true;
     bool return_inverse = false;
     
@@ -809,6 +831,7 @@ TensorUniqueArgs ParseTensorUniqueArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             throw std::runtime_error("Usage: torch::tensor_unique tensor ?sorted? ?return_inverse?");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             int sorted_val;
@@ -836,6 +859,7 @@ TensorUniqueArgs ParseTensorUniqueArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-sorted") {
                 int sorted_val;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &sorted_val) != TCL_OK) {
@@ -871,30 +895,27 @@ int Torch_TensorUnique_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
     try {
         TensorUniqueArgs args = ParseTensorUniqueArgs(interp, objc, objv);
 
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
         if (args.return_inverse) {
             // Use the actual _unique function with return_inverse
-            auto [unique_result, inverse_result] = at::_unique(tensor_it->second, args.sorted, args.return_inverse);
+            auto [unique_result, inverse_result] = at::_unique(*tensor_entry, args.sorted, args.return_inverse);
             
-            std::string unique_name = GetNextHandle("tensor");
-            std::string inverse_name = GetNextHandle("tensor");
-            tensor_storage[unique_name] = unique_result;
-            tensor_storage[inverse_name] = inverse_result;
+            std::string unique_name = StoreTensor(unique_result);
+            std::string inverse_name = StoreTensor(inverse_result);
 
             std::string result = "{unique " + unique_name + " inverse " + inverse_name + "}";
             Tcl_SetResult(interp, const_cast<char*>(result.c_str()), TCL_VOLATILE);
         } else {
             // Use the actual _unique function without return_inverse
-            auto [unique_result, _] = at::_unique(tensor_it->second, args.sorted, false);
+            auto [unique_result, _] = at::_unique(*tensor_entry, args.sorted, false);
             
-            std::string result_name = GetNextHandle("tensor");
-            tensor_storage[result_name] = unique_result;
-            Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+            std::string result_name = StoreTensor(unique_result);
+            Tcl_SetObjResult(interp, NewHandleObj(result_name));
         }
 
         return TCL_OK;
@@ -988,6 +1009,7 @@ int TensorBroadcastShapes_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
 // Parameter structure for squeeze_multiple
 struct SqueezeMultipleArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::vector<long int> dims;  // Empty vector means squeeze all dimensions
     bool has_dims = false;  // Track if dims were provided
     
@@ -1006,6 +1028,7 @@ SqueezeMultipleArgs ParseSqueezeMultipleArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::squeeze_multiple tensor ?dims?");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc > 2) {
             args.dims = GetIntVectorFromObj(interp, objv[2]);
@@ -1022,6 +1045,7 @@ SqueezeMultipleArgs ParseSqueezeMultipleArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dims") {
                 args.dims = GetIntVectorFromObj(interp, objv[i + 1]);
                 args.has_dims = true;
@@ -1050,11 +1074,12 @@ int TensorSqueezeMultiple_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
     try {
         SqueezeMultipleArgs args = ParseSqueezeMultipleArgs(interp, objc, objv);
         // Convert tensor name back to Tcl_Obj for GetTensorFromObj
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto tensor = tensor_storage[args.tensor];
+        auto tensor = *tensor_ptr;
         
         torch::Tensor result;
         if (!args.has_dims) {
@@ -1078,6 +1103,7 @@ int TensorSqueezeMultiple_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
 // Parameter structure for unsqueeze_multiple
 struct UnsqueezeMultipleArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::vector<long int> dims;  // Required list of dimensions to unsqueeze
     
     bool IsValid() const {
@@ -1095,6 +1121,7 @@ UnsqueezeMultipleArgs ParseUnsqueezeMultipleArgs(Tcl_Interp* interp, int objc, T
             throw std::runtime_error("Usage: torch::unsqueeze_multiple tensor dims");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         args.dims = GetIntVectorFromObj(interp, objv[2]);
     } else {
         // Named parameter syntax
@@ -1107,6 +1134,7 @@ UnsqueezeMultipleArgs ParseUnsqueezeMultipleArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dims") {
                 args.dims = GetIntVectorFromObj(interp, objv[i + 1]);
             } else {
@@ -1130,11 +1158,12 @@ int TensorUnsqueezeMultiple_Cmd(ClientData clientData, Tcl_Interp* interp, int o
         UnsqueezeMultipleArgs args = ParseUnsqueezeMultipleArgs(interp, objc, objv);
         
         // Convert tensor name to tensor object
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto tensor = tensor_storage[args.tensor];
+        auto tensor = *tensor_ptr;
         
         torch::Tensor result = tensor;
         // Sort dims in descending order to avoid shifting indices
@@ -1155,6 +1184,7 @@ int TensorUnsqueezeMultiple_Cmd(ClientData clientData, Tcl_Interp* interp, int o
 // Parameter structure for tensor_split command
 struct TensorSplitArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::string sections_or_indices;
     int dim = 0;
     bool has_dim = false;
@@ -1176,6 +1206,7 @@ TensorSplitArgs ParseTensorSplitArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.sections_or_indices = Tcl_GetString(objv[2]);
         
         if (objc == 4) {
@@ -1196,6 +1227,7 @@ TensorSplitArgs ParseTensorSplitArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-sections" || param == "-indices") {
                 args.sections_or_indices = value;
             } else if (param == "-dim" || param == "-dimension") {
@@ -1224,11 +1256,12 @@ int TensorTensorSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
         TensorSplitArgs args = ParseTensorSplitArgs(interp, objc, objv);
         
         // Get tensor from storage
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Create Tcl_Obj for the sections_or_indices argument
         Tcl_Obj* sectionsObj = Tcl_NewStringObj(args.sections_or_indices.c_str(), -1);
@@ -1247,9 +1280,8 @@ int TensorTensorSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
@@ -1261,9 +1293,8 @@ int TensorTensorSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
@@ -1351,9 +1382,8 @@ int TensorHSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
@@ -1365,9 +1395,8 @@ int TensorHSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
@@ -1455,9 +1484,8 @@ int TensorVSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
@@ -1469,9 +1497,8 @@ int TensorVSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
@@ -1559,9 +1586,8 @@ int TensorDSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
@@ -1573,9 +1599,8 @@ int TensorDSplit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             // Return list of tensors
             Tcl_Obj* resultList = Tcl_NewListObj(0, nullptr);
             for (const auto& t : result) {
-                std::string handle = GetNextHandle("tensor");
-                tensor_storage[handle] = t;
-                Tcl_ListObjAppendElement(interp, resultList, Tcl_NewStringObj(handle.c_str(), -1));
+                std::string handle = StoreTensor(t);
+                Tcl_ListObjAppendElement(interp, resultList, NewHandleObj(handle));
             }
             Tcl_SetObjResult(interp, resultList);
             return TCL_OK;
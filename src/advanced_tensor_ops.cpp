@@ -3,6 +3,7 @@
 // Parameter structure for tensor_var command
 struct TensorVarArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified
     bool has_dim = false;
     bool unbiased = true;
@@ -27,6 +28,7 @@ TensorVarArgs ParseTensorVarArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse optional dim or unbiased
         if (objc >= 3) {
@@ -70,6 +72,7 @@ TensorVarArgs ParseTensorVarArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim parameter");
@@ -102,12 +105,13 @@ int TensorVar_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         TensorVarArgs args = ParseTensorVarArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Compute variance
         torch::Tensor result;
@@ -118,10 +122,9 @@ int TensorVar_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -133,6 +136,7 @@ int TensorVar_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for tensor_std command
 struct TensorStdArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified
     bool has_dim = false;
     bool unbiased = true;
@@ -154,6 +158,7 @@ TensorStdArgs ParseTensorStdArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc >= 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -181,6 +186,7 @@ TensorStdArgs ParseTensorStdArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
@@ -213,12 +219,13 @@ int TensorStd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         TensorStdArgs args = ParseTensorStdArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Calculate standard deviation
         torch::Tensor result;
@@ -229,10 +236,9 @@ int TensorStd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -244,6 +250,7 @@ int TensorStd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for tensor_is_cuda command
 struct TensorIsCudaArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     
     bool IsValid() const {
         return !tensor.empty();
@@ -262,6 +269,7 @@ TensorIsCudaArgs ParseTensorIsCudaArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -273,6 +281,7 @@ TensorIsCudaArgs ParseTensorIsCudaArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-tensor" || param == "-input") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -294,12 +303,13 @@ int TensorIsCuda_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         TensorIsCudaArgs args = ParseTensorIsCudaArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         bool is_cuda = tensor.is_cuda();
         
         Tcl_SetResult(interp, is_cuda ? const_cast<char*>("1") : const_cast<char*>("0"), TCL_VOLATILE);
@@ -314,6 +324,7 @@ int TensorIsCuda_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
 // Parameter structure for tensor_is_contiguous command
 struct TensorIsContiguousArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     
     bool IsValid() const {
         return !tensor.empty();
@@ -332,6 +343,7 @@ TensorIsContiguousArgs ParseTensorIsContiguousArgs(Tcl_Interp* interp, int objc,
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -343,6 +355,7 @@ TensorIsContiguousArgs ParseTensorIsContiguousArgs(Tcl_Interp* interp, int objc,
             
             if (param == "-tensor" || param == "-input") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -364,12 +377,13 @@ int TensorIsContiguous_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
         TensorIsContiguousArgs args = ParseTensorIsContiguousArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         bool is_contiguous = tensor.is_contiguous();
         
         Tcl_SetResult(interp, is_contiguous ? const_cast<char*>("1") : const_cast<char*>("0"), TCL_VOLATILE);
@@ -384,6 +398,7 @@ int TensorIsContiguous_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
 // Parameter structure for tensor_contiguous command
 struct TensorContiguousArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -402,6 +417,7 @@ TensorContiguousArgs ParseTensorContiguousArgs(Tcl_Interp* interp, int objc, Tcl
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -413,6 +429,7 @@ TensorContiguousArgs ParseTensorContiguousArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -434,19 +451,19 @@ int TensorContiguous_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
         TensorContiguousArgs args = ParseTensorContiguousArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.contiguous();
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -460,6 +477,9 @@ typedef struct {
     std::string condition;
     std::string x;
     std::string y;
+    Tcl_Obj* conditionObj = nullptr;
+    Tcl_Obj* xObj = nullptr;
+    Tcl_Obj* yObj = nullptr;
     bool IsValid() const {
         return !condition.empty() && !x.empty() && !y.empty();
     }
@@ -475,8 +495,11 @@ static TensorWhereArgs ParseTensorWhereArgs(Tcl_Interp* interp, int objc, Tcl_Ob
             throw std::runtime_error("Usage: torch::tensor_where condition x y");
         }
         args.condition = Tcl_GetString(objv[1]);
+        args.conditionObj = objv[1];
         args.x = Tcl_GetString(objv[2]);
+        args.xObj = objv[2];
         args.y = Tcl_GetString(objv[3]);
+        args.yObj = objv[3];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -486,10 +509,13 @@ static TensorWhereArgs ParseTensorWhereArgs(Tcl_Interp* interp, int objc, Tcl_Ob
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-condition") {
                 args.condition = Tcl_GetString(objv[i + 1]);
+                args.conditionObj = objv[i + 1];
             } else if (param == "-x") {
                 args.x = Tcl_GetString(objv[i + 1]);
+                args.xObj = objv[i + 1];
             } else if (param == "-y") {
                 args.y = Tcl_GetString(objv[i + 1]);
+                args.yObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -507,26 +533,28 @@ int TensorWhere_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj
     try {
         TensorWhereArgs args = ParseTensorWhereArgs(interp, objc, objv);
         // Check if tensors exist
-        if (tensor_storage.find(args.condition) == tensor_storage.end()) {
+        torch::Tensor* condition_tensor = FindTensorFromObj(args.conditionObj);
+        if (condition_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid condition tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.x) == tensor_storage.end()) {
+        torch::Tensor* x_tensor = FindTensorFromObj(args.xObj);
+        if (x_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid x tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.y) == tensor_storage.end()) {
+        torch::Tensor* y_tensor = FindTensorFromObj(args.yObj);
+        if (y_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid y tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& condition = tensor_storage[args.condition];
-        auto& x = tensor_storage[args.x];
-        auto& y = tensor_storage[args.y];
+        auto& condition = *condition_tensor;
+        auto& x = *x_tensor;
+        auto& y = *y_tensor;
         torch::Tensor result = torch::where(condition, x, y);
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -537,6 +565,7 @@ int TensorWhere_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj
 // Parameter structure for tensor_expand command
 struct TensorExpandArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> sizes;
     
     bool IsValid() const {
@@ -556,6 +585,7 @@ TensorExpandArgs ParseTensorExpandArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.sizes = TclListToShape(interp, objv[2]);
     } else {
         // Named parameter syntax
@@ -568,6 +598,7 @@ TensorExpandArgs ParseTensorExpandArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-sizes" || param == "-shape") {
                 args.sizes = TclListToShape(interp, objv[i + 1]);
             } else {
@@ -591,20 +622,20 @@ int TensorExpand_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         TensorExpandArgs args = ParseTensorExpandArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         torch::Tensor result = tensor.expand(args.sizes);
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -616,6 +647,7 @@ int TensorExpand_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
 // Parameter structure for tensor_repeat command
 struct TensorRepeatArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> repeats;
     
     bool IsValid() const {
@@ -635,6 +667,7 @@ TensorRepeatArgs ParseTensorRepeatArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.repeats = TclListToShape(interp, objv[2]);
     } else {
         // Named parameter syntax
@@ -648,6 +681,7 @@ TensorRepeatArgs ParseTensorRepeatArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-repeats") {
                 args.repeats = TclListToShape(interp, objv[i + 1]);
             } else {
@@ -671,20 +705,20 @@ int TensorRepeat_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         TensorRepeatArgs args = ParseTensorRepeatArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         torch::Tensor result = tensor.repeat(args.repeats);
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -697,6 +731,8 @@ struct TensorIndexSelectArgs {
     std::string input;
     int dim;
     std::string indices;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* indicesObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !indices.empty();
@@ -714,10 +750,12 @@ TensorIndexSelectArgs ParseTensorIndexSelectArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dimension value");
         }
         args.indices = Tcl_GetString(objv[3]);
+        args.indicesObj = objv[3];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -730,12 +768,14 @@ TensorIndexSelectArgs ParseTensorIndexSelectArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
                 }
             } else if (param == "-indices") {
                 args.indices = value;
+                args.indicesObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -757,25 +797,26 @@ int TensorIndexSelect_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
         TensorIndexSelectArgs args = ParseTensorIndexSelectArgs(interp, objc, objv);
         
         // Check if tensors exist
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.indices) == tensor_storage.end()) {
+        torch::Tensor* indices_tensor = FindTensorFromObj(args.indicesObj);
+        if (indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid indices tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
-        auto& indices = tensor_storage[args.indices];
+        auto& tensor = *input;
+        auto& indices = *indices_tensor;
         
         torch::Tensor result = torch::index_select(tensor, args.dim, indices);
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -787,6 +828,7 @@ int TensorIndexSelect_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
 // Parameter structure for tensor_median command
 struct TensorMedianArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified
     bool has_dim = false;
     
@@ -807,6 +849,7 @@ TensorMedianArgs ParseTensorMedianArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -826,6 +869,7 @@ TensorMedianArgs ParseTensorMedianArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
@@ -852,12 +896,13 @@ int TensorMedian_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         TensorMedianArgs args = ParseTensorMedianArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         torch::Tensor result;
         if (args.has_dim) {
@@ -870,10 +915,9 @@ int TensorMedian_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         }
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -885,6 +929,7 @@ int TensorMedian_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
 // Parameter structure for tensor_quantile command
 struct TensorQuantileArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double q;
     int dim = -1;  // -1 means no dimension specified
     bool has_dim = false;
@@ -906,6 +951,7 @@ TensorQuantileArgs ParseTensorQuantileArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.q) != TCL_OK) {
             throw std::runtime_error("Invalid quantile value");
@@ -929,6 +975,7 @@ TensorQuantileArgs ParseTensorQuantileArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-q" || param == "-quantile") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.q) != TCL_OK) {
                     throw std::runtime_error("Invalid quantile value");
@@ -959,12 +1006,13 @@ int TensorQuantile_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_
         TensorQuantileArgs args = ParseTensorQuantileArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         torch::Tensor result;
         if (args.has_dim) {
@@ -976,10 +1024,9 @@ int TensorQuantile_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_
         }
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -991,6 +1038,7 @@ int TensorQuantile_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_
 // Parameter structure for tensor_mode command
 struct TensorModeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified
     bool has_dim = false;
     
@@ -1011,6 +1059,7 @@ TensorModeArgs ParseTensorModeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -1030,6 +1079,7 @@ TensorModeArgs ParseTensorModeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
@@ -1056,12 +1106,13 @@ int TensorMode_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         TensorModeArgs args = ParseTensorModeArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         torch::Tensor result;
         if (args.has_dim) {
@@ -1076,10 +1127,9 @@ int TensorMode_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -4,9 +4,9 @@
 #include <ATen/autocast_mode.h>
 
 // Forward declarations of global variables
-extern std::unordered_map<std::string, torch::Tensor> tensor_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::nn::Module>> module_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
+extern thread_local HandleTable<torch::Tensor> tensor_storage;
+extern thread_local std::unordered_map<std::string, ModuleRef> module_storage;
+extern thread_local std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
 
 
 // LibTorch-native gradient scaler implementation
@@ -30,6 +30,14 @@ struct NativeGradScaler {
     }
     
     void step_optimizer(torch::optim::Optimizer& optimizer) {
+        // Only step if no infinities found
+        if (unscale(optimizer)) {
+            optimizer.step();
+        }
+    }
+    
+    // Unscale gradients in place; false if any of them is inf or NaN
+    bool unscale(torch::optim::Optimizer& optimizer) {
         // Check for infinite gradients
         found_inf.zero_();
         std::vector<torch::Tensor> grads;
@@ -47,10 +55,7 @@ struct NativeGradScaler {
             at::_amp_foreach_non_finite_check_and_unscale_(grads, found_inf, inv_scale);
         }
         
-        // Only step if no infinities found
-        if (found_inf.item<float>() == 0.0f) {
-            optimizer.step();
-        }
+        return found_inf.item<float>() == 0.0f;
     }
     
     void update() {
@@ -67,8 +72,35 @@ struct NativeGradScaler {
 };
 
 // Storage for gradient scalers
-std::unordered_map<std::string, NativeGradScaler> g_grad_scalers;
-int g_scaler_counter = 0;
+thread_local std::unordered_map<std::string, NativeGradScaler> g_grad_scalers;
+thread_local int g_scaler_counter = 0;
+
+// Scaled backward and step for torch::train_step: gradients are unscaled
+// before clipping, the step is skipped if any is not finite, and the scale
+// is updated. Returns whether the optimizer stepped.
+bool GradScalerTrainStep(const std::string& scaler_name, const torch::Tensor& loss,
+                         torch::optim::Optimizer& optimizer, double max_norm) {
+    auto it = g_grad_scalers.find(scaler_name);
+    if (it == g_grad_scalers.end()) {
+        throw std::runtime_error("Gradient scaler not found");
+    }
+    NativeGradScaler& scaler = it->second;
+
+    scaler.scale_tensor(loss).backward();
+    bool finite = scaler.unscale(optimizer);
+    if (finite) {
+        if (max_norm > 0.0) {
+            std::vector<torch::Tensor> params;
+            for (auto& group : optimizer.param_groups()) {
+                params.insert(params.end(), group.params().begin(), group.params().end());
+            }
+            torch::nn::utils::clip_grad_norm_(params, max_norm);
+        }
+        optimizer.step();
+    }
+    scaler.update();
+    return finite;
+}
 
 // Note: Autocast state is now managed by LibTorch's native autocast system
 
@@ -520,6 +552,7 @@ int Torch_GradScalerNew_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
 struct GradScalerScaleArgs {
     std::string scaler;  // gradient scaler handle
     std::string tensor;  // tensor handle
+    Tcl_Obj* tensorObj = nullptr;
     
     bool IsValid() const {
         return !scaler.empty() && !tensor.empty();
@@ -537,6 +570,7 @@ GradScalerScaleArgs ParseGradScalerScaleArgs(Tcl_Interp* interp, int objc, Tcl_O
         
         args.scaler = Tcl_GetString(objv[1]);
         args.tensor = Tcl_GetString(objv[2]);
+        args.tensorObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -550,6 +584,7 @@ GradScalerScaleArgs ParseGradScalerScaleArgs(Tcl_Interp* interp, int objc, Tcl_O
                 args.scaler = Tcl_GetString(objv[i + 1]);
             } else if (param == "-tensor" || param == "-input") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -577,18 +612,17 @@ int Torch_GradScalerScale_Cmd(ClientData clientData, Tcl_Interp *interp, int obj
             return TCL_ERROR;
         }
 
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
-        auto scaled_tensor = scaler_it->second.scale_tensor(tensor_it->second);
+        auto scaled_tensor = scaler_it->second.scale_tensor(*tensor_entry);
         
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = scaled_tensor;
+        std::string result_name = StoreTensor(scaled_tensor);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -601,6 +635,7 @@ int Torch_GradScalerScale_Cmd(ClientData clientData, Tcl_Interp *interp, int obj
 struct GradScalerStepArgs {
     std::string scaler;     // gradient scaler handle
     std::string optimizer;  // optimizer handle
+    Tcl_Obj* optimizerObj = nullptr;
     
     bool IsValid() const {
         return !scaler.empty() && !optimizer.empty();
@@ -618,6 +653,7 @@ GradScalerStepArgs ParseGradScalerStepArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         
         args.scaler = Tcl_GetString(objv[1]);
         args.optimizer = Tcl_GetString(objv[2]);
+        args.optimizerObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -631,6 +667,7 @@ GradScalerStepArgs ParseGradScalerStepArgs(Tcl_Interp* interp, int objc, Tcl_Obj
                 args.scaler = Tcl_GetString(objv[i + 1]);
             } else if (param == "-optimizer" || param == "-optim") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -658,13 +695,13 @@ int Torch_GradScalerStep_Cmd(ClientData clientData, Tcl_Interp *interp, int objc
             return TCL_ERROR;
         }
 
-        auto optimizer_it = optimizer_storage.find(args.optimizer);
-        if (optimizer_it == optimizer_storage.end()) {
+        std::shared_ptr<torch::optim::Optimizer>* optimizer_entry = FindOptimizerFromObj(args.optimizerObj);
+        if (optimizer_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Optimizer not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
-        scaler_it->second.step_optimizer(*optimizer_it->second);
+        scaler_it->second.step_optimizer(**optimizer_entry);
 
         Tcl_SetResult(interp, const_cast<char*>("scaler step completed"), TCL_STATIC);
         return TCL_OK;
@@ -826,6 +863,8 @@ int Torch_GradScalerGetScale_Cmd(ClientData clientData, Tcl_Interp *interp, int
 struct TensorMaskedFillArgs {
     std::string tensor;
     std::string mask;
+    Tcl_Obj* tensorObj = nullptr;
+    Tcl_Obj* maskObj = nullptr;
     double value;
     
     bool IsValid() const {
@@ -847,7 +886,9 @@ TensorMaskedFillArgs ParseTensorMaskedFillArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::tensor_masked_fill tensor mask value");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         args.mask = Tcl_GetString(objv[2]);
+        args.maskObj = objv[2];
         
         if (Tcl_GetDoubleFromObj(interp, objv[3], &args.value) != TCL_OK) {
             throw std::runtime_error("Invalid value parameter");
@@ -863,8 +904,10 @@ TensorMaskedFillArgs ParseTensorMaskedFillArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-mask") {
                 args.mask = Tcl_GetString(objv[i + 1]);
+                args.maskObj = objv[i + 1];
             } else if (param == "-value") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.value) != TCL_OK) {
                     throw std::runtime_error("Invalid value parameter");
@@ -889,20 +932,19 @@ int Torch_TensorMaskedFill_Cmd(ClientData clientData, Tcl_Interp *interp, int ob
         // Parse arguments using dual syntax parser
         TensorMaskedFillArgs args = ParseTensorMaskedFillArgs(interp, objc, objv);
 
-        auto tensor_it = tensor_storage.find(args.tensor);
-        auto mask_it = tensor_storage.find(args.mask);
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        torch::Tensor* mask_entry = FindTensorFromObj(args.maskObj);
         
-        if (tensor_it == tensor_storage.end() || mask_it == tensor_storage.end()) {
+        if (tensor_entry == nullptr || mask_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
-        auto result = tensor_it->second.masked_fill(mask_it->second, args.value);
+        auto result = tensor_entry->masked_fill(*mask_entry, args.value);
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -914,6 +956,7 @@ int Torch_TensorMaskedFill_Cmd(ClientData clientData, Tcl_Interp *interp, int ob
 // Parameter structure for tensor_clamp command
 struct TensorClampArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::optional<double> min_val;
     std::optional<double> max_val;
     
@@ -936,6 +979,7 @@ TensorClampArgs ParseTensorClampArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::tensor_clamp tensor ?min? ?max?");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             double min_val;
@@ -963,6 +1007,7 @@ TensorClampArgs ParseTensorClampArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-min") {
                 double min_val;
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &min_val) != TCL_OK) {
@@ -994,8 +1039,8 @@ int Torch_TensorClamp_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, T
     try {
         TensorClampArgs args = ParseTensorClampArgs(interp, objc, objv);
         
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -1004,22 +1049,21 @@ int Torch_TensorClamp_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, T
         
         if (!args.min_val.has_value() && !args.max_val.has_value()) {
             // No clamping bounds specified
-            result = tensor_it->second.clone();
+            result = tensor_entry->clone();
         } else if (args.min_val.has_value() && !args.max_val.has_value()) {
             // Only min specified
-            result = torch::clamp_min(tensor_it->second, args.min_val.value());
+            result = torch::clamp_min(*tensor_entry, args.min_val.value());
         } else if (!args.min_val.has_value() && args.max_val.has_value()) {
             // Only max specified
-            result = torch::clamp_max(tensor_it->second, args.max_val.value());
+            result = torch::clamp_max(*tensor_entry, args.max_val.value());
         } else {
             // Both min and max specified
-            result = torch::clamp(tensor_it->second, args.min_val.value(), args.max_val.value());
+            result = torch::clamp(*tensor_entry, args.min_val.value(), args.max_val.value());
         }
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -0,0 +1,455 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// A torch::async future. The work runs on a pool thread and completion is
+// delivered to the thread that owns the interpreter as a Tcl event, so
+// results are stored as handles, and callbacks run, on that thread only.
+// Tcl objects are released explicitly on the owning thread; the destructor
+// may run on a worker and must not touch them.
+struct AsyncFuture {
+    enum class State { Pending, Done, Failed };
+
+    AsyncWork work;
+    bool gradEnabled = true;        // grad mode of the submitting thread
+
+    // Written by the worker before the completion event is queued
+    std::vector<torch::Tensor> outputs;
+    std::string error;
+
+    // Owning thread only
+    State state = State::Pending;
+    Tcl_Interp* interp = nullptr;
+    Tcl_ThreadId owner = nullptr;
+    std::string handle;
+    Tcl_Obj* result = nullptr;      // handle or list of handles once done
+    Tcl_Obj* callback = nullptr;
+    Tcl_Obj* variable = nullptr;
+    bool released = false;
+};
+
+thread_local std::unordered_map<std::string, std::shared_ptr<AsyncFuture>> async_future_storage;
+
+bool AsyncFutureHandleExists(const std::string& handle) {
+    return async_future_storage.find(handle) != async_future_storage.end();
+}
+
+// A pending future can be released; its results are dropped on completion
+bool ReleaseAsyncFutureHandle(const std::string& handle) {
+    auto it = async_future_storage.find(handle);
+    if (it == async_future_storage.end()) {
+        return false;
+    }
+    AsyncFuture& future = *it->second;
+    future.released = true;
+    if (future.result != nullptr) {
+        Tcl_DecrRefCount(future.result);
+        future.result = nullptr;
+    }
+    async_future_storage.erase(it);
+    return true;
+}
+
+size_t AsyncFutureHandleCount() {
+    return async_future_storage.size();
+}
+
+// ============================================================================
+// Completion
+// ============================================================================
+
+struct AsyncEvent {
+    Tcl_Event header;               // must be first
+    std::shared_ptr<AsyncFuture>* future;
+};
+
+// Runs on the owning thread: store the outputs, then set the -variable and
+// run the -callback. The event loop may be serviced inside a torch::scope;
+// the result handles belong to the future, not to that scope.
+static void CompleteAsyncFuture(AsyncFuture& future) {
+    HandleScopeSuspension no_scope;
+    if (!future.error.empty()) {
+        future.state = AsyncFuture::State::Failed;
+    } else if (future.released) {
+        future.state = AsyncFuture::State::Failed;
+        future.error = "Future was released before it completed";
+    } else {
+        auto store = [](const torch::Tensor& tensor) {
+            std::string handle = StoreTensor(tensor);
+            return NewHandleObj(handle);
+        };
+        if (future.work.listResult || future.outputs.size() != 1) {
+            future.result = Tcl_NewListObj(0, nullptr);
+            for (const auto& output : future.outputs) {
+                Tcl_ListObjAppendElement(nullptr, future.result, store(output));
+            }
+        } else {
+            future.result = store(future.outputs[0]);
+        }
+        Tcl_IncrRefCount(future.result);
+        future.state = AsyncFuture::State::Done;
+    }
+    future.outputs.clear();
+
+    // Nobody is listening for a released future
+    Tcl_Interp* interp = future.interp;
+    if (!future.released && !Tcl_InterpDeleted(interp)) {
+        if (future.variable != nullptr) {
+            const char* status = future.state == AsyncFuture::State::Done ? "done" : "error";
+            if (Tcl_ObjSetVar2(interp, future.variable, nullptr, Tcl_NewStringObj(status, -1),
+                               TCL_GLOBAL_ONLY | TCL_LEAVE_ERR_MSG) == nullptr) {
+                Tcl_BackgroundException(interp, TCL_ERROR);
+            }
+        }
+        if (future.callback != nullptr) {
+            Tcl_Obj* script = Tcl_DuplicateObj(future.callback);
+            Tcl_IncrRefCount(script);
+            Tcl_ListObjAppendElement(nullptr, script, Tcl_NewStringObj(future.handle.c_str(), -1));
+            int code = Tcl_EvalObjEx(interp, script, TCL_EVAL_GLOBAL);
+            if (code != TCL_OK) {
+                Tcl_BackgroundException(interp, code);
+            }
+            Tcl_DecrRefCount(script);
+        }
+    }
+    if (future.variable != nullptr) {
+        Tcl_DecrRefCount(future.variable);
+        future.variable = nullptr;
+    }
+    if (future.callback != nullptr) {
+        Tcl_DecrRefCount(future.callback);
+        future.callback = nullptr;
+    }
+    Tcl_Release(interp);
+}
+
+static int AsyncEventProc(Tcl_Event* event, int flags) {
+    if (!(flags & TCL_FILE_EVENTS)) {
+        return 0;
+    }
+    std::unique_ptr<std::shared_ptr<AsyncFuture>> future(reinterpret_cast<AsyncEvent*>(event)->future);
+    CompleteAsyncFuture(**future);
+    return 1;
+}
+
+// Hand a finished future to its owning thread. Callable from any thread;
+// an empty error means success.
+void DeliverAsyncFuture(std::shared_ptr<AsyncFuture> future, std::vector<torch::Tensor> outputs,
+                        const std::string& error) {
+    future->outputs = std::move(outputs);
+    future->error = error;
+    Tcl_ThreadId owner = future->owner;
+    auto* event = static_cast<AsyncEvent*>(static_cast<void*>(Tcl_Alloc(sizeof(AsyncEvent))));
+    event->header.proc = AsyncEventProc;
+    event->future = new std::shared_ptr<AsyncFuture>(std::move(future));
+    Tcl_ThreadQueueEvent(owner, &event->header, TCL_QUEUE_TAIL);
+    Tcl_ThreadAlert(owner);
+}
+
+// Create and store a pending future owned by the current thread; its handle
+// is returned in handle
+std::shared_ptr<AsyncFuture> NewAsyncFuture(Tcl_Interp* interp, Tcl_Obj* callback, Tcl_Obj* variable,
+                                            std::string& handle) {
+    auto future = std::make_shared<AsyncFuture>();
+    future->interp = interp;
+    future->owner = Tcl_GetCurrentThread();
+    future->handle = GetNextHandle("future");
+    if (callback != nullptr) {
+        future->callback = callback;
+        Tcl_IncrRefCount(future->callback);
+    }
+    if (variable != nullptr) {
+        future->variable = variable;
+        Tcl_IncrRefCount(future->variable);
+    }
+    Tcl_Preserve(interp);
+    async_future_storage[future->handle] = future;
+    handle = future->handle;
+    return future;
+}
+
+// ============================================================================
+// Worker pool
+// ============================================================================
+
+class AsyncWorkerPool {
+public:
+    ~AsyncWorkerPool() {
+        Stop();
+    }
+
+    void Submit(std::shared_ptr<AsyncFuture> future) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (workers_.empty()) {
+            unsigned count = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+            for (unsigned i = 0; i < count; i++) {
+                workers_.emplace_back([this] { Work(); });
+            }
+        }
+        queue_.push_back(std::move(future));
+        ready_.notify_one();
+    }
+
+    // Queued work is rejected and running work finishes. Either way the
+    // future is delivered, so its owner fails or completes it and releases
+    // the interpreter preserved for it.
+    void Stop() {
+        std::deque<std::shared_ptr<AsyncFuture>> rejected;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            rejected.swap(queue_);
+        }
+        ready_.notify_all();
+        for (auto& future : rejected) {
+            DeliverAsyncFuture(std::move(future), {}, "Async workers stopped before the command ran");
+        }
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+    }
+
+private:
+    void Work() {
+        for (;;) {
+            std::shared_ptr<AsyncFuture> future;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (stopping_) {
+                    return;
+                }
+                future = std::move(queue_.front());
+                queue_.pop_front();
+            }
+
+            std::vector<torch::Tensor> outputs;
+            std::string error;
+            try {
+                // Grad mode is thread local; run under the submitter's
+                torch::AutoGradMode grad_mode(future->gradEnabled);
+                outputs = future->work.run();
+            } catch (const c10::Error& e) {
+                error = e.what_without_backtrace();
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+            // Drop captured tensors and modules here rather than on completion
+            future->work.run = nullptr;
+            DeliverAsyncFuture(std::move(future), std::move(outputs), error);
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::shared_ptr<AsyncFuture>> queue_;
+    std::vector<std::thread> workers_;
+    bool stopping_ = false;
+};
+
+static AsyncWorkerPool& AsyncWorkers() {
+    static AsyncWorkerPool pool;
+    return pool;
+}
+
+// Workers must be gone before Tcl finalizes its notifier
+static void StopAsyncWorkers(ClientData clientData) {
+    (void)clientData;
+    AsyncWorkers().Stop();
+}
+
+// Commands torch::async can run, under every name they are registered with
+static const std::unordered_map<std::string, AsyncWork (*)(Tcl_Interp*, int, Tcl_Obj* const[])>& AsyncCommandTable() {
+    static const std::unordered_map<std::string, AsyncWork (*)(Tcl_Interp*, int, Tcl_Obj* const[])> table = {
+        {"torch::exec", PrepareExec},
+        {"torch::layer_forward", PrepareLayerForward},
+        {"torch::layerForward", PrepareLayerForward},
+        {"torch::tensor_matmul", PrepareTensorMatmul},
+        {"torch::tensorMatmul", PrepareTensorMatmul},
+    };
+    return table;
+}
+
+// ============================================================================
+// torch::async
+// ============================================================================
+
+// Parameter structure for async command
+struct AsyncArgs {
+    Tcl_Obj* command = nullptr;
+    Tcl_Obj* callback = nullptr;
+    Tcl_Obj* variable = nullptr;
+
+    bool IsValid() const {
+        return command != nullptr;
+    }
+};
+
+// Parse dual syntax: command ?callback? |
+// -command list ?-callback script? ?-variable name?
+static AsyncArgs ParseAsyncArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    AsyncArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 3) {
+            throw std::runtime_error("Usage: torch::async command ?callback?");
+        }
+        args.command = objv[1];
+        if (objc > 2) {
+            args.callback = objv[2];
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-command") {
+                args.command = objv[i + 1];
+            } else if (param == "-callback") {
+                args.callback = objv[i + 1];
+            } else if (param == "-variable") {
+                args.variable = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -command, -callback, -variable");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: command");
+    }
+
+    return args;
+}
+
+// torch::async - Run a command on a worker thread and return a future handle
+// right away. Arguments are checked and handles resolved before returning;
+// only the computation itself is deferred.
+int Async_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        AsyncArgs args = ParseAsyncArgs(interp, objc, objv);
+
+        int count;
+        Tcl_Obj** words;
+        if (Tcl_ListObjGetElements(interp, args.command, &count, &words) != TCL_OK || count == 0) {
+            throw std::runtime_error("command must be a non-empty list");
+        }
+        std::string name = Tcl_GetString(words[0]);
+        if (name.compare(0, 2, "::") == 0) {
+            name.erase(0, 2);
+        }
+        auto prepare = AsyncCommandTable().find(name);
+        if (prepare == AsyncCommandTable().end()) {
+            throw std::runtime_error("torch::async cannot run " + name +
+                                     "; supported commands are torch::exec, torch::layer_forward and torch::tensor_matmul");
+        }
+
+        // Prepare first, so argument errors leave no future behind
+        AsyncWork work = prepare->second(interp, count, words);
+
+        // The pool is shared by every interpreter thread
+        static std::once_flag exit_handler;
+        std::call_once(exit_handler, [] { Tcl_CreateExitHandler(StopAsyncWorkers, nullptr); });
+
+        std::string handle;
+        auto future = NewAsyncFuture(interp, args.callback, args.variable, handle);
+        future->work = std::move(work);
+        future->gradEnabled = torch::GradMode::is_enabled();
+        AsyncWorkers().Submit(future);
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::async_wait
+// ============================================================================
+
+// Parameter structure for async_wait command
+struct AsyncWaitArgs {
+    std::string future;
+
+    bool IsValid() const {
+        return !future.empty();
+    }
+};
+
+// Parse dual syntax: future | -future handle
+static AsyncWaitArgs ParseAsyncWaitArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    AsyncWaitArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error("Usage: torch::async_wait future");
+        }
+        args.future = Tcl_GetString(objv[1]);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-future") {
+                args.future = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -future");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: future");
+    }
+
+    return args;
+}
+
+// torch::async_wait - Return the result of a future, servicing events (like
+// vwait) until it completes. A failed command raises its error here.
+int AsyncWait_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        AsyncWaitArgs args = ParseAsyncWaitArgs(interp, objc, objv);
+
+        auto it = async_future_storage.find(args.future);
+        if (it == async_future_storage.end()) {
+            throw std::runtime_error("Invalid future: " + args.future);
+        }
+        std::shared_ptr<AsyncFuture> future = it->second;
+        while (future->state == AsyncFuture::State::Pending) {
+            Tcl_DoOneEvent(TCL_ALL_EVENTS);
+        }
+
+        if (future->state == AsyncFuture::State::Failed) {
+            throw std::runtime_error(future->error);
+        }
+        if (future->result == nullptr) {
+            throw std::runtime_error("Future was released before its result was read");
+        }
+        Tcl_SetObjResult(interp, future->result);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -496,6 +496,7 @@ int TensorVMap_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 struct GradCheckArgs {
     std::string func;    // function handle or name
     std::string inputs;  // tensor handle for inputs
+    Tcl_Obj* inputsObj = nullptr;
     
     bool IsValid() const {
         return !func.empty() && !inputs.empty();
@@ -513,6 +514,7 @@ GradCheckArgs ParseGradCheckArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         
         args.func = Tcl_GetString(objv[1]);
         args.inputs = Tcl_GetString(objv[2]);
+        args.inputsObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -527,6 +529,7 @@ GradCheckArgs ParseGradCheckArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
                 args.func = value;
             } else if (param == "-inputs" || param == "-input") {
                 args.inputs = value;
+                args.inputsObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -549,7 +552,7 @@ int TensorGradCheck_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         GradCheckArgs args = ParseGradCheckArgs(interp, objc, objv);
         
         // Validate inputs tensor exists
-        if (tensor_storage.find(args.inputs) == tensor_storage.end()) {
+        if (FindTensorFromObj(args.inputsObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle for inputs"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -574,6 +577,7 @@ int TensorGradCheck_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 struct GradCheckFiniteDiffArgs {
     std::string func;     // function handle or name
     std::string inputs;   // tensor handle for inputs
+    Tcl_Obj* inputsObj = nullptr;
     double eps = 1e-5;    // epsilon for finite differences (default: 1e-5)
     
     bool IsValid() const {
@@ -592,6 +596,7 @@ GradCheckFiniteDiffArgs ParseGradCheckFiniteDiffArgs(Tcl_Interp* interp, int obj
         
         args.func = Tcl_GetString(objv[1]);
         args.inputs = Tcl_GetString(objv[2]);
+        args.inputsObj = objv[2];
         
         if (objc > 3) {
             if (Tcl_GetDoubleFromObj(interp, objv[3], &args.eps) != TCL_OK) {
@@ -612,6 +617,7 @@ GradCheckFiniteDiffArgs ParseGradCheckFiniteDiffArgs(Tcl_Interp* interp, int obj
                 args.func = value;
             } else if (param == "-inputs" || param == "-input") {
                 args.inputs = value;
+                args.inputsObj = objv[i + 1];
             } else if (param == "-eps" || param == "-epsilon") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.eps) != TCL_OK) {
                     throw std::runtime_error("Invalid eps value");
@@ -638,7 +644,7 @@ int TensorGradCheckFiniteDiff_Cmd(ClientData clientData, Tcl_Interp* interp, int
         GradCheckFiniteDiffArgs args = ParseGradCheckFiniteDiffArgs(interp, objc, objv);
         
         // Validate inputs tensor exists
-        if (tensor_storage.find(args.inputs) == tensor_storage.end()) {
+        if (FindTensorFromObj(args.inputsObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle for inputs"), TCL_VOLATILE);
             return TCL_ERROR;
         }
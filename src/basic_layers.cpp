@@ -98,34 +98,18 @@ public:
     torch::Tensor forward(const torch::Tensor& x) {
         torch::Tensor current = x;
         for (auto& module : modules_) {
-            if (auto concrete_linear = std::dynamic_pointer_cast<ConcreteLinear>(module)) {
-                current = concrete_linear->forward(current);
-            } else if (auto concrete_conv2d = std::dynamic_pointer_cast<ConcreteConv2d>(module)) {
-                current = concrete_conv2d->forward(current);
-            } else if (auto concrete_maxpool = std::dynamic_pointer_cast<ConcreteMaxPool2d>(module)) {
-                current = concrete_maxpool->forward(current);
-            } else if (auto concrete_dropout = std::dynamic_pointer_cast<ConcreteDropout>(module)) {
-                current = concrete_dropout->forward(current);
-            } else if (auto concrete_batchnorm = std::dynamic_pointer_cast<ConcreteBatchNorm2d>(module)) {
-                current = concrete_batchnorm->forward(current);
-            } else if (auto concrete_avgpool = std::dynamic_pointer_cast<ConcreteAvgPool2d>(module)) {
-                current = concrete_avgpool->forward(current);
-            } else if (auto concrete_maxpool1d = std::dynamic_pointer_cast<ConcreteMaxPool1d>(module)) {
-                current = concrete_maxpool1d->forward(current);
-            } else if (auto concrete_maxpool3d = std::dynamic_pointer_cast<ConcreteCustomMaxPool3d>(module)) {
-                current = concrete_maxpool3d->forward(current);
-            }
+            current = ModuleForward(module, current);
         }
         return current;
     }
     
-    void push_back(std::shared_ptr<torch::nn::Module> module) {
+    void push_back(ModuleRef module) {
         register_module(std::to_string(modules_.size()), module);
-        modules_.push_back(module);
+        modules_.push_back(std::move(module));
     }
     
 private:
-    std::vector<std::shared_ptr<torch::nn::Module>> modules_;
+    std::vector<ModuleRef> modules_;
 };
 
 // Parameter structure for linear command
@@ -213,7 +197,7 @@ int Linear_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
         
         std::string handle = StoreModule("linear", linear);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -339,7 +323,7 @@ int Conv2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
         
         std::string handle = StoreModule("conv2d", conv2d);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -423,7 +407,7 @@ int MaxPool2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         );
 
         std::string handle = StoreModule("maxpool2d", maxpool);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -510,7 +494,7 @@ int Dropout_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         );
         std::string handle = StoreModule("dropout", dropout);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -606,7 +590,7 @@ int BatchNorm2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj
                 .track_running_stats(args.trackRunningStats)
         );
         std::string handle = StoreModule("batchnorm2d", batchnorm);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -714,7 +698,7 @@ int AvgPool2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 
         std::string handle = StoreModule("avgpool2d", avgpool);
 
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -725,6 +709,7 @@ int AvgPool2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for sequential command
 struct SequentialArgs {
     std::vector<std::string> modules;  // List of module handles
+    std::vector<Tcl_Obj*> moduleObjs;
     
     bool IsValid() const {
         return true;  // Empty sequential is valid
@@ -751,6 +736,7 @@ SequentialArgs ParseSequentialArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
                 Tcl_Obj* module_obj;
                 Tcl_ListObjIndex(interp, objv[1], i, &module_obj);
                 args.modules.push_back(Tcl_GetString(module_obj));
+                args.moduleObjs.push_back(module_obj);
             }
         }
     } else {
@@ -772,6 +758,7 @@ SequentialArgs ParseSequentialArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
                     Tcl_Obj* module_obj;
                     Tcl_ListObjIndex(interp, objv[i + 1], j, &module_obj);
                     args.modules.push_back(Tcl_GetString(module_obj));
+                    args.moduleObjs.push_back(module_obj);
                 }
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
@@ -790,15 +777,16 @@ int Sequential_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         auto sequential = std::make_shared<ConcreteSequential>();
         
         // Add modules to sequential if provided
-        for (const auto& module_name : args.modules) {
-            if (module_storage.find(module_name) == module_storage.end()) {
-                throw std::runtime_error("Invalid module name: " + module_name);
+        for (Tcl_Obj* module_obj : args.moduleObjs) {
+            ModuleRef* module = FindModuleFromObj(module_obj);
+            if (module == nullptr) {
+                throw std::runtime_error("Invalid module name: " + std::string(Tcl_GetString(module_obj)));
             }
-            sequential->push_back(module_storage[module_name]);
+            sequential->push_back(*module);
         }
         
         std::string handle = StoreModule("sequential", sequential);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -806,10 +794,21 @@ int Sequential_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     }
 }
 
+// Forward pass through any stored module; shared with sequential containers,
+// tracing and the fused training commands
+torch::Tensor ModuleForward(const ModuleRef& module, const torch::Tensor& input) {
+    if (!module.forward) {
+        throw std::runtime_error("Unsupported module type for forward pass");
+    }
+    return module.forward(input);
+}
+
 // Parameter structure for layer_forward command
 struct LayerForwardArgs {
     std::string layer;
     std::string input;
+    Tcl_Obj* layerObj = nullptr;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !layer.empty() && !input.empty();
@@ -828,6 +827,8 @@ LayerForwardArgs ParseLayerForwardArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         
         args.layer = Tcl_GetString(objv[1]);
         args.input = Tcl_GetString(objv[2]);
+        args.layerObj = objv[1];
+        args.inputObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -840,8 +841,10 @@ LayerForwardArgs ParseLayerForwardArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-layer") {
                 args.layer = value;
+                args.layerObj = objv[i + 1];
             } else if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -855,6 +858,30 @@ LayerForwardArgs ParseLayerForwardArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
     return args;
 }
 
+// Resolve the layer and input tensor of layer_forward; the forward pass is
+// computed by run, either right away or on a torch::async worker
+AsyncWork PrepareLayerForward(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    LayerForwardArgs args = ParseLayerForwardArgs(interp, objc, objv);
+
+    ModuleRef* layer = FindModuleFromObj(args.layerObj);
+    if (layer == nullptr) {
+        throw std::runtime_error("Invalid layer name");
+    }
+    if (FindPackedSequence(args.input) != nullptr) {
+        throw std::runtime_error("Packed sequences cannot be forwarded asynchronously");
+    }
+    torch::Tensor* inputTensor = FindTensorFromObj(args.inputObj);
+    if (inputTensor == nullptr) {
+        throw std::runtime_error("Invalid input tensor name");
+    }
+
+    AsyncWork work;
+    work.run = [module = *layer, input = *inputTensor]() {
+        return std::vector<torch::Tensor>{ModuleForward(module, input)};
+    };
+    return work;
+}
+
 int LayerForward_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     (void)clientData; // Suppress unused parameter warning
     
@@ -862,49 +889,25 @@ int LayerForward_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         // Parse arguments using dual syntax parser
         LayerForwardArgs args = ParseLayerForwardArgs(interp, objc, objv);
         
-        if (module_storage.find(args.layer) == module_storage.end()) {
+        ModuleRef* layer = FindModuleFromObj(args.layerObj);
+        if (layer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid layer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
-            Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
-            return TCL_ERROR;
-        }
-        
-        auto& module = module_storage[args.layer];
-        auto& input = tensor_storage[args.input];
-        
-        torch::Tensor output;
-        
-        // Try different module types
-        if (auto concrete_linear = std::dynamic_pointer_cast<ConcreteLinear>(module)) {
-            output = concrete_linear->forward(input);
-        } else if (auto concrete_conv2d = std::dynamic_pointer_cast<ConcreteConv2d>(module)) {
-            output = concrete_conv2d->forward(input);
-        } else if (auto concrete_maxpool2d = std::dynamic_pointer_cast<ConcreteMaxPool2d>(module)) {
-            output = concrete_maxpool2d->forward(input);
-        } else if (auto concrete_dropout = std::dynamic_pointer_cast<ConcreteDropout>(module)) {
-            output = concrete_dropout->forward(input);
-        } else if (auto concrete_batchnorm = std::dynamic_pointer_cast<ConcreteBatchNorm2d>(module)) {
-            output = concrete_batchnorm->forward(input);
-        } else if (auto concrete_avgpool = std::dynamic_pointer_cast<ConcreteAvgPool2d>(module)) {
-            output = concrete_avgpool->forward(input);
-        } else if (auto concrete_maxpool1d = std::dynamic_pointer_cast<ConcreteMaxPool1d>(module)) {
-            output = concrete_maxpool1d->forward(input);
-        } else if (auto concrete_maxpool3d = std::dynamic_pointer_cast<ConcreteCustomMaxPool3d>(module)) {
-            output = concrete_maxpool3d->forward(input);
-        } else if (auto concrete_sequential = std::dynamic_pointer_cast<ConcreteSequential>(module)) {
-            output = concrete_sequential->forward(input);
-        } else {
-            Tcl_SetResult(interp, const_cast<char*>("Unsupported module type for forward pass"), TCL_VOLATILE);
-            return TCL_ERROR;
+
+        // Packed sequences go through recurrent layers and stay packed
+        if (auto* packed = FindPackedSequence(args.input)) {
+            torch::nn::utils::rnn::PackedSequence packed_output;
+            if (!RecurrentLayerForwardPacked(*layer, *packed, packed_output)) {
+                Tcl_SetResult(interp, const_cast<char*>("Packed sequences are only accepted by recurrent layers"), TCL_VOLATILE);
+                return TCL_ERROR;
+            }
+            Tcl_SetObjResult(interp, NewHandleObj(StorePackedSequence(packed_output)));
+            return TCL_OK;
         }
-        
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
-        return TCL_OK;
+
+        AsyncWork work = PrepareLayerForward(interp, objc, objv);
+        return SetTensorResult(interp, work.run()[0]);
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
         return TCL_ERROR;
@@ -915,6 +918,9 @@ struct Conv2dSetWeightsArgs {
     std::string layer;
     std::string weight;
     std::string bias;  // Optional
+    Tcl_Obj* layerObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
+    Tcl_Obj* biasObj = nullptr;
     
     bool IsValid() const {
         return !layer.empty() && !weight.empty();
@@ -931,9 +937,12 @@ Conv2dSetWeightsArgs ParseConv2dSetWeightsArgs(Tcl_Interp* interp, int objc, Tcl
         }
         
         args.layer = Tcl_GetString(objv[1]);
+        args.layerObj = objv[1];
         args.weight = Tcl_GetString(objv[2]);
+        args.weightObj = objv[2];
         if (objc == 4) {
             args.bias = Tcl_GetString(objv[3]);
+            args.biasObj = objv[3];
         }
     } else {
         // Named parameter syntax
@@ -945,10 +954,13 @@ Conv2dSetWeightsArgs ParseConv2dSetWeightsArgs(Tcl_Interp* interp, int objc, Tcl
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-layer") {
                 args.layer = Tcl_GetString(objv[i + 1]);
+                args.layerObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = Tcl_GetString(objv[i + 1]);
+                args.weightObj = objv[i + 1];
             } else if (param == "-bias") {
                 args.bias = Tcl_GetString(objv[i + 1]);
+                args.biasObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -967,38 +979,37 @@ int Conv2dSetWeights_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     try {
         Conv2dSetWeightsArgs args = ParseConv2dSetWeightsArgs(interp, objc, objv);
         
-        std::string layer_name = args.layer;
-        std::string weight_name = args.weight;
-        std::string bias_name = args.bias;
-        
-        if (module_storage.find(layer_name) == module_storage.end()) {
+        ModuleRef* layer = FindModuleFromObj(args.layerObj);
+        if (layer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid layer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(weight_name) == tensor_storage.end()) {
+        torch::Tensor* weight = FindTensorFromObj(args.weightObj);
+        if (weight == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid weight tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& module = module_storage[layer_name];
+        auto& module = *layer;
         auto conv2d = std::dynamic_pointer_cast<ConcreteConv2d>(module);
         if (!conv2d) {
             Tcl_SetResult(interp, const_cast<char*>("Layer is not a Conv2d layer"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& weight_tensor = tensor_storage[weight_name];
+        auto& weight_tensor = *weight;
         
         // Set weight
         conv2d->weight.data().copy_(weight_tensor);
         
         // Set bias if provided
-        if (!bias_name.empty()) {
-            if (tensor_storage.find(bias_name) == tensor_storage.end()) {
+        if (!args.bias.empty()) {
+            torch::Tensor* bias = FindTensorFromObj(args.biasObj);
+            if (bias == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid bias tensor name"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            auto& bias_tensor = tensor_storage[bias_name];
+            auto& bias_tensor = *bias;
             if (conv2d->bias.defined()) {
                 conv2d->bias.data().copy_(bias_tensor);
             }
@@ -1116,7 +1127,7 @@ int MaxPool1d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         
         std::string handle = StoreModule("maxpool1d", maxpool1d);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1295,7 +1306,7 @@ int MaxPool3d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         auto maxpool3d = std::make_shared<ConcreteCustomMaxPool3d>(options, is_identity_maxpool3d(args));
         
         std::string handle = StoreModule("maxpool3d", maxpool3d);
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -204,11 +204,12 @@ int OptimizerSGD_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
             std::string param_name = Tcl_GetString(param_obj);
             
-            if (tensor_storage.find(param_name) == tensor_storage.end()) {
+            torch::Tensor* param_obj_tensor = FindTensorFromObj(param_obj);
+            if (param_obj_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + param_name).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            parameters.push_back(tensor_storage[param_name]);
+            parameters.push_back(*param_obj_tensor);
         }
         
         // Create SGD optimizer with all parameters
@@ -224,7 +225,7 @@ int OptimizerSGD_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -251,11 +252,12 @@ int OptimizerAdam_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_O
             Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
             std::string param_name = Tcl_GetString(param_obj);
             
-            if (tensor_storage.find(param_name) == tensor_storage.end()) {
+            torch::Tensor* param_obj_tensor = FindTensorFromObj(param_obj);
+            if (param_obj_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + param_name).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            parameters.push_back(tensor_storage[param_name]);
+            parameters.push_back(*param_obj_tensor);
         }
         
         // Create Adam optimizer
@@ -269,7 +271,7 @@ int OptimizerAdam_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_O
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -280,6 +282,7 @@ int OptimizerAdam_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_O
 // Parameter structure for torch::optimizer_step
 struct OptimizerStepArgs {
     std::string optimizer;  // optimizer handle (required)
+    Tcl_Obj* optimizerObj = nullptr;
     
     bool IsValid() const {
         return !optimizer.empty();
@@ -297,6 +300,7 @@ OptimizerStepArgs ParseOptimizerStepArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -308,6 +312,7 @@ OptimizerStepArgs ParseOptimizerStepArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-optimizer" || param == "-opt") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -324,6 +329,7 @@ OptimizerStepArgs ParseOptimizerStepArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for torch::optimizer_zero_grad
 struct OptimizerZeroGradArgs {
     std::string optimizer;  // optimizer handle (required)
+    Tcl_Obj* optimizerObj = nullptr;
     bool setToNone = true;  // whether to set gradients to None instead of zero (default: true)
     
     bool IsValid() const {
@@ -342,6 +348,7 @@ OptimizerZeroGradArgs ParseOptimizerZeroGradArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (objc > 2) {
             int setToNoneVal;
@@ -361,6 +368,7 @@ OptimizerZeroGradArgs ParseOptimizerZeroGradArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-optimizer" || param == "-opt") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-setToNone" || param == "-set_to_none") {
                 int setToNoneVal;
                 if (Tcl_GetBooleanFromObj(interp, objv[i + 1], &setToNoneVal) != TCL_OK) {
@@ -388,12 +396,13 @@ int OptimizerStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_O
         // Parse arguments using dual syntax parser
         OptimizerStepArgs args = ParseOptimizerStepArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        std::shared_ptr<torch::optim::Optimizer>* entry = FindOptimizerFromObj(args.optimizerObj);
+        if (entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& optimizer = optimizer_storage[args.optimizer];
+        auto& optimizer = *entry;
         optimizer->step();
         
         Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
@@ -412,12 +421,13 @@ int OptimizerZeroGrad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
         // Parse arguments using dual syntax parser
         OptimizerZeroGradArgs args = ParseOptimizerZeroGradArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        std::shared_ptr<torch::optim::Optimizer>* entry = FindOptimizerFromObj(args.optimizerObj);
+        if (entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& optimizer = optimizer_storage[args.optimizer];
+        auto& optimizer = *entry;
         optimizer->zero_grad(args.setToNone);
         
         Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
@@ -183,10 +183,9 @@ int TensorCreate_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -202,13 +201,13 @@ static int TensorProperty(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
     }
 
     try {
-        std::string name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(name) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(objv[1]);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[name];
+        auto& tensor = *input;
         if (strcmp(property, "dtype") == 0) {
             std::string dtype = torch::toString(tensor.scalar_type());
             Tcl_SetResult(interp, const_cast<char*>(dtype.c_str()), TCL_VOLATILE);
@@ -219,9 +218,8 @@ static int TensorProperty(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
             Tcl_SetResult(interp, const_cast<char*>(tensor.requires_grad() ? "1" : "0"), TCL_VOLATILE);
         } else if (strcmp(property, "grad") == 0) {
             if (tensor.grad().defined()) {
-                std::string grad_handle = GetNextHandle("tensor");
-                tensor_storage[grad_handle] = tensor.grad();
-                Tcl_SetResult(interp, const_cast<char*>(grad_handle.c_str()), TCL_VOLATILE);
+                std::string grad_handle = StoreTensor(tensor.grad());
+                Tcl_SetObjResult(interp, NewHandleObj(grad_handle));
             } else {
                 Tcl_SetResult(interp, const_cast<char*>(""), TCL_VOLATILE);
             }
@@ -236,6 +234,7 @@ static int TensorProperty(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
 // Parameter structure for tensor_dtype command
 struct TensorDtypeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -254,6 +253,7 @@ TensorDtypeArgs ParseTensorDtypeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -266,6 +266,7 @@ TensorDtypeArgs ParseTensorDtypeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -283,12 +284,13 @@ int TensorGetDtype_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
     try {
         TensorDtypeArgs args = ParseTensorDtypeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         std::string dtype;
         
         // Convert scalar type to expected format for tests
@@ -317,6 +319,7 @@ int TensorGetDtype_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
 // Parameter structure for tensor_device command
 struct TensorDeviceArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -335,6 +338,7 @@ TensorDeviceArgs ParseTensorDeviceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -347,6 +351,7 @@ TensorDeviceArgs ParseTensorDeviceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -364,12 +369,13 @@ int TensorGetDevice_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* co
     try {
         TensorDeviceArgs args = ParseTensorDeviceArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         std::string device = torch::toString(tensor.device());
         
         Tcl_SetResult(interp, const_cast<char*>(device.c_str()), TCL_VOLATILE);
@@ -383,6 +389,7 @@ int TensorGetDevice_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* co
 // Parameter structure for tensor_requires_grad command
 struct TensorRequiresGradArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -401,6 +408,7 @@ TensorRequiresGradArgs ParseTensorRequiresGradArgs(Tcl_Interp* interp, int objc,
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -413,6 +421,7 @@ TensorRequiresGradArgs ParseTensorRequiresGradArgs(Tcl_Interp* interp, int objc,
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -430,12 +439,13 @@ int TensorRequiresGrad_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         TensorRequiresGradArgs args = ParseTensorRequiresGradArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         Tcl_SetResult(interp, const_cast<char*>(tensor.requires_grad() ? "1" : "0"), TCL_VOLATILE);
         return TCL_OK;
     } catch (const std::exception& e) {
@@ -447,6 +457,7 @@ int TensorRequiresGrad_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for tensor_grad command
 struct TensorGradArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -465,6 +476,7 @@ TensorGradArgs ParseTensorGradArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -477,6 +489,7 @@ TensorGradArgs ParseTensorGradArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -494,12 +507,13 @@ int TensorGetGrad_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         TensorGradArgs args = ParseTensorGradArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         if (!tensor.requires_grad()) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor does not require gradients"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -510,10 +524,9 @@ int TensorGetGrad_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
             return TCL_ERROR;
         }
         
-        std::string grad_handle = GetNextHandle("tensor");
-        tensor_storage[grad_handle] = tensor.grad();
+        std::string grad_handle = StoreTensor(tensor.grad());
         
-        Tcl_SetResult(interp, const_cast<char*>(grad_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(grad_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -524,6 +537,7 @@ int TensorGetGrad_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for tensor_print command
 struct TensorPrintArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -542,6 +556,7 @@ TensorPrintArgs ParseTensorPrintArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -554,6 +569,7 @@ TensorPrintArgs ParseTensorPrintArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -571,12 +587,13 @@ int TensorPrint_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorPrintArgs args = ParseTensorPrintArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         std::ostringstream oss;
         
         // Get tensor data
@@ -639,6 +656,7 @@ int TensorPrint_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for tensor_backward command
 struct TensorBackwardArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -657,6 +675,7 @@ TensorBackwardArgs ParseTensorBackwardArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -669,6 +688,7 @@ TensorBackwardArgs ParseTensorBackwardArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -686,12 +706,13 @@ int TensorBackward_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorBackwardArgs args = ParseTensorBackwardArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         if (!tensor.requires_grad()) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor does not require gradients"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -714,13 +735,13 @@ static int TensorAdvancedOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
     }
 
     try {
-        std::string name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(name) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(objv[1]);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[name];
+        auto& tensor = *input;
         torch::Tensor result;
         
         if (objc == 3) {
@@ -764,10 +785,9 @@ static int TensorAdvancedOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
             }
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -778,6 +798,7 @@ static int TensorAdvancedOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
 // Parameter structure for tensor_abs command
 struct TensorAbsArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -796,6 +817,7 @@ TensorAbsArgs ParseTensorAbsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -808,6 +830,7 @@ TensorAbsArgs ParseTensorAbsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -825,20 +848,23 @@ TensorAbsArgs ParseTensorAbsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 int TensorAbs_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorAbsArgs args = ParseTensorAbsArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Abs, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         // Apply abs operation while preserving all tensor options
         torch::Tensor result = tensor.abs().to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -848,6 +874,7 @@ int TensorAbs_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
 struct TensorExpArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -863,6 +890,7 @@ TensorExpArgs ParseTensorExpArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::tensor_exp tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -875,6 +903,7 @@ TensorExpArgs ParseTensorExpArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -891,20 +920,23 @@ TensorExpArgs ParseTensorExpArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 int TensorExp_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorExpArgs args = ParseTensorExpArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Exp, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         // Apply exp operation while preserving all tensor options
         torch::Tensor result = torch::exp(tensor).to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -914,6 +946,7 @@ int TensorExp_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
 struct TensorLogArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -929,6 +962,7 @@ TensorLogArgs ParseTensorLogArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::tensor_log tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -941,6 +975,7 @@ TensorLogArgs ParseTensorLogArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -957,20 +992,23 @@ TensorLogArgs ParseTensorLogArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 int TensorLog_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorLogArgs args = ParseTensorLogArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Log, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         // Apply log operation while preserving all tensor options
         torch::Tensor result = torch::log(tensor).to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -981,6 +1019,7 @@ int TensorLog_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for tensor_sqrt command
 struct TensorSqrtArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -997,6 +1036,7 @@ TensorSqrtArgs ParseTensorSqrtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::tensor_sqrt tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1009,6 +1049,7 @@ TensorSqrtArgs ParseTensorSqrtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1025,21 +1066,24 @@ TensorSqrtArgs ParseTensorSqrtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
 int TensorSqrt_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorSqrtArgs args = ParseTensorSqrtArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Sqrt, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Apply sqrt operation while preserving all tensor options
         torch::Tensor result = torch::sqrt(tensor).to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1050,6 +1094,7 @@ int TensorSqrt_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for tensor_sum command
 struct TensorSumArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified (reduce all)
     
     bool IsValid() const {
@@ -1067,6 +1112,7 @@ TensorSumArgs ParseTensorSumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::tensor_sum tensor ?dim?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
                 throw std::runtime_error("Invalid dimension parameter");
@@ -1084,6 +1130,7 @@ TensorSumArgs ParseTensorSumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 args.dim = std::stoi(value);
             } else {
@@ -1103,12 +1150,13 @@ int TensorSum_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorSumArgs args = ParseTensorSumArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result;
         
         if (args.dim >= 0) {
@@ -1117,10 +1165,9 @@ int TensorSum_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             result = tensor.sum();
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1131,6 +1178,7 @@ int TensorSum_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for tensor_mean command
 struct TensorMeanArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified (reduce all)
     
     bool IsValid() const {
@@ -1150,6 +1198,7 @@ TensorMeanArgs ParseTensorMeanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -1168,6 +1217,7 @@ TensorMeanArgs ParseTensorMeanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value: " + value);
@@ -1189,12 +1239,13 @@ int TensorMean_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorMeanArgs args = ParseTensorMeanArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result;
         
         if (args.dim >= 0) {
@@ -1203,10 +1254,9 @@ int TensorMean_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
             result = tensor.mean();
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1217,6 +1267,7 @@ int TensorMean_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for tensor_max command
 struct TensorMaxArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified (reduce all)
     
     bool IsValid() const {
@@ -1236,6 +1287,7 @@ TensorMaxArgs ParseTensorMaxArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -1254,6 +1306,7 @@ TensorMaxArgs ParseTensorMaxArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value: " + value);
@@ -1275,12 +1328,13 @@ int TensorMax_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorMaxArgs args = ParseTensorMaxArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result;
         
         if (args.dim >= 0) {
@@ -1291,10 +1345,9 @@ int TensorMax_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             result = tensor.max();
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1305,6 +1358,7 @@ int TensorMax_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for tensor_min command
 struct TensorMinArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;  // -1 means no dimension specified (reduce all)
     
     bool IsValid() const {
@@ -1323,6 +1377,7 @@ TensorMinArgs ParseTensorMinArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -1340,6 +1395,7 @@ TensorMinArgs ParseTensorMinArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid value for -dim parameter");
@@ -1361,12 +1417,13 @@ int TensorMin_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorMinArgs args = ParseTensorMinArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result;
         
         if (args.dim == -1) {
@@ -1377,10 +1434,9 @@ int TensorMin_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             result = std::get<0>(tensor.min(args.dim));
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1391,6 +1447,7 @@ int TensorMin_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for tensor_sigmoid command
 struct TensorSigmoidArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1407,6 +1464,7 @@ TensorSigmoidArgs ParseTensorSigmoidArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::tensor_sigmoid tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1419,6 +1477,7 @@ TensorSigmoidArgs ParseTensorSigmoidArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1435,21 +1494,24 @@ TensorSigmoidArgs ParseTensorSigmoidArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
 int TensorSigmoid_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorSigmoidArgs args = ParseTensorSigmoidArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Sigmoid, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Apply sigmoid operation while preserving all tensor options
         torch::Tensor result = torch::sigmoid(tensor).to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1460,6 +1522,7 @@ int TensorSigmoid_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for tensor_relu command
 struct TensorReluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1476,6 +1539,7 @@ TensorReluArgs ParseTensorReluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::tensor_relu tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1488,6 +1552,7 @@ TensorReluArgs ParseTensorReluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1504,21 +1569,24 @@ TensorReluArgs ParseTensorReluArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
 int TensorRelu_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorReluArgs args = ParseTensorReluArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Relu, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Apply ReLU operation while preserving all tensor options
         torch::Tensor result = torch::relu(tensor).to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1529,6 +1597,7 @@ int TensorRelu_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for tensor_tanh command
 struct TensorTanhArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1545,6 +1614,7 @@ TensorTanhArgs ParseTensorTanhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::tensor_tanh tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1557,6 +1627,7 @@ TensorTanhArgs ParseTensorTanhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1573,20 +1644,23 @@ TensorTanhArgs ParseTensorTanhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
 int TensorTanh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorTanhArgs args = ParseTensorTanhArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Tanh, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         // Ensure we preserve the data type by using the same options
         torch::Tensor result = tensor.tanh().to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1598,6 +1672,8 @@ int TensorTanh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 struct TensorAddArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     double alpha = 1.0;
     
     bool IsValid() const {
@@ -1618,6 +1694,8 @@ TensorAddArgs ParseTensorAddArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         
         args.input1 = Tcl_GetString(objv[1]);
         args.input2 = Tcl_GetString(objv[2]);
+        args.input1Obj = objv[1];
+        args.input2Obj = objv[2];
         
         if (objc > 3) {
             if (Tcl_GetDoubleFromObj(interp, objv[3], &args.alpha) != TCL_OK) {
@@ -1636,8 +1714,10 @@ TensorAddArgs ParseTensorAddArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input1" || param == "-input") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-other") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else if (param == "-alpha") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.alpha) != TCL_OK) {
                     throw std::runtime_error("Invalid alpha value: " + value);
@@ -1658,25 +1738,29 @@ TensorAddArgs ParseTensorAddArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 int TensorAdd_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorAddArgs args = ParseTensorAddArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Add, {args.input1, args.input2}, args.alpha)) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         // Perform addition while preserving tensor options from the first tensor
         torch::Tensor result = (tensor1 + args.alpha * tensor2).to(tensor1.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1688,6 +1772,8 @@ int TensorAdd_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 struct TensorSubArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     double alpha = 1.0;
     
     bool IsValid() const {
@@ -1706,6 +1792,8 @@ TensorSubArgs ParseTensorSubArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         args.input = Tcl_GetString(objv[1]);
         args.other = Tcl_GetString(objv[2]);
+        args.inputObj = objv[1];
+        args.otherObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1718,8 +1806,10 @@ TensorSubArgs ParseTensorSubArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = value;
+                args.otherObj = objv[i + 1];
             } else if (param == "-alpha") {
                 args.alpha = std::stod(value);
             } else {
@@ -1738,25 +1828,29 @@ TensorSubArgs ParseTensorSubArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 int TensorSub_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorSubArgs args = ParseTensorSubArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Sub, {args.input, args.other}, args.alpha)) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other = FindTensorFromObj(args.otherObj);
+        if (other == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input];
-        auto& tensor2 = tensor_storage[args.other];
+        auto& tensor1 = *input;
+        auto& tensor2 = *other;
         // Perform subtraction while preserving tensor options from the first tensor
         torch::Tensor result = (tensor1 - (args.alpha * tensor2)).to(tensor1.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1767,6 +1861,8 @@ int TensorSub_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 struct TensorMulArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     double scalar = 0.0;  // For scalar multiplication
     bool is_scalar = false;  // Flag to indicate scalar multiplication
     
@@ -1784,6 +1880,7 @@ TensorMulArgs ParseTensorMulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::tensor_mul tensor1 tensor2|scalar");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Try to parse second argument as scalar
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.scalar) == TCL_OK) {
@@ -1792,6 +1889,7 @@ TensorMulArgs ParseTensorMulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             // If not a scalar, treat as tensor handle
             Tcl_ResetResult(interp);  // Clear error from failed double conversion
             args.other = Tcl_GetString(objv[2]);
+            args.otherObj = objv[2];
         }
     } else {
         // Named parameter syntax
@@ -1805,6 +1903,7 @@ TensorMulArgs ParseTensorMulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 // Try to parse as scalar first
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.scalar) == TCL_OK) {
@@ -1813,6 +1912,7 @@ TensorMulArgs ParseTensorMulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
                     // If not a scalar, treat as tensor handle
                     Tcl_ResetResult(interp);  // Clear error from failed double conversion
                     args.other = value;
+                    args.otherObj = objv[i + 1];
                 }
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
@@ -1830,30 +1930,37 @@ TensorMulArgs ParseTensorMulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 int TensorMul_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorMulArgs args = ParseTensorMulArgs(interp, objc, objv);
+        if (LazyModeEnabled()) {
+            bool recorded = args.is_scalar ? LazyRecord(interp, LazyOp::Scale, {args.input}, args.scalar)
+                                           : LazyRecord(interp, LazyOp::Mul, {args.input, args.other});
+            if (recorded) {
+                return TCL_OK;
+            }
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input];
+        auto& tensor1 = *input;
         torch::Tensor result;
         
         if (args.is_scalar) {
             result = tensor1 * args.scalar;
         } else {
-            if (tensor_storage.find(args.other) == tensor_storage.end()) {
+            torch::Tensor* other = FindTensorFromObj(args.otherObj);
+            if (other == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            auto& tensor2 = tensor_storage[args.other];
-            result = tensor1 * tensor2;
+            result = tensor1 * *other;
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1865,6 +1972,8 @@ int TensorMul_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 struct TensorDivArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !other.empty();
@@ -1882,6 +1991,8 @@ TensorDivArgs ParseTensorDivArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         args.input = Tcl_GetString(objv[1]);
         args.other = Tcl_GetString(objv[2]);
+        args.inputObj = objv[1];
+        args.otherObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1894,8 +2005,10 @@ TensorDivArgs ParseTensorDivArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = value;
+                args.otherObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1912,25 +2025,29 @@ TensorDivArgs ParseTensorDivArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 int TensorDiv_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorDivArgs args = ParseTensorDivArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Div, {args.input, args.other})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other = FindTensorFromObj(args.otherObj);
+        if (other == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input];
-        auto& tensor2 = tensor_storage[args.other];
+        auto& tensor1 = *input;
+        auto& tensor2 = *other;
         // Perform division while preserving tensor options from the first tensor
         torch::Tensor result = (tensor1 / tensor2).to(tensor1.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1942,6 +2059,8 @@ int TensorDiv_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 struct TensorMatmulArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !other.empty();
@@ -1959,6 +2078,8 @@ TensorMatmulArgs ParseTensorMatmulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         args.input = Tcl_GetString(objv[1]);
         args.other = Tcl_GetString(objv[2]);
+        args.inputObj = objv[1];
+        args.otherObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1971,8 +2092,10 @@ TensorMatmulArgs ParseTensorMatmulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = value;
+                args.otherObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1986,29 +2109,32 @@ TensorMatmulArgs ParseTensorMatmulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
     return args;
 }
 
+// Resolve the operands of tensor_matmul; the product is computed by run,
+// either right away or on a torch::async worker
+AsyncWork PrepareTensorMatmul(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    TensorMatmulArgs args = ParseTensorMatmulArgs(interp, objc, objv);
+
+    torch::Tensor* input = FindTensorFromObj(args.inputObj);
+    if (input == nullptr) {
+        throw std::runtime_error("Invalid first tensor name");
+    }
+    torch::Tensor* other = FindTensorFromObj(args.otherObj);
+    if (other == nullptr) {
+        throw std::runtime_error("Invalid second tensor name");
+    }
+
+    AsyncWork work;
+    work.run = [tensor1 = *input, tensor2 = *other]() {
+        // Perform matrix multiplication while preserving tensor options from the first tensor
+        return std::vector<torch::Tensor>{tensor1.matmul(tensor2).to(tensor1.options())};
+    };
+    return work;
+}
+
 int TensorMatmul_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
-        TensorMatmulArgs args = ParseTensorMatmulArgs(interp, objc, objv);
-        
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
-            Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
-            return TCL_ERROR;
-        }
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
-            Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
-            return TCL_ERROR;
-        }
-        
-        auto& tensor1 = tensor_storage[args.input];
-        auto& tensor2 = tensor_storage[args.other];
-        // Perform matrix multiplication while preserving tensor options from the first tensor
-        torch::Tensor result = tensor1.matmul(tensor2).to(tensor1.options());
-        
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
-        
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
-        return TCL_OK;
+        AsyncWork work = PrepareTensorMatmul(interp, objc, objv);
+        return SetTensorResult(interp, work.run()[0]);
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
         return TCL_ERROR;
@@ -2018,6 +2144,8 @@ int TensorMatmul_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct TensorBmmArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !other.empty();
@@ -2030,7 +2158,9 @@ TensorBmmArgs ParseTensorBmmArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     if (objc >= 3 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.other = Tcl_GetString(objv[2]);
+        args.otherObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2043,8 +2173,10 @@ TensorBmmArgs ParseTensorBmmArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = value;
+                args.otherObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -2062,26 +2194,27 @@ int TensorBmm_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorBmmArgs args = ParseTensorBmmArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other = FindTensorFromObj(args.otherObj);
+        if (other == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid other tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
-        auto& other_tensor = tensor_storage[args.other];
+        auto& input_tensor = *input;
+        auto& other_tensor = *other;
         
         // Perform batch matrix multiplication while preserving tensor options from the input tensor
         torch::Tensor result = torch::bmm(input_tensor, other_tensor).to(input_tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2092,6 +2225,7 @@ int TensorBmm_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for tensor_to command
 struct TensorToArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::string device;
     std::string dtype = "";  // Optional
     
@@ -2112,6 +2246,7 @@ TensorToArgs ParseTensorToArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.device = Tcl_GetString(objv[2]);
         
         if (objc == 4) {
@@ -2129,6 +2264,7 @@ TensorToArgs ParseTensorToArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-device") {
                 args.device = value;
             } else if (param == "-dtype") {
@@ -2150,12 +2286,13 @@ int TensorTo_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
     try {
         TensorToArgs args = ParseTensorToArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Device device = GetDevice(args.device.c_str());
         torch::Tensor result = tensor.to(device);
         
@@ -2164,10 +2301,9 @@ int TensorTo_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             result = result.to(dtype);
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2179,6 +2315,7 @@ int TensorTo_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
 
 struct TensorReshapeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> shape;
     
     bool IsValid() const {
@@ -2195,6 +2332,7 @@ TensorReshapeArgs ParseTensorReshapeArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::tensor_reshape tensor shape");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.shape = TclListToShape(interp, objv[2]);
     } else {
         // Named parameter syntax
@@ -2208,6 +2346,7 @@ TensorReshapeArgs ParseTensorReshapeArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-shape") {
                 Tcl_Obj* shape_obj = Tcl_NewStringObj(value.c_str(), -1);
                 args.shape = TclListToShape(interp, shape_obj);
@@ -2228,19 +2367,19 @@ int TensorReshape_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorReshapeArgs args = ParseTensorReshapeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         // Perform reshape while preserving all tensor options
         torch::Tensor result = tensor.reshape(args.shape).to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2250,6 +2389,7 @@ int TensorReshape_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 
 struct TensorPermuteArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> dims;
     
     bool IsValid() const {
@@ -2266,6 +2406,7 @@ TensorPermuteArgs ParseTensorPermuteArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::tensor_permute tensor dims");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.dims = TclListToShape(interp, objv[2]);
     } else {
         // Named parameter syntax
@@ -2279,6 +2420,7 @@ TensorPermuteArgs ParseTensorPermuteArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dims") {
                 Tcl_Obj* dims_obj = Tcl_NewStringObj(value.c_str(), -1);
                 args.dims = TclListToShape(interp, dims_obj);
@@ -2299,19 +2441,19 @@ int TensorPermute_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorPermuteArgs args = ParseTensorPermuteArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         // Perform permute while preserving all tensor options
         torch::Tensor result = tensor.permute(args.dims).to(tensor.options());
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2321,6 +2463,7 @@ int TensorPermute_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 
 struct TensorCatArgs {
     std::vector<std::string> tensors;
+    std::vector<Tcl_Obj*> tensorObjs;
     int dim = 0;
     
     bool IsValid() const {
@@ -2341,6 +2484,7 @@ TensorCatArgs ParseTensorCatArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             Tcl_Obj* tensor_obj;
             Tcl_ListObjIndex(interp, objv[1], i, &tensor_obj);
             args.tensors.push_back(Tcl_GetString(tensor_obj));
+            args.tensorObjs.push_back(tensor_obj);
         }
         
         // Parse dimension
@@ -2367,6 +2511,7 @@ TensorCatArgs ParseTensorCatArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
                     Tcl_Obj* tensor_obj;
                     Tcl_ListObjIndex(interp, list_obj, j, &tensor_obj);
                     args.tensors.push_back(Tcl_GetString(tensor_obj));
+                    args.tensorObjs.push_back(tensor_obj);
                 }
             } else if (param == "-dim") {
                 args.dim = std::stoi(value);
@@ -2388,12 +2533,13 @@ int TensorCat_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
         TensorCatArgs args = ParseTensorCatArgs(interp, objc, objv);
         
         std::vector<torch::Tensor> tensors;
-        for (const auto& tensor_name : args.tensors) {
-            if (tensor_storage.find(tensor_name) == tensor_storage.end()) {
-                Tcl_SetResult(interp, const_cast<char*>(("Invalid tensor name: " + tensor_name).c_str()), TCL_VOLATILE);
+        for (Tcl_Obj* tensor_obj : args.tensorObjs) {
+            torch::Tensor* tensor = FindTensorFromObj(tensor_obj);
+            if (tensor == nullptr) {
+                Tcl_SetResult(interp, const_cast<char*>(("Invalid tensor name: " + std::string(Tcl_GetString(tensor_obj))).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            tensors.push_back(tensor_storage[tensor_name]);
+            tensors.push_back(*tensor);
         }
         
         // Preserve tensor options from the first tensor in the list
@@ -2402,10 +2548,9 @@ int TensorCat_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
             result = result.to(tensors[0].options());
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2415,6 +2560,7 @@ int TensorCat_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
 
 struct TensorStackArgs {
     std::vector<std::string> tensors;
+    std::vector<Tcl_Obj*> tensorObjs;
     int dim = 0;
     
     bool IsValid() const {
@@ -2436,6 +2582,7 @@ TensorStackArgs ParseTensorStackArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             Tcl_Obj* tensor_obj;
             Tcl_ListObjIndex(interp, objv[1], i, &tensor_obj);
             args.tensors.push_back(Tcl_GetString(tensor_obj));
+            args.tensorObjs.push_back(tensor_obj);
         }
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim parameter");
@@ -2459,6 +2606,7 @@ TensorStackArgs ParseTensorStackArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
                     Tcl_Obj* tensor_obj;
                     Tcl_ListObjIndex(interp, list_obj, j, &tensor_obj);
                     args.tensors.push_back(Tcl_GetString(tensor_obj));
+                    args.tensorObjs.push_back(tensor_obj);
                 }
             } else if (param == "-dim") {
                 args.dim = std::stoi(value);
@@ -2477,21 +2625,21 @@ int TensorStack_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorStackArgs args = ParseTensorStackArgs(interp, objc, objv);
         std::vector<torch::Tensor> tensors;
-        for (const auto& tensor_name : args.tensors) {
-            if (tensor_storage.find(tensor_name) == tensor_storage.end()) {
-                Tcl_SetResult(interp, const_cast<char*>(("Invalid tensor name: " + tensor_name).c_str()), TCL_VOLATILE);
+        for (Tcl_Obj* tensor_obj : args.tensorObjs) {
+            torch::Tensor* tensor = FindTensorFromObj(tensor_obj);
+            if (tensor == nullptr) {
+                Tcl_SetResult(interp, const_cast<char*>(("Invalid tensor name: " + std::string(Tcl_GetString(tensor_obj))).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            tensors.push_back(tensor_storage[tensor_name]);
+            tensors.push_back(*tensor);
         }
         // Preserve tensor options from the first tensor in the list
         torch::Tensor result = torch::stack(tensors, args.dim);
         if (!tensors.empty()) {
             result = result.to(tensors[0].options());
         }
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        std::string result_handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2501,6 +2649,7 @@ int TensorStack_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 
 struct TensorShapeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -2516,6 +2665,7 @@ TensorShapeArgs ParseTensorShapeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::tensor_shape tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2528,6 +2678,7 @@ TensorShapeArgs ParseTensorShapeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-tensor" || param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -2545,12 +2696,13 @@ int TensorShape_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorShapeArgs args = ParseTensorShapeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>(("Invalid tensor name: " + args.input).c_str()), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto sizes = tensor.sizes();
         
         Tcl_Obj* shape_list = Tcl_NewListObj(0, NULL);
@@ -0,0 +1,775 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+
+// A dataset is a list of sources indexed together along dimension 0, e.g.
+// {features labels}. Sources are ordinary tensors, which includes tensors
+// mapped from .npy or fixed-size record files.
+struct Dataset {
+    std::vector<torch::Tensor> sources;
+    int64_t size = 0;
+};
+
+// One collated batch, or the error raised while building it
+struct DataBatch {
+    std::vector<torch::Tensor> tensors;
+    std::string error;
+};
+
+// Batches are built by worker threads into a window of at most prefetch
+// batches ahead of the consumer and handed out in order. Everything below
+// mutex is shared with the workers; the sources themselves are only read.
+//
+// With per-sample lengths the loader buckets: each pool of bucket_size
+// batches is sorted by decreasing length before it is cut into batches, and
+// the sequence sources named at creation are trimmed to the longest sample of
+// their batch, so batches carry little padding and are ready for
+// pack_padded_sequence.
+struct DataLoader {
+    std::shared_ptr<Dataset> dataset;
+    int64_t batch_size = 1;
+    bool shuffle = false;
+    bool drop_last = false;
+    bool pin_memory = false;
+    uint64_t seed = 0;
+    int64_t prefetch = 2;
+    std::vector<int64_t> lengths;        // empty unless bucketing
+    int64_t bucket_size = 100;
+    int64_t time_steps = 0;              // padded length (dim 1) of sequence sources
+    std::vector<bool> sequence_sources;  // per source: trimmed when bucketing
+
+    std::mutex mutex;
+    std::condition_variable work_cv;     // workers wait for a free slot
+    std::condition_variable ready_cv;    // the consumer waits for its batch
+    std::vector<int64_t> order;          // sample indices for this epoch
+    std::vector<int64_t> starts;         // batch k is order[starts[k], starts[k + 1])
+    int64_t epoch = 0;
+    int64_t num_batches = 0;
+    int64_t next_to_build = 0;
+    int64_t next_to_return = 0;
+    uint64_t generation = 0;             // bumped on every epoch start
+    std::map<int64_t, DataBatch> ready;
+    bool stopping = false;
+    std::vector<std::thread> workers;
+
+    ~DataLoader() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        work_cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Caller holds mutex
+    void StartEpoch(int64_t new_epoch) {
+        epoch = new_epoch;
+        order.resize(static_cast<size_t>(dataset->size));
+        std::iota(order.begin(), order.end(), 0);
+
+        // Seeded per epoch so a run can be replayed or resumed mid-way
+        std::mt19937_64 rng(seed + 0x9e3779b97f4a7c15ULL * static_cast<uint64_t>(epoch));
+        if (shuffle) {
+            std::shuffle(order.begin(), order.end(), rng);
+        }
+        if (drop_last) {
+            order.resize(static_cast<size_t>(dataset->size / batch_size * batch_size));
+        }
+        int64_t count = static_cast<int64_t>(order.size());
+
+        if (!lengths.empty()) {
+            int64_t pool = batch_size * bucket_size;
+            for (int64_t p = 0; p < count; p += pool) {
+                std::stable_sort(order.begin() + p, order.begin() + std::min(p + pool, count),
+                                 [this](int64_t a, int64_t b) { return lengths[a] > lengths[b]; });
+            }
+        }
+
+        starts.clear();
+        for (int64_t s = 0; s < count; s += batch_size) {
+            starts.push_back(s);
+        }
+        starts.push_back(count);
+        num_batches = static_cast<int64_t>(starts.size()) - 1;
+
+        // Bucketed batches are sorted, so shuffle their order instead
+        if (!lengths.empty() && shuffle) {
+            std::vector<int64_t> ids(static_cast<size_t>(num_batches));
+            std::iota(ids.begin(), ids.end(), 0);
+            std::shuffle(ids.begin(), ids.end(), rng);
+            std::vector<int64_t> shuffled;
+            std::vector<int64_t> shuffled_starts = {0};
+            shuffled.reserve(order.size());
+            for (int64_t id : ids) {
+                shuffled.insert(shuffled.end(), order.begin() + starts[id], order.begin() + starts[id + 1]);
+                shuffled_starts.push_back(static_cast<int64_t>(shuffled.size()));
+            }
+            order.swap(shuffled);
+            starts.swap(shuffled_starts);
+        }
+
+        next_to_build = 0;
+        next_to_return = 0;
+        generation++;
+        ready.clear();
+        work_cv.notify_all();
+    }
+
+    // Build a batch from indices copied out under the lock
+    DataBatch Build(const std::vector<int64_t>& indices) const {
+        DataBatch batch;
+        try {
+            torch::NoGradGuard no_grad;
+            int64_t count = static_cast<int64_t>(indices.size());
+            bool contiguous = !shuffle && lengths.empty();
+            torch::Tensor index;
+            if (!contiguous) {
+                index = torch::from_blob(const_cast<int64_t*>(indices.data()), {count}, torch::kInt64);
+            }
+
+            int64_t longest = time_steps;
+            std::vector<int64_t> batch_lengths;
+            if (!lengths.empty()) {
+                longest = 0;
+                for (int64_t i : indices) {
+                    batch_lengths.push_back(lengths[i]);
+                    longest = std::max(longest, lengths[i]);
+                }
+            }
+
+            for (size_t s = 0; s < dataset->sources.size(); s++) {
+                // Trim before gathering so padding is never copied
+                torch::Tensor src = dataset->sources[s];
+                if (!lengths.empty() && sequence_sources[s]) {
+                    src = src.narrow(1, 0, longest);
+                }
+                torch::Tensor out = contiguous ? src.narrow(0, indices.front(), count).clone()
+                                               : src.index_select(0, index.to(src.device()));
+                if (pin_memory && out.device().is_cpu() && torch::cuda::is_available()) {
+                    out = out.pin_memory();
+                }
+                batch.tensors.push_back(out);
+            }
+            if (!lengths.empty()) {
+                batch.tensors.push_back(torch::tensor(batch_lengths, torch::kInt64));
+            }
+        } catch (const std::exception& e) {
+            batch.error = e.what();
+        }
+        return batch;
+    }
+
+    void WorkerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            work_cv.wait(lock, [this] {
+                return stopping || (next_to_build < num_batches && next_to_build < next_to_return + prefetch);
+            });
+            if (stopping) {
+                return;
+            }
+
+            int64_t k = next_to_build++;
+            uint64_t gen = generation;
+            std::vector<int64_t> indices(order.begin() + starts[k], order.begin() + starts[k + 1]);
+
+            lock.unlock();
+            DataBatch batch = Build(indices);
+            lock.lock();
+
+            // Results from an epoch that was reset meanwhile are dropped
+            if (gen == generation) {
+                ready[k] = std::move(batch);
+                ready_cv.notify_all();
+            }
+        }
+    }
+
+    // Next batch of the epoch; false at the end of the epoch, after which the
+    // following epoch starts prefetching immediately
+    bool Next(DataBatch& out) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (next_to_return >= num_batches) {
+            StartEpoch(epoch + 1);
+            return false;
+        }
+
+        int64_t k = next_to_return;
+        if (workers.empty()) {
+            std::vector<int64_t> indices(order.begin() + starts[k], order.begin() + starts[k + 1]);
+            next_to_return++;
+            lock.unlock();
+            out = Build(indices);
+            return true;
+        }
+
+        ready_cv.wait(lock, [this, k] { return ready.count(k) > 0; });
+        out = std::move(ready[k]);
+        ready.erase(k);
+        next_to_return++;
+        work_cv.notify_all();
+        return true;
+    }
+};
+
+thread_local std::unordered_map<std::string, std::shared_ptr<Dataset>> dataset_storage;
+thread_local std::unordered_map<std::string, std::shared_ptr<DataLoader>> dataloader_storage;
+
+bool DataHandleExists(const std::string& handle) {
+    return dataset_storage.find(handle) != dataset_storage.end() ||
+           dataloader_storage.find(handle) != dataloader_storage.end();
+}
+
+bool ReleaseDataHandle(const std::string& handle) {
+    return dataset_storage.erase(handle) > 0 || dataloader_storage.erase(handle) > 0;
+}
+
+size_t DatasetHandleCount() {
+    return dataset_storage.size();
+}
+
+size_t DataLoaderHandleCount() {
+    return dataloader_storage.size();
+}
+
+std::shared_ptr<DataLoader> FindDataLoader(const std::string& handle) {
+    auto it = dataloader_storage.find(handle);
+    return it == dataloader_storage.end() ? nullptr : it->second;
+}
+
+// Start the current epoch over if some of its batches were already taken,
+// so a native loop such as torch::fit always sees whole epochs
+void DataLoaderRestartPartialEpoch(DataLoader& loader) {
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    if (loader.next_to_return > 0) {
+        loader.StartEpoch(loader.epoch);
+    }
+}
+
+// Next batch for native loops such as torch::fit; false at the end of an
+// epoch. Throws if building the batch failed.
+bool DataLoaderNextBatch(DataLoader& loader, std::vector<torch::Tensor>& tensors) {
+    DataBatch batch;
+    if (!loader.Next(batch)) {
+        return false;
+    }
+    if (!batch.error.empty()) {
+        throw std::runtime_error("Failed to build batch: " + batch.error);
+    }
+    tensors = std::move(batch.tensors);
+    return true;
+}
+
+// ============================================================================
+// torch::dataset
+// ============================================================================
+
+// Parameter structure for dataset command
+struct DatasetArgs {
+    std::vector<Tcl_Obj*> tensors;
+    std::vector<Tcl_Obj*> files;
+
+    bool IsValid() const {
+        return !tensors.empty() || !files.empty();
+    }
+};
+
+// Parse dual syntax: tensorList | ?-tensors list? ?-files list?
+static DatasetArgs ParseDatasetArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    DatasetArgs args;
+
+    auto parse_list = [&](Tcl_Obj* obj, std::vector<Tcl_Obj*>& out) {
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, obj, &count, &items) != TCL_OK) {
+            throw std::runtime_error("Expected a list");
+        }
+        out.insert(out.end(), items, items + count);
+    };
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error("Usage: torch::dataset tensorList");
+        }
+        parse_list(objv[1], args.tensors);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-tensors") {
+                parse_list(objv[i + 1], args.tensors);
+            } else if (param == "-files") {
+                parse_list(objv[i + 1], args.files);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -tensors, -files");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Usage: torch::dataset tensorList | torch::dataset ?-tensors list? ?-files list?");
+    }
+
+    return args;
+}
+
+// torch::dataset - Group tensors and/or mapped files into a dataset whose
+// samples are the rows along dimension 0
+int Dataset_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        DatasetArgs args = ParseDatasetArgs(interp, objc, objv);
+
+        auto dataset = std::make_shared<Dataset>();
+        for (Tcl_Obj* obj : args.tensors) {
+            torch::Tensor* tensor = FindTensorFromObj(obj);
+            if (tensor == nullptr) {
+                throw std::runtime_error(std::string("Invalid tensor name: ") + Tcl_GetString(obj));
+            }
+            dataset->sources.push_back(tensor->detach());
+        }
+
+        // A file is a .npy path, or {path dtype rowShape} for a raw file of
+        // fixed-size records
+        for (Tcl_Obj* obj : args.files) {
+            int count;
+            Tcl_Obj** items;
+            if (Tcl_ListObjGetElements(interp, obj, &count, &items) != TCL_OK || (count != 1 && count != 3)) {
+                throw std::runtime_error("Each file must be a path or {path dtype rowShape}");
+            }
+            if (count == 1) {
+                dataset->sources.push_back(MapTensorFile(Tcl_GetString(items[0]), "", nullptr, -1, false));
+            } else {
+                std::vector<int64_t> shape = {-1};
+                std::vector<int64_t> row = TclListToShape(interp, items[2]);
+                shape.insert(shape.end(), row.begin(), row.end());
+                torch::Tensor flat = MapTensorFile(Tcl_GetString(items[0]), Tcl_GetString(items[1]), nullptr, -1, false);
+                int64_t row_numel = 1;
+                for (int64_t dim : row) {
+                    row_numel *= dim;
+                }
+                if (row_numel <= 0 || flat.numel() % row_numel != 0) {
+                    throw std::runtime_error(std::string("File size of \"") + Tcl_GetString(items[0]) +
+                                             "\" is not a whole number of records");
+                }
+                dataset->sources.push_back(flat.view(shape));
+            }
+        }
+
+        for (const auto& source : dataset->sources) {
+            if (source.dim() == 0) {
+                throw std::runtime_error("Dataset sources must have at least one dimension");
+            }
+            if (&source == &dataset->sources.front()) {
+                dataset->size = source.size(0);
+            } else if (source.size(0) != dataset->size) {
+                throw std::runtime_error("All dataset sources must have the same size in dimension 0");
+            }
+        }
+
+        std::string handle = GetNextHandle("dataset");
+        dataset_storage[handle] = dataset;
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for commands taking a single dataset or loader handle
+struct DataHandleArgs {
+    std::string handle;
+
+    bool IsValid() const {
+        return !handle.empty();
+    }
+};
+
+// Parse dual syntax: handle | -<name> handle
+static DataHandleArgs ParseDataHandleArgs(int objc, Tcl_Obj* const objv[], const char* command, const char* name) {
+    DataHandleArgs args;
+    std::string flag = std::string("-") + name;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error(std::string("Usage: ") + command + " " + name);
+        }
+        args.handle = Tcl_GetString(objv[1]);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == flag) {
+                args.handle = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: " + flag);
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error(std::string("Required parameter missing: ") + name);
+    }
+
+    return args;
+}
+
+// torch::dataset_size - Number of samples in a dataset
+int DatasetSize_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        DataHandleArgs args = ParseDataHandleArgs(objc, objv, "torch::dataset_size", "dataset");
+
+        auto it = dataset_storage.find(args.handle);
+        if (it == dataset_storage.end()) {
+            throw std::runtime_error("Invalid dataset handle: " + args.handle);
+        }
+
+        Tcl_SetObjResult(interp, Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(it->second->size)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::dataloader
+// ============================================================================
+
+// Parameter structure for dataloader command
+struct DataLoaderArgs {
+    std::string dataset;
+    int64_t batchSize = 1;
+    bool shuffle = false;
+    bool dropLast = false;
+    bool pinMemory = false;
+    int64_t numWorkers = 0;
+    int64_t prefetch = 2;
+    bool has_seed = false;
+    int64_t seed = 0;
+    Tcl_Obj* lengths = nullptr;
+    int64_t bucketSize = 100;
+    bool has_sequence_sources = false;
+    std::vector<int64_t> sequenceSources = {0};
+
+    bool IsValid() const {
+        return !dataset.empty() && batchSize > 0 && numWorkers >= 0 && prefetch > 0 && bucketSize > 0;
+    }
+};
+
+// Parse dual syntax: dataset ?batchSize? ?shuffle? ?numWorkers? |
+// -dataset ds ?-batchSize n? ?-shuffle bool? ?-seed n? ?-numWorkers n?
+// ?-prefetch n? ?-dropLast bool? ?-pinMemory bool? ?-lengths tensor? ?-bucketSize n?
+// ?-sequenceSources list?
+static DataLoaderArgs ParseDataLoaderArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    DataLoaderArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 5) {
+            throw std::runtime_error("Usage: torch::dataloader dataset ?batchSize? ?shuffle? ?numWorkers?");
+        }
+        args.dataset = Tcl_GetString(objv[1]);
+        if (objc > 2) {
+            args.batchSize = GetInt64FromObj(interp, objv[2]);
+        }
+        if (objc > 3) {
+            args.shuffle = GetBoolFromObj(interp, objv[3]);
+        }
+        if (objc > 4) {
+            args.numWorkers = GetInt64FromObj(interp, objv[4]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-dataset") {
+                args.dataset = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-batchSize" || param == "-batch_size") {
+                args.batchSize = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-shuffle") {
+                args.shuffle = GetBoolFromObj(interp, objv[i + 1]);
+            } else if (param == "-seed") {
+                args.seed = GetInt64FromObj(interp, objv[i + 1]);
+                args.has_seed = true;
+            } else if (param == "-numWorkers" || param == "-num_workers") {
+                args.numWorkers = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-prefetch") {
+                args.prefetch = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-dropLast" || param == "-drop_last") {
+                args.dropLast = GetBoolFromObj(interp, objv[i + 1]);
+            } else if (param == "-pinMemory" || param == "-pin_memory") {
+                args.pinMemory = GetBoolFromObj(interp, objv[i + 1]);
+            } else if (param == "-lengths") {
+                args.lengths = objv[i + 1];
+            } else if (param == "-bucketSize" || param == "-bucket_size") {
+                args.bucketSize = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-sequenceSources" || param == "-sequence_sources") {
+                args.sequenceSources = GetIntVectorFromObj(interp, objv[i + 1]);
+                args.has_sequence_sources = true;
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -dataset, -batchSize, -shuffle, -seed, -numWorkers, -prefetch, -dropLast, -pinMemory, -lengths, -bucketSize, -sequenceSources");
+            }
+        }
+    }
+
+    if (args.dataset.empty()) {
+        throw std::runtime_error("Required parameter missing: dataset");
+    }
+    if (!args.IsValid()) {
+        throw std::runtime_error("batchSize, prefetch and bucketSize must be positive and numWorkers non-negative");
+    }
+    if (args.has_sequence_sources && args.lengths == nullptr) {
+        throw std::runtime_error("sequenceSources is only used with lengths");
+    }
+
+    return args;
+}
+
+// torch::dataloader - Iterate a dataset in (optionally shuffled) batches,
+// collated ahead of time on worker threads
+int DataLoader_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        DataLoaderArgs args = ParseDataLoaderArgs(interp, objc, objv);
+
+        auto it = dataset_storage.find(args.dataset);
+        if (it == dataset_storage.end()) {
+            throw std::runtime_error("Invalid dataset handle: " + args.dataset);
+        }
+
+        auto loader = std::make_shared<DataLoader>();
+        loader->dataset = it->second;
+        loader->batch_size = args.batchSize;
+        loader->shuffle = args.shuffle;
+        loader->drop_last = args.dropLast;
+        loader->pin_memory = args.pinMemory;
+        loader->prefetch = args.prefetch;
+        loader->seed = args.has_seed ? static_cast<uint64_t>(args.seed) : std::random_device{}();
+        loader->bucket_size = args.bucketSize;
+        if (args.lengths != nullptr) {
+            torch::Tensor* lengths = FindTensorFromObj(args.lengths);
+            if (lengths == nullptr) {
+                throw std::runtime_error(std::string("Invalid lengths tensor: ") + Tcl_GetString(args.lengths));
+            }
+            // Every sequence source is padded to the same number of steps
+            const auto& sources = loader->dataset->sources;
+            if (args.sequenceSources.empty()) {
+                throw std::runtime_error("sequenceSources must name at least one source");
+            }
+            loader->sequence_sources.assign(sources.size(), false);
+            for (int64_t index : args.sequenceSources) {
+                if (index < 0 || index >= static_cast<int64_t>(sources.size())) {
+                    throw std::runtime_error("Sequence source " + std::to_string(index) + " is out of range for a dataset with " +
+                                             std::to_string(sources.size()) + " sources");
+                }
+                const torch::Tensor& source = sources[index];
+                if (source.dim() < 2) {
+                    throw std::runtime_error("Sequence source " + std::to_string(index) + " must have shape [samples, time, ...]");
+                }
+                if (index == args.sequenceSources.front()) {
+                    loader->time_steps = source.size(1);
+                } else if (source.size(1) != loader->time_steps) {
+                    throw std::runtime_error("Sequence source " + std::to_string(index) + " has " + std::to_string(source.size(1)) +
+                                             " steps in dimension 1, expected " + std::to_string(loader->time_steps));
+                }
+                loader->sequence_sources[index] = true;
+            }
+            if (lengths->dim() != 1 || lengths->size(0) != loader->dataset->size) {
+                throw std::runtime_error("lengths must be a 1-D tensor with one entry per sample");
+            }
+            torch::Tensor values = lengths->to(torch::kCPU, torch::kInt64).contiguous();
+            loader->lengths.assign(values.data_ptr<int64_t>(), values.data_ptr<int64_t>() + values.numel());
+            for (int64_t length : loader->lengths) {
+                if (length < 0 || length > loader->time_steps) {
+                    throw std::runtime_error("lengths must lie between 0 and the padded length " +
+                                             std::to_string(loader->time_steps));
+                }
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(loader->mutex);
+            loader->StartEpoch(0);
+        }
+        for (int64_t w = 0; w < args.numWorkers; w++) {
+            DataLoader* raw = loader.get();
+            loader->workers.emplace_back([raw] { raw->WorkerLoop(); });
+        }
+
+        std::string handle = GetNextHandle("dataloader");
+        dataloader_storage[handle] = loader;
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// torch::dataloader_next - Next batch: a tensor handle for single-source
+// datasets, otherwise a list with one handle per source (plus the batch
+// lengths when bucketing). Returns an empty string at the end of each epoch.
+int DataLoaderNext_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        DataHandleArgs args = ParseDataHandleArgs(objc, objv, "torch::dataloader_next", "loader");
+
+        auto it = dataloader_storage.find(args.handle);
+        if (it == dataloader_storage.end()) {
+            throw std::runtime_error("Invalid dataloader handle: " + args.handle);
+        }
+
+        std::vector<torch::Tensor> tensors;
+        if (!DataLoaderNextBatch(*it->second, tensors)) {
+            Tcl_ResetResult(interp);
+            return TCL_OK;
+        }
+
+        std::vector<Tcl_Obj*> handles;
+        for (auto& tensor : tensors) {
+            std::string handle = StoreTensor(tensor);
+            handles.push_back(NewHandleObj(handle));
+        }
+        if (handles.size() == 1) {
+            Tcl_SetObjResult(interp, handles[0]);
+        } else {
+            Tcl_SetObjResult(interp, Tcl_NewListObj(static_cast<int>(handles.size()), handles.data()));
+        }
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for dataloader_reset command
+struct DataLoaderResetArgs {
+    std::string loader;
+    int64_t epoch = -1;              // next epoch by default
+
+    bool IsValid() const {
+        return !loader.empty();
+    }
+};
+
+// Parse dual syntax: loader ?epoch? | -loader loader ?-epoch n?
+static DataLoaderResetArgs ParseDataLoaderResetArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    DataLoaderResetArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 3) {
+            throw std::runtime_error("Usage: torch::dataloader_reset loader ?epoch?");
+        }
+        args.loader = Tcl_GetString(objv[1]);
+        if (objc == 3) {
+            args.epoch = GetInt64FromObj(interp, objv[2]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-loader") {
+                args.loader = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-epoch") {
+                args.epoch = GetInt64FromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -loader, -epoch");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: loader");
+    }
+
+    return args;
+}
+
+// torch::dataloader_reset - Abandon the current epoch and start another one
+// (by default the next); returns the epoch number
+int DataLoaderReset_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        DataLoaderResetArgs args = ParseDataLoaderResetArgs(interp, objc, objv);
+
+        auto it = dataloader_storage.find(args.loader);
+        if (it == dataloader_storage.end()) {
+            throw std::runtime_error("Invalid dataloader handle: " + args.loader);
+        }
+
+        DataLoader& loader = *it->second;
+        int64_t epoch;
+        {
+            std::lock_guard<std::mutex> lock(loader.mutex);
+            epoch = args.epoch >= 0 ? args.epoch : loader.epoch + 1;
+            loader.StartEpoch(epoch);
+        }
+
+        Tcl_SetObjResult(interp, Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(epoch)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// torch::dataloader_len - Number of batches per epoch
+int DataLoaderLen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        DataHandleArgs args = ParseDataHandleArgs(objc, objv, "torch::dataloader_len", "loader");
+
+        auto it = dataloader_storage.find(args.handle);
+        if (it == dataloader_storage.end()) {
+            throw std::runtime_error("Invalid dataloader handle: " + args.handle);
+        }
+
+        int64_t batches;
+        {
+            std::lock_guard<std::mutex> lock(it->second->mutex);
+            batches = it->second->num_batches;
+        }
+
+        Tcl_SetObjResult(interp, Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(batches)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -8,6 +8,7 @@
 
 struct DistributedGatherArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int dst = 0;
     std::string group = "";
     
@@ -26,6 +27,7 @@ DistributedGatherArgs ParseDistributedGatherArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dst) != TCL_OK) {
@@ -46,6 +48,7 @@ DistributedGatherArgs ParseDistributedGatherArgs(Tcl_Interp* interp, int objc, T
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dst") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dst) != TCL_OK) {
                     throw std::runtime_error("Invalid -dst parameter. Must be an integer.");
@@ -73,12 +76,13 @@ int TensorDistributedGather_Cmd(ClientData clientData, Tcl_Interp* interp, int o
         DistributedGatherArgs args = ParseDistributedGatherArgs(interp, objc, objv);
         
         // Check if tensor exists in storage
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        torch::Tensor tensor = tensor_storage[args.tensor];
+        torch::Tensor tensor = *tensor_ptr;
         
         // Simplified distributed gather implementation
         // In a real distributed setting, this would gather from all processes
@@ -101,6 +105,7 @@ int TensorDistributedGather_Cmd(ClientData clientData, Tcl_Interp* interp, int o
 
 struct DistributedScatterArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int src = 0;             // Default source rank
     std::string group = "";  // Optional group parameter
     
@@ -119,6 +124,7 @@ DistributedScatterArgs ParseDistributedScatterArgs(Tcl_Interp* interp, int objc,
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.src) != TCL_OK) {
@@ -139,6 +145,7 @@ DistributedScatterArgs ParseDistributedScatterArgs(Tcl_Interp* interp, int objc,
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-src") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.src) != TCL_OK) {
                     throw std::runtime_error("Invalid -src parameter. Must be an integer.");
@@ -166,12 +173,13 @@ int TensorDistributedScatter_Cmd(ClientData clientData, Tcl_Interp* interp, int
         DistributedScatterArgs args = ParseDistributedScatterArgs(interp, objc, objv);
         
         // Check if tensor exists in storage
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        torch::Tensor tensor = tensor_storage[args.tensor];
+        torch::Tensor tensor = *tensor_ptr;
         
         // Simplified distributed scatter implementation
         // In a real distributed setting, this would scatter to all processes
@@ -190,6 +198,7 @@ int TensorDistributedScatter_Cmd(ClientData clientData, Tcl_Interp* interp, int
 
 struct DistributedReduceScatterArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::string op = "sum";      // Default operation
     std::string group = "";      // Optional group parameter
     
@@ -208,6 +217,7 @@ DistributedReduceScatterArgs ParseDistributedReduceScatterArgs(Tcl_Interp* inter
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             args.op = Tcl_GetString(objv[2]);
@@ -226,6 +236,7 @@ DistributedReduceScatterArgs ParseDistributedReduceScatterArgs(Tcl_Interp* inter
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-op") {
                 args.op = Tcl_GetString(objv[i + 1]);
             } else if (param == "-group") {
@@ -251,12 +262,13 @@ int TensorDistributedReduceScatter_Cmd(ClientData clientData, Tcl_Interp* interp
         DistributedReduceScatterArgs args = ParseDistributedReduceScatterArgs(interp, objc, objv);
         
         // Check if tensor exists in storage
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        torch::Tensor tensor = tensor_storage[args.tensor];
+        torch::Tensor tensor = *tensor_ptr;
         
         // Simplified reduce-scatter implementation
         // In a real distributed setting, this would reduce across processes and scatter
@@ -289,6 +301,7 @@ int TensorDistributedReduceScatter_Cmd(ClientData clientData, Tcl_Interp* interp
 
 struct DistributedAllToAllArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::string group = "";  // optional group parameter
     
     bool IsValid() const {
@@ -306,6 +319,7 @@ DistributedAllToAllArgs ParseDistributedAllToAllArgs(Tcl_Interp* interp, int obj
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc == 3) {
             args.group = Tcl_GetString(objv[2]);
@@ -320,6 +334,7 @@ DistributedAllToAllArgs ParseDistributedAllToAllArgs(Tcl_Interp* interp, int obj
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-group") {
                 args.group = Tcl_GetString(objv[i + 1]);
             } else {
@@ -343,13 +358,14 @@ int TensorDistributedAllToAll_Cmd(ClientData clientData, Tcl_Interp* interp, int
         DistributedAllToAllArgs args = ParseDistributedAllToAllArgs(interp, objc, objv);
         
         // Check if tensor exists in storage
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // For simplicity, expect a single tensor and return it
-        torch::Tensor tensor = tensor_storage[args.tensor];
+        torch::Tensor tensor = *tensor_ptr;
         
         // Simplified all-to-all implementation
         // In a real distributed setting, this would exchange data between all processes
@@ -368,6 +384,7 @@ int TensorDistributedAllToAll_Cmd(ClientData clientData, Tcl_Interp* interp, int
 
 struct DistributedSendArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int dst = -1;          // Initialize to invalid value to detect missing parameter
     int tag = 0;           // Default tag value
     
@@ -386,6 +403,7 @@ DistributedSendArgs ParseDistributedSendArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dst) != TCL_OK) {
             throw std::runtime_error("Invalid dst parameter. Must be an integer.");
@@ -406,6 +424,7 @@ DistributedSendArgs ParseDistributedSendArgs(Tcl_Interp* interp, int objc, Tcl_O
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dst") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dst) != TCL_OK) {
                     throw std::runtime_error("Invalid -dst parameter. Must be an integer.");
@@ -435,11 +454,12 @@ int TensorDistributedSend_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
         DistributedSendArgs args = ParseDistributedSendArgs(interp, objc, objv);
         
         // Get tensor from tensor storage
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             throw std::runtime_error("Invalid tensor handle: " + args.tensor);
         }
         
-        torch::Tensor tensor = tensor_storage[args.tensor];
+        torch::Tensor tensor = *tensor_ptr;
         
         // Simplified send implementation
         // In a real distributed setting, this would send to specific process
@@ -540,6 +560,7 @@ int TensorDistributedRecv_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
 
 struct DistributedISendArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int dst = -1;          // Initialize to invalid value to detect missing parameter
     int tag = 0;           // Default tag value
     
@@ -558,6 +579,7 @@ DistributedISendArgs ParseDistributedISendArgs(Tcl_Interp* interp, int objc, Tcl
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dst) != TCL_OK) {
             throw std::runtime_error("Invalid dst parameter. Must be an integer.");
@@ -578,6 +600,7 @@ DistributedISendArgs ParseDistributedISendArgs(Tcl_Interp* interp, int objc, Tcl
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dst") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dst) != TCL_OK) {
                     throw std::runtime_error("Invalid -dst parameter. Must be an integer.");
@@ -607,11 +630,12 @@ int TensorDistributedISend_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
         DistributedISendArgs args = ParseDistributedISendArgs(interp, objc, objv);
         
         // Get tensor from tensor storage
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             throw std::runtime_error("Invalid tensor handle: " + args.tensor);
         }
         
-        torch::Tensor tensor = tensor_storage[args.tensor];
+        torch::Tensor tensor = *tensor_ptr;
         
         // Simplified non-blocking send implementation
         // In a real distributed setting, this would return a handle for later waiting
@@ -2,7 +2,7 @@
 #include <torch/torch.h>
 
 // Forward declarations of global variables
-extern std::unordered_map<std::string, torch::Tensor> tensor_storage;
+extern thread_local HandleTable<torch::Tensor> tensor_storage;
 
 // Global distributed training state
 static bool distributed_initialized = false;
@@ -146,6 +146,7 @@ int Torch_DistributedInit_Cmd(ClientData clientData, Tcl_Interp *interp, int obj
 
 struct AllReduceArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::string operation = "sum";
     
     bool IsValid() const {
@@ -165,6 +166,7 @@ AllReduceArgs ParseAllReduceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc == 3) {
             args.operation = Tcl_GetString(objv[2]);
@@ -185,6 +187,7 @@ AllReduceArgs ParseAllReduceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (option == "-tensor") {
                 args.tensor = value;
+                args.tensorObj = objv[i + 1];
             } else if (option == "-operation") {
                 args.operation = value;
             } else {
@@ -206,8 +209,8 @@ int Torch_RealAllReduce_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
     try {
         AllReduceArgs args = ParseAllReduceArgs(interp, objc, objv);
         
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -215,7 +218,7 @@ int Torch_RealAllReduce_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
         // Distributed all-reduce operation
         // In single GPU mode: return input tensor
         // In multi-GPU mode: simulate all-reduce by applying operation locally
-        auto tensor = tensor_it->second;
+        auto tensor = *tensor_entry;
         auto result = tensor;
         
         if (distributed_initialized && world_size > 1) {
@@ -226,10 +229,9 @@ int Torch_RealAllReduce_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
             // For sum, max, min - just return the tensor (simulation)
         }
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
@@ -244,6 +246,7 @@ int Torch_RealAllReduce_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
 
 struct DistributedBroadcastArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int root = 0;
     
     bool IsValid() const {
@@ -262,6 +265,7 @@ DistributedBroadcastArgs ParseDistributedBroadcastArgs(Tcl_Interp* interp, int o
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc == 3) {
             int root_val;
@@ -286,6 +290,7 @@ DistributedBroadcastArgs ParseDistributedBroadcastArgs(Tcl_Interp* interp, int o
             
             if (option == "-tensor") {
                 args.tensor = value;
+                args.tensorObj = objv[i + 1];
             } else if (option == "-root") {
                 int root_val;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &root_val) != TCL_OK) {
@@ -311,8 +316,8 @@ int Torch_RealBroadcast_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
     try {
         DistributedBroadcastArgs args = ParseDistributedBroadcastArgs(interp, objc, objv);
         
-        auto tensor_it = tensor_storage.find(args.tensor);
-        if (tensor_it == tensor_storage.end()) {
+        torch::Tensor* tensor_entry = FindTensorFromObj(args.tensorObj);
+        if (tensor_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Tensor not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -320,12 +325,11 @@ int Torch_RealBroadcast_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
         // Distributed broadcast operation
         // In single GPU mode: return input tensor
         // In multi-GPU mode: return input tensor (from root rank simulation)
-        auto result = tensor_it->second;
+        auto result = *tensor_entry;
 
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = result;
+        std::string result_name = StoreTensor(result);
 
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
 
     } catch (const std::exception& e) {
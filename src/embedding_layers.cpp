@@ -3,6 +3,7 @@
 // Parameter structure for embedding command
 struct EmbeddingArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int num_embeddings = 0;
     int embedding_dim = 0;
     int padding_idx = -1;
@@ -23,6 +24,7 @@ EmbeddingArgs ParseEmbeddingArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     if (objc >= 4 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.num_embeddings) != TCL_OK) {
             throw std::runtime_error("Invalid num_embeddings value");
@@ -48,6 +50,7 @@ EmbeddingArgs ParseEmbeddingArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-num_embeddings") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.num_embeddings) != TCL_OK) {
                     throw std::runtime_error("Invalid num_embeddings value");
@@ -87,11 +90,12 @@ int Embedding_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
         EmbeddingArgs args = ParseEmbeddingArgs(interp, objc, objv);
         
         // Look up tensor from storage
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        torch::Tensor input = tensor_storage[args.input];
+        torch::Tensor input = *input_tensor;
 
         // Create embedding weight matrix
         torch::Tensor weight = torch::randn({args.num_embeddings, args.embedding_dim});
@@ -118,6 +122,10 @@ struct EmbeddingBagArgs {
     std::string offsets;
     int mode = 0;  // 0=sum, 1=mean, 2=max
     std::string per_sample_weights;  // Optional
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
+    Tcl_Obj* offsetsObj = nullptr;
+    Tcl_Obj* per_sample_weightsObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !weight.empty() && !offsets.empty();
@@ -135,8 +143,11 @@ EmbeddingBagArgs ParseEmbeddingBagArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
     if (objc >= 5 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.weight = Tcl_GetString(objv[2]);
+        args.weightObj = objv[2];
         args.offsets = Tcl_GetString(objv[3]);
+        args.offsetsObj = objv[3];
         
         if (Tcl_GetIntFromObj(interp, objv[4], &args.mode) != TCL_OK) {
             throw std::runtime_error("Invalid mode value");
@@ -144,6 +155,7 @@ EmbeddingBagArgs ParseEmbeddingBagArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         
         if (objc >= 6) {
             args.per_sample_weights = Tcl_GetString(objv[5]);
+            args.per_sample_weightsObj = objv[5];
         }
     } else {
         // Named parameter syntax
@@ -156,16 +168,20 @@ EmbeddingBagArgs ParseEmbeddingBagArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = Tcl_GetString(objv[i + 1]);
+                args.weightObj = objv[i + 1];
             } else if (param == "-offsets") {
                 args.offsets = Tcl_GetString(objv[i + 1]);
+                args.offsetsObj = objv[i + 1];
             } else if (param == "-mode") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.mode) != TCL_OK) {
                     throw std::runtime_error("Invalid mode value");
                 }
             } else if (param == "-per_sample_weights") {
                 args.per_sample_weights = Tcl_GetString(objv[i + 1]);
+                args.per_sample_weightsObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -weight, -offsets, -mode, -per_sample_weights");
             }
@@ -189,31 +205,35 @@ int EmbeddingBag_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         EmbeddingBagArgs args = ParseEmbeddingBagArgs(interp, objc, objv);
         
         // Look up tensors from storage
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        torch::Tensor input = tensor_storage[args.input];
+        torch::Tensor input = *input_tensor;
         
-        if (tensor_storage.find(args.weight) == tensor_storage.end()) {
+        torch::Tensor* weight_tensor = FindTensorFromObj(args.weightObj);
+        if (weight_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid weight tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        torch::Tensor weight = tensor_storage[args.weight];
+        torch::Tensor weight = *weight_tensor;
         
-        if (tensor_storage.find(args.offsets) == tensor_storage.end()) {
+        torch::Tensor* offsets_tensor = FindTensorFromObj(args.offsetsObj);
+        if (offsets_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid offsets tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        torch::Tensor offsets = tensor_storage[args.offsets];
+        torch::Tensor offsets = *offsets_tensor;
         
         torch::Tensor per_sample_weights;
         if (!args.per_sample_weights.empty()) {
-            if (tensor_storage.find(args.per_sample_weights) == tensor_storage.end()) {
+            torch::Tensor* per_sample_weights_tensor = FindTensorFromObj(args.per_sample_weightsObj);
+            if (per_sample_weights_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid per_sample_weights tensor"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            per_sample_weights = tensor_storage[args.per_sample_weights];
+            per_sample_weights = *per_sample_weights_tensor;
         }
 
         // Use correct API signature 
@@ -231,6 +251,7 @@ int EmbeddingBag_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for sparse_embedding command
 struct SparseEmbeddingArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int num_embeddings = 0;
     int embedding_dim = 0;
     int padding_idx = -1;
@@ -254,6 +275,7 @@ SparseEmbeddingArgs ParseSparseEmbeddingArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("");  // Empty message since Tcl_WrongNumArgs already set the error
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.num_embeddings) != TCL_OK) {
             throw std::runtime_error("Invalid num_embeddings value");
@@ -277,6 +299,7 @@ SparseEmbeddingArgs ParseSparseEmbeddingArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-num_embeddings") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.num_embeddings) != TCL_OK) {
                     throw std::runtime_error("Invalid num_embeddings value");
@@ -309,12 +332,13 @@ int SparseEmbedding_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         SparseEmbeddingArgs args = ParseSparseEmbeddingArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         
         // Create embedding weight matrix
         torch::Tensor weight = torch::randn({args.num_embeddings, args.embedding_dim});
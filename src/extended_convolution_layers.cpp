@@ -23,19 +23,20 @@ static Conv1dArgs ParseConv1dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const o
             Tcl_WrongNumArgs(interp, 1, objv, "input weight ?bias? ?stride? ?padding? ?dilation? ?groups?");
             throw std::runtime_error("Invalid number of arguments");
         }
-        std::string inName = Tcl_GetString(objv[1]);
-        std::string wName  = Tcl_GetString(objv[2]);
-        if (tensor_storage.find(inName) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-        if (tensor_storage.find(wName) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-        args.input  = tensor_storage[inName];
-        args.weight = tensor_storage[wName];
+        torch::Tensor* input = FindTensorFromObj(objv[1]);
+        torch::Tensor* weight = FindTensorFromObj(objv[2]);
+        if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+        if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+        args.input  = *input;
+        args.weight = *weight;
 
         int index = 3;
         if (objc > index) {
             std::string biasName = Tcl_GetString(objv[index]);
             if (biasName != "none") {
-                if (tensor_storage.find(biasName) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                args.bias = tensor_storage[biasName];
+                torch::Tensor* bias = FindTensorFromObj(objv[index]);
+                if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                args.bias = *bias;
                 args.hasBias = true;
             }
             ++index;
@@ -51,18 +52,19 @@ static Conv1dArgs ParseConv1dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const o
             std::string param = Tcl_GetString(objv[i]);
             Tcl_Obj* valObj = objv[i+1];
             if (param == "-input") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-                args.input = tensor_storage[name];
+                torch::Tensor* input = FindTensorFromObj(valObj);
+                if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+                args.input = *input;
             } else if (param == "-weight") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-                args.weight = tensor_storage[name];
+                torch::Tensor* weight = FindTensorFromObj(valObj);
+                if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+                args.weight = *weight;
             } else if (param == "-bias") {
                 std::string name = Tcl_GetString(valObj);
                 if (name != "none") {
-                    if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                    args.bias = tensor_storage[name];
+                    torch::Tensor* bias = FindTensorFromObj(valObj);
+                    if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                    args.bias = *bias;
                     args.hasBias = true;
                 }
             } else if (param == "-stride") {
@@ -92,9 +94,8 @@ int TensorConv1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         else
             result = torch::conv1d(args.input, args.weight, torch::Tensor(), args.stride, args.padding, args.dilation, args.groups);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -106,6 +107,9 @@ struct Conv3dArgs {
     std::string input;
     std::string weight;
     std::string bias;  // Optional, can be "none" or empty
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
+    Tcl_Obj* biasObj = nullptr;
     std::vector<int64_t> stride = {1, 1, 1};
     std::vector<int64_t> padding = {0, 0, 0};
     std::vector<int64_t> dilation = {1, 1, 1};
@@ -175,10 +179,13 @@ Conv3dArgs ParseConv3dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.weight = Tcl_GetString(objv[2]);
+        args.weightObj = objv[2];
         
         if (objc > 3) {
             args.bias = Tcl_GetString(objv[3]);
+            args.biasObj = objv[3];
         }
         if (objc > 4) {
             args.stride = ParseIntOrList3(interp, objv[4], {1, 1, 1});
@@ -206,10 +213,13 @@ Conv3dArgs ParseConv3dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = Tcl_GetString(objv[i + 1]);
+                args.weightObj = objv[i + 1];
             } else if (param == "-bias") {
                 args.bias = Tcl_GetString(objv[i + 1]);
+                args.biasObj = objv[i + 1];
             } else if (param == "-stride") {
                 args.stride = ParseIntOrList3(interp, objv[i + 1], {1, 1, 1});
             } else if (param == "-padding") {
@@ -241,29 +251,32 @@ int TensorConv3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         Conv3dArgs args = ParseConv3dArgs(interp, objc, objv);
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
         
         // Validate weight tensor
-        if (tensor_storage.find(args.weight) == tensor_storage.end()) {
+        torch::Tensor* weight_tensor = FindTensorFromObj(args.weightObj);
+        if (weight_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid weight tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& weight = tensor_storage[args.weight];
+        auto& input = *input_tensor;
+        auto& weight = *weight_tensor;
         
         // Handle bias
         torch::Tensor bias;
         bool has_bias = false;
         if (!args.bias.empty() && args.bias != "none") {
-            if (tensor_storage.find(args.bias) == tensor_storage.end()) {
+            torch::Tensor* bias_tensor = FindTensorFromObj(args.biasObj);
+            if (bias_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid bias tensor name"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            bias = tensor_storage[args.bias];
+            bias = *bias_tensor;
             has_bias = true;
         }
         
@@ -275,10 +288,9 @@ int TensorConv3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             result = torch::conv3d(input, weight, torch::Tensor(), args.stride, args.padding, args.dilation, args.groups);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -291,6 +303,9 @@ struct ConvTranspose1dArgs {
     std::string input;
     std::string weight;
     std::string bias;  // Optional, can be "none" or empty
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
+    Tcl_Obj* biasObj = nullptr;
     int stride = 1;
     int padding = 0;
     int output_padding = 0;
@@ -312,12 +327,15 @@ ConvTranspose1dArgs ParseConvTranspose1dArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.weight = Tcl_GetString(objv[2]);
+        args.weightObj = objv[2];
         
         if (objc > 3) {
             std::string bias_str = Tcl_GetString(objv[3]);
             if (bias_str != "none" && !bias_str.empty()) {
                 args.bias = bias_str;
+                args.biasObj = objv[3];
             }
         }
         
@@ -362,11 +380,14 @@ ConvTranspose1dArgs ParseConvTranspose1dArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (key == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (key == "-weight") {
                 args.weight = value;
+                args.weightObj = objv[i + 1];
             } else if (key == "-bias") {
                 if (value != "none" && !value.empty()) {
                     args.bias = value;
+                    args.biasObj = objv[i + 1];
                 }
             } else if (key == "-stride") {
                 int val;
@@ -416,29 +437,32 @@ int TensorConvTranspose1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         ConvTranspose1dArgs args = ParseConvTranspose1dArgs(interp, objc, objv);
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Validate weight tensor
-        if (tensor_storage.find(args.weight) == tensor_storage.end()) {
+        torch::Tensor* weight_tensor = FindTensorFromObj(args.weightObj);
+        if (weight_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid weight tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& weight = tensor_storage[args.weight];
+        auto& input = *input_tensor;
+        auto& weight = *weight_tensor;
         
         // Handle bias
         torch::Tensor bias;
         bool has_bias = false;
         if (!args.bias.empty() && args.bias != "none") {
-            if (tensor_storage.find(args.bias) == tensor_storage.end()) {
+            torch::Tensor* bias_tensor = FindTensorFromObj(args.biasObj);
+            if (bias_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid bias tensor name"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            bias = tensor_storage[args.bias];
+            bias = *bias_tensor;
             has_bias = true;
         }
         
@@ -452,10 +476,9 @@ int TensorConvTranspose1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
                                            args.output_padding, args.groups, args.dilation);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -468,6 +491,9 @@ struct ConvTranspose3dArgs {
     std::string input;
     std::string weight;
     std::string bias;  // Optional, can be "none" or empty
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
+    Tcl_Obj* biasObj = nullptr;
     std::vector<int64_t> stride = {1, 1, 1};
     std::vector<int64_t> padding = {0, 0, 0};
     std::vector<int64_t> output_padding = {0, 0, 0};
@@ -489,12 +515,15 @@ ConvTranspose3dArgs ParseConvTranspose3dArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.weight = Tcl_GetString(objv[2]);
+        args.weightObj = objv[2];
         
         if (objc > 3) {
             std::string bias_str = Tcl_GetString(objv[3]);
             if (bias_str != "none" && !bias_str.empty()) {
                 args.bias = bias_str;
+                args.biasObj = objv[3];
             }
         }
         
@@ -530,12 +559,15 @@ ConvTranspose3dArgs ParseConvTranspose3dArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = Tcl_GetString(objv[i + 1]);
+                args.weightObj = objv[i + 1];
             } else if (param == "-bias") {
                 std::string bias_str = Tcl_GetString(objv[i + 1]);
                 if (bias_str != "none" && !bias_str.empty()) {
                     args.bias = bias_str;
+                    args.biasObj = objv[i + 1];
                 }
             } else if (param == "-stride") {
                 args.stride = ParseIntOrList3(interp, objv[i + 1], {1, 1, 1});
@@ -567,29 +599,32 @@ int TensorConvTranspose3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         ConvTranspose3dArgs args = ParseConvTranspose3dArgs(interp, objc, objv);
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Validate weight tensor
-        if (tensor_storage.find(args.weight) == tensor_storage.end()) {
+        torch::Tensor* weight_tensor = FindTensorFromObj(args.weightObj);
+        if (weight_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid weight tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& weight = tensor_storage[args.weight];
+        auto& input = *input_tensor;
+        auto& weight = *weight_tensor;
         
         // Handle bias
         torch::Tensor bias;
         bool has_bias = false;
         if (!args.bias.empty() && args.bias != "none") {
-            if (tensor_storage.find(args.bias) == tensor_storage.end()) {
+            torch::Tensor* bias_tensor = FindTensorFromObj(args.biasObj);
+            if (bias_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid bias tensor name"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            bias = tensor_storage[args.bias];
+            bias = *bias_tensor;
             has_bias = true;
                     }
         
@@ -603,10 +638,9 @@ int TensorConvTranspose3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
                                            args.output_padding, args.groups, args.dilation);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -617,6 +651,7 @@ int TensorConvTranspose3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for unfold command
 struct UnfoldArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dimension;
     int size;
     int step;
@@ -641,6 +676,7 @@ UnfoldArgs ParseUnfoldArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dimension) != TCL_OK) {
             throw std::runtime_error("Invalid dimension parameter: must be an integer");
@@ -662,6 +698,7 @@ UnfoldArgs ParseUnfoldArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dimension) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension parameter: must be an integer");
@@ -692,18 +729,18 @@ int TensorUnfold_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         UnfoldArgs args = ParseUnfoldArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         torch::Tensor result = input.unfold(args.dimension, args.size, args.step);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -715,6 +752,7 @@ int TensorUnfold_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Dual-syntax argument structure & parser
 struct FoldArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> output_size;
     std::vector<int64_t> kernel_size;
     std::vector<int64_t> dilation = {1, 1};
@@ -740,6 +778,7 @@ FoldArgs ParseFoldArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse output_size (list of 2 ints)
         int listLen;
@@ -817,6 +856,7 @@ FoldArgs ParseFoldArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-output_size" || param == "-outputSize") {
                 // Parse output_size
                 int listLen;
@@ -910,12 +950,13 @@ int TensorFold_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         FoldArgs args = ParseFoldArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         torch::Tensor result = torch::nn::functional::fold(input, 
             torch::nn::functional::FoldFuncOptions(args.output_size, args.kernel_size)
@@ -924,10 +965,9 @@ int TensorFold_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         // Preserve the input tensor's options (dtype, device, etc.)
         result = result.to(input.options());
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in fold: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -940,6 +980,9 @@ struct ConvTranspose2dArgs {
     std::string input;
     std::string weight;
     std::string bias;  // Optional, can be "none" or empty
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
+    Tcl_Obj* biasObj = nullptr;
     std::vector<int64_t> stride = {1, 1};
     std::vector<int64_t> padding = {0, 0};
     std::vector<int64_t> output_padding = {0, 0};
@@ -961,12 +1004,15 @@ ConvTranspose2dArgs ParseConvTranspose2dArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.weight = Tcl_GetString(objv[2]);
+        args.weightObj = objv[2];
         
         if (objc > 3) {
             std::string bias_str = Tcl_GetString(objv[3]);
             if (bias_str != "none" && !bias_str.empty()) {
                 args.bias = bias_str;
+                args.biasObj = objv[3];
             }
         }
         
@@ -1002,12 +1048,15 @@ ConvTranspose2dArgs ParseConvTranspose2dArgs(Tcl_Interp* interp, int objc, Tcl_O
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = Tcl_GetString(objv[i + 1]);
+                args.weightObj = objv[i + 1];
             } else if (param == "-bias") {
                 std::string bias_str = Tcl_GetString(objv[i + 1]);
                 if (bias_str != "none" && !bias_str.empty()) {
                     args.bias = bias_str;
+                    args.biasObj = objv[i + 1];
                 }
             } else if (param == "-stride") {
                 args.stride = ParseIntOrList2(interp, objv[i + 1], {1, 1});
@@ -1039,29 +1088,32 @@ int TensorConvTranspose2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         ConvTranspose2dArgs args = ParseConvTranspose2dArgs(interp, objc, objv);
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Validate weight tensor
-        if (tensor_storage.find(args.weight) == tensor_storage.end()) {
+        torch::Tensor* weight_tensor = FindTensorFromObj(args.weightObj);
+        if (weight_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid weight tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& weight = tensor_storage[args.weight];
+        auto& input = *input_tensor;
+        auto& weight = *weight_tensor;
         
         // Handle bias
         torch::Tensor bias;
         bool has_bias = false;
         if (!args.bias.empty() && args.bias != "none") {
-            if (tensor_storage.find(args.bias) == tensor_storage.end()) {
+            torch::Tensor* bias_tensor = FindTensorFromObj(args.biasObj);
+            if (bias_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid bias tensor name"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            bias = tensor_storage[args.bias];
+            bias = *bias_tensor;
             has_bias = true;
         }
         
@@ -1075,10 +1127,9 @@ int TensorConvTranspose2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
                                            args.output_padding, args.groups, args.dilation);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -6,6 +6,8 @@
 struct KLDivLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";  // Default reduction
     bool logTarget = false;          // Default log_target flag
     
@@ -24,7 +26,9 @@ KLDivLossArgs ParseKLDivLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::kl_div_loss input target ?reduction? ?log_target?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.target = Tcl_GetString(objv[2]);
+        args.targetObj = objv[2];
         if (objc > 3) {
             args.reduction = Tcl_GetString(objv[3]);
         }
@@ -46,8 +50,10 @@ KLDivLossArgs ParseKLDivLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = Tcl_GetString(objv[i + 1]);
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = Tcl_GetString(objv[i + 1]);
             } else if (param == "-logTarget") {
@@ -73,6 +79,8 @@ KLDivLossArgs ParseKLDivLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 struct MultilabelMarginLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";  // Default reduction (mean, sum, none)
     
     bool IsValid() const {
@@ -90,7 +98,9 @@ MultilabelMarginLossArgs ParseMultilabelMarginLossArgs(Tcl_Interp* interp, int o
             throw std::runtime_error("Usage: torch::multilabel_margin_loss input target ?reduction?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.target = Tcl_GetString(objv[2]);
+        args.targetObj = objv[2];
         if (objc > 3) {
             // Convert old integer format to string format
             int red_val;
@@ -113,8 +123,10 @@ MultilabelMarginLossArgs ParseMultilabelMarginLossArgs(Tcl_Interp* interp, int o
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = Tcl_GetString(objv[i + 1]);
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = Tcl_GetString(objv[i + 1]);
             } else {
@@ -134,6 +146,8 @@ MultilabelMarginLossArgs ParseMultilabelMarginLossArgs(Tcl_Interp* interp, int o
 struct MultilabelSoftMarginLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";  // Default reduction (mean, sum, none)
     
     bool IsValid() const {
@@ -151,7 +165,9 @@ MultilabelSoftMarginLossArgs ParseMultilabelSoftMarginLossArgs(Tcl_Interp* inter
             throw std::runtime_error("Usage: torch::multilabel_soft_margin_loss input target ?reduction?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.target = Tcl_GetString(objv[2]);
+        args.targetObj = objv[2];
         if (objc > 3) {
             // Convert old integer format to string format
             int red_val;
@@ -174,8 +190,10 @@ MultilabelSoftMarginLossArgs ParseMultilabelSoftMarginLossArgs(Tcl_Interp* inter
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = Tcl_GetString(objv[i + 1]);
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = Tcl_GetString(objv[i + 1]);
             } else {
@@ -196,6 +214,9 @@ struct CosineEmbeddingLossArgs {
     std::string input1;
     std::string input2;
     std::string target;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     double margin = 0.0;
     std::string reduction = "mean";
     
@@ -210,9 +231,18 @@ CosineEmbeddingLossArgs ParseCosineEmbeddingLossArgs(Tcl_Interp* interp, int obj
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input1 = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.input2 = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.target = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.input1 = Tcl_GetString(objv[1]);
+            args.input1Obj = objv[1];
+        }
+        if (objc >= 3) {
+            args.input2 = Tcl_GetString(objv[2]);
+            args.input2Obj = objv[2];
+        }
+        if (objc >= 4) {
+            args.target = Tcl_GetString(objv[3]);
+            args.targetObj = objv[3];
+        }
         if (objc >= 5) {
             if (Tcl_GetDoubleFromObj(interp, objv[4], &args.margin) != TCL_OK) {
                 throw std::runtime_error("Invalid margin value");
@@ -239,10 +269,13 @@ CosineEmbeddingLossArgs ParseCosineEmbeddingLossArgs(Tcl_Interp* interp, int obj
             
             if (param == "-input1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-margin") {
                 args.margin = std::stod(value);
             } else if (param == "-reduction") {
@@ -264,6 +297,8 @@ CosineEmbeddingLossArgs ParseCosineEmbeddingLossArgs(Tcl_Interp* interp, int obj
 struct DiceLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     double smooth = 1.0;
     std::string reduction = "mean";
     
@@ -278,8 +313,14 @@ DiceLossArgs ParseDiceLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             if (Tcl_GetDoubleFromObj(interp, objv[3], &args.smooth) != TCL_OK) {
                 throw std::runtime_error("Invalid smooth parameter");
@@ -310,8 +351,10 @@ DiceLossArgs ParseDiceLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-smooth") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.smooth) != TCL_OK) {
                     throw std::runtime_error("Invalid smooth parameter value");
@@ -335,6 +378,8 @@ DiceLossArgs ParseDiceLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 struct FocalLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     double alpha = 1.0;
     double gamma = 2.0;
     std::string reduction = "mean";
@@ -350,8 +395,14 @@ FocalLossArgs ParseFocalLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             if (Tcl_GetDoubleFromObj(interp, objv[3], &args.alpha) != TCL_OK) {
                 throw std::runtime_error("Invalid alpha parameter");
@@ -387,8 +438,10 @@ FocalLossArgs ParseFocalLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-alpha") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.alpha) != TCL_OK) {
                     throw std::runtime_error("Invalid alpha parameter value");
@@ -417,6 +470,9 @@ struct GaussianNLLLossArgs {
     std::string input;
     std::string target;
     std::string var;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
+    Tcl_Obj* varObj = nullptr;
     bool full = false;
     double eps = 1e-6;
     std::string reduction = "mean";
@@ -432,9 +488,18 @@ GaussianNLLLossArgs ParseGaussianNLLLossArgs(Tcl_Interp* interp, int objc, Tcl_O
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.var = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
+        if (objc >= 4) {
+            args.var = Tcl_GetString(objv[3]);
+            args.varObj = objv[3];
+        }
         if (objc >= 5) {
             int full_val;
             if (Tcl_GetIntFromObj(interp, objv[4], &full_val) != TCL_OK) {
@@ -472,10 +537,13 @@ GaussianNLLLossArgs ParseGaussianNLLLossArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-var") {
                 args.var = value;
+                args.varObj = objv[i + 1];
             } else if (param == "-full") {
                 int full_val;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &full_val) != TCL_OK) {
@@ -505,6 +573,8 @@ GaussianNLLLossArgs ParseGaussianNLLLossArgs(Tcl_Interp* interp, int objc, Tcl_O
 struct L1LossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";
     
     bool IsValid() const {
@@ -518,8 +588,14 @@ L1LossArgs ParseL1LossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             // Convert integer reduction to string for consistency
             int red_val;
@@ -544,8 +620,10 @@ L1LossArgs ParseL1LossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else {
@@ -572,17 +650,19 @@ int TensorL1Loss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         L1LossArgs args = ParseL1LossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Convert reduction string to integer for PyTorch API
         int64_t reduction = 1; // mean (default)
@@ -592,10 +672,9 @@ int TensorL1Loss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         
         torch::Tensor result = torch::l1_loss(input, target, reduction);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -607,6 +686,8 @@ int TensorL1Loss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 struct SmoothL1LossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";
     double beta = 1.0;
     
@@ -621,8 +702,14 @@ SmoothL1LossArgs ParseSmoothL1LossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             int red_val;
             if (Tcl_GetIntFromObj(interp, objv[3], &red_val) != TCL_OK) {
@@ -653,8 +740,10 @@ SmoothL1LossArgs ParseSmoothL1LossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else if (param == "-beta") {
@@ -685,17 +774,19 @@ int TensorSmoothL1Loss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
     try {
         SmoothL1LossArgs args = ParseSmoothL1LossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Convert reduction string to integer for PyTorch API
         int64_t reduction = 1; // mean (default)
@@ -705,10 +796,9 @@ int TensorSmoothL1Loss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         
         torch::Tensor result = torch::smooth_l1_loss(input, target, reduction, args.beta);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -720,6 +810,8 @@ int TensorSmoothL1Loss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
 struct HuberLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";
     double delta = 1.0;
     
@@ -734,8 +826,14 @@ HuberLossArgs ParseHuberLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             // Handle both string and integer reduction for backward compatibility
             const char* reduction_str = Tcl_GetString(objv[3]);
@@ -767,8 +865,10 @@ HuberLossArgs ParseHuberLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else if (param == "-delta") {
@@ -797,17 +897,19 @@ int TensorHuberLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         HuberLossArgs args = ParseHuberLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Convert string reduction to integer for PyTorch
         int64_t reduction = 1; // mean (default)
@@ -821,10 +923,9 @@ int TensorHuberLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         
         torch::Tensor result = torch::huber_loss(input, target, reduction, args.delta);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -844,17 +945,19 @@ int TensorKLDivLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         // Validate tensor existence
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Convert reduction string to integer
         int64_t reduction = 1; // mean (default)
@@ -865,10 +968,9 @@ int TensorKLDivLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Compute KL divergence loss
         torch::Tensor result = torch::kl_div(input, target, reduction, args.logTarget);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -887,22 +989,25 @@ int TensorCosineEmbeddingLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
     try {
         CosineEmbeddingLossArgs args = ParseCosineEmbeddingLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1_tensor = FindTensorFromObj(args.input1Obj);
+        if (input1_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input1 tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2_tensor = FindTensorFromObj(args.input2Obj);
+        if (input2_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input2 tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input1 = tensor_storage[args.input1];
-        auto& input2 = tensor_storage[args.input2];
-        auto& target = tensor_storage[args.target];
+        auto& input1 = *input1_tensor;
+        auto& input2 = *input2_tensor;
+        auto& target = *target_tensor;
         
         // Convert reduction string to integer
         int64_t reduction = 1; // mean (default)
@@ -912,10 +1017,9 @@ int TensorCosineEmbeddingLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
         
         torch::Tensor result = torch::cosine_embedding_loss(input1, input2, target, args.margin, reduction);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -928,6 +1032,9 @@ struct MarginRankingLossArgs {
     std::string input1;
     std::string input2;
     std::string target;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     double margin = 0.0;
     std::string reduction = "mean";
     
@@ -942,9 +1049,18 @@ MarginRankingLossArgs ParseMarginRankingLossArgs(Tcl_Interp* interp, int objc, T
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input1 = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.input2 = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.target = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.input1 = Tcl_GetString(objv[1]);
+            args.input1Obj = objv[1];
+        }
+        if (objc >= 3) {
+            args.input2 = Tcl_GetString(objv[2]);
+            args.input2Obj = objv[2];
+        }
+        if (objc >= 4) {
+            args.target = Tcl_GetString(objv[3]);
+            args.targetObj = objv[3];
+        }
         if (objc >= 5) {
             double margin_val;
             if (Tcl_GetDoubleFromObj(interp, objv[4], &margin_val) == TCL_OK) {
@@ -976,10 +1092,13 @@ MarginRankingLossArgs ParseMarginRankingLossArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-input1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-margin") {
                 args.margin = std::stod(value);
             } else if (param == "-reduction") {
@@ -1008,22 +1127,25 @@ int TensorMarginRankingLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
     try {
         MarginRankingLossArgs args = ParseMarginRankingLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1_tensor = FindTensorFromObj(args.input1Obj);
+        if (input1_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input1 tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2_tensor = FindTensorFromObj(args.input2Obj);
+        if (input2_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input2 tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input1 = tensor_storage[args.input1];
-        auto& input2 = tensor_storage[args.input2];
-        auto& target = tensor_storage[args.target];
+        auto& input1 = *input1_tensor;
+        auto& input2 = *input2_tensor;
+        auto& target = *target_tensor;
         
         // Convert string reduction to integer for PyTorch
         int64_t reduction = 1; // mean (default)
@@ -1037,10 +1159,9 @@ int TensorMarginRankingLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
         
         torch::Tensor result = torch::margin_ranking_loss(input1, input2, target, args.margin, reduction);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1053,6 +1174,9 @@ struct TripletMarginLossArgs {
     std::string anchor;
     std::string positive;
     std::string negative;
+    Tcl_Obj* anchorObj = nullptr;
+    Tcl_Obj* positiveObj = nullptr;
+    Tcl_Obj* negativeObj = nullptr;
     double margin = 1.0;
     double p = 2.0;
     std::string reduction = "mean";
@@ -1068,9 +1192,18 @@ TripletMarginLossArgs ParseTripletMarginLossArgs(Tcl_Interp* interp, int objc, T
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.anchor = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.positive = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.negative = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.anchor = Tcl_GetString(objv[1]);
+            args.anchorObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.positive = Tcl_GetString(objv[2]);
+            args.positiveObj = objv[2];
+        }
+        if (objc >= 4) {
+            args.negative = Tcl_GetString(objv[3]);
+            args.negativeObj = objv[3];
+        }
         if (objc >= 5) {
             double margin_val;
             if (Tcl_GetDoubleFromObj(interp, objv[4], &margin_val) == TCL_OK) {
@@ -1107,10 +1240,13 @@ TripletMarginLossArgs ParseTripletMarginLossArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-anchor") {
                 args.anchor = value;
+                args.anchorObj = objv[i + 1];
             } else if (param == "-positive") {
                 args.positive = value;
+                args.positiveObj = objv[i + 1];
             } else if (param == "-negative") {
                 args.negative = value;
+                args.negativeObj = objv[i + 1];
             } else if (param == "-margin") {
                 args.margin = std::stod(value);
             } else if (param == "-p") {
@@ -1141,22 +1277,25 @@ int TensorTripletMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
     try {
         TripletMarginLossArgs args = ParseTripletMarginLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.anchor) == tensor_storage.end()) {
+        torch::Tensor* anchor_tensor = FindTensorFromObj(args.anchorObj);
+        if (anchor_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid anchor tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.positive) == tensor_storage.end()) {
+        torch::Tensor* positive_tensor = FindTensorFromObj(args.positiveObj);
+        if (positive_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid positive tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.negative) == tensor_storage.end()) {
+        torch::Tensor* negative_tensor = FindTensorFromObj(args.negativeObj);
+        if (negative_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid negative tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& anchor = tensor_storage[args.anchor];
-        auto& positive = tensor_storage[args.positive];
-        auto& negative = tensor_storage[args.negative];
+        auto& anchor = *anchor_tensor;
+        auto& positive = *positive_tensor;
+        auto& negative = *negative_tensor;
         
         // Convert string reduction to integer for PyTorch
         int64_t reduction = 1; // mean (default)
@@ -1170,10 +1309,9 @@ int TensorTripletMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
         
         torch::Tensor result = torch::triplet_margin_loss(anchor, positive, negative, args.margin, args.p, 1e-6, false, reduction);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1185,6 +1323,8 @@ int TensorTripletMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
 struct HingeEmbeddingLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     double margin = 1.0;
     std::string reduction = "mean";
     
@@ -1199,8 +1339,14 @@ HingeEmbeddingLossArgs ParseHingeEmbeddingLossArgs(Tcl_Interp* interp, int objc,
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             double margin_val;
             if (Tcl_GetDoubleFromObj(interp, objv[3], &margin_val) == TCL_OK) {
@@ -1232,8 +1378,10 @@ HingeEmbeddingLossArgs ParseHingeEmbeddingLossArgs(Tcl_Interp* interp, int objc,
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-margin") {
                 args.margin = std::stod(value);
             } else if (param == "-reduction") {
@@ -1262,17 +1410,19 @@ int TensorHingeEmbeddingLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_O
     try {
         HingeEmbeddingLossArgs args = ParseHingeEmbeddingLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Convert string reduction to integer for PyTorch
         int64_t reduction = 1; // mean (default)
@@ -1286,10 +1436,9 @@ int TensorHingeEmbeddingLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_O
         
         torch::Tensor result = torch::hinge_embedding_loss(input, target, args.margin, reduction);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1301,6 +1450,8 @@ int TensorHingeEmbeddingLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_O
 struct PoissonNLLLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     bool logInput = true;
     bool full = false;
     std::string reduction = "mean";
@@ -1316,8 +1467,14 @@ PoissonNLLLossArgs ParsePoissonNLLLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             int log_val;
             if (Tcl_GetIntFromObj(interp, objv[3], &log_val) != TCL_OK) {
@@ -1357,8 +1514,10 @@ PoissonNLLLossArgs ParsePoissonNLLLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-logInput") {
                 int log_val;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &log_val) != TCL_OK) {
@@ -1397,17 +1556,19 @@ int TensorPoissonNLLLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         PoissonNLLLossArgs args = ParsePoissonNLLLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Convert reduction string to integer for PyTorch API
         int64_t reduction = 1; // mean (default)
@@ -1417,10 +1578,9 @@ int TensorPoissonNLLLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         
         torch::Tensor result = torch::poisson_nll_loss(input, target, args.logInput, args.full, 1e-8, reduction);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1439,22 +1599,25 @@ int TensorGaussianNLLLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         GaussianNLLLossArgs args = ParseGaussianNLLLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.var) == tensor_storage.end()) {
+        torch::Tensor* var_tensor = FindTensorFromObj(args.varObj);
+        if (var_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid var tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
-        auto& var = tensor_storage[args.var];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
+        auto& var = *var_tensor;
         
         // Manual implementation of Gaussian NLL loss
         torch::Tensor diff = input - target;
@@ -1479,10 +1642,9 @@ int TensorGaussianNLLLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Invalid reduction type: " + args.reduction);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1501,17 +1663,19 @@ int TensorFocalLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         FocalLossArgs args = ParseFocalLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Manual implementation of Focal Loss: -alpha * (1-p)^gamma * log(p)
         // First apply softmax to get probabilities
@@ -1543,10 +1707,9 @@ int TensorFocalLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Invalid reduction type: " + args.reduction);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1565,17 +1728,19 @@ int TensorDiceLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         DiceLossArgs args = ParseDiceLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Apply sigmoid to input to get probabilities
         torch::Tensor probs = torch::sigmoid(input);
@@ -1603,10 +1768,9 @@ int TensorDiceLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Invalid reduction type: " + args.reduction);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1618,6 +1782,8 @@ int TensorDiceLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct TverskyLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     double alpha = 0.7;         // Weight for false positives
     double beta = 0.3;          // Weight for false negatives
     double smooth = 1.0;
@@ -1634,8 +1800,14 @@ TverskyLossArgs ParseTverskyLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             double alpha_val;
             if (Tcl_GetDoubleFromObj(interp, objv[3], &alpha_val) == TCL_OK) {
@@ -1678,8 +1850,10 @@ TverskyLossArgs ParseTverskyLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-alpha") {
                 args.alpha = std::stod(value);
             } else if (param == "-beta") {
@@ -1712,17 +1886,19 @@ int TensorTverskyLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
     try {
         TverskyLossArgs args = ParseTverskyLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Apply sigmoid to input to get probabilities
         torch::Tensor probs = torch::sigmoid(input);
@@ -1751,10 +1927,9 @@ int TensorTverskyLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
             result = tversky_loss;
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1767,6 +1942,9 @@ struct TripletMarginWithDistanceLossArgs {
     std::string anchor;
     std::string positive;
     std::string negative;
+    Tcl_Obj* anchorObj = nullptr;
+    Tcl_Obj* positiveObj = nullptr;
+    Tcl_Obj* negativeObj = nullptr;
     std::string distanceFunction = "euclidean";
     double margin = 1.0;
     std::string reduction = "mean";
@@ -1782,9 +1960,18 @@ TripletMarginWithDistanceLossArgs ParseTripletMarginWithDistanceLossArgs(Tcl_Int
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.anchor = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.positive = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.negative = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.anchor = Tcl_GetString(objv[1]);
+            args.anchorObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.positive = Tcl_GetString(objv[2]);
+            args.positiveObj = objv[2];
+        }
+        if (objc >= 4) {
+            args.negative = Tcl_GetString(objv[3]);
+            args.negativeObj = objv[3];
+        }
         if (objc >= 5) {
             int distance_func;
             if (Tcl_GetIntFromObj(interp, objv[4], &distance_func) == TCL_OK) {
@@ -1827,10 +2014,13 @@ TripletMarginWithDistanceLossArgs ParseTripletMarginWithDistanceLossArgs(Tcl_Int
             
             if (param == "-anchor") {
                 args.anchor = value;
+                args.anchorObj = objv[i + 1];
             } else if (param == "-positive") {
                 args.positive = value;
+                args.positiveObj = objv[i + 1];
             } else if (param == "-negative") {
                 args.negative = value;
+                args.negativeObj = objv[i + 1];
             } else if (param == "-distanceFunction") {
                 args.distanceFunction = value;
             } else if (param == "-margin") {
@@ -1861,22 +2051,25 @@ int TensorTripletMarginWithDistanceLoss_Cmd(ClientData, Tcl_Interp* interp, int
     try {
         TripletMarginWithDistanceLossArgs args = ParseTripletMarginWithDistanceLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.anchor) == tensor_storage.end()) {
+        torch::Tensor* anchor_tensor = FindTensorFromObj(args.anchorObj);
+        if (anchor_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid anchor tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.positive) == tensor_storage.end()) {
+        torch::Tensor* positive_tensor = FindTensorFromObj(args.positiveObj);
+        if (positive_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid positive tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.negative) == tensor_storage.end()) {
+        torch::Tensor* negative_tensor = FindTensorFromObj(args.negativeObj);
+        if (negative_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid negative tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& anchor = tensor_storage[args.anchor];
-        auto& positive = tensor_storage[args.positive];
-        auto& negative = tensor_storage[args.negative];
+        auto& anchor = *anchor_tensor;
+        auto& positive = *positive_tensor;
+        auto& negative = *negative_tensor;
         
         // Compute distances based on distance function
         torch::Tensor pos_dist, neg_dist;
@@ -1903,10 +2096,9 @@ int TensorTripletMarginWithDistanceLoss_Cmd(ClientData, Tcl_Interp* interp, int
             result = torch::sum(loss);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1918,6 +2110,8 @@ int TensorTripletMarginWithDistanceLoss_Cmd(ClientData, Tcl_Interp* interp, int
 struct MultiMarginLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     int p = 1;                      // Norm degree (default 1)
     double margin = 1.0;            // Margin value (default 1.0)
     std::string reduction = "mean"; // Default reduction
@@ -1939,7 +2133,9 @@ MultiMarginLossArgs ParseMultiMarginLossArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.target = Tcl_GetString(objv[2]);
+        args.targetObj = objv[2];
         
         if (objc > 3) {
             int p_val;
@@ -1979,8 +2175,10 @@ MultiMarginLossArgs ParseMultiMarginLossArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-p") {
                 try {
                     args.p = std::stoi(value);
@@ -2024,17 +2222,19 @@ int TensorMultiMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         // Validate tensor existence
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Convert reduction string to PyTorch reduction enum
         torch::Tensor result;
@@ -2058,10 +2258,9 @@ int TensorMultiMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
                     .reduction(torch::kSum));
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -2080,17 +2279,19 @@ int TensorMultilabelMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl
     try {
         MultilabelMarginLossArgs args = ParseMultilabelMarginLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         torch::Tensor result;
         if (args.reduction == "none") {
@@ -2101,10 +2302,9 @@ int TensorMultilabelMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl
             result = torch::nn::functional::multilabel_margin_loss(input, target, torch::nn::functional::MultilabelMarginLossFuncOptions().reduction(torch::kSum));
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -2123,17 +2323,19 @@ int TensorMultilabelSoftMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc,
     try {
         MultilabelSoftMarginLossArgs args = ParseMultilabelSoftMarginLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         torch::Tensor result;
         if (args.reduction == "none") {
@@ -2144,10 +2346,9 @@ int TensorMultilabelSoftMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc,
             result = torch::nn::functional::multilabel_soft_margin_loss(input, target, torch::nn::functional::MultilabelSoftMarginLossFuncOptions().reduction(torch::kSum));
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -2159,6 +2360,8 @@ int TensorMultilabelSoftMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc,
 struct SoftMarginLossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";
     
     bool IsValid() const {
@@ -2172,8 +2375,14 @@ SoftMarginLossArgs ParseSoftMarginLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) {
             int red_val;
             if (Tcl_GetIntFromObj(interp, objv[3], &red_val) != TCL_OK) {
@@ -2199,8 +2408,10 @@ SoftMarginLossArgs ParseSoftMarginLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else {
@@ -2227,17 +2438,19 @@ int TensorSoftMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         SoftMarginLossArgs args = ParseSoftMarginLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         torch::Tensor result;
         if (args.reduction == "none") {
@@ -2248,10 +2461,9 @@ int TensorSoftMarginLoss_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
             result = torch::nn::functional::soft_margin_loss(input, target, torch::nn::functional::SoftMarginLossFuncOptions().reduction(torch::kSum));
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
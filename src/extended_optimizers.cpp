@@ -2,11 +2,12 @@
 #include <torch/optim.h>
 
 // External global storage for learning rate schedulers (defined elsewhere)
-extern std::unordered_map<std::string, std::shared_ptr<void>> scheduler_storage;
+extern thread_local std::unordered_map<std::string, std::shared_ptr<void>> scheduler_storage;
 
 // Parameter structure for torch::optimizer_lbfgs
 struct OptimizerLBFGSArgs {
     std::string parameters;  // parameter list (list of tensor names)
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 1.0;         // learning rate (LBFGS specific default)
     int maxIter = 20;        // maximum number of iterations
     int maxEval = 25;        // maximum number of function evaluations
@@ -30,6 +31,7 @@ OptimizerLBFGSArgs ParseOptimizerLBFGSArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) {
@@ -71,6 +73,7 @@ OptimizerLBFGSArgs ParseOptimizerLBFGSArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-parameters" || param == "-params") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
             } else if (param == "-lr" || param == "-learningRate") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lr) != TCL_OK) {
                     throw std::runtime_error("Invalid learning rate");
@@ -122,21 +125,22 @@ int OptimizerLBFGS_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.push_back(*elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
             // Single tensor handle or module handle (backward compatibility)
-            if (tensor_storage.find(args.parameters) != tensor_storage.end()) {
-                parameters.push_back(tensor_storage[args.parameters]);
-            } else if (module_storage.find(args.parameters) != module_storage.end()) {
+            if (FindTensorFromObj(args.parametersObj) != nullptr) {
+                parameters.push_back(*FindTensorFromObj(args.parametersObj));
+            } else if (FindModuleFromObj(args.parametersObj) != nullptr) {
                 // Module handle (backward compatibility)
-                auto module = module_storage[args.parameters];
+                auto module = *FindModuleFromObj(args.parametersObj);
                 for (auto& param : module->parameters()) {
                     parameters.push_back(param);
                 }
@@ -158,7 +162,7 @@ int OptimizerLBFGS_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -169,6 +173,7 @@ int OptimizerLBFGS_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for torch::optimizer_rprop
 struct OptimizerRpropArgs {
     std::string parameters;  // parameter list (list of tensor names)
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 0.01;        // learning rate (default: 0.01)
     std::pair<double, double> etas = {0.5, 1.2};  // eta minus and eta plus values
     std::pair<double, double> stepSizes = {1e-6, 50.0};  // min and max step sizes
@@ -192,6 +197,7 @@ OptimizerRpropArgs ParseOptimizerRpropArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) {
@@ -243,6 +249,7 @@ OptimizerRpropArgs ParseOptimizerRpropArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-parameters" || param == "-params") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
             } else if (param == "-lr" || param == "-learningRate") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lr) != TCL_OK) {
                     throw std::runtime_error("Invalid learning rate");
@@ -297,9 +304,9 @@ int OptimizerRprop_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         
         std::vector<torch::Tensor> parameters;
         
-        if (module_storage.find(args.parameters) != module_storage.end()) {
+        if (FindModuleFromObj(args.parametersObj) != nullptr) {
             // Module handle
-            auto module = module_storage[args.parameters];
+            auto module = *FindModuleFromObj(args.parametersObj);
             for (auto& param : module->parameters()) {
                 parameters.push_back(param);
             }
@@ -312,11 +319,12 @@ int OptimizerRprop_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
                     Tcl_Obj* param_obj;
                     Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
                     std::string name = Tcl_GetString(param_obj);
-                    if (tensor_storage.find(name) == tensor_storage.end()) {
+                    torch::Tensor* param_obj_tensor = FindTensorFromObj(param_obj);
+                    if (param_obj_tensor == nullptr) {
                         Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + name).c_str()), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                    parameters.push_back(tensor_storage[name]);
+                    parameters.push_back(*param_obj_tensor);
                 }
             } else {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid parameters handle"), TCL_VOLATILE);
@@ -333,7 +341,7 @@ int OptimizerRprop_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -344,6 +352,7 @@ int OptimizerRprop_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for torch::optimizer_adamax
 struct OptimizerAdamaxArgs {
     std::string parameters;  // parameter list (list of tensor names)
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 0.002;       // learning rate (default for Adamax)
     double beta1 = 0.9;      // first moment decay rate
     double beta2 = 0.999;    // second moment decay rate
@@ -367,6 +376,7 @@ OptimizerAdamaxArgs ParseOptimizerAdamaxArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) {
@@ -411,6 +421,7 @@ OptimizerAdamaxArgs ParseOptimizerAdamaxArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-parameters" || param == "-params") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
             } else if (param == "-lr" || param == "-learningRate") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lr) != TCL_OK) {
                     throw std::runtime_error("Invalid learning rate");
@@ -473,21 +484,23 @@ int OptimizerAdamax_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.push_back(*elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
             // Single tensor handle
-            if (tensor_storage.find(args.parameters) == tensor_storage.end()) {
+            torch::Tensor* parameters_tensor = FindTensorFromObj(args.parametersObj);
+            if (parameters_tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid parameters handle"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            parameters.push_back(tensor_storage[args.parameters]);
+            parameters.push_back(*parameters_tensor);
         }
 
         // Construct options (using AdamOptions as placeholder)
@@ -499,7 +512,7 @@ int OptimizerAdamax_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         auto optimizer = std::make_shared<torch::optim::Adam>(parameters, opts);
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -510,6 +523,7 @@ int OptimizerAdamax_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameters for torch::lr_scheduler_lambda
 struct LRSchedulerLambdaArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     double multiplier = 1.0;  // Optional, default 1.0
     
     bool IsValid() const {
@@ -528,6 +542,7 @@ LRSchedulerLambdaArgs ParseLRSchedulerLambdaArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.multiplier) != TCL_OK) {
@@ -545,6 +560,7 @@ LRSchedulerLambdaArgs ParseLRSchedulerLambdaArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-multiplier" || param == "-lambda") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.multiplier) != TCL_OK) {
                     throw std::runtime_error("Invalid multiplier value");
@@ -567,7 +583,7 @@ int LRSchedulerLambda_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
     try {
         auto args = ParseLRSchedulerLambdaArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -589,6 +605,7 @@ int LRSchedulerLambda_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
 // Parameters for torch::lr_scheduler_exponential_decay
 struct LRSchedulerExponentialDecayArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     double gamma = 0.95;
     
     bool IsValid() const {
@@ -607,6 +624,7 @@ LRSchedulerExponentialDecayArgs ParseLRSchedulerExponentialDecayArgs(Tcl_Interp*
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.gamma) != TCL_OK) {
             throw std::runtime_error("Invalid gamma value");
@@ -622,6 +640,7 @@ LRSchedulerExponentialDecayArgs ParseLRSchedulerExponentialDecayArgs(Tcl_Interp*
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-gamma") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.gamma) != TCL_OK) {
                     throw std::runtime_error("Invalid gamma value");
@@ -644,7 +663,7 @@ int LRSchedulerExponentialDecay_Cmd(ClientData, Tcl_Interp* interp, int objc, Tc
     try {
         auto args = ParseLRSchedulerExponentialDecayArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -666,6 +685,7 @@ int LRSchedulerExponentialDecay_Cmd(ClientData, Tcl_Interp* interp, int objc, Tc
 // Parameters for torch::lr_scheduler_cyclic
 struct LRSchedulerCyclicArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     double baseLr = -1.0;  // Required parameter, -1 indicates not set
     double maxLr = -1.0;   // Required parameter, -1 indicates not set  
     int stepSize = 2000;   // Optional, default 2000
@@ -687,6 +707,7 @@ LRSchedulerCyclicArgs ParseLRSchedulerCyclicArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.baseLr) != TCL_OK) {
             throw std::runtime_error("Invalid base_lr value");
@@ -716,6 +737,7 @@ LRSchedulerCyclicArgs ParseLRSchedulerCyclicArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-baseLr" || param == "-base_lr") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.baseLr) != TCL_OK) {
                     throw std::runtime_error("Invalid baseLr value");
@@ -748,7 +770,7 @@ int LRSchedulerCyclic_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
     try {
         auto args = ParseLRSchedulerCyclicArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -797,7 +819,7 @@ int LRSchedulerOneCycle_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
     try {
         std::string optimizer_handle = Tcl_GetString(objv[1]);
         
-        if (optimizer_storage.find(optimizer_handle) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(objv[1]) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -861,6 +883,7 @@ int LRSchedulerOneCycle_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
 // Parameters for torch::lr_scheduler_reduce_on_plateau
 struct LRSchedulerReduceOnPlateauArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     std::string mode = "min";  // Optional, default "min"
     double factor = 0.1;  // Optional, default 0.1
     int patience = 10;  // Optional, default 10
@@ -887,6 +910,7 @@ LRSchedulerReduceOnPlateauArgs ParseLRSchedulerReduceOnPlateauArgs(Tcl_Interp* i
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (objc > 2) {
             args.mode = Tcl_GetString(objv[2]);
@@ -930,6 +954,7 @@ LRSchedulerReduceOnPlateauArgs ParseLRSchedulerReduceOnPlateauArgs(Tcl_Interp* i
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-mode") {
                 args.mode = Tcl_GetString(objv[i + 1]);
             } else if (param == "-factor") {
@@ -968,7 +993,7 @@ int LRSchedulerReduceOnPlateau_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl
     try {
         auto args = ParseLRSchedulerReduceOnPlateauArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -1155,6 +1180,7 @@ int GetLRAdvanced_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for torch::optimizer_sparse_adam
 struct OptimizerSparseAdamArgs {
     std::string parameters;  // parameter list (list of tensor names or module handle)
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 0.001;       // learning rate (default: 0.001)
     double beta1 = 0.9;      // first moment decay rate (default: 0.9)
     double beta2 = 0.999;    // second moment decay rate (default: 0.999)
@@ -1183,6 +1209,7 @@ OptimizerSparseAdamArgs ParseOptimizerSparseAdamArgs(Tcl_Interp* interp, int obj
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) {
@@ -1226,6 +1253,7 @@ OptimizerSparseAdamArgs ParseOptimizerSparseAdamArgs(Tcl_Interp* interp, int obj
             
             if (param == "-parameters") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
                 parameters_set = true;
             } else if (param == "-lr") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lr) != TCL_OK) {
@@ -1283,21 +1311,22 @@ int OptimizerSparseAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.push_back(*elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
             // Single tensor handle or module handle (backward compatibility)
-            if (tensor_storage.find(args.parameters) != tensor_storage.end()) {
-                parameters.push_back(tensor_storage[args.parameters]);
-            } else if (module_storage.find(args.parameters) != module_storage.end()) {
+            if (FindTensorFromObj(args.parametersObj) != nullptr) {
+                parameters.push_back(*FindTensorFromObj(args.parametersObj));
+            } else if (FindModuleFromObj(args.parametersObj) != nullptr) {
                 // Module handle (backward compatibility)
-                auto module = module_storage[args.parameters];
+                auto module = *FindModuleFromObj(args.parametersObj);
                 for (auto& param : module->parameters()) {
                     parameters.push_back(param);
                 }
@@ -1318,7 +1347,7 @@ int OptimizerSparseAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1329,6 +1358,7 @@ int OptimizerSparseAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
 // Parameter structure for torch::optimizer_nadam
 struct OptimizerNAdamArgs {
     std::string parameters;  // parameter list (list of tensor names)
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 0.002;       // learning rate (NAdam specific default)
     double beta1 = 0.9;      // first moment decay rate
     double beta2 = 0.999;    // second moment decay rate
@@ -1354,6 +1384,7 @@ OptimizerNAdamArgs ParseOptimizerNAdamArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) {
@@ -1404,6 +1435,7 @@ OptimizerNAdamArgs ParseOptimizerNAdamArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-parameters" || param == "-params") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
             } else if (param == "-lr" || param == "-learningRate") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lr) != TCL_OK) {
                     throw std::runtime_error("Invalid learning rate");
@@ -1472,21 +1504,22 @@ int OptimizerNAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.push_back(*elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
             // Single tensor handle or module handle (backward compatibility)
-            if (tensor_storage.find(args.parameters) != tensor_storage.end()) {
-                parameters.push_back(tensor_storage[args.parameters]);
-            } else if (module_storage.find(args.parameters) != module_storage.end()) {
+            if (FindTensorFromObj(args.parametersObj) != nullptr) {
+                parameters.push_back(*FindTensorFromObj(args.parametersObj));
+            } else if (FindModuleFromObj(args.parametersObj) != nullptr) {
                 // Module handle (backward compatibility)
-                auto module = module_storage[args.parameters];
+                auto module = *FindModuleFromObj(args.parametersObj);
                 for (auto& param : module->parameters()) {
                     parameters.push_back(param);
                 }
@@ -1512,7 +1545,7 @@ int OptimizerNAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1523,6 +1556,7 @@ int OptimizerNAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for torch::optimizer_radam
 struct OptimizerRAdamArgs {
     std::string parameters;
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 0.001;
     double beta1 = 0.9;
     double beta2 = 0.999;
@@ -1542,6 +1576,7 @@ static OptimizerRAdamArgs ParseOptimizerRAdamArgs(Tcl_Interp* interp, int objc,
             throw std::runtime_error("Usage: torch::optimizer_radam parameters ?lr? ?betas? ?eps? ?weight_decay?");
         }
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         if (objc > 2 && Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) throw std::runtime_error("Invalid lr");
         if (objc > 3) {
             int len; Tcl_Obj** listObj;
@@ -1556,7 +1591,10 @@ static OptimizerRAdamArgs ParseOptimizerRAdamArgs(Tcl_Interp* interp, int objc,
             if (i+1>=objc) throw std::runtime_error("Named parameters must come in pairs");
             std::string param = Tcl_GetString(objv[i]);
             Tcl_Obj* val = objv[i+1];
-            if (param=="-parameters"||param=="-params") args.parameters=Tcl_GetString(val);
+            if (param=="-parameters"||param=="-params") {
+                args.parameters=Tcl_GetString(val);
+                args.parametersObj = val;
+            }
             else if (param=="-lr"||param=="-learningRate") { if (Tcl_GetDoubleFromObj(interp,val,&args.lr)!=TCL_OK) throw std::runtime_error("Invalid lr"); }
             else if (param=="-beta1") { if (Tcl_GetDoubleFromObj(interp,val,&args.beta1)!=TCL_OK) throw std::runtime_error("Invalid beta1"); }
             else if (param=="-beta2") { if (Tcl_GetDoubleFromObj(interp,val,&args.beta2)!=TCL_OK) throw std::runtime_error("Invalid beta2"); }
@@ -1589,21 +1627,22 @@ int OptimizerRAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.push_back(*elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
             // Single tensor handle or module handle (backward compatibility)
-            if (tensor_storage.find(args.parameters) != tensor_storage.end()) {
-                parameters.push_back(tensor_storage[args.parameters]);
-            } else if (module_storage.find(args.parameters) != module_storage.end()) {
+            if (FindTensorFromObj(args.parametersObj) != nullptr) {
+                parameters.push_back(*FindTensorFromObj(args.parametersObj));
+            } else if (FindModuleFromObj(args.parametersObj) != nullptr) {
                 // Module handle (backward compatibility)
-                auto module = module_storage[args.parameters];
+                auto module = *FindModuleFromObj(args.parametersObj);
                 for (auto& param : module->parameters()) {
                     parameters.push_back(param);
                 }
@@ -1624,7 +1663,7 @@ int OptimizerRAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1632,15 +1671,224 @@ int OptimizerRAdam_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     }
 }
 
+// ============================================================================
+// Adafactor (Shazeer & Stern, 2018)
+// ============================================================================
+
+// Options of one parameter group. lr 0 selects relative step sizing,
+// min(1e-2, 1/sqrt(step)); scale_parameter multiplies the step by the RMS of
+// the parameter. beta1 < 0 keeps no first moment.
+struct AdafactorOptions : public torch::optim::OptimizerCloneableOptions<AdafactorOptions> {
+    AdafactorOptions(double lr = 0.0) : lr_(lr) {}
+    TORCH_ARG(double, lr);
+    TORCH_ARG(double, eps) = 1e-30;
+    TORCH_ARG(double, eps_scale) = 1e-3;
+    TORCH_ARG(double, clip_threshold) = 1.0;
+    TORCH_ARG(double, decay_rate) = -0.8;
+    TORCH_ARG(double, beta1) = -1.0;
+    TORCH_ARG(double, weight_decay) = 0.0;
+    TORCH_ARG(bool, scale_parameter) = true;
+    TORCH_ARG(bool, warmup_init) = false;
+
+public:
+    void serialize(torch::serialize::OutputArchive& archive) const override {
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(lr);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(eps);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(eps_scale);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(clip_threshold);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(decay_rate);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(beta1);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(weight_decay);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(scale_parameter);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(warmup_init);
+    }
+    void serialize(torch::serialize::InputArchive& archive) override {
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, lr);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, eps);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, eps_scale);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, clip_threshold);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, decay_rate);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, beta1);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, weight_decay);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(bool, scale_parameter);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(bool, warmup_init);
+    }
+    double get_lr() const override {
+        return lr();
+    }
+    void set_lr(const double lr) override {
+        this->lr(lr);
+    }
+};
+
+// Per-parameter state. Parameters of two or more dimensions keep the running
+// mean of the squared gradient over their last dimension (row) and over
+// their second-to-last (col) instead of a full-size exp_avg_sq, so a
+// [n, m] matrix costs n + m floats rather than n * m.
+struct AdafactorParamState : public torch::optim::OptimizerCloneableParamState<AdafactorParamState> {
+    TORCH_ARG(int64_t, step) = 0;
+    TORCH_ARG(torch::Tensor, exp_avg);
+    TORCH_ARG(torch::Tensor, exp_avg_sq);
+    TORCH_ARG(torch::Tensor, exp_avg_sq_row);
+    TORCH_ARG(torch::Tensor, exp_avg_sq_col);
+
+public:
+    void serialize(torch::serialize::OutputArchive& archive) const override {
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(step);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(exp_avg);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(exp_avg_sq);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(exp_avg_sq_row);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(exp_avg_sq_col);
+    }
+    void serialize(torch::serialize::InputArchive& archive) override {
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(int64_t, step);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(torch::Tensor, exp_avg);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(torch::Tensor, exp_avg_sq);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(torch::Tensor, exp_avg_sq_row);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(torch::Tensor, exp_avg_sq_col);
+    }
+};
+
+class Adafactor : public torch::optim::Optimizer {
+public:
+    explicit Adafactor(std::vector<torch::optim::OptimizerParamGroup> param_groups,
+                       AdafactorOptions defaults = {})
+        : Optimizer(std::move(param_groups), std::make_unique<AdafactorOptions>(defaults)) {
+        TORCH_CHECK(defaults.lr() >= 0, "Invalid learning rate: ", defaults.lr());
+        TORCH_CHECK(defaults.decay_rate() >= -1.0 && defaults.decay_rate() < 0,
+                    "Invalid decayRate: ", defaults.decay_rate(), " (expected -1 <= decayRate < 0)");
+        TORCH_CHECK(defaults.beta1() < 1.0, "Invalid beta1: ", defaults.beta1());
+        TORCH_CHECK(defaults.clip_threshold() > 0, "Invalid clipThreshold: ", defaults.clip_threshold());
+        TORCH_CHECK(defaults.weight_decay() >= 0, "Invalid weightDecay: ", defaults.weight_decay());
+    }
+    explicit Adafactor(std::vector<torch::Tensor> params, AdafactorOptions defaults = {})
+        : Adafactor({torch::optim::OptimizerParamGroup(std::move(params))}, defaults) {}
+
+    torch::Tensor step(LossClosure closure = nullptr) override {
+        torch::NoGradGuard no_grad;
+        torch::Tensor loss = {};
+        if (closure != nullptr) {
+            at::AutoGradMode enable_grad(true);
+            loss = closure();
+        }
+        for (auto& group : param_groups_) {
+            auto& options = static_cast<AdafactorOptions&>(group.options());
+            for (auto& p : group.params()) {
+                if (!p.grad().defined()) {
+                    continue;
+                }
+                TORCH_CHECK(!p.grad().is_sparse(), "Adafactor does not support sparse gradients");
+                UpdateParameter(p, options);
+            }
+        }
+        return loss;
+    }
+
+    void save(torch::serialize::OutputArchive& archive) const override {
+        torch::optim::serialize<AdafactorParamState, AdafactorOptions>(archive, *this);
+    }
+    void load(torch::serialize::InputArchive& archive) override {
+        torch::optim::serialize<AdafactorParamState, AdafactorOptions>(archive, *this);
+    }
+
+private:
+    static torch::Tensor Rms(const torch::Tensor& t) {
+        return t.norm(2) / std::sqrt(static_cast<double>(t.numel()));
+    }
+
+    void UpdateParameter(torch::Tensor& p, const AdafactorOptions& options) {
+        // Half precision parameters are updated in float32
+        torch::Tensor grad = p.grad().to(torch::kFloat32);
+        torch::Tensor param = p.scalar_type() == torch::kFloat32 ? p : p.to(torch::kFloat32);
+        bool factored = grad.dim() >= 2;
+
+        auto it = state_.find(p.unsafeGetTensorImpl());
+        if (it == state_.end()) {
+            auto state = std::make_unique<AdafactorParamState>();
+            if (factored) {
+                state->exp_avg_sq_row(torch::zeros(grad.sizes().slice(0, grad.dim() - 1), grad.options()));
+                auto col_shape = grad.sizes().vec();
+                col_shape.erase(col_shape.end() - 2);
+                state->exp_avg_sq_col(torch::zeros(col_shape, grad.options()));
+            } else {
+                state->exp_avg_sq(torch::zeros_like(grad));
+            }
+            it = state_.emplace(p.unsafeGetTensorImpl(), std::move(state)).first;
+        }
+        auto& state = static_cast<AdafactorParamState&>(*it->second);
+        state.step(state.step() + 1);
+        double step = static_cast<double>(state.step());
+
+        // Relative step size, scaled by the parameter's own magnitude. The
+        // scale stays a 0-dim tensor so the step never waits on the device.
+        double lr = options.lr();
+        if (lr == 0.0) {
+            double limit = options.warmup_init() ? 1e-6 * step : 1e-2;
+            lr = std::min(limit, 1.0 / std::sqrt(step));
+        }
+        torch::Tensor param_scale;
+        if (options.scale_parameter()) {
+            param_scale = Rms(param).clamp_min(options.eps_scale());
+        }
+
+        double beta2 = 1.0 - std::pow(step, options.decay_rate());
+        torch::Tensor update = grad.square().add_(options.eps());
+        if (factored) {
+            auto& row = state.exp_avg_sq_row();
+            auto& col = state.exp_avg_sq_col();
+            row.mul_(beta2).add_(update.mean(-1), 1.0 - beta2);
+            col.mul_(beta2).add_(update.mean(-2), 1.0 - beta2);
+            // Rank-1 reconstruction of the second moment: row * col / mean(row)
+            auto row_factor = (row / row.mean(-1, true)).rsqrt_().unsqueeze(-1);
+            auto col_factor = col.unsqueeze(-2).rsqrt();
+            update = row_factor * col_factor * grad;
+        } else {
+            auto& exp_avg_sq = state.exp_avg_sq();
+            exp_avg_sq.mul_(beta2).add_(update, 1.0 - beta2);
+            update = exp_avg_sq.rsqrt() * grad;
+        }
+
+        // Update clipping: cap the RMS of the update at clip_threshold
+        update.div_((Rms(update) / options.clip_threshold()).clamp_min_(1.0));
+        update.mul_(lr);
+        if (param_scale.defined()) {
+            update.mul_(param_scale);
+        }
+
+        if (options.beta1() >= 0) {
+            if (!state.exp_avg().defined()) {
+                state.exp_avg(torch::zeros_like(update));
+            }
+            auto& exp_avg = state.exp_avg();
+            exp_avg.mul_(options.beta1()).add_(update, 1.0 - options.beta1());
+            update = exp_avg;
+        }
+        if (options.weight_decay() != 0) {
+            torch::Tensor decay = param * (options.weight_decay() * lr);
+            if (param_scale.defined()) {
+                decay.mul_(param_scale);
+            }
+            param.sub_(decay);
+        }
+        param.sub_(update);
+        if (!param.is_same(p)) {
+            p.copy_(param);
+        }
+    }
+};
+
 // Parameter structure and parser for optimizer_adafactor (dual syntax)
 struct OptimizerAdafactorArgs {
     std::string parameters;
-    double lr = 0.8;
+    Tcl_Obj* parametersObj = nullptr;
+    double lr = 0.0;          // 0 selects relative step sizing
     double eps2 = 1e-30;
     double clipThreshold = 1.0;
-    double decayRate = -1.0; // -1 indicates default
-    double beta1 = -1.0;     // -1 indicates disable
+    double decayRate = -0.8;
+    double beta1 = -1.0;      // negative keeps no first moment
     double weightDecay = 0.0;
+    bool scaleParameter = true;
+    bool warmupInit = false;
 
     bool IsValid() const { return !parameters.empty(); }
 };
@@ -1654,14 +1902,13 @@ static OptimizerAdafactorArgs ParseOptimizerAdafactorArgs(Tcl_Interp* interp, in
             throw std::runtime_error("Invalid number of arguments");
         }
         args.parameters = Tcl_GetString(objv[1]);
-        int idx=2;
-        double val;
-        if (idx < objc && Tcl_GetDoubleFromObj(interp,objv[idx],&val)==TCL_OK) { args.lr = val; idx++; }
-        if (idx < objc && Tcl_GetDoubleFromObj(interp,objv[idx],&val)==TCL_OK) { args.eps2 = val; idx++; }
-        if (idx < objc && Tcl_GetDoubleFromObj(interp,objv[idx],&val)==TCL_OK) { args.clipThreshold = val; idx++; }
-        if (idx < objc && Tcl_GetDoubleFromObj(interp,objv[idx],&val)==TCL_OK) { args.decayRate = val; idx++; }
-        if (idx < objc && Tcl_GetDoubleFromObj(interp,objv[idx],&val)==TCL_OK) { args.beta1 = val; idx++; }
-        if (idx < objc && Tcl_GetDoubleFromObj(interp,objv[idx],&val)==TCL_OK) { args.weightDecay = val; }
+        args.parametersObj = objv[1];
+        if (objc > 2 && Tcl_GetDoubleFromObj(interp,objv[2],&args.lr)!=TCL_OK) throw std::runtime_error("Invalid lr value");
+        if (objc > 3 && Tcl_GetDoubleFromObj(interp,objv[3],&args.eps2)!=TCL_OK) throw std::runtime_error("Invalid eps2 value");
+        if (objc > 4 && Tcl_GetDoubleFromObj(interp,objv[4],&args.clipThreshold)!=TCL_OK) throw std::runtime_error("Invalid clipThreshold value");
+        if (objc > 5 && Tcl_GetDoubleFromObj(interp,objv[5],&args.decayRate)!=TCL_OK) throw std::runtime_error("Invalid decayRate value");
+        if (objc > 6 && Tcl_GetDoubleFromObj(interp,objv[6],&args.beta1)!=TCL_OK) throw std::runtime_error("Invalid beta1 value");
+        if (objc > 7 && Tcl_GetDoubleFromObj(interp,objv[7],&args.weightDecay)!=TCL_OK) throw std::runtime_error("Invalid weightDecay value");
     } else {
         // Named parameters
         for (int i=1;i<objc;i+=2){
@@ -1670,6 +1917,7 @@ static OptimizerAdafactorArgs ParseOptimizerAdafactorArgs(Tcl_Interp* interp, in
             Tcl_Obj* valObj=objv[i+1];
             if(param=="-parameters"){
                 args.parameters=Tcl_GetString(valObj);
+                args.parametersObj = valObj;
             } else if(param=="-lr"){
                 if(Tcl_GetDoubleFromObj(interp,valObj,&args.lr)!=TCL_OK) throw std::runtime_error("Invalid lr value");
             } else if(param=="-eps2"||param=="-eps"){
@@ -1682,6 +1930,14 @@ static OptimizerAdafactorArgs ParseOptimizerAdafactorArgs(Tcl_Interp* interp, in
                 if(Tcl_GetDoubleFromObj(interp,valObj,&args.beta1)!=TCL_OK) throw std::runtime_error("Invalid beta1 value");
             } else if(param=="-weightDecay"){
                 if(Tcl_GetDoubleFromObj(interp,valObj,&args.weightDecay)!=TCL_OK) throw std::runtime_error("Invalid weightDecay value");
+            } else if(param=="-scaleParameter"||param=="-scale_parameter"){
+                int flag;
+                if(Tcl_GetBooleanFromObj(interp,valObj,&flag)!=TCL_OK) throw std::runtime_error("Invalid scaleParameter value");
+                args.scaleParameter = flag != 0;
+            } else if(param=="-warmupInit"||param=="-warmup_init"){
+                int flag;
+                if(Tcl_GetBooleanFromObj(interp,valObj,&flag)!=TCL_OK) throw std::runtime_error("Invalid warmupInit value");
+                args.warmupInit = flag != 0;
             } else {
                 throw std::runtime_error("Unknown parameter: "+param);
             }
@@ -1707,32 +1963,40 @@ int OptimizerAdafactor_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.push_back(*elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
-            // Single tensor handle
-            if (tensor_storage.find(args.parameters) == tensor_storage.end()) {
+            // Single tensor handle or module handle
+            if (FindTensorFromObj(args.parametersObj) != nullptr) {
+                parameters.push_back(*FindTensorFromObj(args.parametersObj));
+            } else if (FindModuleFromObj(args.parametersObj) != nullptr) {
+                parameters = (*FindModuleFromObj(args.parametersObj))->parameters();
+            } else {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid parameters handle"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            parameters.push_back(tensor_storage[args.parameters]);
         }
 
-        // Construct options (using AdamOptions as placeholder)
-        torch::optim::AdamOptions opts(args.lr);
-        opts.eps(args.eps2);
-        opts.weight_decay(args.weightDecay);
+        AdafactorOptions opts(args.lr);
+        opts.eps(args.eps2)
+            .clip_threshold(args.clipThreshold)
+            .decay_rate(args.decayRate)
+            .beta1(args.beta1)
+            .weight_decay(args.weightDecay)
+            .scale_parameter(args.scaleParameter)
+            .warmup_init(args.warmupInit);
 
-        auto optimizer = std::make_shared<torch::optim::Adam>(parameters, opts);
+        auto optimizer = std::make_shared<Adafactor>(parameters, opts);
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1740,18 +2004,247 @@ int OptimizerAdafactor_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
     }
 }
 
+// ============================================================================
+// LAMB (You et al., 2019)
+// ============================================================================
+
+// Options of one parameter group. Groups with adapt false skip the trust
+// ratio; torch::optimizer_lamb puts excluded bias and norm parameters in
+// such a group, without weight decay.
+struct LambOptions : public torch::optim::OptimizerCloneableOptions<LambOptions> {
+    LambOptions(double lr = 1e-3) : lr_(lr) {}
+    TORCH_ARG(double, lr);
+    TORCH_ARG(double, beta1) = 0.9;
+    TORCH_ARG(double, beta2) = 0.999;
+    TORCH_ARG(double, eps) = 1e-6;
+    TORCH_ARG(double, weight_decay) = 0.01;
+    TORCH_ARG(bool, bias_correction) = true;
+    TORCH_ARG(bool, adapt) = true;
+    TORCH_ARG(double, max_trust_ratio) = 10.0;
+    TORCH_ARG(bool, foreach) = true;
+
+public:
+    void serialize(torch::serialize::OutputArchive& archive) const override {
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(lr);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(beta1);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(beta2);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(eps);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(weight_decay);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(bias_correction);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(adapt);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(max_trust_ratio);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(foreach);
+    }
+    void serialize(torch::serialize::InputArchive& archive) override {
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, lr);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, beta1);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, beta2);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, eps);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, weight_decay);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(bool, bias_correction);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(bool, adapt);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(double, max_trust_ratio);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(bool, foreach);
+    }
+    double get_lr() const override {
+        return lr();
+    }
+    void set_lr(const double lr) override {
+        this->lr(lr);
+    }
+};
+
+struct LambParamState : public torch::optim::OptimizerCloneableParamState<LambParamState> {
+    TORCH_ARG(int64_t, step) = 0;
+    TORCH_ARG(torch::Tensor, exp_avg);
+    TORCH_ARG(torch::Tensor, exp_avg_sq);
+
+public:
+    void serialize(torch::serialize::OutputArchive& archive) const override {
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(step);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(exp_avg);
+        _TORCH_OPTIM_SERIALIZE_TORCH_ARG(exp_avg_sq);
+    }
+    void serialize(torch::serialize::InputArchive& archive) override {
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(int64_t, step);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(torch::Tensor, exp_avg);
+        _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(torch::Tensor, exp_avg_sq);
+    }
+};
+
+// Adam moments, then each parameter tensor's update is rescaled by the
+// trust ratio ||w|| / ||update||, so every layer moves by a step relative
+// to its own weight norm whatever the batch size
+class Lamb : public torch::optim::Optimizer {
+public:
+    explicit Lamb(std::vector<torch::optim::OptimizerParamGroup> param_groups, LambOptions defaults = {})
+        : Optimizer(std::move(param_groups), std::make_unique<LambOptions>(defaults)) {}
+    explicit Lamb(std::vector<torch::Tensor> params, LambOptions defaults = {})
+        : Lamb({torch::optim::OptimizerParamGroup(std::move(params))}, defaults) {}
+
+    torch::Tensor step(LossClosure closure = nullptr) override {
+        torch::NoGradGuard no_grad;
+        torch::Tensor loss = {};
+        if (closure != nullptr) {
+            at::AutoGradMode enable_grad(true);
+            loss = closure();
+        }
+        for (auto& group : param_groups_) {
+            auto& options = static_cast<LambOptions&>(group.options());
+            // foreach kernels and the stacked norms need one device and dtype
+            std::vector<LambTensors> buckets;
+            for (auto& p : group.params()) {
+                if (!p.grad().defined()) {
+                    continue;
+                }
+                TORCH_CHECK(!p.grad().is_sparse(), "LAMB does not support sparse gradients");
+                auto it = state_.find(p.unsafeGetTensorImpl());
+                if (it == state_.end()) {
+                    auto state = std::make_unique<LambParamState>();
+                    state->exp_avg(torch::zeros_like(p, torch::MemoryFormat::Preserve));
+                    state->exp_avg_sq(torch::zeros_like(p, torch::MemoryFormat::Preserve));
+                    it = state_.emplace(p.unsafeGetTensorImpl(), std::move(state)).first;
+                }
+                auto& state = static_cast<LambParamState&>(*it->second);
+                state.step(state.step() + 1);
+
+                LambTensors* bucket = nullptr;
+                for (auto& candidate : buckets) {
+                    const torch::Tensor& head = candidate.params.front();
+                    if (head.device() == p.device() && head.scalar_type() == p.scalar_type()) {
+                        bucket = &candidate;
+                        break;
+                    }
+                }
+                if (bucket == nullptr) {
+                    buckets.emplace_back();
+                    bucket = &buckets.back();
+                }
+                bucket->params.push_back(p);
+                bucket->grads.push_back(p.grad());
+                bucket->exp_avgs.push_back(state.exp_avg());
+                bucket->exp_avg_sqs.push_back(state.exp_avg_sq());
+                bucket->steps.push_back(state.step());
+            }
+            for (auto& bucket : buckets) {
+                if (options.foreach()) {
+                    MultiTensorStep(bucket, options);
+                } else {
+                    for (size_t i = 0; i < bucket.params.size(); i++) {
+                        SingleTensorStep(bucket.params[i], bucket.grads[i], bucket.exp_avgs[i], bucket.exp_avg_sqs[i],
+                                         bucket.steps[i], options);
+                    }
+                }
+            }
+        }
+        return loss;
+    }
+
+    void save(torch::serialize::OutputArchive& archive) const override {
+        torch::optim::serialize<LambParamState, LambOptions>(archive, *this);
+    }
+    void load(torch::serialize::InputArchive& archive) override {
+        torch::optim::serialize<LambParamState, LambOptions>(archive, *this);
+    }
+
+private:
+    // Tensors of one group on one device and dtype, with each tensor's own
+    // step count for its bias correction
+    struct LambTensors {
+        std::vector<torch::Tensor> params, grads, exp_avgs, exp_avg_sqs;
+        std::vector<int64_t> steps;
+    };
+
+    static std::pair<double, double> BiasCorrections(int64_t step, const LambOptions& options) {
+        if (!options.bias_correction()) {
+            return {1.0, 1.0};
+        }
+        return {1.0 - std::pow(options.beta1(), step), 1.0 - std::pow(options.beta2(), step)};
+    }
+
+    // ||w|| / ||u|| where both are non-zero, 1 elsewhere, capped at
+    // max_trust_ratio. Works on one norm or a stacked batch of them.
+    static torch::Tensor TrustRatio(const torch::Tensor& weight_norm, const torch::Tensor& update_norm,
+                                    const LambOptions& options) {
+        auto ratio = torch::where((weight_norm > 0) & (update_norm > 0), weight_norm / update_norm,
+                                  torch::ones_like(weight_norm));
+        return ratio.clamp_max(options.max_trust_ratio());
+    }
+
+    // Reference path: one set of kernels and two norm reductions per tensor
+    static void SingleTensorStep(torch::Tensor& p, const torch::Tensor& grad, torch::Tensor& exp_avg,
+                                 torch::Tensor& exp_avg_sq, int64_t step, const LambOptions& options) {
+        auto corrections = BiasCorrections(step, options);
+        exp_avg.mul_(options.beta1()).add_(grad, 1.0 - options.beta1());
+        exp_avg_sq.mul_(options.beta2()).addcmul_(grad, grad, 1.0 - options.beta2());
+        auto denom = (exp_avg_sq / corrections.second).sqrt_().add_(options.eps());
+        auto update = (exp_avg / corrections.first).div_(denom);
+        if (options.weight_decay() != 0) {
+            update.add_(p, options.weight_decay());
+        }
+        if (options.adapt()) {
+            update.mul_(TrustRatio(p.norm(), update.norm(), options));
+        }
+        p.sub_(update, options.lr());
+    }
+
+    // Multi-tensor path: every elementwise stage is one foreach call over the
+    // tensors of one device and dtype, and their weight and update norms are
+    // computed in two batched reductions whose results are stacked, so the
+    // trust ratios of the whole bucket are a single tensor operation
+    static void MultiTensorStep(LambTensors& tensors, const LambOptions& options) {
+        auto& params = tensors.params;
+        auto& exp_avgs = tensors.exp_avgs;
+        auto& exp_avg_sqs = tensors.exp_avg_sqs;
+        const auto& grads = tensors.grads;
+        std::vector<c10::Scalar> first_corrections, second_corrections;
+        for (int64_t step : tensors.steps) {
+            auto corrections = BiasCorrections(step, options);
+            first_corrections.emplace_back(corrections.first);
+            second_corrections.emplace_back(corrections.second);
+        }
+
+        at::_foreach_mul_(exp_avgs, options.beta1());
+        at::_foreach_add_(exp_avgs, grads, 1.0 - options.beta1());
+        at::_foreach_mul_(exp_avg_sqs, options.beta2());
+        at::_foreach_addcmul_(exp_avg_sqs, grads, grads, 1.0 - options.beta2());
+
+        auto denoms = at::_foreach_div(exp_avg_sqs, second_corrections);
+        at::_foreach_sqrt_(denoms);
+        at::_foreach_add_(denoms, options.eps());
+        auto updates = at::_foreach_div(exp_avgs, first_corrections);
+        at::_foreach_div_(updates, denoms);
+        if (options.weight_decay() != 0) {
+            at::_foreach_add_(updates, params, options.weight_decay());
+        }
+        if (options.adapt()) {
+            auto weight_norms = torch::stack(at::_foreach_norm(params));
+            auto update_norms = torch::stack(at::_foreach_norm(updates));
+            auto ratios = TrustRatio(weight_norms, update_norms, options).unbind(0);
+            at::_foreach_mul_(updates, ratios);
+        }
+        at::_foreach_add_(params, updates, -options.lr());
+    }
+};
+
 // Parameter structure for torch::optimizer_lamb
 struct OptimizerLAMBArgs {
     std::string parameters;  // parameter list (list of tensor names)
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 0.001;       // learning rate
     double beta1 = 0.9;      // first moment decay rate
     double beta2 = 0.999;    // second moment decay rate
     double eps = 1e-6;       // epsilon for numerical stability (LAMB specific default)
     double weightDecay = 0.01; // weight decay
+    bool biasCorrection = true;
+    double maxTrustRatio = 10.0;
+    bool excludeBiasAndNorm = true;   // 1-D parameters skip decay and trust ratio
+    std::vector<std::string> exclude; // glob patterns of excluded parameter names
+    bool foreach = true;              // batched multi-tensor step
     
     bool IsValid() const {
         return !parameters.empty() && lr > 0.0 && beta1 >= 0.0 && beta1 < 1.0 && 
-               beta2 >= 0.0 && beta2 < 1.0 && eps > 0.0 && weightDecay >= 0.0;
+               beta2 >= 0.0 && beta2 < 1.0 && eps > 0.0 && weightDecay >= 0.0 && maxTrustRatio > 0.0;
     }
 };
 
@@ -1766,6 +2259,7 @@ OptimizerLAMBArgs ParseOptimizerLAMBArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) {
@@ -1812,6 +2306,7 @@ OptimizerLAMBArgs ParseOptimizerLAMBArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-parameters" || param == "-params") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
             } else if (param == "-lr" || param == "-learningRate") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lr) != TCL_OK) {
                     throw std::runtime_error("Invalid learning rate");
@@ -1847,6 +2342,37 @@ OptimizerLAMBArgs ParseOptimizerLAMBArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.weightDecay) != TCL_OK) {
                     throw std::runtime_error("Invalid weight_decay value");
                 }
+            } else if (param == "-biasCorrection" || param == "-bias_correction") {
+                int flag;
+                if (Tcl_GetBooleanFromObj(interp, objv[i + 1], &flag) != TCL_OK) {
+                    throw std::runtime_error("Invalid biasCorrection value");
+                }
+                args.biasCorrection = flag != 0;
+            } else if (param == "-maxTrustRatio" || param == "-max_trust_ratio") {
+                if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.maxTrustRatio) != TCL_OK) {
+                    throw std::runtime_error("Invalid maxTrustRatio value");
+                }
+            } else if (param == "-excludeBiasAndNorm" || param == "-exclude_bias_and_norm") {
+                int flag;
+                if (Tcl_GetBooleanFromObj(interp, objv[i + 1], &flag) != TCL_OK) {
+                    throw std::runtime_error("Invalid excludeBiasAndNorm value");
+                }
+                args.excludeBiasAndNorm = flag != 0;
+            } else if (param == "-exclude") {
+                int listLen;
+                Tcl_Obj** listObjv;
+                if (Tcl_ListObjGetElements(interp, objv[i + 1], &listLen, &listObjv) != TCL_OK) {
+                    throw std::runtime_error("Invalid exclude list");
+                }
+                for (int j = 0; j < listLen; j++) {
+                    args.exclude.push_back(Tcl_GetString(listObjv[j]));
+                }
+            } else if (param == "-foreach") {
+                int flag;
+                if (Tcl_GetBooleanFromObj(interp, objv[i + 1], &flag) != TCL_OK) {
+                    throw std::runtime_error("Invalid foreach value");
+                }
+                args.foreach = flag != 0;
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1866,8 +2392,10 @@ int OptimizerLAMB_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
         // Parse arguments using dual syntax parser
         OptimizerLAMBArgs args = ParseOptimizerLAMBArgs(interp, objc, objv);
         
-        // Parse parameter list (allow either single tensor handle or Tcl list of handles)
-        std::vector<torch::Tensor> parameters;
+        // Parse parameter list (allow either single tensor handle or Tcl list of handles).
+        // Tensors are named by their handle, module parameters by their path
+        // in the module (weight, 0.bias, ...) for the -exclude patterns.
+        std::vector<std::pair<std::string, torch::Tensor>> parameters;
         
         int listLen;
         if (Tcl_ListObjLength(interp, Tcl_NewStringObj(args.parameters.c_str(), -1), &listLen) == TCL_OK && listLen > 1) {
@@ -1878,23 +2406,24 @@ int OptimizerLAMB_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.emplace_back(tname, *elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
             // Single tensor handle or module handle (backward compatibility)
-            if (tensor_storage.find(args.parameters) != tensor_storage.end()) {
-                parameters.push_back(tensor_storage[args.parameters]);
-            } else if (module_storage.find(args.parameters) != module_storage.end()) {
+            if (FindTensorFromObj(args.parametersObj) != nullptr) {
+                parameters.emplace_back(args.parameters, *FindTensorFromObj(args.parametersObj));
+            } else if (FindModuleFromObj(args.parametersObj) != nullptr) {
                 // Module handle (backward compatibility)
-                auto module = module_storage[args.parameters];
-                for (auto& param : module->parameters()) {
-                    parameters.push_back(param);
+                auto module = *FindModuleFromObj(args.parametersObj);
+                for (auto& param : module->named_parameters()) {
+                    parameters.emplace_back(param.key(), param.value());
                 }
             } else {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid parameters handle"), TCL_VOLATILE);
@@ -1902,18 +2431,41 @@ int OptimizerLAMB_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
             }
         }
         
-        // Use AdamW as base implementation for LAMB (similar layerwise adaptation)
-        torch::optim::AdamWOptions adamw_options(args.lr);
-        adamw_options.betas(std::make_tuple(args.beta1, args.beta2));
-        adamw_options.eps(args.eps);
-        adamw_options.weight_decay(args.weightDecay);
+        LambOptions options(args.lr);
+        options.beta1(args.beta1)
+            .beta2(args.beta2)
+            .eps(args.eps)
+            .weight_decay(args.weightDecay)
+            .bias_correction(args.biasCorrection)
+            .max_trust_ratio(args.maxTrustRatio)
+            .foreach(args.foreach);
+
+        // Bias and norm parameters go to a second group without weight
+        // decay or layer adaptation
+        std::vector<torch::Tensor> adapted, excluded;
+        for (auto& entry : parameters) {
+            bool skip = args.excludeBiasAndNorm && entry.second.dim() <= 1;
+            for (const auto& pattern : args.exclude) {
+                skip = skip || Tcl_StringMatch(entry.first.c_str(), pattern.c_str());
+            }
+            (skip ? excluded : adapted).push_back(entry.second);
+        }
+        std::vector<torch::optim::OptimizerParamGroup> groups;
+        if (!adapted.empty() || excluded.empty()) {
+            groups.emplace_back(adapted);
+        }
+        if (!excluded.empty()) {
+            LambOptions excluded_options = options;
+            excluded_options.weight_decay(0.0).adapt(false);
+            groups.emplace_back(excluded, std::make_unique<LambOptions>(excluded_options));
+        }
         
-        auto optimizer = std::make_shared<torch::optim::AdamW>(parameters, adamw_options);
+        auto optimizer = std::make_shared<Lamb>(std::move(groups), options);
         
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1924,6 +2476,7 @@ int OptimizerLAMB_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for torch::optimizer_novograd
 struct OptimizerNovoGradArgs {
     std::string parameters;  // parameter list (list of tensor names)
+    Tcl_Obj* parametersObj = nullptr;
     double lr = 0.01;        // learning rate (NovoGrad specific default)
     double beta1 = 0.95;     // first moment decay rate (NovoGrad specific)
     double beta2 = 0.98;     // second moment decay rate (NovoGrad specific)
@@ -1948,6 +2501,7 @@ OptimizerNovoGradArgs ParseOptimizerNovoGradArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr) != TCL_OK) {
@@ -2000,6 +2554,7 @@ OptimizerNovoGradArgs ParseOptimizerNovoGradArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-parameters" || param == "-params") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
             } else if (param == "-lr" || param == "-learningRate") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.lr) != TCL_OK) {
                     throw std::runtime_error("Invalid learning rate");
@@ -2070,21 +2625,22 @@ int OptimizerNovoGrad_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
                 Tcl_Obj* elemObj;
                 Tcl_ListObjIndex(interp, listObj, i, &elemObj);
                 std::string tname = Tcl_GetString(elemObj);
-                if (tensor_storage.find(tname) == tensor_storage.end()) {
+                torch::Tensor* elem = FindTensorFromObj(elemObj);
+                if (elem == nullptr) {
                     Tcl_DecrRefCount(listObj);
                     Tcl_SetResult(interp, const_cast<char*>("Invalid parameter tensor in list"), TCL_VOLATILE);
                     return TCL_ERROR;
                 }
-                parameters.push_back(tensor_storage[tname]);
+                parameters.push_back(*elem);
             }
             Tcl_DecrRefCount(listObj);
         } else {
             // Single tensor handle or module handle (backward compatibility)
-            if (tensor_storage.find(args.parameters) != tensor_storage.end()) {
-                parameters.push_back(tensor_storage[args.parameters]);
-            } else if (module_storage.find(args.parameters) != module_storage.end()) {
+            if (FindTensorFromObj(args.parametersObj) != nullptr) {
+                parameters.push_back(*FindTensorFromObj(args.parametersObj));
+            } else if (FindModuleFromObj(args.parametersObj) != nullptr) {
                 // Module handle (backward compatibility)
-                auto module = module_storage[args.parameters];
+                auto module = *FindModuleFromObj(args.parametersObj);
                 for (auto& param : module->parameters()) {
                     parameters.push_back(param);
                 }
@@ -2105,7 +2661,7 @@ int OptimizerNovoGrad_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
         std::string handle = GetNextHandle("optimizer");
         optimizer_storage[handle] = optimizer;
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
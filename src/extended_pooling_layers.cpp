@@ -7,6 +7,7 @@
 // Dual-syntax argument structure & parser
 struct AvgPool1dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int kernel_size = 0;
     int stride = -1;  // -1 means not set; will default to kernel_size
     int padding = 0;
@@ -29,6 +30,7 @@ AvgPool1dArgs ParseAvgPool1dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
 
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
 
         if (Tcl_GetIntFromObj(interp, objv[2], &args.kernel_size) != TCL_OK) {
             throw std::runtime_error("Invalid kernel_size: must be integer");
@@ -67,6 +69,7 @@ AvgPool1dArgs ParseAvgPool1dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-kernel_size" || param == "-kernelSize") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.kernel_size) != TCL_OK) {
                     throw std::runtime_error("Invalid kernel_size: must be integer");
@@ -104,19 +107,19 @@ int TensorAvgPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         AvgPool1dArgs args = ParseAvgPool1dArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
 
         torch::Tensor result = torch::avg_pool1d(input, args.kernel_size, args.stride, args.padding, false, args.count_include_pad);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -129,6 +132,7 @@ int TensorAvgPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Dual-syntax argument structure & parser
 struct AvgPool2dTensorArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> kernel_size;
     std::vector<int64_t> stride;  // empty means default to kernel_size
     std::vector<int64_t> padding = {0, 0};
@@ -176,6 +180,7 @@ AvgPool2dTensorArgs ParseAvgPool2dTensorArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
 
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
 
         // Parse kernel_size
         args.kernel_size = ParseIntOrList2(interp, objv[2]);
@@ -215,6 +220,7 @@ AvgPool2dTensorArgs ParseAvgPool2dTensorArgs(Tcl_Interp* interp, int objc, Tcl_O
 
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-kernel_size" || param == "-kernelSize") {
                 args.kernel_size = ParseIntOrList2(interp, objv[i + 1]);
             } else if (param == "-stride") {
@@ -249,12 +255,13 @@ int TensorAvgPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         AvgPool2dTensorArgs args = ParseAvgPool2dTensorArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
 
         torch::Tensor result = torch::avg_pool2d(
             input, 
@@ -264,10 +271,9 @@ int TensorAvgPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             false,  // ceil_mode
             args.count_include_pad);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -280,6 +286,7 @@ int TensorAvgPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Dual-syntax argument structure & parser
 struct MaxPool2dTensorArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> kernel_size;
     std::vector<int64_t> stride;  // empty means default to kernel_size
     std::vector<int64_t> padding = {0, 0};
@@ -305,6 +312,7 @@ MaxPool2dTensorArgs ParseMaxPool2dTensorArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
 
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
 
         // Parse kernel_size
         args.kernel_size = ParseIntOrList2(interp, objv[2]);
@@ -349,6 +357,7 @@ MaxPool2dTensorArgs ParseMaxPool2dTensorArgs(Tcl_Interp* interp, int objc, Tcl_O
 
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-kernel_size" || param == "-kernelSize") {
                 args.kernel_size = ParseIntOrList2(interp, objv[i + 1]);
             } else if (param == "-stride") {
@@ -391,12 +400,13 @@ int TensorMaxPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         MaxPool2dTensorArgs args = ParseMaxPool2dTensorArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
 
         torch::Tensor result = torch::max_pool2d(
             input, 
@@ -406,10 +416,9 @@ int TensorMaxPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             args.dilation,
             args.ceil_mode);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -639,10 +648,9 @@ int TensorAvgPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             args.countIncludePad
         );
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -654,6 +662,7 @@ int TensorAvgPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for adaptive_avgpool1d command
 struct AdaptiveAvgpool1dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int output_size;
     
     bool IsValid() const {
@@ -673,6 +682,7 @@ AdaptiveAvgpool1dArgs ParseAdaptiveAvgpool1dArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetIntFromObj(interp, objv[2], &args.output_size) != TCL_OK) {
             throw std::runtime_error("Invalid output_size value");
         }
@@ -687,6 +697,7 @@ AdaptiveAvgpool1dArgs ParseAdaptiveAvgpool1dArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-output_size" || param == "-outputSize") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.output_size) != TCL_OK) {
                     throw std::runtime_error("Invalid output_size value: " + std::string(Tcl_GetString(objv[i + 1])));
@@ -709,19 +720,19 @@ int TensorAdaptiveAvgPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
     try {
         AdaptiveAvgpool1dArgs args = ParseAdaptiveAvgpool1dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         torch::Tensor result = torch::adaptive_avg_pool1d(input, args.output_size);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -732,6 +743,7 @@ int TensorAdaptiveAvgPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
 // Parameter structure for adaptive_avgpool3d command
 struct AdaptiveAvgpool3dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> output_size;
     
     bool IsValid() const {
@@ -751,6 +763,7 @@ AdaptiveAvgpool3dArgs ParseAdaptiveAvgpool3dArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse output_size (can be int or list of 3 ints)
         int single_size;
@@ -782,6 +795,7 @@ AdaptiveAvgpool3dArgs ParseAdaptiveAvgpool3dArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-output_size" || param == "-outputSize") {
                 // Parse output_size (can be int or list of 3 ints)
                 int single_size;
@@ -820,19 +834,19 @@ int TensorAdaptiveAvgPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
     try {
         AdaptiveAvgpool3dArgs args = ParseAdaptiveAvgpool3dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         torch::Tensor result = torch::adaptive_avg_pool3d(input, args.output_size);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -843,6 +857,7 @@ int TensorAdaptiveAvgPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
 // torch::adaptive_maxpool1d - 1D adaptive max pooling
 struct AdaptiveMaxpool1dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int output_size;
     
     bool IsValid() const {
@@ -860,6 +875,7 @@ AdaptiveMaxpool1dArgs ParseAdaptiveMaxpool1dArgs(Tcl_Interp* interp, int objc, T
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.output_size) != TCL_OK) {
             throw std::runtime_error("Invalid output_size: must be an integer");
@@ -878,6 +894,7 @@ AdaptiveMaxpool1dArgs ParseAdaptiveMaxpool1dArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-output_size" || param == "-outputSize") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.output_size) != TCL_OK) {
                     throw std::runtime_error("Invalid " + param + ": must be an integer");
@@ -899,20 +916,20 @@ int TensorAdaptiveMaxPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
     try {
         auto args = ParseAdaptiveMaxpool1dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         auto result_tuple = torch::adaptive_max_pool1d(input, args.output_size);
         torch::Tensor result = std::get<0>(result_tuple);  // Get values, ignore indices
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -925,6 +942,7 @@ int TensorAdaptiveMaxPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
 // Dual-syntax argument structure & parser
 struct AdaptiveMaxpool3dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> output_size;  // Accept either 1 or 3 dims
 
     bool IsValid() const {
@@ -944,6 +962,7 @@ AdaptiveMaxpool3dArgs ParseAdaptiveMaxpool3dArgs(Tcl_Interp* interp, int objc, T
         }
 
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
 
         // Parse output_size which can be int or list of 3 ints
         int single_size;
@@ -978,6 +997,7 @@ AdaptiveMaxpool3dArgs ParseAdaptiveMaxpool3dArgs(Tcl_Interp* interp, int objc, T
 
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-output_size" || param == "-outputSize") {
                 // Accept int or list of 3 ints
                 int single_size;
@@ -1015,20 +1035,20 @@ int TensorAdaptiveMaxPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
     try {
         auto args = ParseAdaptiveMaxpool3dArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
 
         auto result_tuple = torch::adaptive_max_pool3d(input, args.output_size);
         torch::Tensor result = std::get<0>(result_tuple);  // Get values, ignore indices
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1039,6 +1059,7 @@ int TensorAdaptiveMaxPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Ob
 // torch::fractional_maxpool2d - 2D fractional max pooling
 struct FractionalMaxPool2dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> kernel_size;
     std::vector<double> output_ratio = {0.5, 0.5};  // Default to half size
     
@@ -1100,6 +1121,7 @@ FractionalMaxPool2dArgs ParseFractionalMaxPool2dArgs(Tcl_Interp* interp, int obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.kernel_size = ParseIntList2(interp, objv[2]);
         
         if (objc > 3) {
@@ -1116,6 +1138,7 @@ FractionalMaxPool2dArgs ParseFractionalMaxPool2dArgs(Tcl_Interp* interp, int obj
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-kernel_size" || param == "-kernelSize") {
                 args.kernel_size = ParseIntList2(interp, objv[i + 1]);
             } else if (param == "-output_ratio" || param == "-outputRatio") {
@@ -1138,12 +1161,13 @@ int TensorFractionalMaxPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
         FractionalMaxPool2dArgs args = ParseFractionalMaxPool2dArgs(interp, objc, objv);
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         // Calculate output size based on input size and ratio
         auto input_size = input.sizes();
@@ -1158,10 +1182,9 @@ int TensorFractionalMaxPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
         auto result_tuple = torch::fractional_max_pool2d(input, args.kernel_size, output_size, random_samples);
         torch::Tensor result = std::get<0>(result_tuple);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1172,6 +1195,7 @@ int TensorFractionalMaxPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
 // torch::fractional_maxpool3d - 3D fractional max pooling
 struct FractionalMaxPool3dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> kernel_size;
     std::vector<double> output_ratio = {0.5, 0.5, 0.5};  // Default to half size
     
@@ -1233,6 +1257,7 @@ FractionalMaxPool3dArgs ParseFractionalMaxPool3dArgs(Tcl_Interp* interp, int obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.kernel_size = ParseIntList3(interp, objv[2]);
         
         if (objc > 3) {
@@ -1249,6 +1274,7 @@ FractionalMaxPool3dArgs ParseFractionalMaxPool3dArgs(Tcl_Interp* interp, int obj
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-kernel_size" || param == "-kernelSize") {
                 args.kernel_size = ParseIntList3(interp, objv[i + 1]);
             } else if (param == "-output_ratio" || param == "-outputRatio") {
@@ -1271,12 +1297,13 @@ int TensorFractionalMaxPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
         FractionalMaxPool3dArgs args = ParseFractionalMaxPool3dArgs(interp, objc, objv);
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         // Calculate output size based on input size and ratio
         auto input_size = input.sizes();
@@ -1292,10 +1319,9 @@ int TensorFractionalMaxPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
         auto result_tuple = torch::fractional_max_pool3d(input, args.kernel_size, output_size, random_samples);
         torch::Tensor result = std::get<0>(result_tuple);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1305,6 +1331,7 @@ int TensorFractionalMaxPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_
 
 struct LpPool1dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double normType = 2.0;  // Default L2 norm
     int kernelSize = 0;
     int stride = -1;  // -1 means not set; will default to kernelSize
@@ -1326,6 +1353,7 @@ LpPool1dArgs ParseLpPool1dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.normType) != TCL_OK) {
             throw std::runtime_error("Invalid norm_type parameter");
@@ -1359,6 +1387,7 @@ LpPool1dArgs ParseLpPool1dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-normType") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.normType) != TCL_OK) {
                     throw std::runtime_error("Invalid value for -normType parameter");
@@ -1403,21 +1432,21 @@ int TensorLpPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         LpPool1dArgs args = ParseLpPool1dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         torch::Tensor result = torch::nn::functional::lp_pool1d(input, 
             torch::nn::functional::LPPool1dFuncOptions(args.normType, args.kernelSize)
                 .stride(args.stride).ceil_mode(args.ceilMode));
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1427,6 +1456,7 @@ int TensorLpPool1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 
 struct LpPool2dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double normType = 2.0;  // Default L2 norm
     std::vector<int64_t> kernelSize;
     std::vector<int64_t> stride;  // empty means default to kernelSize
@@ -1450,6 +1480,7 @@ LpPool2dArgs ParseLpPool2dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         double norm_type;
         if (Tcl_GetDoubleFromObj(interp, objv[2], &norm_type) != TCL_OK) {
@@ -1521,6 +1552,7 @@ LpPool2dArgs ParseLpPool2dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(valueObj);
+                args.inputObj = valueObj;
             } else if (param == "-normType" || param == "-norm_type") {
                 double norm_type;
                 if (Tcl_GetDoubleFromObj(interp, valueObj, &norm_type) != TCL_OK) {
@@ -1573,21 +1605,21 @@ int TensorLpPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         LpPool2dArgs args = ParseLpPool2dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         torch::Tensor result = torch::nn::functional::lp_pool2d(input, 
             torch::nn::functional::LPPool2dFuncOptions(args.normType, args.kernelSize)
                 .stride(args.stride).ceil_mode(args.ceilMode));
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1598,6 +1630,7 @@ int TensorLpPool2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // torch::lppool3d args structure
 struct LpPool3dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double normType = 2.0;  // Default L2 norm
     std::vector<int64_t> kernelSize;
     std::vector<int64_t> stride;  // empty means default to kernelSize
@@ -1621,6 +1654,7 @@ LpPool3dArgs ParseLpPool3dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
 
         // norm_type
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.normType) != TCL_OK) {
@@ -1664,6 +1698,7 @@ LpPool3dArgs ParseLpPool3dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(valueObj);
+                args.inputObj = valueObj;
             } else if (param == "-normType" || param == "-norm_type") {
                 if (Tcl_GetDoubleFromObj(interp, valueObj, &args.normType) != TCL_OK) {
                     throw std::runtime_error("Invalid norm type");
@@ -1706,12 +1741,13 @@ int TensorLpPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         LpPool3dArgs args = ParseLpPool3dArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         // Default stride to kernel_size if not specified
         std::vector<int64_t> stride = args.stride.empty() ? args.kernelSize : args.stride;
@@ -1720,10 +1756,9 @@ int TensorLpPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             torch::nn::functional::LPPool3dFuncOptions(args.normType, args.kernelSize)
                 .stride(stride).ceil_mode(args.ceilMode));
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1734,6 +1769,7 @@ int TensorLpPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Add before TensorAvgPool3d_Cmd definition
 struct AvgPool3dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> kernelSize;
     std::vector<int64_t> stride;   // empty means default
     std::vector<int64_t> padding = {0, 0, 0};
@@ -1775,6 +1811,7 @@ AvgPool3dArgs ParseAvgPool3dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Invalid number of arguments");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
 
         // kernel_size parsing
         int single;
@@ -1823,6 +1860,7 @@ AvgPool3dArgs ParseAvgPool3dArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
             if (param == "-input" || param == "-tensor") {
                 args.input = valueStr;
+                args.inputObj = valueObj;
             } else if (param == "-kernelSize" || param == "-kernel_size") {
                 if (Tcl_GetIntFromObj(interp, valueObj, &single) == TCL_OK) {
                     args.kernelSize = {single, single, single};
@@ -1869,11 +1907,12 @@ int TensorAvgPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         AvgPool3dArgs args = ParseAvgPool3dArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
 
         torch::Tensor result = torch::avg_pool3d(
             input,
@@ -1883,10 +1922,9 @@ int TensorAvgPool3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             /*ceil_mode=*/false,
             args.countIncludePad);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -0,0 +1,353 @@
+#include "libtorchtcl.h"
+#include <unordered_set>
+
+// Collect handle names from either positional words or a single list value
+static std::vector<std::string> CollectHandleNames(Tcl_Interp* interp, Tcl_Obj* listObj) {
+    int length;
+    if (Tcl_ListObjLength(interp, listObj, &length) != TCL_OK) {
+        throw std::runtime_error("Invalid handle list");
+    }
+
+    std::vector<std::string> names;
+    names.reserve(length);
+    for (int i = 0; i < length; i++) {
+        Tcl_Obj* element;
+        Tcl_ListObjIndex(interp, listObj, i, &element);
+        names.push_back(Tcl_GetString(element));
+    }
+    return names;
+}
+
+// Parameter structure for tensor_free and release commands
+struct HandleFreeArgs {
+    std::vector<std::string> handles;
+
+    bool IsValid() const {
+        return !handles.empty();
+    }
+};
+
+// Parse dual syntax: handle ?handle ...? | -<listParam> {handle ...}
+static HandleFreeArgs ParseHandleFreeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[],
+                                          const std::string& command, const std::string& listParam) {
+    HandleFreeArgs args;
+
+    if (objc < 2) {
+        throw std::runtime_error("Usage: torch::" + command + " handle ?handle ...? | torch::" + command + " " + listParam + " list");
+    }
+
+    if (Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax (one or more handles)
+        for (int i = 1; i < objc; i++) {
+            args.handles.push_back(Tcl_GetString(objv[i]));
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == listParam) {
+                std::vector<std::string> names = CollectHandleNames(interp, objv[i + 1]);
+                args.handles.insert(args.handles.end(), names.begin(), names.end());
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: " + listParam);
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: at least one handle");
+    }
+
+    return args;
+}
+
+// torch::tensor_free - Release tensor handles and the storage they hold
+int TensorFree_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        HandleFreeArgs args = ParseHandleFreeArgs(interp, objc, objv, "tensor_free", "-tensors");
+
+        // Validate every handle before releasing any of them
+        for (const auto& name : args.handles) {
+            if (tensor_storage.find(name) == tensor_storage.end()) {
+                throw std::runtime_error("Invalid tensor name: " + name);
+            }
+        }
+
+        for (const auto& name : args.handles) {
+            ReleaseHandle(name);
+        }
+
+        Tcl_SetObjResult(interp, Tcl_NewIntObj(static_cast<int>(args.handles.size())));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// torch::release - Release tensor, module, optimizer or scheduler handles.
+// Unknown handles are ignored so the command is safe to use in cleanup code.
+int Release_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        HandleFreeArgs args = ParseHandleFreeArgs(interp, objc, objv, "release", "-handles");
+
+        int released = 0;
+        for (const auto& name : args.handles) {
+            if (ReleaseHandle(name)) {
+                released++;
+            }
+        }
+
+        Tcl_SetObjResult(interp, Tcl_NewIntObj(released));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for handle_autorelease command
+struct HandleAutoreleaseArgs {
+    bool has_value = false;
+    bool enabled = false;
+};
+
+// Parse dual syntax: ?enabled? | -enabled bool
+static HandleAutoreleaseArgs ParseHandleAutoreleaseArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    HandleAutoreleaseArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error("Usage: torch::handle_autorelease ?enabled?");
+        }
+        args.enabled = GetBoolFromObj(interp, objv[1]);
+        args.has_value = true;
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-enabled") {
+                args.enabled = GetBoolFromObj(interp, objv[i + 1]);
+                args.has_value = true;
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -enabled");
+            }
+        }
+    }
+
+    return args;
+}
+
+// torch::handle_autorelease - Query or set automatic reclamation of handles
+// once the last Tcl object referring to them is freed
+int HandleAutorelease_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        HandleAutoreleaseArgs args = ParseHandleAutoreleaseArgs(interp, objc, objv);
+        if (args.has_value) {
+            SetHandleAutorelease(args.enabled);
+        }
+
+        Tcl_SetObjResult(interp, Tcl_NewBooleanObj(GetHandleAutorelease()));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for handle_count command
+struct HandleCountArgs {
+    std::string kind = "all";
+
+    bool IsValid() const {
+        return kind == "all" || kind == "tensor" || kind == "module" ||
+               kind == "optimizer" || kind == "scheduler" || kind == "reader" ||
+               kind == "dataset" || kind == "dataloader" || kind == "packed" ||
+               kind == "stream" || kind == "future" ||
+               kind == "server" || kind == "reserved";
+    }
+};
+
+// Parse dual syntax: ?kind? | -kind kind
+static HandleCountArgs ParseHandleCountArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    HandleCountArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error("Usage: torch::handle_count ?kind?");
+        }
+        args.kind = Tcl_GetString(objv[1]);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-kind") {
+                args.kind = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -kind");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Invalid kind: " + args.kind + ". Valid kinds are: all, tensor, module, optimizer, scheduler, reader, dataset, dataloader, packed, stream, future, server, reserved");
+    }
+
+    return args;
+}
+
+// torch::handle_count - Number of live handles, overall or per kind
+int HandleCount_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        HandleCountArgs args = ParseHandleCountArgs(interp, objc, objv);
+
+        size_t count = 0;
+        if (args.kind == "all" || args.kind == "tensor") count += tensor_storage.size() + LazyHandleCount();
+        if (args.kind == "all" || args.kind == "module") count += module_storage.size();
+        if (args.kind == "all" || args.kind == "optimizer") count += optimizer_storage.size();
+        if (args.kind == "all" || args.kind == "scheduler") count += SchedulerHandleCount();
+        if (args.kind == "all" || args.kind == "reader") count += NpyReaderHandleCount();
+        if (args.kind == "all" || args.kind == "dataset") count += DatasetHandleCount();
+        if (args.kind == "all" || args.kind == "dataloader") count += DataLoaderHandleCount();
+        if (args.kind == "all" || args.kind == "packed") count += PackedSequenceHandleCount();
+        if (args.kind == "all" || args.kind == "stream") count += RnnStreamHandleCount();
+        if (args.kind == "all" || args.kind == "future") count += AsyncFutureHandleCount();
+        if (args.kind == "all" || args.kind == "server") count += ServerHandleCount();
+        // Not part of "all": pending lazy tensors are already counted above
+        if (args.kind == "reserved") count += tensor_storage.reserved();
+
+        Tcl_SetObjResult(interp, Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(count)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for scope command
+struct ScopeArgs {
+    Tcl_Obj* body = nullptr;
+    std::vector<std::string> keep;  // variable names whose handles escape
+
+    bool IsValid() const {
+        return body != nullptr;
+    }
+};
+
+// Parse dual syntax: body ?-keep varList? | -body script ?-keep varList?
+static ScopeArgs ParseScopeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    ScopeArgs args;
+
+    if (objc < 2) {
+        throw std::runtime_error("Usage: torch::scope body ?-keep varList? | torch::scope -body script ?-keep varList?");
+    }
+
+    int first = 1;
+    if (Tcl_GetString(objv[1])[0] != '-') {
+        // Positional body, optionally followed by named options
+        args.body = objv[1];
+        first = 2;
+    }
+
+    for (int i = first; i < objc; i += 2) {
+        if (i + 1 >= objc) {
+            throw std::runtime_error("Missing value for parameter");
+        }
+
+        std::string param = Tcl_GetString(objv[i]);
+        if (param == "-body") {
+            args.body = objv[i + 1];
+        } else if (param == "-keep") {
+            args.keep = CollectHandleNames(interp, objv[i + 1]);
+        } else {
+            throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -body, -keep");
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: body");
+    }
+
+    return args;
+}
+
+// Add a value and, if it is a well-formed list, each of its elements
+static void CollectEscapingNames(Tcl_Obj* value, std::unordered_set<std::string>& names) {
+    names.insert(Tcl_GetString(value));
+
+    int count;
+    Tcl_Obj** elements;
+    if (Tcl_ListObjGetElements(nullptr, value, &count, &elements) == TCL_OK) {
+        for (int i = 0; i < count; i++) {
+            names.insert(Tcl_GetString(elements[i]));
+        }
+    }
+}
+
+// torch::scope - Evaluate body in the caller's frame and release every handle
+// it allocated, except those in the result or in the -keep variables. Handles
+// that escape a nested scope are handed to the enclosing one.
+int Scope_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    ScopeArgs args;
+    try {
+        args = ParseScopeArgs(interp, objc, objv);
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+
+    PushHandleScope();
+    int code = Tcl_EvalObjEx(interp, args.body, 0);
+    std::vector<std::string> created = PopHandleScope();
+
+    // The body's result (or error message) is passed through unchanged
+    Tcl_Obj* result = Tcl_GetObjResult(interp);
+    Tcl_IncrRefCount(result);
+
+    std::unordered_set<std::string> escaping;
+    if (code != TCL_ERROR) {
+        CollectEscapingNames(result, escaping);
+    }
+    for (const auto& var : args.keep) {
+        Tcl_Obj* value = Tcl_GetVar2Ex(interp, var.c_str(), nullptr, 0);
+        if (value != nullptr) {
+            CollectEscapingNames(value, escaping);
+        }
+    }
+
+    for (const auto& name : created) {
+        if (escaping.count(name)) {
+            RecordScopedHandle(name);
+        } else {
+            ReleaseHandle(name);
+        }
+    }
+
+    Tcl_SetObjResult(interp, result);
+    Tcl_DecrRefCount(result);
+    return code;
+}
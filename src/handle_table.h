@@ -0,0 +1,286 @@
+#ifndef HANDLE_TABLE_H
+#define HANDLE_TABLE_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Generational slot map keyed by handle strings.
+//
+// Handles produced by Reserve() have the form <prefix><index> for the first
+// use of a slot and <prefix><index>_<generation> once the slot has been
+// reused. The first use of every slot therefore yields the familiar
+// "tensor0", "tensor1", ... names, a reused slot yields e.g. "tensor1_1",
+// and a released handle never resolves to its successor. Keeping the names
+// this short keeps them within std::string's small buffer.
+//
+// Lookups parse the index (and generation) and index the slot directly; no
+// hashing or node allocation is involved. Names that are not of that form (or refer to a
+// slot generation that no longer exists) fall back to an ordinary map, which
+// keeps arbitrary names usable as before.
+//
+// The interface mirrors the parts of std::unordered_map the commands use
+// (find/end/operator[]/erase/size, it->second). Entries never move once
+// created, so pointers to values stay valid until erased.
+//
+// An optional miss handler lets the owner fill in a reserved entry on first
+// lookup, which is how lazily evaluated tensors materialize on demand.
+//
+// A slot reserved through Reservation is freed again if the reservation is
+// dropped before a value is stored, so a command that throws between
+// reserving a handle and filling it does not leave the slot Reserved forever.
+template <typename T>
+class HandleTable {
+public:
+    // Named after std::pair's member so existing it->second code works
+    struct value_type {
+        T second{};
+    };
+
+    class iterator {
+    public:
+        iterator() = default;
+        explicit iterator(value_type* entry) : entry_(entry) {}
+
+        value_type& operator*() const { return *entry_; }
+        value_type* operator->() const { return entry_; }
+        bool operator==(const iterator& other) const { return entry_ == other.entry_; }
+        bool operator!=(const iterator& other) const { return entry_ != other.entry_; }
+
+    private:
+        value_type* entry_ = nullptr;
+    };
+
+    explicit HandleTable(std::string prefix) : prefix_(std::move(prefix)) {}
+
+    HandleTable(const HandleTable&) = delete;
+    HandleTable& operator=(const HandleTable&) = delete;
+
+    // Allocate a slot and return its handle. The slot becomes visible to
+    // find() once a value is assigned through operator[].
+    std::string Reserve() {
+        uint32_t index;
+        if (!free_.empty()) {
+            index = free_.back();
+            free_.pop_back();
+        } else {
+            index = next_index_++;
+            if ((index % kChunkSize) == 0) {
+                chunks_.emplace_back(new Slot[kChunkSize]);
+            }
+        }
+
+        Slot& slot = SlotAt(index);
+        std::string handle = MakeName(slot.generation, index);
+        while (!overflow_.empty() && overflow_.count(handle)) {
+            // Name already taken by an explicitly named entry
+            handle = MakeName(++slot.generation, index);
+        }
+        slot.state = SlotState::Reserved;
+        return handle;
+    }
+
+    // Owns a reserved handle until Fill() stores a value under it or Keep()
+    // hands it off; otherwise the destructor frees the slot
+    class Reservation {
+    public:
+        explicit Reservation(HandleTable& table) : table_(&table), name_(table.Reserve()) {}
+        Reservation(Reservation&& other) noexcept
+            : table_(std::exchange(other.table_, nullptr)), name_(std::move(other.name_)) {}
+        Reservation(const Reservation&) = delete;
+        Reservation& operator=(const Reservation&) = delete;
+        Reservation& operator=(Reservation&&) = delete;
+
+        ~Reservation() {
+            if (table_ != nullptr) {
+                table_->Unreserve(name_);
+            }
+        }
+
+        const std::string& name() const { return name_; }
+
+        std::string Fill(T value) {
+            (*table_)[name_] = std::move(value);
+            table_ = nullptr;
+            return name_;
+        }
+
+        // Leave the slot reserved; the caller (or a miss handler) fills it
+        std::string Keep() {
+            table_ = nullptr;
+            return name_;
+        }
+
+    private:
+        HandleTable* table_;
+        std::string name_;
+    };
+
+    // Free a slot that was reserved but never assigned. Assigned entries and
+    // names that are not reserved slots are left alone.
+    void Unreserve(const std::string& name) {
+        Slot* slot = Lookup(name);
+        if (slot != nullptr && slot->state == SlotState::Reserved) {
+            slot->state = SlotState::Free;
+            slot->generation++;
+            free_.push_back(ParseIndex(name));
+        }
+    }
+
+    iterator find(const std::string& name) {
+        iterator it = FindPresent(name);
+        if (it == end() && miss_handler_ != nullptr && miss_handler_(name)) {
+            it = FindPresent(name);
+        }
+        return it;
+    }
+
+    // handler(name) is called when find() misses; returning true means it
+    // stored a value under name and the lookup should be retried
+    void SetMissHandler(bool (*handler)(const std::string&)) { miss_handler_ = handler; }
+
+    iterator end() { return iterator(); }
+
+    T& operator[](const std::string& name) {
+        Slot* slot = Lookup(name);
+        if (slot != nullptr) {
+            if (slot->state == SlotState::Reserved) {
+                slot->state = SlotState::Occupied;
+                live_++;
+            }
+            return slot->entry.second;
+        }
+        return overflow_[name].second;
+    }
+
+    size_t erase(const std::string& name) {
+        Slot* slot = Lookup(name);
+        if (slot == nullptr) {
+            return overflow_.erase(name);
+        }
+
+        bool occupied = slot->state == SlotState::Occupied;
+        slot->entry.second = T();
+        slot->state = SlotState::Free;
+        slot->generation++;
+        free_.push_back(ParseIndex(name));
+        if (occupied) {
+            live_--;
+            return 1;
+        }
+        return 0;
+    }
+
+    size_t size() const { return live_ + overflow_.size(); }
+
+    // Slots reserved but not assigned a value yet
+    size_t reserved() const { return next_index_ - free_.size() - live_; }
+
+private:
+    enum class SlotState : uint8_t { Free, Reserved, Occupied };
+
+    struct Slot {
+        value_type entry;
+        uint32_t generation = 0;
+        SlotState state = SlotState::Free;
+    };
+
+    static constexpr uint32_t kChunkSize = 1024;
+
+    std::string MakeName(uint32_t generation, uint32_t index) const {
+        char digits[21];  // <index>_<generation>, 10 digits each
+        char* end = std::to_chars(digits, digits + 10, index).ptr;
+        if (generation > 0) {
+            *end++ = '_';
+            end = std::to_chars(end, digits + sizeof(digits), generation).ptr;
+        }
+
+        std::string name;
+        name.reserve(prefix_.size() + static_cast<size_t>(end - digits));
+        name.append(prefix_);
+        name.append(digits, end);
+        return name;
+    }
+
+    Slot& SlotAt(uint32_t index) {
+        return chunks_[index / kChunkSize][index % kChunkSize];
+    }
+
+    // Decode <prefix><index>[_<generation>]; false for anything else,
+    // including leading zeros and an explicit "_0", so every slot has exactly
+    // one spelling.
+    bool ParseName(const std::string& name, uint32_t& index, uint32_t& generation) const {
+        size_t len = prefix_.size();
+        if (name.size() <= len || name.compare(0, len, prefix_) != 0) {
+            return false;
+        }
+        const char* first = name.data() + len;
+        const char* last = name.data() + name.size();
+        const char* sep = std::find(first, last, '_');
+
+        if (!ParseDecimal(first, sep, index)) {
+            return false;
+        }
+        generation = 0;
+        if (sep == last) {
+            return true;
+        }
+        return ParseDecimal(sep + 1, last, generation) && generation > 0;
+    }
+
+    static bool ParseDecimal(const char* first, const char* last, uint32_t& value) {
+        if (first == last || (*first == '0' && last - first > 1)) {
+            return false;
+        }
+        auto result = std::from_chars(first, last, value);
+        return result.ec == std::errc() && result.ptr == last;
+    }
+
+    uint32_t ParseIndex(const std::string& name) const {
+        uint32_t index = 0;
+        uint32_t generation = 0;
+        ParseName(name, index, generation);
+        return index;
+    }
+
+    iterator FindPresent(const std::string& name) {
+        Slot* slot = Lookup(name);
+        if (slot != nullptr) {
+            return slot->state == SlotState::Occupied ? iterator(&slot->entry) : end();
+        }
+        auto it = overflow_.find(name);
+        return it != overflow_.end() ? iterator(&it->second) : end();
+    }
+
+    // Live (reserved or occupied) slot named by name, or nullptr
+    Slot* Lookup(const std::string& name) {
+        uint32_t index;
+        uint32_t generation;
+        if (!ParseName(name, index, generation)) {
+            return nullptr;
+        }
+        if (index >= next_index_) {
+            return nullptr;
+        }
+        Slot& slot = SlotAt(index);
+        if (slot.state == SlotState::Free || slot.generation != generation) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    std::string prefix_;
+    std::vector<std::unique_ptr<Slot[]>> chunks_;
+    std::vector<uint32_t> free_;
+    uint32_t next_index_ = 0;
+    size_t live_ = 0;
+    std::unordered_map<std::string, value_type> overflow_;
+    bool (*miss_handler_)(const std::string&) = nullptr;
+};
+
+#endif // HANDLE_TABLE_H
@@ -1,10 +1,11 @@
 #include "libtorchtcl.h"
 #include <atomic>
+#include <type_traits>
 
-// Global storage definitions
-std::unordered_map<std::string, torch::Tensor> tensor_storage;
-std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
-std::unordered_map<std::string, std::shared_ptr<torch::nn::Module>> module_storage;
+// Handle table definitions, one set per interpreter thread
+thread_local HandleTable<torch::Tensor> tensor_storage("tensor");
+thread_local std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
+thread_local std::unordered_map<std::string, ModuleRef> module_storage;
 
 // Helper function to get scalar type from string
 c10::ScalarType GetScalarType(const char* type_str) {
@@ -13,6 +14,11 @@ c10::ScalarType GetScalarType(const char* type_str) {
     if (strcmp(type_str, "int32") == 0 || strcmp(type_str, "Int32") == 0 || strcmp(type_str, "int") == 0) return torch::kInt32;
     if (strcmp(type_str, "int64") == 0 || strcmp(type_str, "Int64") == 0 || strcmp(type_str, "long") == 0) return torch::kInt64;
     if (strcmp(type_str, "bool") == 0 || strcmp(type_str, "Bool") == 0) return torch::kBool;
+    if (strcmp(type_str, "float16") == 0 || strcmp(type_str, "Float16") == 0 || strcmp(type_str, "half") == 0) return torch::kFloat16;
+    if (strcmp(type_str, "bfloat16") == 0 || strcmp(type_str, "BFloat16") == 0) return torch::kBFloat16;
+    if (strcmp(type_str, "int16") == 0 || strcmp(type_str, "Int16") == 0 || strcmp(type_str, "short") == 0) return torch::kInt16;
+    if (strcmp(type_str, "int8") == 0 || strcmp(type_str, "Int8") == 0) return torch::kInt8;
+    if (strcmp(type_str, "uint8") == 0 || strcmp(type_str, "UInt8") == 0 || strcmp(type_str, "byte") == 0) return torch::kUInt8;
     throw std::runtime_error(std::string("Unknown scalar type: ") + type_str);
 }
 
@@ -31,88 +37,129 @@ torch::Device GetDevice(const char* device_str) {
     return torch::kCPU;
 }
 
-// Helper function to convert TCL list (supports 1-D or 2-D rectangular lists) to tensor with type
-torch::Tensor TclListToTensor(Tcl_Interp* interp, Tcl_Obj* list,
-                             const char* type_str,
-                             const char* device_str,
-                             bool requires_grad) {
-    int outerLen;
-    if (Tcl_ListObjLength(interp, list, &outerLen) != TCL_OK) {
-        throw std::runtime_error("Invalid list object");
+// Convert one leaf of a nested Tcl list to the destination element type.
+// Integer types go through Tcl_GetWideIntFromObj so large values keep full
+// precision; non-integral input such as 1.5 is truncated as before.
+template <typename T>
+static T TclElementValue(Tcl_Obj* obj) {
+    double d;
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        Tcl_WideInt w;
+        if (Tcl_GetWideIntFromObj(nullptr, obj, &w) == TCL_OK) {
+            return static_cast<T>(w);
+        }
+    }
+    if (Tcl_GetDoubleFromObj(nullptr, obj, &d) != TCL_OK) {
+        throw std::runtime_error("Invalid numeric value in list");
+    }
+    if constexpr (std::is_same_v<T, bool>) {
+        return d != 0.0;
+    } else {
+        return static_cast<T>(d);
+    }
+}
+
+// Write the leaves of list into out in row-major order, checking every
+// sub-list against the inferred shape.
+template <typename T>
+static void FillFromTclList(Tcl_Obj* list, const std::vector<int64_t>& shape, size_t depth, T*& out) {
+    int count;
+    Tcl_Obj** elems;
+    if (Tcl_ListObjGetElements(nullptr, list, &count, &elems) != TCL_OK) {
+        throw std::runtime_error("Invalid sub-list in tensor data");
+    }
+    if (count != shape[depth]) {
+        throw std::runtime_error("Jagged lists are not supported – each row must have equal length");
     }
 
-    if (outerLen == 0) {
-        // Create an empty tensor with the specified options
-        auto options = torch::TensorOptions()
-            .dtype(GetScalarType(type_str))
-            .device(GetDevice(device_str))
-            .requires_grad(requires_grad);
-        
-        return torch::empty({0}, options);
+    if (depth + 1 < shape.size()) {
+        for (int i = 0; i < count; ++i) {
+            FillFromTclList(elems[i], shape, depth + 1, out);
+        }
+    } else {
+        for (int i = 0; i < count; ++i) {
+            *out++ = TclElementValue<T>(elems[i]);
+        }
     }
+}
+
+template <typename T>
+static void FillTensorFromTclList(torch::Tensor& tensor, Tcl_Obj* list, const std::vector<int64_t>& shape) {
+    T* out = tensor.data_ptr<T>();
+    FillFromTclList(list, shape, 0, out);
+}
 
-    // Detect if first element is a list (2-D case)
-    Tcl_Obj* firstElem;
-    Tcl_ListObjIndex(interp, list, 0, &firstElem);
-    int innerLen = 0;
-    bool firstElemIsList = (Tcl_ListObjLength(interp, firstElem, &innerLen) == TCL_OK);
-    double dummyNumeric;
-    bool firstElemIsNumeric = (Tcl_GetDoubleFromObj(interp, firstElem, &dummyNumeric) == TCL_OK);
-    bool is2D = firstElemIsList && !firstElemIsNumeric;
+// Helper function to convert a (possibly nested) TCL list to a tensor. The
+// shape is taken from the first element at each level, the tensor is
+// allocated once in the requested dtype, and values are written straight
+// into its storage.
+torch::Tensor TclListToTensor(Tcl_Interp* interp, Tcl_Obj* list,
+                             const char* type_str,
+                             const char* device_str,
+                             bool requires_grad) {
+    (void)interp; // Suppress unused parameter warning
 
-    std::vector<double> flat;
+    // Infer the shape by following the first element down
     std::vector<int64_t> shape;
+    Tcl_Obj* current = list;
+    while (true) {
+        int count;
+        Tcl_Obj** elems;
+        if (Tcl_ListObjGetElements(nullptr, current, &count, &elems) != TCL_OK) {
+            throw std::runtime_error(shape.empty() ? "Invalid list object" : "Invalid sub-list in tensor data");
+        }
+        shape.push_back(count);
+        if (count == 0) {
+            break;
+        }
 
-    if (!is2D) {
-        // ---------------- 1-D ----------------
-        shape.push_back(outerLen);
-        flat.reserve(outerLen);
-        for (int i = 0; i < outerLen; ++i) {
-            Tcl_Obj* elem;
-            Tcl_ListObjIndex(interp, list, i, &elem);
-            double v;
-            if (Tcl_GetDoubleFromObj(interp, elem, &v) != TCL_OK) {
-                throw std::runtime_error("Invalid numeric value in list");
-            }
-            flat.push_back(v);
+        double numeric;
+        if (Tcl_GetDoubleFromObj(nullptr, elems[0], &numeric) == TCL_OK) {
+            break;
         }
-    } else {
-        // ---------------- 2-D ----------------
-        shape.push_back(outerLen);       // rows
-        shape.push_back(innerLen);       // cols
-        flat.reserve(static_cast<size_t>(outerLen) * innerLen);
-
-        // Validate rectangular matrix and collect values
-        for (int r = 0; r < outerLen; ++r) {
-            Tcl_Obj* rowObj;
-            Tcl_ListObjIndex(interp, list, r, &rowObj);
-            int thisLen;
-            if (Tcl_ListObjLength(interp, rowObj, &thisLen) != TCL_OK) {
-                throw std::runtime_error("Invalid sub-list in 2-D tensor data");
-            }
-            if (thisLen != innerLen) {
-                throw std::runtime_error("Jagged lists are not supported – each row must have equal length");
-            }
-            for (int c = 0; c < innerLen; ++c) {
-                Tcl_Obj* elem;
-                Tcl_ListObjIndex(interp, rowObj, c, &elem);
-                double v;
-                if (Tcl_GetDoubleFromObj(interp, elem, &v) != TCL_OK) {
-                    throw std::runtime_error("Invalid numeric value in list");
-                }
-                flat.push_back(v);
-            }
+        // A single word that is not a number is a bad leaf, not a nested list
+        int subCount;
+        Tcl_Obj** subElems;
+        if (Tcl_ListObjGetElements(nullptr, elems[0], &subCount, &subElems) != TCL_OK ||
+            (subCount == 1 && strcmp(Tcl_GetString(subElems[0]), Tcl_GetString(elems[0])) == 0)) {
+            break;
         }
+        current = elems[0];
+    }
+
+    c10::ScalarType dtype = GetScalarType(type_str);
+    torch::Device device = GetDevice(device_str);
+
+    // Reduced-precision floats are filled as float64 and converted once
+    c10::ScalarType fillType = dtype;
+    if (dtype == torch::kFloat16 || dtype == torch::kBFloat16) {
+        fillType = torch::kFloat64;
     }
 
-    auto options = torch::TensorOptions()
-        .dtype(GetScalarType(type_str))
-        .device(GetDevice(device_str))
-        .requires_grad(requires_grad);
+    torch::Tensor t = torch::empty(shape, torch::TensorOptions().dtype(fillType));
+    if (t.numel() > 0) {
+        switch (fillType) {
+            case torch::kFloat32: FillTensorFromTclList<float>(t, list, shape); break;
+            case torch::kFloat64: FillTensorFromTclList<double>(t, list, shape); break;
+            case torch::kInt64:   FillTensorFromTclList<int64_t>(t, list, shape); break;
+            case torch::kInt32:   FillTensorFromTclList<int32_t>(t, list, shape); break;
+            case torch::kInt16:   FillTensorFromTclList<int16_t>(t, list, shape); break;
+            case torch::kInt8:    FillTensorFromTclList<int8_t>(t, list, shape); break;
+            case torch::kUInt8:   FillTensorFromTclList<uint8_t>(t, list, shape); break;
+            case torch::kBool:    FillTensorFromTclList<bool>(t, list, shape); break;
+            default:
+                throw std::runtime_error("Unsupported dtype for list conversion");
+        }
+    }
 
-    torch::Tensor t = torch::tensor(flat, options);
-    if (shape.size() > 1) {
-        t = t.reshape(shape);
+    if (fillType != dtype) {
+        t = t.to(dtype);
+    }
+    if (!device.is_cpu()) {
+        t = t.to(device);
+    }
+    if (requires_grad) {
+        t.set_requires_grad(true);
     }
     return t;
 }
@@ -143,20 +190,61 @@ std::vector<int64_t> TclListToShape(Tcl_Interp* interp, Tcl_Obj* list) {
     return shape;
 }
 
-// Helper function to generate unique handles
+// Open torch::scope frames, innermost last. Each frame lists the handles
+// allocated while it was innermost.
+static thread_local std::vector<std::vector<std::string>> handle_scopes;
+
+// Helper function to generate unique handles. Tensor handles come from
+// StoreTensor or ReserveTensorHandle instead, so a command that fails
+// before storing its result never holds a tensor slot.
 std::string GetNextHandle(const std::string& prefix) {
     static std::atomic<int> counter{0};
-    return prefix + std::to_string(counter.fetch_add(1));
+    if (prefix == "tensor") {
+        throw std::runtime_error("Tensor handles must be allocated with StoreTensor or ReserveTensorHandle");
+    }
+    std::string handle = prefix + std::to_string(counter.fetch_add(1));
+    RecordScopedHandle(handle);
+    return handle;
+}
+
+TensorReservation ReserveTensorHandle() {
+    TensorReservation reservation(tensor_storage);
+    RecordScopedHandle(reservation.name());
+    return reservation;
+}
+
+std::string StoreTensor(const torch::Tensor& tensor) {
+    return ReserveTensorHandle().Fill(tensor);
 }
 
 // Helper function to get tensor from Tcl object
 torch::Tensor GetTensorFromObj(Tcl_Interp* interp, Tcl_Obj* obj) {
     (void)interp; // Suppress unused parameter warning
-    std::string name = Tcl_GetString(obj);
-    if (tensor_storage.find(name) == tensor_storage.end()) {
+    torch::Tensor* tensor = FindTensorFromObj(obj);
+    if (tensor == nullptr) {
         throw std::runtime_error("Invalid tensor");
     }
-    return tensor_storage[name];
+    return *tensor;
+}
+
+// Helper function to get module from Tcl object
+std::shared_ptr<torch::nn::Module> GetModuleFromObj(Tcl_Interp* interp, Tcl_Obj* obj) {
+    (void)interp; // Suppress unused parameter warning
+    ModuleRef* module = FindModuleFromObj(obj);
+    if (module == nullptr) {
+        throw std::runtime_error("Invalid module");
+    }
+    return *module;
+}
+
+// Helper function to get optimizer from Tcl object
+std::shared_ptr<torch::optim::Optimizer> GetOptimizerFromObj(Tcl_Interp* interp, Tcl_Obj* obj) {
+    (void)interp; // Suppress unused parameter warning
+    std::shared_ptr<torch::optim::Optimizer>* optimizer = FindOptimizerFromObj(obj);
+    if (optimizer == nullptr) {
+        throw std::runtime_error("Invalid optimizer");
+    }
+    return *optimizer;
 }
 
 // Helper function to get integer from Tcl object
@@ -168,6 +256,14 @@ int GetIntFromObj(Tcl_Interp* interp, Tcl_Obj* obj) {
     return value;
 }
 
+int64_t GetInt64FromObj(Tcl_Interp* interp, Tcl_Obj* obj) {
+    Tcl_WideInt value;
+    if (Tcl_GetWideIntFromObj(interp, obj, &value) != TCL_OK) {
+        throw std::runtime_error("Invalid integer value");
+    }
+    return static_cast<int64_t>(value);
+}
+
 // Helper function to get double from Tcl object
 double GetDoubleFromObj(Tcl_Interp* interp, Tcl_Obj* obj) {
     double value;
@@ -214,10 +310,368 @@ std::vector<int64_t> GetIntVectorFromObj(Tcl_Interp* interp, Tcl_Obj* obj) {
 
 // Helper function to set tensor result
 int SetTensorResult(Tcl_Interp* interp, const torch::Tensor& tensor) {
-    std::string handle = GetNextHandle("tensor");
-    tensor_storage[handle] = tensor;
-    Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+    std::string handle = StoreTensor(tensor);
+    Tcl_SetObjResult(interp, NewHandleObj(handle));
     return TCL_OK;
 }
 
- 
\ No newline at end of file
+ 
+// ============================================================================
+// Handle object types
+// ============================================================================
+
+// Bookkeeping record shared by every Tcl_Obj whose internal representation
+// refers to a handle. obj_refs counts those Tcl_Objs; when it drops to zero on
+// an autorelease handle, the stored object is released. The storage slot is
+// resolved on first use and cached here, so repeated lookups through any of
+// the Tcl_Objs cost no hashing. Storage entries stay put until erased,
+// and erasing only happens through ReleaseHandle, which clears the cache.
+struct HandleRef {
+    std::string name;
+    int obj_refs = 0;
+    bool autorelease = false;
+    bool released = false;
+    torch::Tensor* tensor = nullptr;
+    ModuleRef* module = nullptr;
+    std::shared_ptr<torch::optim::Optimizer>* optimizer = nullptr;
+};
+
+static thread_local std::unordered_map<std::string, HandleRef*> handle_refs;
+static thread_local bool handle_autorelease_enabled = false;
+
+static void FreeHandleIntRep(Tcl_Obj* objPtr);
+static void DupHandleIntRep(Tcl_Obj* srcPtr, Tcl_Obj* dupPtr);
+static void UpdateHandleString(Tcl_Obj* objPtr);
+static int SetHandleFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr);
+static int SetTensorFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr);
+static int SetModuleFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr);
+static int SetOptimizerFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr);
+
+// All handle types share one internal representation (a HandleRef pointer),
+// so an object can move between them without reallocating anything.
+static Tcl_ObjType torchHandleType = {
+    "torchHandle", FreeHandleIntRep, DupHandleIntRep, UpdateHandleString, SetHandleFromAny
+};
+static Tcl_ObjType torchTensorType = {
+    "torchTensor", FreeHandleIntRep, DupHandleIntRep, UpdateHandleString, SetTensorFromAny
+};
+static Tcl_ObjType torchModuleType = {
+    "torchModule", FreeHandleIntRep, DupHandleIntRep, UpdateHandleString, SetModuleFromAny
+};
+static Tcl_ObjType torchOptimizerType = {
+    "torchOptimizer", FreeHandleIntRep, DupHandleIntRep, UpdateHandleString, SetOptimizerFromAny
+};
+
+static bool IsHandleObjType(const Tcl_ObjType* typePtr) {
+    return typePtr == &torchHandleType || typePtr == &torchTensorType ||
+           typePtr == &torchModuleType || typePtr == &torchOptimizerType;
+}
+
+static HandleRef* HandleRefFromObj(Tcl_Obj* objPtr) {
+    return static_cast<HandleRef*>(objPtr->internalRep.twoPtrValue.ptr1);
+}
+
+static void DropHandleRef(HandleRef* ref) {
+    auto it = handle_refs.find(ref->name);
+    if (it != handle_refs.end() && it->second == ref) {
+        handle_refs.erase(it);
+    }
+    delete ref;
+}
+
+static void FreeHandleIntRep(Tcl_Obj* objPtr) {
+    HandleRef* ref = HandleRefFromObj(objPtr);
+    objPtr->typePtr = nullptr;
+    if (ref == nullptr) {
+        return;
+    }
+
+    // A Tcl_Obj that is still referenced is being shimmered to another type,
+    // not deleted. Its string rep lives on where we can no longer see it, so
+    // the handle must not be reclaimed automatically from now on.
+    if (objPtr->refCount > 0) {
+        ref->autorelease = false;
+    }
+
+    if (--ref->obj_refs > 0) {
+        return;
+    }
+    if (!ref->released && ref->autorelease) {
+        std::string name = ref->name;
+        ReleaseHandle(name);
+        return;
+    }
+    DropHandleRef(ref);
+}
+
+static void DupHandleIntRep(Tcl_Obj* srcPtr, Tcl_Obj* dupPtr) {
+    HandleRef* ref = HandleRefFromObj(srcPtr);
+    ref->obj_refs++;
+    dupPtr->internalRep.twoPtrValue.ptr1 = ref;
+    dupPtr->internalRep.twoPtrValue.ptr2 = nullptr;
+    dupPtr->typePtr = srcPtr->typePtr;
+}
+
+static void UpdateHandleString(Tcl_Obj* objPtr) {
+    const std::string& name = HandleRefFromObj(objPtr)->name;
+    objPtr->bytes = Tcl_Alloc(static_cast<unsigned int>(name.size() + 1));
+    memcpy(objPtr->bytes, name.c_str(), name.size() + 1);
+    objPtr->length = static_cast<int>(name.size());
+}
+
+static HandleRef* AcquireHandleRef(const std::string& name, bool autorelease) {
+    auto it = handle_refs.find(name);
+    if (it != handle_refs.end()) {
+        return it->second;
+    }
+    HandleRef* ref = new HandleRef();
+    ref->name = name;
+    ref->autorelease = autorelease;
+    handle_refs[name] = ref;
+    return ref;
+}
+
+static void AttachHandleRef(Tcl_Obj* objPtr, HandleRef* ref, const Tcl_ObjType* typePtr) {
+    ref->obj_refs++;
+    objPtr->internalRep.twoPtrValue.ptr1 = ref;
+    objPtr->internalRep.twoPtrValue.ptr2 = nullptr;
+    objPtr->typePtr = typePtr;
+}
+
+// Replace whatever internal rep objPtr has with a reference to name's
+// HandleRef. Handles first seen as plain strings were never owned by a
+// Tcl_Obj, so they are only ever released explicitly.
+static HandleRef* ConvertToHandleRef(Tcl_Obj* objPtr, const std::string& name, const Tcl_ObjType* typePtr) {
+    HandleRef* ref = AcquireHandleRef(name, false);
+    if (IsHandleObjType(objPtr->typePtr) && HandleRefFromObj(objPtr) == ref) {
+        // Moving between handle types is not a shimmer; just retype
+        objPtr->typePtr = typePtr;
+        return ref;
+    }
+    ref->obj_refs++;  // keep ref alive while the old rep is freed
+    if (objPtr->typePtr && objPtr->typePtr->freeIntRepProc) {
+        objPtr->typePtr->freeIntRepProc(objPtr);
+    }
+    objPtr->typePtr = nullptr;
+    ref->obj_refs--;
+    AttachHandleRef(objPtr, ref, typePtr);
+    return ref;
+}
+
+static int SetHandleFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr) {
+    std::string name = Tcl_GetString(objPtr);
+    if (!HandleExists(name)) {
+        if (interp) {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("Invalid handle: %s", name.c_str()));
+        }
+        return TCL_ERROR;
+    }
+    ConvertToHandleRef(objPtr, name, &torchHandleType);
+    return TCL_OK;
+}
+
+static int SetTensorFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr) {
+    std::string name = Tcl_GetString(objPtr);
+    auto it = tensor_storage.find(name);
+    if (it == tensor_storage.end()) {
+        if (interp) {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("Invalid tensor: %s", name.c_str()));
+        }
+        return TCL_ERROR;
+    }
+    ConvertToHandleRef(objPtr, name, &torchTensorType)->tensor = &it->second;
+    return TCL_OK;
+}
+
+static int SetModuleFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr) {
+    std::string name = Tcl_GetString(objPtr);
+    auto it = module_storage.find(name);
+    if (it == module_storage.end()) {
+        if (interp) {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("Invalid module: %s", name.c_str()));
+        }
+        return TCL_ERROR;
+    }
+    ConvertToHandleRef(objPtr, name, &torchModuleType)->module = &it->second;
+    return TCL_OK;
+}
+
+static int SetOptimizerFromAny(Tcl_Interp* interp, Tcl_Obj* objPtr) {
+    std::string name = Tcl_GetString(objPtr);
+    auto it = optimizer_storage.find(name);
+    if (it == optimizer_storage.end()) {
+        if (interp) {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("Invalid optimizer: %s", name.c_str()));
+        }
+        return TCL_ERROR;
+    }
+    ConvertToHandleRef(objPtr, name, &torchOptimizerType)->optimizer = &it->second;
+    return TCL_OK;
+}
+
+// Resolve objPtr to a live HandleRef of the given type. Objects that already
+// carry a live handle rep are retyped in place; anything else (plain strings,
+// other types, or reps left behind by a released handle) goes through the
+// type's setFromAnyProc, which falls back to a by-name storage lookup.
+static HandleRef* ResolveHandleObj(Tcl_Obj* objPtr, Tcl_ObjType* typePtr) {
+    if (objPtr == nullptr) {
+        return nullptr;  // optional argument that was not given
+    }
+    if (IsHandleObjType(objPtr->typePtr)) {
+        HandleRef* ref = HandleRefFromObj(objPtr);
+        if (!ref->released) {
+            objPtr->typePtr = typePtr;
+            return ref;
+        }
+    }
+    if (typePtr->setFromAnyProc(nullptr, objPtr) != TCL_OK) {
+        return nullptr;
+    }
+    return HandleRefFromObj(objPtr);
+}
+
+// Register the handle object types with Tcl
+void RegisterHandleObjType() {
+    Tcl_RegisterObjType(&torchHandleType);
+    Tcl_RegisterObjType(&torchTensorType);
+    Tcl_RegisterObjType(&torchModuleType);
+    Tcl_RegisterObjType(&torchOptimizerType);
+}
+
+// Create a Tcl_Obj for a freshly stored handle. With autorelease enabled the
+// stored object is reclaimed once the last Tcl_Obj referring to it is freed.
+Tcl_Obj* NewHandleObj(const std::string& handle) {
+    Tcl_Obj* objPtr = Tcl_NewStringObj(handle.c_str(), static_cast<int>(handle.size()));
+    AttachHandleRef(objPtr, AcquireHandleRef(handle, handle_autorelease_enabled), &torchHandleType);
+    return objPtr;
+}
+
+// O(1) lookups through the cached internal rep; nullptr if obj is null or
+// does not name a live handle of that kind. The returned pointer stays valid until the
+// handle is released.
+torch::Tensor* FindTensorFromObj(Tcl_Obj* obj) {
+    HandleRef* ref = ResolveHandleObj(obj, &torchTensorType);
+    if (ref == nullptr) {
+        return nullptr;
+    }
+    if (ref->tensor == nullptr) {
+        auto it = tensor_storage.find(ref->name);
+        if (it == tensor_storage.end()) {
+            return nullptr;
+        }
+        ref->tensor = &it->second;
+    }
+    return ref->tensor;
+}
+
+ModuleRef* FindModuleFromObj(Tcl_Obj* obj) {
+    HandleRef* ref = ResolveHandleObj(obj, &torchModuleType);
+    if (ref == nullptr) {
+        return nullptr;
+    }
+    if (ref->module == nullptr) {
+        auto it = module_storage.find(ref->name);
+        if (it == module_storage.end()) {
+            return nullptr;
+        }
+        ref->module = &it->second;
+    }
+    return ref->module;
+}
+
+std::shared_ptr<torch::optim::Optimizer>* FindOptimizerFromObj(Tcl_Obj* obj) {
+    HandleRef* ref = ResolveHandleObj(obj, &torchOptimizerType);
+    if (ref == nullptr) {
+        return nullptr;
+    }
+    if (ref->optimizer == nullptr) {
+        auto it = optimizer_storage.find(ref->name);
+        if (it == optimizer_storage.end()) {
+            return nullptr;
+        }
+        ref->optimizer = &it->second;
+    }
+    return ref->optimizer;
+}
+
+bool HandleExists(const std::string& handle) {
+    return LazyHandleExists(handle) ||
+           tensor_storage.find(handle) != tensor_storage.end() ||
+           module_storage.find(handle) != module_storage.end() ||
+           optimizer_storage.find(handle) != optimizer_storage.end() ||
+           SchedulerHandleExists(handle) ||
+           NpyReaderHandleExists(handle) ||
+           DataHandleExists(handle) ||
+           PackedSequenceHandleExists(handle) ||
+           RnnStreamHandleExists(handle) ||
+           AsyncFutureHandleExists(handle) ||
+           ServerHandleExists(handle);
+}
+
+// Remove a handle from whichever storage owns it. Returns false if the handle
+// does not exist.
+bool ReleaseHandle(const std::string& handle) {
+    auto it = handle_refs.find(handle);
+    if (it != handle_refs.end()) {
+        HandleRef* ref = it->second;
+        handle_refs.erase(it);
+        ref->released = true;
+        ref->tensor = nullptr;
+        ref->module = nullptr;
+        ref->optimizer = nullptr;
+        if (ref->obj_refs <= 0) {
+            delete ref;
+        }
+    }
+
+    return tensor_storage.erase(handle) > 0 ||
+           module_storage.erase(handle) > 0 ||
+           optimizer_storage.erase(handle) > 0 ||
+           ReleaseSchedulerHandle(handle) ||
+           ReleaseNpyReaderHandle(handle) ||
+           ReleaseDataHandle(handle) ||
+           ReleasePackedSequenceHandle(handle) ||
+           ReleaseRnnStreamHandle(handle) ||
+           ReleaseAsyncFutureHandle(handle) ||
+           ReleaseServerHandle(handle) ||
+           ReleaseLazyHandle(handle);
+}
+
+// Handle scopes: every handle allocated while a scope is open is recorded in
+// the innermost frame so torch::scope can release it on exit.
+void PushHandleScope() {
+    handle_scopes.emplace_back();
+}
+
+std::vector<std::string> PopHandleScope() {
+    if (handle_scopes.empty()) {
+        return {};
+    }
+    std::vector<std::string> handles = std::move(handle_scopes.back());
+    handle_scopes.pop_back();
+    return handles;
+}
+
+void RecordScopedHandle(const std::string& handle) {
+    if (!handle_scopes.empty()) {
+        handle_scopes.back().push_back(handle);
+    }
+}
+
+// Scopes opened meanwhile (by a callback, say) are closed again before the
+// saved frames come back
+HandleScopeSuspension::HandleScopeSuspension() {
+    saved_.swap(handle_scopes);
+}
+
+HandleScopeSuspension::~HandleScopeSuspension() {
+    handle_scopes.swap(saved_);
+}
+
+bool GetHandleAutorelease() {
+    return handle_autorelease_enabled;
+}
+
+void SetHandleAutorelease(bool enabled) {
+    handle_autorelease_enabled = enabled;
+}
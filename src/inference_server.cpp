@@ -0,0 +1,471 @@
+#include "libtorchtcl.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using ServeClock = std::chrono::steady_clock;
+
+// One submitted input of one or more rows, answered through a future
+struct ServeRequest {
+    torch::Tensor input;
+    std::shared_ptr<AsyncFuture> future;
+    ServeClock::time_point enqueued;
+};
+
+// A dynamic-batching server: requests queue up until max_batch rows are
+// waiting or the oldest has waited max_delay, then a batching thread runs
+// them through the model as one batch and scatters the rows back
+struct InferenceServer {
+    ModuleRef model;
+    int64_t maxBatch = 32;
+    std::chrono::microseconds maxDelay{1000};
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<ServeRequest> queue;
+    int64_t queuedRows = 0;
+    bool stopping = false;
+    std::thread batcher;
+
+    // Metrics, guarded by mutex
+    uint64_t requests = 0;
+    uint64_t served = 0;
+    uint64_t batches = 0;
+    uint64_t rows = 0;
+    double queueUsTotal = 0.0;
+    double queueUsMax = 0.0;
+    double forwardUsTotal = 0.0;
+    double forwardUsMax = 0.0;
+
+    ~InferenceServer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_all();
+        if (batcher.joinable()) {
+            batcher.join();
+        }
+    }
+
+    void Run();
+    void Stop();
+};
+
+// Requests that can share a batch: same row shape, dtype and device
+static bool SameRowLayout(const torch::Tensor& a, const torch::Tensor& b) {
+    return a.sizes().slice(1) == b.sizes().slice(1) && a.scalar_type() == b.scalar_type() &&
+           a.device() == b.device();
+}
+
+void InferenceServer::Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        ready.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (stopping) {
+            return;
+        }
+        // Wait for a full batch, or until the oldest request is due
+        ready.wait_until(lock, queue.front().enqueued + maxDelay,
+                         [this] { return stopping || queuedRows >= maxBatch; });
+        if (stopping) {
+            return;
+        }
+
+        // A request larger than max_batch still goes through, on its own
+        std::vector<ServeRequest> batch;
+        int64_t batch_rows = 0;
+        while (!queue.empty()) {
+            const ServeRequest& next = queue.front();
+            int64_t next_rows = next.input.size(0);
+            if (!batch.empty() && (batch_rows + next_rows > maxBatch ||
+                                   !SameRowLayout(batch.front().input, next.input))) {
+                break;
+            }
+            batch_rows += next_rows;
+            batch.push_back(std::move(queue.front()));
+            queue.pop_front();
+        }
+        queuedRows -= batch_rows;
+        ServeClock::time_point start = ServeClock::now();
+        lock.unlock();
+
+        std::vector<torch::Tensor> inputs;
+        for (const auto& request : batch) {
+            inputs.push_back(request.input);
+        }
+        std::vector<torch::Tensor> outputs;
+        std::string error;
+        try {
+            torch::NoGradGuard no_grad;
+            torch::Tensor input = inputs.size() == 1 ? inputs[0] : torch::cat(inputs, 0);
+            torch::Tensor output = ModuleForward(model, input);
+            if (output.dim() == 0 || output.size(0) != batch_rows) {
+                throw std::runtime_error("Model output does not have one row per input row");
+            }
+            int64_t offset = 0;
+            for (const auto& request : batch) {
+                int64_t count = request.input.size(0);
+                outputs.push_back(output.narrow(0, offset, count));
+                offset += count;
+            }
+        } catch (const c10::Error& e) {
+            error = e.what_without_backtrace();
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+        ServeClock::time_point end = ServeClock::now();
+
+        lock.lock();
+        double forward_us = std::chrono::duration<double, std::micro>(end - start).count();
+        batches++;
+        rows += batch_rows;
+        forwardUsTotal += forward_us;
+        forwardUsMax = std::max(forwardUsMax, forward_us);
+        for (size_t i = 0; i < batch.size(); i++) {
+            double queue_us = std::chrono::duration<double, std::micro>(start - batch[i].enqueued).count();
+            queueUsTotal += queue_us;
+            queueUsMax = std::max(queueUsMax, queue_us);
+            served++;
+            std::vector<torch::Tensor> result;
+            if (error.empty()) {
+                result.push_back(outputs[i]);
+            }
+            DeliverAsyncFuture(std::move(batch[i].future), std::move(result), error);
+        }
+    }
+}
+
+// Runs on the interpreter thread. Queued requests fail; a batch in flight
+// finishes and is delivered first.
+void InferenceServer::Stop() {
+    std::deque<ServeRequest> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        pending.swap(queue);
+        queuedRows = 0;
+    }
+    ready.notify_all();
+    if (batcher.joinable()) {
+        batcher.join();
+    }
+    for (auto& request : pending) {
+        DeliverAsyncFuture(std::move(request.future), {}, "Server was closed before the request ran");
+    }
+}
+
+thread_local std::unordered_map<std::string, std::shared_ptr<InferenceServer>> server_storage;
+
+bool ServerHandleExists(const std::string& handle) {
+    return server_storage.find(handle) != server_storage.end();
+}
+
+bool ReleaseServerHandle(const std::string& handle) {
+    auto it = server_storage.find(handle);
+    if (it == server_storage.end()) {
+        return false;
+    }
+    it->second->Stop();
+    server_storage.erase(it);
+    return true;
+}
+
+size_t ServerHandleCount() {
+    return server_storage.size();
+}
+
+// Batching threads must be gone before Tcl finalizes the notifier of the
+// thread that owns them
+static void StopServers(ClientData clientData) {
+    (void)clientData;
+    for (auto& entry : server_storage) {
+        entry.second->Stop();
+    }
+    server_storage.clear();
+}
+
+static std::shared_ptr<InferenceServer> FindServer(const std::string& handle) {
+    auto it = server_storage.find(handle);
+    if (it == server_storage.end()) {
+        throw std::runtime_error("Invalid server: " + handle);
+    }
+    return it->second;
+}
+
+// ============================================================================
+// torch::serve_open
+// ============================================================================
+
+// Parameter structure for serve_open command
+struct ServeOpenArgs {
+    Tcl_Obj* model = nullptr;
+    int64_t maxBatch = 32;
+    int64_t maxDelayUs = 1000;
+
+    bool IsValid() const {
+        return model != nullptr && maxBatch > 0 && maxDelayUs >= 0;
+    }
+};
+
+// Parse dual syntax: model ?maxBatch? ?maxDelayUs? |
+// -model layer ?-maxBatch int? ?-maxDelayUs int?
+static ServeOpenArgs ParseServeOpenArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    ServeOpenArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 4) {
+            throw std::runtime_error("Usage: torch::serve_open model ?maxBatch? ?maxDelayUs?");
+        }
+        args.model = objv[1];
+        if (objc > 2) {
+            args.maxBatch = GetInt64FromObj(interp, objv[2]);
+        }
+        if (objc > 3) {
+            args.maxDelayUs = GetInt64FromObj(interp, objv[3]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-model") {
+                args.model = objv[i + 1];
+            } else if (param == "-maxBatch" || param == "-max_batch") {
+                args.maxBatch = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-maxDelayUs" || param == "-max_delay_us") {
+                args.maxDelayUs = GetInt64FromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -model, -maxBatch, -maxDelayUs");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing or invalid: model, positive maxBatch and non-negative maxDelayUs");
+    }
+
+    return args;
+}
+
+// torch::serve_open - Start a batching thread serving forward passes of a
+// model to torch::serve_submit requests
+int ServeOpen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        ServeOpenArgs args = ParseServeOpenArgs(interp, objc, objv);
+
+        auto* model = FindModuleFromObj(args.model);
+        if (model == nullptr) {
+            throw std::runtime_error(std::string("Invalid model: ") + Tcl_GetString(args.model));
+        }
+
+        static thread_local bool exit_handler = false;
+        if (!exit_handler) {
+            Tcl_CreateThreadExitHandler(StopServers, nullptr);
+            exit_handler = true;
+        }
+
+        auto server = std::make_shared<InferenceServer>();
+        server->model = *model;
+        server->maxBatch = args.maxBatch;
+        server->maxDelay = std::chrono::microseconds(args.maxDelayUs);
+        server->batcher = std::thread([raw = server.get()] { raw->Run(); });
+
+        std::string handle = GetNextHandle("server");
+        server_storage[handle] = server;
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::serve_submit
+// ============================================================================
+
+// Parameter structure for serve_submit command
+struct ServeSubmitArgs {
+    std::string server;
+    Tcl_Obj* input = nullptr;
+    Tcl_Obj* callback = nullptr;
+    Tcl_Obj* variable = nullptr;
+
+    bool IsValid() const {
+        return !server.empty() && input != nullptr;
+    }
+};
+
+// Parse dual syntax: server input ?callback? |
+// -server handle -input tensor ?-callback script? ?-variable name?
+static ServeSubmitArgs ParseServeSubmitArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    ServeSubmitArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 3 || objc > 4) {
+            throw std::runtime_error("Usage: torch::serve_submit server input ?callback?");
+        }
+        args.server = Tcl_GetString(objv[1]);
+        args.input = objv[2];
+        if (objc > 3) {
+            args.callback = objv[3];
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-server") {
+                args.server = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-input") {
+                args.input = objv[i + 1];
+            } else if (param == "-callback") {
+                args.callback = objv[i + 1];
+            } else if (param == "-variable") {
+                args.variable = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -server, -input, -callback, -variable");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: server and input");
+    }
+
+    return args;
+}
+
+// torch::serve_submit - Queue an input of one or more rows and return a
+// future for its output rows (see torch::async_wait)
+int ServeSubmit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        ServeSubmitArgs args = ParseServeSubmitArgs(interp, objc, objv);
+        std::shared_ptr<InferenceServer> server = FindServer(args.server);
+
+        torch::Tensor* input = FindTensorFromObj(args.input);
+        if (input == nullptr) {
+            throw std::runtime_error(std::string("Invalid input tensor: ") + Tcl_GetString(args.input));
+        }
+        if (input->dim() == 0 || input->size(0) == 0) {
+            throw std::runtime_error("Input must have at least one row");
+        }
+
+        std::string handle;
+        ServeRequest request;
+        request.input = *input;
+        request.future = NewAsyncFuture(interp, args.callback, args.variable, handle);
+        request.enqueued = ServeClock::now();
+        {
+            std::lock_guard<std::mutex> lock(server->mutex);
+            server->queuedRows += request.input.size(0);
+            server->requests++;
+            server->queue.push_back(std::move(request));
+        }
+        server->ready.notify_one();
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::serve_stats
+// ============================================================================
+
+// Parameter structure for serve_stats command
+struct ServeStatsArgs {
+    std::string server;
+
+    bool IsValid() const {
+        return !server.empty();
+    }
+};
+
+// Parse dual syntax: server | -server handle
+static ServeStatsArgs ParseServeStatsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    ServeStatsArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error("Usage: torch::serve_stats server");
+        }
+        args.server = Tcl_GetString(objv[1]);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-server") {
+                args.server = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -server");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: server");
+    }
+
+    return args;
+}
+
+// torch::serve_stats - Request, batch and latency counters as a dict
+int ServeStats_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        ServeStatsArgs args = ParseServeStatsArgs(interp, objc, objv);
+        std::shared_ptr<InferenceServer> server = FindServer(args.server);
+
+        std::lock_guard<std::mutex> lock(server->mutex);
+        auto mean = [](double total, uint64_t count) { return count > 0 ? total / count : 0.0; };
+
+        Tcl_Obj* dict = Tcl_NewDictObj();
+        auto put_int = [&](const char* key, uint64_t value) {
+            Tcl_DictObjPut(nullptr, dict, Tcl_NewStringObj(key, -1), Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(value)));
+        };
+        auto put_double = [&](const char* key, double value) {
+            Tcl_DictObjPut(nullptr, dict, Tcl_NewStringObj(key, -1), Tcl_NewDoubleObj(value));
+        };
+        put_int("requests", server->requests);
+        put_int("pending", server->queue.size());
+        put_int("batches", server->batches);
+        put_int("rows", server->rows);
+        put_double("meanBatchRows", mean(static_cast<double>(server->rows), server->batches));
+        put_double("meanQueueUs", mean(server->queueUsTotal, server->served));
+        put_double("maxQueueUs", server->queueUsMax);
+        put_double("meanForwardUs", mean(server->forwardUsTotal, server->batches));
+        put_double("maxForwardUs", server->forwardUsMax);
+        Tcl_SetObjResult(interp, dict);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -0,0 +1,410 @@
+#include "libtorchtcl.h"
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+
+// Lazy elementwise evaluation. Between torch::lazy_begin and torch::lazy_end
+// the elementwise commands record their operation instead of running it and
+// return a handle to the pending value. When a value is needed (torch::lazy_end,
+// or any command looking the handle up) the whole expression is evaluated in
+// one vectorized pass over blocks of the inputs, so intermediates only occupy a
+// cache-sized scratch buffer instead of a full tensor each.
+//
+// Only CPU float32/float64 tensors that are contiguous (or single elements)
+// and need no autograd are recorded; anything else runs eagerly as before.
+
+struct LazyNode {
+    LazyOp op = LazyOp::Add;
+    double alpha = 1.0;
+    std::vector<std::shared_ptr<LazyNode>> inputs;
+    torch::Tensor value;            // set for leaves and materialized nodes
+    std::vector<int64_t> shape;
+    c10::ScalarType dtype = torch::kFloat32;
+    uint32_t version = 0;           // value._version() when the leaf was captured
+
+    bool IsLeaf() const { return value.defined(); }
+    bool IsScalar() const { return IsLeaf() && value.numel() == 1; }
+};
+
+static thread_local std::unordered_map<std::string, std::shared_ptr<LazyNode>> lazy_nodes;
+static thread_local int lazy_depth = 0;
+
+// Elements per block; the scratch buffers of one block stay in L1/L2
+static constexpr int64_t kLazyBlock = 2048;
+
+bool LazyModeEnabled() {
+    return lazy_depth > 0;
+}
+
+bool LazyHandleExists(const std::string& handle) {
+    return lazy_nodes.find(handle) != lazy_nodes.end();
+}
+
+// Lookups only need the miss handler while some handle is still pending
+static void UninstallMissHandlerIfIdle() {
+    if (lazy_depth == 0 && lazy_nodes.empty()) {
+        tensor_storage.SetMissHandler(nullptr);
+    }
+}
+
+bool ReleaseLazyHandle(const std::string& handle) {
+    // Consumers keep their own reference to the node
+    bool released = lazy_nodes.erase(handle) > 0;
+    UninstallMissHandlerIfIdle();
+    return released;
+}
+
+size_t LazyHandleCount() {
+    return lazy_nodes.size();
+}
+
+static bool IsFusableTensor(const torch::Tensor& tensor) {
+    return tensor.defined() && tensor.device().is_cpu() && tensor.layout() == torch::kStrided &&
+           (tensor.scalar_type() == torch::kFloat32 || tensor.scalar_type() == torch::kFloat64) &&
+           (tensor.is_contiguous() || tensor.numel() == 1) && !tensor.is_inference() &&
+           !(tensor.requires_grad() && torch::autograd::GradMode::is_enabled());
+}
+
+// Node for a recorded input: a pending lazy value, or a leaf wrapping a stored
+// tensor. nullptr if the input cannot take part in a fused expression.
+static std::shared_ptr<LazyNode> LazyInput(const std::string& name) {
+    auto pending = lazy_nodes.find(name);
+    if (pending != lazy_nodes.end()) {
+        return pending->second;
+    }
+    auto it = tensor_storage.find(name);
+    if (it == tensor_storage.end() || !IsFusableTensor(it->second)) {
+        return nullptr;
+    }
+    auto leaf = std::make_shared<LazyNode>();
+    leaf->value = it->second;
+    leaf->shape = it->second.sizes().vec();
+    leaf->dtype = it->second.scalar_type();
+    leaf->version = it->second._version();
+    return leaf;
+}
+
+bool LazyRecord(Tcl_Interp* interp, LazyOp op, const std::vector<std::string>& inputs, double alpha) {
+    auto node = std::make_shared<LazyNode>();
+    node->op = op;
+    node->alpha = alpha;
+    for (const auto& name : inputs) {
+        std::shared_ptr<LazyNode> input = LazyInput(name);
+        if (input == nullptr) {
+            return false;
+        }
+        node->inputs.push_back(input);
+    }
+
+    // All operands share one dtype, and broadcasting is limited to single
+    // elements whose rank does not exceed the result's, so the result has
+    // exactly the shape of its largest operand
+    const LazyNode& first = *node->inputs[0];
+    node->dtype = first.dtype;
+    node->shape = first.shape;
+    for (size_t i = 1; i < node->inputs.size(); i++) {
+        const LazyNode& other = *node->inputs[i];
+        if (other.dtype != node->dtype) {
+            return false;
+        }
+        if (other.shape == node->shape) {
+            continue;
+        }
+        if (other.IsScalar() && other.shape.size() <= node->shape.size()) {
+            continue;
+        }
+        if (first.IsScalar() && first.shape.size() <= other.shape.size() && i == 1) {
+            node->shape = other.shape;
+            continue;
+        }
+        return false;
+    }
+    for (const auto& input : node->inputs) {
+        if (!input->IsLeaf() && input->shape != node->shape) {
+            return false;
+        }
+    }
+
+    // The slot stays reserved until materialization fills it
+    TensorReservation reservation = ReserveTensorHandle();
+    lazy_nodes[reservation.name()] = node;
+    std::string handle = reservation.Keep();
+    Tcl_SetObjResult(interp, NewHandleObj(handle));
+    return true;
+}
+
+// ============================================================================
+// Fused evaluation
+// ============================================================================
+
+// One step over n elements with SIMD lanes; at::vec::map handles the tail
+// that does not fill a whole vector
+template <typename T>
+static void ApplyLazyOp(LazyOp op, T alpha, const T* a, const T* b, T* out, int64_t n) {
+    using Vec = at::vec::Vectorized<T>;
+    const Vec valpha(alpha);
+    const Vec zero(T(0));
+    const Vec one(T(1));
+    const Vec half(T(0.5));
+    const Vec sqrt1_2(static_cast<T>(0.70710678118654752440));
+
+    switch (op) {
+        case LazyOp::Add:     at::vec::map2([&](Vec x, Vec y) { return at::vec::fmadd(valpha, y, x); }, out, a, b, n); break;
+        case LazyOp::Sub:     at::vec::map2([&](Vec x, Vec y) { return x - valpha * y; }, out, a, b, n); break;
+        case LazyOp::Mul:     at::vec::map2([](Vec x, Vec y) { return x * y; }, out, a, b, n); break;
+        case LazyOp::Div:     at::vec::map2([](Vec x, Vec y) { return x / y; }, out, a, b, n); break;
+        case LazyOp::Scale:   at::vec::map([&](Vec x) { return x * valpha; }, out, a, n); break;
+        case LazyOp::Abs:     at::vec::map([](Vec x) { return x.abs(); }, out, a, n); break;
+        case LazyOp::Exp:     at::vec::map([](Vec x) { return x.exp(); }, out, a, n); break;
+        case LazyOp::Log:     at::vec::map([](Vec x) { return x.log(); }, out, a, n); break;
+        case LazyOp::Sqrt:    at::vec::map([](Vec x) { return x.sqrt(); }, out, a, n); break;
+        case LazyOp::Rsqrt:   at::vec::map([](Vec x) { return x.rsqrt(); }, out, a, n); break;
+        case LazyOp::Square:  at::vec::map([](Vec x) { return x * x; }, out, a, n); break;
+        case LazyOp::Sin:     at::vec::map([](Vec x) { return x.sin(); }, out, a, n); break;
+        case LazyOp::Cos:     at::vec::map([](Vec x) { return x.cos(); }, out, a, n); break;
+        case LazyOp::Tanh:    at::vec::map([](Vec x) { return x.tanh(); }, out, a, n); break;
+        case LazyOp::Sigmoid: at::vec::map([&](Vec x) { return (one + x.neg().exp()).reciprocal(); }, out, a, n); break;
+        case LazyOp::Relu:    at::vec::map([&](Vec x) { return at::vec::maximum(x, zero); }, out, a, n); break;
+        case LazyOp::Silu:    at::vec::map([&](Vec x) { return x / (one + x.neg().exp()); }, out, a, n); break;
+        case LazyOp::Gelu:
+            at::vec::map([&](Vec x) { return half * x * (one + (x * sqrt1_2).erf()); }, out, a, n);
+            break;
+    }
+}
+
+struct LazyStep {
+    LazyOp op;
+    double alpha;
+    size_t in0;
+    size_t in1;            // equal to in0 for unary ops
+    size_t out;            // slot written
+    void* root = nullptr;  // output tensor data for expression roots
+};
+
+// Evaluate steps block by block. Slots [0, leaves.size()) are the leaves,
+// the rest are step results; roots write straight into their output tensor.
+template <typename T>
+static void RunLazySteps(const std::vector<LazyNode*>& leaves, const std::vector<LazyStep>& steps, int64_t numel) {
+    size_t nslots = leaves.size() + steps.size();
+    int64_t grain = kLazyBlock * 16;
+
+    at::parallel_for(0, numel, grain, [&](int64_t begin, int64_t end) {
+        std::vector<T> scratch(steps.size() * kLazyBlock);
+        std::vector<T> scalars(leaves.size() * kLazyBlock);
+        std::vector<const T*> base(leaves.size(), nullptr);
+        for (size_t l = 0; l < leaves.size(); l++) {
+            const T* data = leaves[l]->value.template data_ptr<T>();
+            if (leaves[l]->value.numel() == 1) {
+                std::fill_n(scalars.data() + l * kLazyBlock, kLazyBlock, data[0]);
+            } else {
+                base[l] = data;
+            }
+        }
+
+        std::vector<const T*> slots(nslots);
+        for (int64_t start = begin; start < end; start += kLazyBlock) {
+            int64_t n = std::min(kLazyBlock, end - start);
+            for (size_t l = 0; l < leaves.size(); l++) {
+                slots[l] = base[l] ? base[l] + start : scalars.data() + l * kLazyBlock;
+            }
+            for (size_t s = 0; s < steps.size(); s++) {
+                const LazyStep& step = steps[s];
+                T* out = step.root ? static_cast<T*>(step.root) + start : scratch.data() + s * kLazyBlock;
+                ApplyLazyOp<T>(step.op, static_cast<T>(step.alpha), slots[step.in0], slots[step.in1], out, n);
+                slots[step.out] = out;
+            }
+        }
+    });
+}
+
+// Materialize a group of pending roots sharing one shape and dtype in a
+// single fused pass, then turn them into ordinary stored tensors
+static void MaterializeLazyGroup(const std::vector<std::pair<std::string, std::shared_ptr<LazyNode>>>& roots) {
+    std::unordered_map<LazyNode*, size_t> slot_of;
+    std::vector<LazyNode*> leaves;
+    std::vector<LazyNode*> order;
+
+    // Post-order walk: inputs before the steps that read them
+    std::function<void(LazyNode*)> visit = [&](LazyNode* node) {
+        if (slot_of.count(node)) {
+            return;
+        }
+        if (node->IsLeaf()) {
+            slot_of[node] = leaves.size();
+            leaves.push_back(node);
+            return;
+        }
+        for (const auto& input : node->inputs) {
+            visit(input.get());
+        }
+        slot_of[node] = SIZE_MAX;  // numbered below, after all leaves are known
+        order.push_back(node);
+    };
+    for (const auto& root : roots) {
+        visit(root.second.get());
+    }
+    for (size_t s = 0; s < order.size(); s++) {
+        slot_of[order[s]] = leaves.size() + s;
+    }
+
+    // The expression must see its inputs as they were when it was recorded
+    for (LazyNode* leaf : leaves) {
+        if (leaf->value._version() != leaf->version) {
+            throw std::runtime_error("A tensor read by a pending lazy expression was modified in place before the expression was evaluated");
+        }
+    }
+
+    const LazyNode& first = *roots[0].second;
+    auto options = torch::TensorOptions().dtype(first.dtype);
+    std::unordered_map<LazyNode*, torch::Tensor> outputs;
+    for (const auto& root : roots) {
+        if (!outputs.count(root.second.get())) {
+            outputs[root.second.get()] = torch::empty(first.shape, options);
+        }
+    }
+
+    std::vector<LazyStep> steps;
+    for (LazyNode* node : order) {
+        LazyStep step;
+        step.op = node->op;
+        step.alpha = node->alpha;
+        step.in0 = slot_of[node->inputs[0].get()];
+        step.in1 = node->inputs.size() > 1 ? slot_of[node->inputs[1].get()] : step.in0;
+        step.out = slot_of[node];
+        auto out = outputs.find(node);
+        if (out != outputs.end()) {
+            step.root = out->second.data_ptr();
+        }
+        steps.push_back(step);
+    }
+
+    int64_t numel = 1;
+    for (int64_t size : first.shape) {
+        numel *= size;
+    }
+    if (first.dtype == torch::kFloat64) {
+        RunLazySteps<double>(leaves, steps, numel);
+    } else {
+        RunLazySteps<float>(leaves, steps, numel);
+    }
+
+    for (const auto& root : roots) {
+        LazyNode* node = root.second.get();
+        node->value = outputs[node];
+        node->version = node->value._version();
+        node->inputs.clear();
+        tensor_storage[root.first] = node->value;
+        lazy_nodes.erase(root.first);
+    }
+    UninstallMissHandlerIfIdle();
+}
+
+static void MaterializeLazy(const std::vector<std::pair<std::string, std::shared_ptr<LazyNode>>>& roots) {
+    // Roots of different shapes or dtypes cannot share a loop
+    std::vector<std::vector<std::pair<std::string, std::shared_ptr<LazyNode>>>> groups;
+    for (const auto& root : roots) {
+        bool placed = false;
+        for (auto& group : groups) {
+            const LazyNode& head = *group[0].second;
+            if (head.shape == root.second->shape && head.dtype == root.second->dtype) {
+                group.push_back(root);
+                placed = true;
+                break;
+            }
+        }
+        if (!placed) {
+            groups.push_back({root});
+        }
+    }
+    for (const auto& group : groups) {
+        MaterializeLazyGroup(group);
+    }
+}
+
+// Miss handler for tensor_storage: any command looking up a pending handle
+// gets it evaluated on the spot
+static bool MaterializeLazyHandle(const std::string& handle) {
+    auto it = lazy_nodes.find(handle);
+    if (it == lazy_nodes.end()) {
+        return false;
+    }
+    MaterializeLazy({*it});
+    return true;
+}
+
+// ============================================================================
+// torch::lazy_begin / torch::lazy_end
+// ============================================================================
+
+// torch::lazy_begin - Start recording elementwise operations. Regions nest;
+// recording stops at the matching torch::lazy_end.
+int LazyBegin_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    if (objc != 1) {
+        Tcl_WrongNumArgs(interp, 1, objv, "");
+        return TCL_ERROR;
+    }
+    tensor_storage.SetMissHandler(MaterializeLazyHandle);
+    lazy_depth++;
+    return TCL_OK;
+}
+
+// torch::lazy_end - Stop recording and evaluate every pending expression whose
+// value no other pending expression consumes. Pending intermediates stay lazy
+// and are only computed if something asks for them later; their inputs are
+// checked for in-place changes at that point.
+int LazyEnd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    if (objc != 1) {
+        Tcl_WrongNumArgs(interp, 1, objv, "");
+        return TCL_ERROR;
+    }
+
+    try {
+        if (lazy_depth == 0) {
+            throw std::runtime_error("torch::lazy_end called without torch::lazy_begin");
+        }
+        if (--lazy_depth > 0) {
+            return TCL_OK;
+        }
+
+        std::unordered_set<LazyNode*> consumed;
+        std::vector<LazyNode*> stack;
+        for (const auto& entry : lazy_nodes) {
+            for (const auto& input : entry.second->inputs) {
+                stack.push_back(input.get());
+            }
+        }
+        while (!stack.empty()) {
+            LazyNode* node = stack.back();
+            stack.pop_back();
+            if (consumed.insert(node).second) {
+                for (const auto& input : node->inputs) {
+                    stack.push_back(input.get());
+                }
+            }
+        }
+
+        std::vector<std::pair<std::string, std::shared_ptr<LazyNode>>> roots;
+        for (const auto& entry : lazy_nodes) {
+            if (!consumed.count(entry.second.get())) {
+                roots.push_back(entry);
+            }
+        }
+        if (!roots.empty()) {
+            MaterializeLazy(roots);
+        }
+        UninstallMissHandlerIfIdle();
+
+        Tcl_ResetResult(interp);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -29,32 +29,33 @@ struct LRScheduler {
 };
 
 // Global storage for learning rate schedulers
-std::unordered_map<std::string, std::shared_ptr<LRScheduler>> scheduler_storage;
+thread_local std::unordered_map<std::string, std::shared_ptr<LRScheduler>> scheduler_storage;
+
+bool SchedulerHandleExists(const std::string& handle) {
+    return scheduler_storage.find(handle) != scheduler_storage.end();
+}
+
+bool ReleaseSchedulerHandle(const std::string& handle) {
+    return scheduler_storage.erase(handle) > 0;
+}
+
+size_t SchedulerHandleCount() {
+    return scheduler_storage.size();
+}
 
 // Helper function to update optimizer learning rate
 bool UpdateOptimizerLR(const std::string& optimizer_name, double new_lr) {
-    if (optimizer_storage.find(optimizer_name) == optimizer_storage.end()) {
+    auto optimizer_it = optimizer_storage.find(optimizer_name);
+    if (optimizer_it == optimizer_storage.end()) {
         return false;
     }
     
-    auto& optimizer = optimizer_storage[optimizer_name];
+    auto& optimizer = optimizer_it->second;
     
-    // Update learning rate for all parameter groups
+    // Update learning rate for all parameter groups, whatever the optimizer
     for (auto& group : optimizer->param_groups()) {
         if (group.has_options()) {
-            // Try SGD first
-            try {
-                auto& sgd_options = static_cast<torch::optim::SGDOptions&>(group.options());
-                sgd_options.lr(new_lr);
-                continue;
-            } catch (...) {}
-            
-            // Try Adam
-            try {
-                auto& adam_options = static_cast<torch::optim::AdamOptions&>(group.options());
-                adam_options.lr(new_lr);
-                continue;
-            } catch (...) {}
+            group.options().set_lr(new_lr);
         }
     }
     return true;
@@ -62,25 +63,16 @@ bool UpdateOptimizerLR(const std::string& optimizer_name, double new_lr) {
 
 // Helper function to get current learning rate
 double GetOptimizerLR(const std::string& optimizer_name) {
-    if (optimizer_storage.find(optimizer_name) == optimizer_storage.end()) {
+    auto optimizer_it = optimizer_storage.find(optimizer_name);
+    if (optimizer_it == optimizer_storage.end()) {
         return -1.0;
     }
     
-    auto& optimizer = optimizer_storage[optimizer_name];
+    auto& optimizer = optimizer_it->second;
     
     for (auto& group : optimizer->param_groups()) {
         if (group.has_options()) {
-            // Try SGD first
-            try {
-                auto& sgd_options = static_cast<torch::optim::SGDOptions&>(group.options());
-                return sgd_options.lr();
-            } catch (...) {}
-            
-            // Try Adam
-            try {
-                auto& adam_options = static_cast<torch::optim::AdamOptions&>(group.options());
-                return adam_options.lr();
-            } catch (...) {}
+            return group.options().get_lr();
         }
     }
     return -1.0;
@@ -89,6 +81,7 @@ double GetOptimizerLR(const std::string& optimizer_name) {
 // Parameters for torch::lr_scheduler_step
 struct LRSchedulerStepArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int stepSize = -1;    // Required parameter, -1 indicates not set
     double gamma = 0.1;   // Optional, default 0.1
     
@@ -108,6 +101,7 @@ LRSchedulerStepArgs ParseLRSchedulerStepArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.stepSize) != TCL_OK) {
             throw std::runtime_error("Invalid stepSize value");
@@ -129,6 +123,7 @@ LRSchedulerStepArgs ParseLRSchedulerStepArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-stepSize" || param == "-step_size") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.stepSize) != TCL_OK) {
                     throw std::runtime_error("Invalid stepSize value");
@@ -157,7 +152,7 @@ int LRSchedulerStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         auto args = ParseLRSchedulerStepArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -190,6 +185,7 @@ int LRSchedulerStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 
 struct LRSchedulerExponentialArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     double gamma = 0.95;  // Default gamma value
     
     bool IsValid() const {
@@ -203,6 +199,7 @@ LRSchedulerExponentialArgs ParseLRSchedulerExponentialArgs(Tcl_Interp* interp, i
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (objc > 2) {
             double gamma;
@@ -223,6 +220,7 @@ LRSchedulerExponentialArgs ParseLRSchedulerExponentialArgs(Tcl_Interp* interp, i
             
             if (param == "-optimizer" || param == "-opt") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-gamma" || param == "-decay") {
                 double gamma;
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &gamma) != TCL_OK) {
@@ -253,7 +251,7 @@ int LRSchedulerExponential_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
     try {
         LRSchedulerExponentialArgs args = ParseLRSchedulerExponentialArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -286,6 +284,7 @@ int LRSchedulerExponential_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
 // torch::lr_scheduler_cosine args structure
 struct LRSchedulerCosineArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int tMax = -1;  // Required parameter, -1 indicates not set
     double etaMin = 0.0;  // Optional, default 0.0
     
@@ -305,6 +304,7 @@ LRSchedulerCosineArgs ParseLRSchedulerCosineArgs(Tcl_Interp* interp, int objc, T
         }
 
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
 
         if (Tcl_GetIntFromObj(interp, objv[2], &args.tMax) != TCL_OK) {
             throw std::runtime_error("Invalid T_max value");
@@ -326,6 +326,7 @@ LRSchedulerCosineArgs ParseLRSchedulerCosineArgs(Tcl_Interp* interp, int objc, T
 
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(valueObj);
+                args.optimizerObj = valueObj;
             } else if (param == "-tMax" || param == "-t_max" || param == "-T_max") {
                 if (Tcl_GetIntFromObj(interp, valueObj, &args.tMax) != TCL_OK) {
                     throw std::runtime_error("Invalid T_max value");
@@ -354,7 +355,7 @@ int LRSchedulerCosine_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
     try {
         LRSchedulerCosineArgs args = ParseLRSchedulerCosineArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -421,47 +422,52 @@ static LRSchedulerStepUpdateArgs ParseLRSchedulerStepUpdateArgs(Tcl_Interp* inte
     return args;
 }
 
+// Advance a scheduler by one step and apply the new rate to its optimizer;
+// shared with torch::train_step
+void StepLRScheduler(const std::string& handle) {
+    auto it = scheduler_storage.find(handle);
+    if (it == scheduler_storage.end()) {
+        throw std::runtime_error("Invalid scheduler name");
+    }
+
+    auto& scheduler = it->second;
+    scheduler->step_count++;
+    double new_lr = scheduler->current_lr;
+    
+    if (scheduler->scheduler_type == "step") {
+        int decay_steps = scheduler->step_count / scheduler->step_size;
+        new_lr = scheduler->initial_lr * std::pow(scheduler->gamma, decay_steps);
+    } else if (scheduler->scheduler_type == "exponential") {
+        new_lr = scheduler->initial_lr * std::pow(scheduler->exp_gamma, scheduler->step_count);
+    } else if (scheduler->scheduler_type == "cosine" || scheduler->scheduler_type == "cosine_annealing") {
+        int effective_step = scheduler->step_count % scheduler->T_max;
+        double cosine_arg = M_PI * effective_step / (scheduler->T_max / 2.0);
+        double cosine_factor = (1.0 + std::cos(cosine_arg)) / 2.0;
+        new_lr = scheduler->eta_min + (scheduler->initial_lr - scheduler->eta_min) * cosine_factor;
+    } else if (scheduler->scheduler_type == "cosine_warm_restarts") {
+        int T_i = scheduler->T_max;
+        int epochs_since_restart = scheduler->step_count;
+        while (epochs_since_restart >= T_i) {
+            epochs_since_restart -= T_i;
+            T_i *= scheduler->step_size;
+        }
+        double cosine_factor = (1.0 + std::cos(M_PI * epochs_since_restart / T_i)) / 2.0;
+        new_lr = scheduler->eta_min + (scheduler->initial_lr - scheduler->eta_min) * cosine_factor;
+    }
+
+    scheduler->current_lr = new_lr;
+    if (!UpdateOptimizerLR(scheduler->optimizer_name, new_lr)) {
+        throw std::runtime_error("Failed to update optimizer learning rate");
+    }
+}
+
 // Step the scheduler
 int LRSchedulerStepUpdate_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     (void)clientData; // Suppress unused parameter warning
     try {
         LRSchedulerStepUpdateArgs args = ParseLRSchedulerStepUpdateArgs(interp, objc, objv);
 
-        if (scheduler_storage.find(args.scheduler) == scheduler_storage.end()) {
-            Tcl_SetResult(interp, const_cast<char*>("Invalid scheduler name"), TCL_VOLATILE);
-            return TCL_ERROR;
-        }
-
-        auto& scheduler = scheduler_storage[args.scheduler];
-        scheduler->step_count++;
-        double new_lr = scheduler->current_lr;
-        
-        if (scheduler->scheduler_type == "step") {
-            int decay_steps = scheduler->step_count / scheduler->step_size;
-            new_lr = scheduler->initial_lr * std::pow(scheduler->gamma, decay_steps);
-        } else if (scheduler->scheduler_type == "exponential") {
-            new_lr = scheduler->initial_lr * std::pow(scheduler->exp_gamma, scheduler->step_count);
-        } else if (scheduler->scheduler_type == "cosine" || scheduler->scheduler_type == "cosine_annealing") {
-            int effective_step = scheduler->step_count % scheduler->T_max;
-            double cosine_arg = M_PI * effective_step / (scheduler->T_max / 2.0);
-            double cosine_factor = (1.0 + std::cos(cosine_arg)) / 2.0;
-            new_lr = scheduler->eta_min + (scheduler->initial_lr - scheduler->eta_min) * cosine_factor;
-        } else if (scheduler->scheduler_type == "cosine_warm_restarts") {
-            int T_i = scheduler->T_max;
-            int epochs_since_restart = scheduler->step_count;
-            while (epochs_since_restart >= T_i) {
-                epochs_since_restart -= T_i;
-                T_i *= scheduler->step_size;
-            }
-            double cosine_factor = (1.0 + std::cos(M_PI * epochs_since_restart / T_i)) / 2.0;
-            new_lr = scheduler->eta_min + (scheduler->initial_lr - scheduler->eta_min) * cosine_factor;
-        }
-
-        scheduler->current_lr = new_lr;
-        if (!UpdateOptimizerLR(scheduler->optimizer_name, new_lr)) {
-            Tcl_SetResult(interp, const_cast<char*>("Failed to update optimizer learning rate"), TCL_VOLATILE);
-            return TCL_ERROR;
-        }
+        StepLRScheduler(args.scheduler);
         Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_STATIC);
         return TCL_OK;
     } catch (const std::exception& e) {
@@ -544,6 +550,7 @@ int GetLR_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 
 struct LRSchedulerMultiplicativeArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     double lr_lambda = 1.0;
     
     bool IsValid() const {
@@ -562,6 +569,7 @@ LRSchedulerMultiplicativeArgs ParseLRSchedulerMultiplicativeArgs(Tcl_Interp* int
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.lr_lambda) != TCL_OK) {
             throw std::runtime_error("Invalid lr_lambda value");
@@ -578,6 +586,7 @@ LRSchedulerMultiplicativeArgs ParseLRSchedulerMultiplicativeArgs(Tcl_Interp* int
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(value);
+                args.optimizerObj = value;
             } else if (param == "-lrLambda" || param == "-lr_lambda") {
                 if (Tcl_GetDoubleFromObj(interp, value, &args.lr_lambda) != TCL_OK) {
                     throw std::runtime_error("Invalid lr_lambda value");
@@ -601,7 +610,7 @@ int LRSchedulerMultiplicative_Cmd(ClientData clientData, Tcl_Interp* interp, int
     try {
         LRSchedulerMultiplicativeArgs args = ParseLRSchedulerMultiplicativeArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -634,6 +643,7 @@ int LRSchedulerMultiplicative_Cmd(ClientData clientData, Tcl_Interp* interp, int
 // Parameters for torch::lr_scheduler_polynomial
 struct LRSchedulerPolynomialArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int totalIters = -1;  // Required parameter, -1 indicates not set
     double power = 1.0;  // Optional, default 1.0
     int lastEpoch = -1;  // Optional, default -1
@@ -654,6 +664,7 @@ LRSchedulerPolynomialArgs ParseLRSchedulerPolynomialArgs(Tcl_Interp* interp, int
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.totalIters) != TCL_OK) {
             throw std::runtime_error("Invalid total_iters value");
@@ -681,6 +692,7 @@ LRSchedulerPolynomialArgs ParseLRSchedulerPolynomialArgs(Tcl_Interp* interp, int
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-totalIters" || param == "-total_iters") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.totalIters) != TCL_OK) {
                     throw std::runtime_error("Invalid totalIters value");
@@ -713,7 +725,7 @@ int LRSchedulerPolynomial_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
     try {
         auto args = ParseLRSchedulerPolynomialArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -748,6 +760,7 @@ int LRSchedulerPolynomial_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
 // Parameters for torch::lr_scheduler_cosine_annealing_warm_restarts
 struct LRSchedulerCosineAnnealingWarmRestartsArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int t0 = -1;  // Required parameter, -1 indicates not set
     int tMult = 1;  // Optional, default 1
     double etaMin = 0.0;  // Optional, default 0.0
@@ -769,6 +782,7 @@ LRSchedulerCosineAnnealingWarmRestartsArgs ParseLRSchedulerCosineAnnealingWarmRe
         }
 
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
 
         if (Tcl_GetIntFromObj(interp, objv[2], &args.t0) != TCL_OK) {
             throw std::runtime_error("Invalid T_0 value");
@@ -796,6 +810,7 @@ LRSchedulerCosineAnnealingWarmRestartsArgs ParseLRSchedulerCosineAnnealingWarmRe
 
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(valueObj);
+                args.optimizerObj = valueObj;
             } else if (param == "-t0" || param == "-T_0" || param == "-T0") {
                 if (Tcl_GetIntFromObj(interp, valueObj, &args.t0) != TCL_OK) {
                     throw std::runtime_error("Invalid T_0 value");
@@ -828,7 +843,7 @@ int LRSchedulerCosineAnnealingWarmRestarts_Cmd(ClientData clientData, Tcl_Interp
     try {
         LRSchedulerCosineAnnealingWarmRestartsArgs args = ParseLRSchedulerCosineAnnealingWarmRestartsArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -863,6 +878,7 @@ int LRSchedulerCosineAnnealingWarmRestarts_Cmd(ClientData clientData, Tcl_Interp
 // torch::lr_scheduler_linear_with_warmup args structure
 struct LRSchedulerLinearWithWarmupArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int numWarmupSteps = -1;  // Required parameter, -1 indicates not set
     int numTrainingSteps = -1;  // Required parameter, -1 indicates not set
     int lastEpoch = -1;  // Optional, default -1
@@ -884,6 +900,7 @@ LRSchedulerLinearWithWarmupArgs ParseLRSchedulerLinearWithWarmupArgs(Tcl_Interp*
         }
 
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
 
         if (Tcl_GetIntFromObj(interp, objv[2], &args.numWarmupSteps) != TCL_OK) {
             throw std::runtime_error("Invalid num_warmup_steps value");
@@ -909,6 +926,7 @@ LRSchedulerLinearWithWarmupArgs ParseLRSchedulerLinearWithWarmupArgs(Tcl_Interp*
 
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(valueObj);
+                args.optimizerObj = valueObj;
             } else if (param == "-numWarmupSteps" || param == "-num_warmup_steps") {
                 if (Tcl_GetIntFromObj(interp, valueObj, &args.numWarmupSteps) != TCL_OK) {
                     throw std::runtime_error("Invalid num_warmup_steps value");
@@ -941,7 +959,7 @@ int LRSchedulerLinearWithWarmup_Cmd(ClientData clientData, Tcl_Interp* interp, i
     try {
         LRSchedulerLinearWithWarmupArgs args = ParseLRSchedulerLinearWithWarmupArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -976,6 +994,7 @@ int LRSchedulerLinearWithWarmup_Cmd(ClientData clientData, Tcl_Interp* interp, i
 // torch::lr_scheduler_constant_with_warmup args structure
 struct LRSchedulerConstantWithWarmupArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int numWarmupSteps = -1;  // Required parameter, -1 indicates not set
     int lastEpoch = -1;  // Optional, default -1
     
@@ -995,6 +1014,7 @@ LRSchedulerConstantWithWarmupArgs ParseLRSchedulerConstantWithWarmupArgs(Tcl_Int
         }
 
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
 
         if (Tcl_GetIntFromObj(interp, objv[2], &args.numWarmupSteps) != TCL_OK) {
             throw std::runtime_error("Invalid num_warmup_steps value");
@@ -1016,6 +1036,7 @@ LRSchedulerConstantWithWarmupArgs ParseLRSchedulerConstantWithWarmupArgs(Tcl_Int
 
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(valueObj);
+                args.optimizerObj = valueObj;
             } else if (param == "-numWarmupSteps" || param == "-num_warmup_steps") {
                 if (Tcl_GetIntFromObj(interp, valueObj, &args.numWarmupSteps) != TCL_OK) {
                     throw std::runtime_error("Invalid num_warmup_steps value");
@@ -1044,7 +1065,7 @@ int LRSchedulerConstantWithWarmup_Cmd(ClientData clientData, Tcl_Interp* interp,
     try {
         LRSchedulerConstantWithWarmupArgs args = ParseLRSchedulerConstantWithWarmupArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -1081,6 +1102,7 @@ int LRSchedulerConstantWithWarmup_Cmd(ClientData clientData, Tcl_Interp* interp,
 
 struct LRSchedulerMultiStepArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     std::vector<int> milestones;
     double gamma = 0.1;
     
@@ -1100,6 +1122,7 @@ LRSchedulerMultiStepArgs ParseLRSchedulerMultiStepArgs(Tcl_Interp* interp, int o
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         // Parse milestones list
         int listLen;
@@ -1133,6 +1156,7 @@ LRSchedulerMultiStepArgs ParseLRSchedulerMultiStepArgs(Tcl_Interp* interp, int o
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(value);
+                args.optimizerObj = value;
             } else if (param == "-milestones") {
                 int listLen;
                 Tcl_Obj** listObjv;
@@ -1170,7 +1194,7 @@ int LRSchedulerMultiStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
     try {
         LRSchedulerMultiStepArgs args = ParseLRSchedulerMultiStepArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -1203,6 +1227,7 @@ int LRSchedulerMultiStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
 // Parameters for torch::lr_scheduler_cosine_annealing
 struct LRSchedulerCosineAnnealingArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int tMax = -1;  // Required parameter, -1 indicates not set
     double etaMin = 0.0;  // Optional, default 0.0
     
@@ -1223,6 +1248,7 @@ LRSchedulerCosineAnnealingArgs ParseLRSchedulerCosineAnnealingArgs(Tcl_Interp* i
         }
 
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
 
         if (Tcl_GetIntFromObj(interp, objv[2], &args.tMax) != TCL_OK) {
             throw std::runtime_error("Invalid T_max value");
@@ -1244,6 +1270,7 @@ LRSchedulerCosineAnnealingArgs ParseLRSchedulerCosineAnnealingArgs(Tcl_Interp* i
 
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(valueObj);
+                args.optimizerObj = valueObj;
             } else if (param == "-tMax" || param == "-t_max" || param == "-T_max") {
                 if (Tcl_GetIntFromObj(interp, valueObj, &args.tMax) != TCL_OK) {
                     throw std::runtime_error("Invalid T_max value");
@@ -1272,7 +1299,7 @@ int LRSchedulerCosineAnnealing_Cmd(ClientData clientData, Tcl_Interp* interp, in
     try {
         LRSchedulerCosineAnnealingArgs args = ParseLRSchedulerCosineAnnealingArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -1306,6 +1333,7 @@ int LRSchedulerCosineAnnealing_Cmd(ClientData clientData, Tcl_Interp* interp, in
 // Parameters for torch::lr_scheduler_plateau
 struct LRSchedulerPlateauArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     std::string mode = "min";  // Optional, default "min"
     double factor = 0.1;  // Optional, default 0.1
     int patience = 10;  // Optional, default 10
@@ -1327,6 +1355,7 @@ LRSchedulerPlateauArgs ParseLRSchedulerPlateauArgs(Tcl_Interp* interp, int objc,
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (objc > 2) {
             args.mode = Tcl_GetString(objv[2]);
@@ -1354,6 +1383,7 @@ LRSchedulerPlateauArgs ParseLRSchedulerPlateauArgs(Tcl_Interp* interp, int objc,
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-mode") {
                 args.mode = Tcl_GetString(objv[i + 1]);
             } else if (param == "-factor") {
@@ -1384,7 +1414,7 @@ int LRSchedulerPlateau_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
     try {
         auto args = ParseLRSchedulerPlateauArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -1418,6 +1448,7 @@ int LRSchedulerPlateau_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
 // Parameters for torch::lr_scheduler_inverse_sqrt
 struct LRSchedulerInverseSqrtArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int warmup_steps = -1;  // -1 indicates not set, will be validated
     double decay_factor = 1.0;
     bool warmup_steps_set = false;
@@ -1438,6 +1469,7 @@ LRSchedulerInverseSqrtArgs ParseLRSchedulerInverseSqrtArgs(Tcl_Interp* interp, i
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.warmup_steps) != TCL_OK) {
             throw std::runtime_error("Invalid warmup_steps value");
@@ -1460,6 +1492,7 @@ LRSchedulerInverseSqrtArgs ParseLRSchedulerInverseSqrtArgs(Tcl_Interp* interp, i
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-warmupSteps" || param == "-warmup_steps") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.warmup_steps) != TCL_OK) {
                     throw std::runtime_error("Invalid warmupSteps value");
@@ -1489,7 +1522,7 @@ int LRSchedulerInverseSqrt_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
     try {
         auto args = ParseLRSchedulerInverseSqrtArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -1523,6 +1556,7 @@ int LRSchedulerInverseSqrt_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
 // Parameters for torch::lr_scheduler_noam
 struct LRSchedulerNoamArgs {
     std::string optimizer;
+    Tcl_Obj* optimizerObj = nullptr;
     int modelSize = -1;  // Required parameter, -1 indicates not set
     int warmupSteps = 4000;  // Optional, default 4000
     
@@ -1542,6 +1576,7 @@ LRSchedulerNoamArgs ParseLRSchedulerNoamArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.optimizer = Tcl_GetString(objv[1]);
+        args.optimizerObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.modelSize) != TCL_OK) {
             throw std::runtime_error("Invalid model_size value");
@@ -1563,6 +1598,7 @@ LRSchedulerNoamArgs ParseLRSchedulerNoamArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-modelSize" || param == "-model_size") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.modelSize) != TCL_OK) {
                     throw std::runtime_error("Invalid modelSize value");
@@ -1591,7 +1627,7 @@ int LRSchedulerNoam_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         auto args = ParseLRSchedulerNoamArgs(interp, objc, objv);
         
-        if (optimizer_storage.find(args.optimizer) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(args.optimizerObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -1633,7 +1669,7 @@ int LRSchedulerOneCycleAdvanced_Cmd(ClientData clientData, Tcl_Interp* interp, i
     try {
         std::string optimizer_name = Tcl_GetString(objv[1]);
         
-        if (optimizer_storage.find(optimizer_name) == optimizer_storage.end()) {
+        if (FindOptimizerFromObj(objv[1]) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid optimizer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
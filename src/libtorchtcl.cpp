@@ -58,6 +58,9 @@ extern "C" {
 
         // Create namespace
         Tcl_CreateNamespace(interp, "torch", NULL, NULL);
+
+        // Handle object type used for reference-counted handle lifetimes
+        RegisterHandleObjType();
         
         // Register basic tensor commands
         Tcl_CreateObjCommand(interp, "torch::tensor_create", TensorCreate_Cmd, NULL, NULL);
@@ -549,6 +552,9 @@ extern "C" {
         Tcl_CreateObjCommand(interp, "torch::modelTrain", ModelTrain_Cmd, NULL, NULL);  // camelCase alias
         Tcl_CreateObjCommand(interp, "torch::model_eval", ModelEval_Cmd, NULL, NULL);
         Tcl_CreateObjCommand(interp, "torch::modelEval", ModelEval_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::train_step", TrainStep_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::trainStep", TrainStep_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::fit", Fit_Cmd, NULL, NULL);
 
         // Register additional optimizers
         Tcl_CreateObjCommand(interp, "torch::optimizer_adamw", OptimizerAdamW_Cmd, NULL, NULL);
@@ -1132,6 +1138,94 @@ extern "C" {
         Tcl_CreateObjCommand(interp, "torch::distributed_test", TensorDistributedTest_Cmd, NULL, NULL);
     Tcl_CreateObjCommand(interp, "torch::distributedTest", TensorDistributedTest_Cmd, NULL, NULL);
 
+        // Handle lifetime management
+        Tcl_CreateObjCommand(interp, "torch::tensor_free", TensorFree_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::tensorFree", TensorFree_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::release", Release_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::handle_autorelease", HandleAutorelease_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::handleAutorelease", HandleAutorelease_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::handle_count", HandleCount_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::handleCount", HandleCount_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::scope", Scope_Cmd, NULL, NULL);
+
+        // Binary tensor import/export
+        Tcl_CreateObjCommand(interp, "torch::tensor_from_bytes", TensorFromBytes_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::tensorFromBytes", TensorFromBytes_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::tensor_to_bytes", TensorToBytes_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::tensorToBytes", TensorToBytes_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::tensor_mmap", TensorMmap_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::tensorMmap", TensorMmap_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::tensor_mmap_create", TensorMmapCreate_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::tensorMmapCreate", TensorMmapCreate_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::tensor_mmap_write", TensorMmapWrite_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::tensorMmapWrite", TensorMmapWrite_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::tensor_mmap_flush", TensorMmapFlush_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::tensorMmapFlush", TensorMmapFlush_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::npy_load", NpyLoad_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::npyLoad", NpyLoad_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::npy_save", NpySave_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::npySave", NpySave_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::npz_load", NpzLoad_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::npzLoad", NpzLoad_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::npy_open", NpyOpen_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::npyOpen", NpyOpen_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::npy_next", NpyNext_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::npyNext", NpyNext_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::npy_close", NpyClose_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::npyClose", NpyClose_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::save_safetensors", SaveSafetensors_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::saveSafetensors", SaveSafetensors_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::load_safetensors", LoadSafetensors_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::loadSafetensors", LoadSafetensors_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::dataset", Dataset_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::dataset_size", DatasetSize_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::datasetSize", DatasetSize_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::dataloader", DataLoader_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::dataloader_next", DataLoaderNext_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::dataloaderNext", DataLoaderNext_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::dataloader_reset", DataLoaderReset_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::dataloaderReset", DataLoaderReset_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::dataloader_len", DataLoaderLen_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::dataloaderLen", DataLoaderLen_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::pack_padded_sequence", PackPaddedSequence_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::packPaddedSequence", PackPaddedSequence_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::pad_packed_sequence", PadPackedSequence_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::padPackedSequence", PadPackedSequence_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::exec", Exec_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::lazy_begin", LazyBegin_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::lazyBegin", LazyBegin_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::lazy_end", LazyEnd_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::lazyEnd", LazyEnd_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::jit_load", JitLoad_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::jitLoad", JitLoad_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::jit_forward", JitForward_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::jitForward", JitForward_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::jit_save", JitSave_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::jitSave", JitSave_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::jit_graph", JitGraph_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::jitGraph", JitGraph_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::model_trace", ModelTrace_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::modelTrace", ModelTrace_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::rnn_stream_open", RnnStreamOpen_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::rnnStreamOpen", RnnStreamOpen_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::rnn_stream_step", RnnStreamStep_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::rnnStreamStep", RnnStreamStep_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::async", Async_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::async_wait", AsyncWait_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::asyncWait", AsyncWait_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::serve_open", ServeOpen_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::serveOpen", ServeOpen_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::serve_submit", ServeSubmit_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::serveSubmit", ServeSubmit_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::serve_stats", ServeStats_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::serveStats", ServeStats_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::registry_publish", RegistryPublish_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::registryPublish", RegistryPublish_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::registry_lookup", RegistryLookup_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::registryLookup", RegistryLookup_Cmd, NULL, NULL);  // camelCase alias
+        Tcl_CreateObjCommand(interp, "torch::registry_remove", RegistryRemove_Cmd, NULL, NULL);
+        Tcl_CreateObjCommand(interp, "torch::registryRemove", RegistryRemove_Cmd, NULL, NULL);  // camelCase alias
+
         // Short convenience aliases matching common PyTorch naming conventions and used by test suites
         Tcl_CreateObjCommand(interp, "torch::randn", TensorRandn_Cmd, NULL, NULL);
         Tcl_CreateObjCommand(interp, "torch::rand", TensorRand_Cmd, NULL, NULL);
@@ -12,8 +12,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
 #include <unordered_map>
 #include <sstream>
+#include "handle_table.h"
 
 // Forward declarations of module classes
 class ConcreteLinear;
@@ -31,10 +33,28 @@ class ConcreteLSTM;
 class ConcreteGRU;
 class ConcreteRNN;
 
-// Global storage declarations
-extern std::unordered_map<std::string, torch::Tensor> tensor_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::nn::Module>> module_storage;
+// Single tensor in, single tensor out. Bound once when a module is stored,
+// so ModuleForward and sequential containers dispatch without probing types.
+using ModuleForwardFn = std::function<torch::Tensor(const torch::Tensor&)>;
+
+// A stored module and its bound forward pass. It is used as the module
+// pointer; every copy (handle entry, sequential child, async job, server,
+// registry entry) carries the forward along, so the lookup is O(1) and the
+// binding lives exactly as long as a reference to the module does.
+struct ModuleRef : std::shared_ptr<torch::nn::Module> {
+    ModuleRef() = default;
+    ModuleRef(std::shared_ptr<torch::nn::Module> module, ModuleForwardFn bound)
+        : std::shared_ptr<torch::nn::Module>(std::move(module)), forward(std::move(bound)) {}
+
+    ModuleForwardFn forward;
+};
+
+// Handle tables. They are thread_local: an interpreter lives on one thread,
+// so each interpreter thread of the Thread package gets tables of its own.
+// Models are shared across threads through torch::registry_publish.
+extern thread_local HandleTable<torch::Tensor> tensor_storage;
+extern thread_local std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
+extern thread_local std::unordered_map<std::string, ModuleRef> module_storage;
 
 // Helper function declarations
 c10::ScalarType GetScalarType(const char* type_str);
@@ -46,23 +66,154 @@ torch::Tensor TclListToTensor(Tcl_Interp* interp, Tcl_Obj* list,
 std::vector<int64_t> TclListToShape(Tcl_Interp* interp, Tcl_Obj* list);
 std::string GetNextHandle(const std::string& prefix);
 
+// Tensor handle that is freed again unless Fill() stores a value in it. Use
+// when a handle name is needed before the value exists (several outputs that
+// are published together, lazily evaluated results).
+using TensorReservation = HandleTable<torch::Tensor>::Reservation;
+TensorReservation ReserveTensorHandle();
+// Store tensor under a new handle and return the handle
+std::string StoreTensor(const torch::Tensor& tensor);
+
 // Additional helper function declarations
 torch::Tensor GetTensorFromObj(Tcl_Interp* interp, Tcl_Obj* obj);
 int GetIntFromObj(Tcl_Interp* interp, Tcl_Obj* obj);
+int64_t GetInt64FromObj(Tcl_Interp* interp, Tcl_Obj* obj);
 double GetDoubleFromObj(Tcl_Interp* interp, Tcl_Obj* obj);
 bool GetBoolFromObj(Tcl_Interp* interp, Tcl_Obj* obj);
 std::vector<int64_t> GetIntVectorFromObj(Tcl_Interp* interp, Tcl_Obj* obj);
 int SetTensorResult(Tcl_Interp* interp, const torch::Tensor& tensor);
 
+// Handle lifetime management and cached handle resolution (helpers.cpp)
+void RegisterHandleObjType();
+Tcl_Obj* NewHandleObj(const std::string& handle);
+torch::Tensor* FindTensorFromObj(Tcl_Obj* obj);
+ModuleRef* FindModuleFromObj(Tcl_Obj* obj);
+std::shared_ptr<torch::optim::Optimizer>* FindOptimizerFromObj(Tcl_Obj* obj);
+std::shared_ptr<torch::nn::Module> GetModuleFromObj(Tcl_Interp* interp, Tcl_Obj* obj);
+std::shared_ptr<torch::optim::Optimizer> GetOptimizerFromObj(Tcl_Interp* interp, Tcl_Obj* obj);
+bool HandleExists(const std::string& handle);
+bool ReleaseHandle(const std::string& handle);
+bool GetHandleAutorelease();
+void SetHandleAutorelease(bool enabled);
+void PushHandleScope();
+std::vector<std::string> PopHandleScope();
+void RecordScopedHandle(const std::string& handle);
+
+// While alive, new handles belong to no torch::scope frame. Used for work
+// delivered by the event loop, which may run inside an unrelated scope.
+class HandleScopeSuspension {
+public:
+    HandleScopeSuspension();
+    ~HandleScopeSuspension();
+
+private:
+    std::vector<std::vector<std::string>> saved_;
+};
+
+// Scheduler storage lives in learning_rate_schedulers.cpp
+bool SchedulerHandleExists(const std::string& handle);
+bool ReleaseSchedulerHandle(const std::string& handle);
+size_t SchedulerHandleCount();
+
+// .npy row reader storage lives in npy_io.cpp
+bool NpyReaderHandleExists(const std::string& handle);
+bool ReleaseNpyReaderHandle(const std::string& handle);
+size_t NpyReaderHandleCount();
+
+// Dataset and dataloader storage lives in dataloader.cpp
+struct DataLoader;
+bool DataHandleExists(const std::string& handle);
+bool ReleaseDataHandle(const std::string& handle);
+size_t DatasetHandleCount();
+size_t DataLoaderHandleCount();
+std::shared_ptr<DataLoader> FindDataLoader(const std::string& handle);
+void DataLoaderRestartPartialEpoch(DataLoader& loader);
+bool DataLoaderNextBatch(DataLoader& loader, std::vector<torch::Tensor>& tensors);
+
+// Packed sequence storage lives in packed_sequence.cpp
+bool PackedSequenceHandleExists(const std::string& handle);
+bool ReleasePackedSequenceHandle(const std::string& handle);
+size_t PackedSequenceHandleCount();
+torch::nn::utils::rnn::PackedSequence* FindPackedSequence(const std::string& handle);
+std::string StorePackedSequence(const torch::nn::utils::rnn::PackedSequence& sequence);
+
+// Recurrent stream storage lives in rnn_stream.cpp
+bool RnnStreamHandleExists(const std::string& handle);
+bool ReleaseRnnStreamHandle(const std::string& handle);
+size_t RnnStreamHandleCount();
+
+// Asynchronous execution lives in async_exec.cpp. Commands torch::async can
+// run are split into a Prepare step on the interpreter thread (argument
+// parsing and handle lookup) and AsyncWork::run, which may execute on a
+// worker thread and so must not touch handle storage.
+struct AsyncWork {
+    std::function<std::vector<torch::Tensor>()> run;
+    bool listResult = false;    // return a list of handles, not a single one
+};
+AsyncWork PrepareExec(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+AsyncWork PrepareLayerForward(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+AsyncWork PrepareTensorMatmul(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+bool AsyncFutureHandleExists(const std::string& handle);
+bool ReleaseAsyncFutureHandle(const std::string& handle);
+size_t AsyncFutureHandleCount();
+
+// Futures can also be completed by other native threads, like the batching
+// thread of torch::serve_open. NewAsyncFuture runs on the interpreter thread;
+// DeliverAsyncFuture may be called from any thread.
+struct AsyncFuture;
+std::shared_ptr<AsyncFuture> NewAsyncFuture(Tcl_Interp* interp, Tcl_Obj* callback, Tcl_Obj* variable,
+                                            std::string& handle);
+void DeliverAsyncFuture(std::shared_ptr<AsyncFuture> future, std::vector<torch::Tensor> outputs,
+                        const std::string& error);
+
+// Inference server storage lives in inference_server.cpp
+bool ServerHandleExists(const std::string& handle);
+bool ReleaseServerHandle(const std::string& handle);
+size_t ServerHandleCount();
+
+// Lazy elementwise evaluation lives in lazy_fusion.cpp. Commands call
+// LazyRecord while LazyModeEnabled(); it returns false when the operation
+// cannot be deferred and must run eagerly.
+enum class LazyOp {
+    Add, Sub, Mul, Div, Scale,
+    Abs, Exp, Log, Sqrt, Rsqrt, Square, Sin, Cos, Tanh, Sigmoid, Relu, Silu, Gelu
+};
+bool LazyModeEnabled();
+bool LazyRecord(Tcl_Interp* interp, LazyOp op, const std::vector<std::string>& inputs, double alpha = 1.0);
+bool LazyHandleExists(const std::string& handle);
+bool ReleaseLazyHandle(const std::string& handle);
+size_t LazyHandleCount();
+
 template<typename T>
 std::shared_ptr<torch::nn::Module> convert_to_base_module(std::shared_ptr<T> derived) {
     return std::static_pointer_cast<torch::nn::Module>(derived);
 }
 
+// Recurrent layers return (output, state); only the output sequence is kept
+inline torch::Tensor ForwardOutput(const torch::Tensor& output) {
+    return output;
+}
+
+template<typename... State>
+torch::Tensor ForwardOutput(const std::tuple<torch::Tensor, State...>& result) {
+    return std::get<0>(result);
+}
+
+template<typename T>
+auto BindModuleForward(T* module, int)
+    -> decltype(ForwardOutput(module->forward(std::declval<torch::Tensor>())), ModuleForwardFn()) {
+    return [module](const torch::Tensor& input) { return ForwardOutput(module->forward(input)); };
+}
+
+template<typename T>
+ModuleForwardFn BindModuleForward(T*, long) {
+    return nullptr;
+}
+
 template<typename T>
 std::string StoreModule(const std::string& prefix, std::shared_ptr<T> module) {
     std::string handle = GetNextHandle(prefix);
-    module_storage[handle] = convert_to_base_module(module);
+    module_storage[handle] = ModuleRef(convert_to_base_module(module), BindModuleForward(module.get(), 0));
     return handle;
 }
 
@@ -238,11 +389,85 @@ int TensorMultilabelMarginLoss_Cmd(ClientData clientData, Tcl_Interp* interp, in
 int TensorMultilabelSoftMarginLoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int TensorSoftMarginLoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 
+// Command function declarations for handle management
+int TensorFree_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int Release_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int HandleAutorelease_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int HandleCount_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int Scope_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for binary tensor import/export
+int TensorFromBytes_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int TensorToBytes_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// NumPy .npy header helpers (npy_format.cpp)
+struct NpyHeader {
+    c10::ScalarType dtype;
+    std::vector<int64_t> shape;
+    bool fortran_order = false;
+    size_t data_offset = 0;          // byte offset of the first element
+};
+bool IsNpyData(const unsigned char* buf, size_t len);
+// Bytes from the start of the file to the first element, read from the
+// fixed fields at the start of buf (NpyHeaderPrefixMax bytes cover them)
+constexpr size_t NpyHeaderPrefixMax = 12;
+size_t NpyHeaderSize(const unsigned char* buf, size_t len);
+NpyHeader ParseNpyHeader(const unsigned char* buf, size_t len);
+std::string BuildNpyHeader(c10::ScalarType dtype, const std::vector<int64_t>& shape);
+
+// Command function declarations for memory-mapped tensors
+int TensorMmap_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int TensorMmapCreate_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int TensorMmapWrite_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int TensorMmapFlush_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+torch::Tensor MapTensorFile(const std::string& path, const std::string& dtype_name,
+                            const std::vector<int64_t>* shape, int64_t offset, bool writable);
+
+// Command function declarations for NumPy .npy/.npz files
+int NpyLoad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int NpySave_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int NpzLoad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int NpyOpen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int NpyNext_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int NpyClose_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for safetensors files
+int SaveSafetensors_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int LoadSafetensors_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for datasets and data loaders
+int Dataset_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int DatasetSize_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int DataLoader_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int DataLoaderNext_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int DataLoaderReset_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int DataLoaderLen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for packed sequences
+int PackPaddedSequence_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int PadPackedSequence_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for op-list program execution
+int Exec_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for lazy elementwise fusion
+int LazyBegin_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int LazyEnd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for TorchScript modules
+int JitLoad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int JitForward_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int JitSave_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int JitGraph_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int ModelTrace_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
 // Command function declarations for training workflow
 int LayerParameters_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int ParametersTo_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int ModelTrain_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int ModelEval_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int TrainStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int Fit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 
 // Command function declarations for additional optimizers
 int OptimizerAdamW_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
@@ -393,6 +618,7 @@ int LRSchedulerExponential_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
 int LRSchedulerCosine_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int LRSchedulerStepUpdate_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int GetLR_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+void StepLRScheduler(const std::string& handle);
 
 // Command function declarations for advanced layers
 int BatchNorm1d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
@@ -541,12 +767,44 @@ int AvgPool2d_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 int Sequential_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int LayerForward_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int Conv2dSetWeights_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+torch::Tensor ModuleForward(const ModuleRef& module, const torch::Tensor& input);
 
 // Command function declarations for recurrent layers
 int LSTM_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int GRU_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int RNNTanh_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int RNNRelu_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+bool RecurrentLayerForwardPacked(const std::shared_ptr<torch::nn::Module>& module,
+                                 const torch::nn::utils::rnn::PackedSequence& input,
+                                 torch::nn::utils::rnn::PackedSequence& output);
+struct RecurrentLayerShape {
+    int64_t numLayers = 1;
+    int64_t hiddenSize = 0;
+    bool hasCell = false;       // LSTM layers also carry a cell state
+    bool batchFirst = false;
+    bool bidirectional = false;
+};
+bool GetRecurrentLayerShape(const std::shared_ptr<torch::nn::Module>& module, RecurrentLayerShape& shape);
+torch::Tensor RecurrentLayerForwardState(const std::shared_ptr<torch::nn::Module>& module,
+                                         const torch::Tensor& input, torch::Tensor& h, torch::Tensor& c);
+
+// Command function declarations for streaming recurrent inference
+int RnnStreamOpen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int RnnStreamStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for asynchronous execution
+int Async_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int AsyncWait_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for the dynamic-batching inference server
+int ServeOpen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int ServeSubmit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int ServeStats_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+
+// Command function declarations for the cross-thread model registry
+int RegistryPublish_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int RegistryLookup_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+int RegistryRemove_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 
 // Command function declarations for basic optimizers
 int OptimizerSGD_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
@@ -583,6 +841,8 @@ int Torch_GradScalerScale_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
 int Torch_GradScalerStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int Torch_GradScalerUpdate_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int Torch_GradScalerGetScale_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
+bool GradScalerTrainStep(const std::string& scaler_name, const torch::Tensor& loss,
+                         torch::optim::Optimizer& optimizer, double max_norm);
 int Torch_TensorMaskedFill_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 int Torch_TensorClamp_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]);
 
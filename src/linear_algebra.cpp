@@ -3,6 +3,7 @@
 // Parameter structure for tensor_svd command
 struct TensorSVDArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -21,6 +22,7 @@ TensorSVDArgs ParseTensorSVDArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -32,6 +34,7 @@ TensorSVDArgs ParseTensorSVDArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -49,22 +52,23 @@ int TensorSVD_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
     try {
         TensorSVDArgs args = ParseTensorSVDArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto svd_result = torch::svd(tensor);
         
         // Store U, S, V tensors
-        std::string u_name = GetNextHandle("tensor");
-        std::string s_name = GetNextHandle("tensor");
-        std::string v_name = GetNextHandle("tensor");
+        TensorReservation u_handle = ReserveTensorHandle();
+        TensorReservation s_handle = ReserveTensorHandle();
+        TensorReservation v_handle = ReserveTensorHandle();
         
-        tensor_storage[u_name] = std::get<0>(svd_result);
-        tensor_storage[s_name] = std::get<1>(svd_result);
-        tensor_storage[v_name] = std::get<2>(svd_result);
+        std::string u_name = u_handle.Fill(std::get<0>(svd_result));
+        std::string s_name = s_handle.Fill(std::get<1>(svd_result));
+        std::string v_name = v_handle.Fill(std::get<2>(svd_result));
         
         std::ostringstream result;
         result << "{U " << u_name << " S " << s_name << " V " << v_name << "}";
@@ -79,6 +83,7 @@ int TensorSVD_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
 // Parameter structure for tensor_eigen command
 struct TensorEigenArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -97,6 +102,7 @@ TensorEigenArgs ParseTensorEigenArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -108,6 +114,7 @@ TensorEigenArgs ParseTensorEigenArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -125,31 +132,32 @@ int TensorEigen_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorEigenArgs args = ParseTensorEigenArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto eigen_result = torch::linalg::eigh(tensor, "L");
         
         // Store eigenvalues and eigenvectors
-        std::string vals_name = GetNextHandle("tensor");
-        std::string vecs_name = GetNextHandle("tensor");
+        TensorReservation vals_handle = ReserveTensorHandle();
+        TensorReservation vecs_handle = ReserveTensorHandle();
         
-        tensor_storage[vals_name] = std::get<0>(eigen_result);
-        tensor_storage[vecs_name] = std::get<1>(eigen_result);
+        std::string vals_name = vals_handle.Fill(std::get<0>(eigen_result));
+        std::string vecs_name = vecs_handle.Fill(std::get<1>(eigen_result));
         
         // Create a proper Tcl list object
         Tcl_Obj* result_list = Tcl_NewListObj(0, nullptr);
         
         // Add "eigenvalues" and the tensor handle
         Tcl_ListObjAppendElement(interp, result_list, Tcl_NewStringObj("eigenvalues", -1));
-        Tcl_ListObjAppendElement(interp, result_list, Tcl_NewStringObj(vals_name.c_str(), -1));
+        Tcl_ListObjAppendElement(interp, result_list, NewHandleObj(vals_name));
         
         // Add "eigenvectors" and the tensor handle
         Tcl_ListObjAppendElement(interp, result_list, Tcl_NewStringObj("eigenvectors", -1));
-        Tcl_ListObjAppendElement(interp, result_list, Tcl_NewStringObj(vecs_name.c_str(), -1));
+        Tcl_ListObjAppendElement(interp, result_list, NewHandleObj(vecs_name));
         
         Tcl_SetObjResult(interp, result_list);
         return TCL_OK;
@@ -162,6 +170,7 @@ int TensorEigen_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for tensor_qr command
 struct TensorQRArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     
     bool IsValid() const {
         return !tensor.empty();
@@ -182,6 +191,7 @@ TensorQRArgs ParseTensorQRArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Usage: torch::tensor_qr tensor");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -193,6 +203,7 @@ TensorQRArgs ParseTensorQRArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -tensor");
             }
@@ -211,20 +222,21 @@ int TensorQR_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
         // Parse arguments using dual syntax parser
         TensorQRArgs args = ParseTensorQRArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         auto qr_result = torch::qr(tensor);
         
         // Store Q and R tensors
-        std::string q_name = GetNextHandle("tensor");
-        std::string r_name = GetNextHandle("tensor");
+        TensorReservation q_handle = ReserveTensorHandle();
+        TensorReservation r_handle = ReserveTensorHandle();
         
-        tensor_storage[q_name] = std::get<0>(qr_result);
-        tensor_storage[r_name] = std::get<1>(qr_result);
+        std::string q_name = q_handle.Fill(std::get<0>(qr_result));
+        std::string r_name = r_handle.Fill(std::get<1>(qr_result));
         
         std::ostringstream result;
         result << "{Q " << q_name << " R " << r_name << "}";
@@ -239,6 +251,7 @@ int TensorQR_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
 // Parameter structure for tensor_cholesky command
 struct TensorCholeskyArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -259,6 +272,7 @@ TensorCholeskyArgs ParseTensorCholeskyArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             throw std::runtime_error("Usage: torch::tensor_cholesky tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -270,6 +284,7 @@ TensorCholeskyArgs ParseTensorCholeskyArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -288,19 +303,19 @@ int TensorCholesky_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorCholeskyArgs args = ParseTensorCholeskyArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto cholesky_result = torch::linalg::cholesky(tensor);
         
         // Store result tensor
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = cholesky_result;
+        std::string result_name = StoreTensor(cholesky_result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -311,6 +326,7 @@ int TensorCholesky_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for tensor_matrix_exp command
 struct TensorMatrixExpArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -329,6 +345,7 @@ TensorMatrixExpArgs ParseTensorMatrixExpArgs(Tcl_Interp* interp, int objc, Tcl_O
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -340,6 +357,7 @@ TensorMatrixExpArgs ParseTensorMatrixExpArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -358,19 +376,19 @@ int TensorMatrixExp_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorMatrixExpArgs args = ParseTensorMatrixExpArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto matrix_exp_result = torch::linalg::matrix_exp(tensor);
         
         // Store result tensor
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = matrix_exp_result;
+        std::string result_name = StoreTensor(matrix_exp_result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -381,6 +399,7 @@ int TensorMatrixExp_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for tensor_pinv command
 struct TensorPinvArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double rcond = 1e-15;  // Default rcond value
     bool has_rcond = false;
     
@@ -401,6 +420,7 @@ TensorPinvArgs ParseTensorPinvArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetDoubleFromObj(interp, objv[2], &args.rcond) != TCL_OK) {
@@ -420,6 +440,7 @@ TensorPinvArgs ParseTensorPinvArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-rcond") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.rcond) != TCL_OK) {
                     throw std::runtime_error("Invalid rcond value");
@@ -443,12 +464,13 @@ int TensorPinv_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         TensorPinvArgs args = ParseTensorPinvArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         torch::Tensor pinv_result;
         if (args.has_rcond) {
@@ -460,10 +482,9 @@ int TensorPinv_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         // Store result tensor
-        std::string result_name = GetNextHandle("tensor");
-        tensor_storage[result_name] = pinv_result;
+        std::string result_name = StoreTensor(pinv_result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_name.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_name));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
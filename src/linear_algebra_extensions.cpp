@@ -4,6 +4,8 @@
 struct TensorCrossArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     int dim = -1;  // Default value, -1 means use default
     bool has_dim = false;
     
@@ -26,7 +28,9 @@ TensorCrossArgs ParseTensorCrossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::cross input other ?dim?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.other = Tcl_GetString(objv[2]);
+        args.otherObj = objv[2];
         
         if (objc > 3) {
             if (Tcl_GetIntFromObj(interp, objv[3], &args.dim) != TCL_OK) {
@@ -45,8 +49,10 @@ TensorCrossArgs ParseTensorCrossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = Tcl_GetString(objv[i + 1]);
+                args.otherObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim parameter");
@@ -71,18 +77,20 @@ int TensorCross_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         // Parse arguments using dual syntax
         TensorCrossArgs args = ParseTensorCrossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other_tensor = FindTensorFromObj(args.otherObj);
+        if (other_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid other tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto other = tensor_storage[args.other];
+        auto input = *input_tensor;
+        auto other = *other_tensor;
 
         torch::Tensor output;
         if (args.has_dim) {
@@ -91,10 +99,9 @@ int TensorCross_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
             output = torch::cross(input, other);
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -106,6 +113,8 @@ int TensorCross_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 struct DotArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !other.empty();
@@ -127,7 +136,9 @@ DotArgs ParseDotArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.other = Tcl_GetString(objv[2]);
+        args.otherObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -138,8 +149,10 @@ DotArgs ParseDotArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = Tcl_GetString(objv[i + 1]);
+                args.otherObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters: -input, -other");
             }
@@ -158,25 +171,26 @@ int TensorDot_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
     try {
         DotArgs args = ParseDotArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other_tensor = FindTensorFromObj(args.otherObj);
+        if (other_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid other tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto other = tensor_storage[args.other];
+        auto input = *input_tensor;
+        auto other = *other_tensor;
 
         auto output = torch::dot(input, other);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -188,6 +202,8 @@ int TensorDot_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
 struct TensorOuterArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !other.empty();
@@ -208,7 +224,9 @@ TensorOuterArgs ParseTensorOuterArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::outer input other");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.other = Tcl_GetString(objv[2]);
+        args.otherObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -220,8 +238,10 @@ TensorOuterArgs ParseTensorOuterArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = Tcl_GetString(objv[i + 1]);
+                args.otherObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -241,25 +261,26 @@ int TensorOuter_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         // Parse arguments using dual syntax
         TensorOuterArgs args = ParseTensorOuterArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other_tensor = FindTensorFromObj(args.otherObj);
+        if (other_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid other tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto other = tensor_storage[args.other];
+        auto input = *input_tensor;
+        auto other = *other_tensor;
 
         auto output = torch::outer(input, other);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -270,6 +291,7 @@ int TensorOuter_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for trace command
 struct TraceArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -288,6 +310,7 @@ static TraceArgs ParseTraceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -299,6 +322,7 @@ static TraceArgs ParseTraceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const obj
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input");
             }
@@ -317,18 +341,18 @@ int TensorTrace_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TraceArgs args = ParseTraceArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::trace(input);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -339,6 +363,7 @@ int TensorTrace_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for diag command
 struct DiagArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int diagonal = 0;  // Default to main diagonal
     
     bool IsValid() const {
@@ -361,6 +386,7 @@ DiagArgs ParseDiagArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             int diagonal;
@@ -379,6 +405,7 @@ DiagArgs ParseDiagArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-diagonal") {
                 int diagonal;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &diagonal) != TCL_OK) {
@@ -403,12 +430,13 @@ int TensorDiag_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         DiagArgs args = ParseDiagArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         torch::Tensor output;
         if (args.diagonal != 0) {
@@ -417,10 +445,9 @@ int TensorDiag_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             output = torch::diag(input);
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -431,6 +458,7 @@ int TensorDiag_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for diagflat command
 struct DiagflatArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int offset = 0;  // Default to main diagonal
     
     bool IsValid() const {
@@ -453,6 +481,7 @@ DiagflatArgs ParseDiagflatArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             int offset;
@@ -471,6 +500,7 @@ DiagflatArgs ParseDiagflatArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-offset") {
                 int offset;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &offset) != TCL_OK) {
@@ -495,12 +525,13 @@ int TensorDiagflat_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         DiagflatArgs args = ParseDiagflatArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         torch::Tensor output;
         if (args.offset != 0) {
@@ -509,10 +540,9 @@ int TensorDiagflat_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             output = torch::diagflat(input);
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -523,6 +553,7 @@ int TensorDiagflat_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for tril
 struct TrilArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int diagonal = 0;
     bool has_diagonal = false;
     bool IsValid() const { return !input.empty(); }
@@ -545,6 +576,7 @@ TrilArgs ParseTrilArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("Usage: torch::tril input ?diagonal?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.diagonal) != TCL_OK) {
                 throw std::runtime_error("Invalid diagonal parameter: must be an integer");
@@ -560,6 +592,7 @@ TrilArgs ParseTrilArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-diagonal") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.diagonal) != TCL_OK) {
                     throw std::runtime_error("Invalid diagonal parameter: must be an integer");
@@ -580,20 +613,20 @@ TrilArgs ParseTrilArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
 int TensorTril_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TrilArgs args = ParseTrilArgs(interp, objc, objv);
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         torch::Tensor output;
         if (args.has_diagonal) {
             output = torch::tril(input, args.diagonal);
         } else {
             output = torch::tril(input);
         }
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -604,6 +637,7 @@ int TensorTril_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for triu
 struct TriuArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int diagonal = 0;
     bool has_diagonal = false;
     bool IsValid() const { return !input.empty(); }
@@ -626,6 +660,7 @@ TriuArgs ParseTriuArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("Usage: torch::triu input ?diagonal?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.diagonal) != TCL_OK) {
                 throw std::runtime_error("Invalid diagonal parameter: must be an integer");
@@ -641,6 +676,7 @@ TriuArgs ParseTriuArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-diagonal") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.diagonal) != TCL_OK) {
                     throw std::runtime_error("Invalid diagonal parameter: must be an integer");
@@ -661,20 +697,20 @@ TriuArgs ParseTriuArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
 int TensorTriu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TriuArgs args = ParseTriuArgs(interp, objc, objv);
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         torch::Tensor output;
         if (args.has_diagonal) {
             output = torch::triu(input, args.diagonal);
         } else {
             output = torch::triu(input);
         }
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -685,6 +721,7 @@ int TensorTriu_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for matrix_power command
 struct MatrixPowerArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int n = 2;  // Default power value
     
     bool IsValid() const {
@@ -718,6 +755,7 @@ MatrixPowerArgs ParseMatrixPowerArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         int n_val;
         if (Tcl_GetIntFromObj(interp, objv[2], &n_val) != TCL_OK) {
@@ -729,6 +767,7 @@ MatrixPowerArgs ParseMatrixPowerArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
             // Mixed syntax: positional input, then named parameters
             args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
             
             // Parse remaining named parameters starting from index 2
             for (int i = 2; i < objc; i += 2) {
@@ -759,6 +798,7 @@ MatrixPowerArgs ParseMatrixPowerArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
                 
                 if (param == "-input") {
                     args.input = Tcl_GetString(objv[i + 1]);
+                    args.inputObj = objv[i + 1];
                 } else if (param == "-n") {
                     int n_val;
                     if (Tcl_GetIntFromObj(interp, objv[i + 1], &n_val) != TCL_OK) {
@@ -784,19 +824,19 @@ int TensorMatrixPower_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
     try {
         MatrixPowerArgs args = ParseMatrixPowerArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         auto output = torch::matrix_power(input, args.n);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -807,6 +847,7 @@ int TensorMatrixPower_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
 // Parameter structure for matrix_rank command
 struct MatrixRankArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double tol = 1e-12;  // Default tolerance
     bool hermitian = false;  // Default hermitian flag
     
@@ -841,6 +882,7 @@ MatrixRankArgs ParseMatrixRankArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             double tol_val;
@@ -862,6 +904,7 @@ MatrixRankArgs ParseMatrixRankArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
             // Mixed syntax: positional input, then named parameters
             args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
             
             // Parse remaining named parameters starting from index 2
             for (int i = 2; i < objc; i += 2) {
@@ -898,6 +941,7 @@ MatrixRankArgs ParseMatrixRankArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
                 
                 if (param == "-input") {
                     args.input = Tcl_GetString(objv[i + 1]);
+                    args.inputObj = objv[i + 1];
                 } else if (param == "-tol" || param == "-tolerance") {
                     double tol_val;
                     if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &tol_val) != TCL_OK) {
@@ -929,19 +973,19 @@ int TensorMatrixRank_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         MatrixRankArgs args = ParseMatrixRankArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         auto output = torch::linalg::matrix_rank(input, args.tol, args.hermitian);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -952,6 +996,7 @@ int TensorMatrixRank_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for cond command
 struct CondArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::string p = "";  // Empty means use default (2-norm)
     
     bool IsValid() const {
@@ -970,6 +1015,7 @@ CondArgs ParseCondArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             args.p = Tcl_GetString(objv[2]);
@@ -985,6 +1031,7 @@ CondArgs ParseCondArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-p" || param == "-norm") {
                 args.p = Tcl_GetString(objv[i + 1]);
             } else {
@@ -1005,12 +1052,13 @@ int TensorCond_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         CondArgs args = ParseCondArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         torch::Tensor output;
         if (!args.p.empty()) {
@@ -1037,10 +1085,9 @@ int TensorCond_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             output = s[0] / s[-1];
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1051,6 +1098,7 @@ int TensorCond_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for matrix_norm command
 struct MatrixNormArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::string ord = "fro";  // Default value
     std::vector<int64_t> dim;
     bool keepdim = false;
@@ -1075,6 +1123,7 @@ MatrixNormArgs ParseMatrixNormArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::matrix_norm input ?ord? ?dim? ?keepdim?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             args.ord = Tcl_GetString(objv[2]);
@@ -1114,6 +1163,7 @@ MatrixNormArgs ParseMatrixNormArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-ord") {
                 args.ord = Tcl_GetString(objv[i + 1]);
             } else if (param == "-dim") {
@@ -1155,12 +1205,13 @@ int TensorMatrixNorm_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         MatrixNormArgs args = ParseMatrixNormArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         // Handle ord parameter (string or numeric)
         bool use_string_ord = true;
@@ -1200,10 +1251,9 @@ int TensorMatrixNorm_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
             }
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1216,6 +1266,7 @@ int TensorMatrixNorm_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // =====================
 struct TensorVectorNormArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double ord = 2.0;
     std::vector<int64_t> dim;
     bool has_dim = false;
@@ -1237,6 +1288,7 @@ TensorVectorNormArgs ParseTensorVectorNormArgs(Tcl_Interp* interp, int objc, Tcl
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             double ord_val;
@@ -1282,6 +1334,7 @@ TensorVectorNormArgs ParseTensorVectorNormArgs(Tcl_Interp* interp, int objc, Tcl
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-ord") {
                 double ord_val;
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &ord_val) != TCL_OK) {
@@ -1329,12 +1382,13 @@ int TensorVectorNorm_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         TensorVectorNormArgs args = ParseTensorVectorNormArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         // Prepare parameters
         c10::Scalar ord = args.ord;
@@ -1345,10 +1399,9 @@ int TensorVectorNorm_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 
         auto output = torch::linalg_vector_norm(input, ord, dim, args.keepdim);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1360,6 +1413,8 @@ int TensorVectorNorm_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 struct LstsqArgs {
     std::string B;
     std::string A;
+    Tcl_Obj* BObj = nullptr;
+    Tcl_Obj* AObj = nullptr;
     c10::optional<double> rcond = c10::nullopt;
     
     bool IsValid() const {
@@ -1381,7 +1436,9 @@ LstsqArgs ParseLstsqArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             throw std::runtime_error("Usage: torch::lstsq B A ?rcond?");
         }
         args.B = Tcl_GetString(objv[1]);
+        args.BObj = objv[1];
         args.A = Tcl_GetString(objv[2]);
+        args.AObj = objv[2];
         
         if (objc > 3) {
             double rcond_val;
@@ -1401,8 +1458,10 @@ LstsqArgs ParseLstsqArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-b" || param == "-B") {
                 args.B = Tcl_GetString(objv[i + 1]);
+                args.BObj = objv[i + 1];
             } else if (param == "-a" || param == "-A") {
                 args.A = Tcl_GetString(objv[i + 1]);
+                args.AObj = objv[i + 1];
             } else if (param == "-rcond") {
                 double rcond_val;
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &rcond_val) != TCL_OK) {
@@ -1428,26 +1487,27 @@ int TensorLstsq_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         // Parse arguments using dual syntax
         LstsqArgs args = ParseLstsqArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.B) == tensor_storage.end()) {
+        torch::Tensor* B_tensor = FindTensorFromObj(args.BObj);
+        if (B_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid B tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.A) == tensor_storage.end()) {
+        torch::Tensor* A_tensor = FindTensorFromObj(args.AObj);
+        if (A_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid A tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto B = tensor_storage[args.B];
-        auto A = tensor_storage[args.A];
+        auto B = *B_tensor;
+        auto A = *A_tensor;
 
         auto result = torch::linalg_lstsq(B, A, args.rcond);
         auto solution = std::get<0>(result);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = solution;
+        std::string handle = StoreTensor(solution);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1459,6 +1519,8 @@ int TensorLstsq_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 struct SolveTriangularArgs {
     std::string B;
     std::string A;
+    Tcl_Obj* BObj = nullptr;
+    Tcl_Obj* AObj = nullptr;
     bool upper = true;           // Default value
     bool left = true;            // Default value  
     bool unitriangular = false;  // Default value
@@ -1482,7 +1544,9 @@ SolveTriangularArgs ParseSolveTriangularArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::solve_triangular B A ?upper? ?left? ?unitriangular?");
         }
         args.B = Tcl_GetString(objv[1]);
+        args.BObj = objv[1];
         args.A = Tcl_GetString(objv[2]);
+        args.AObj = objv[2];
         
         if (objc > 3) {
             int upper_int;
@@ -1518,8 +1582,10 @@ SolveTriangularArgs ParseSolveTriangularArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-B" || param == "-b") {
                 args.B = Tcl_GetString(objv[i + 1]);
+                args.BObj = objv[i + 1];
             } else if (param == "-A" || param == "-a") {
                 args.A = Tcl_GetString(objv[i + 1]);
+                args.AObj = objv[i + 1];
             } else if (param == "-upper") {
                 int upper_int;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &upper_int) != TCL_OK) {
@@ -1557,25 +1623,26 @@ int TensorSolveTriangular_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         // Parse arguments using dual syntax
         SolveTriangularArgs args = ParseSolveTriangularArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.B) == tensor_storage.end()) {
+        torch::Tensor* B_tensor = FindTensorFromObj(args.BObj);
+        if (B_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid B tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.A) == tensor_storage.end()) {
+        torch::Tensor* A_tensor = FindTensorFromObj(args.AObj);
+        if (A_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid A tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto B = tensor_storage[args.B];
-        auto A = tensor_storage[args.A];
+        auto B = *B_tensor;
+        auto A = *A_tensor;
 
         auto output = torch::linalg_solve_triangular(A, B, args.upper, args.left, args.unitriangular);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1587,6 +1654,8 @@ int TensorSolveTriangular_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 struct CholeskySolveArgs {
     std::string B;
     std::string L;
+    Tcl_Obj* BObj = nullptr;
+    Tcl_Obj* LObj = nullptr;
     bool upper = false;  // Default value
     
     bool IsValid() const {
@@ -1608,7 +1677,9 @@ CholeskySolveArgs ParseCholeskySolveArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::cholesky_solve B L ?upper?");
         }
         args.B = Tcl_GetString(objv[1]);
+        args.BObj = objv[1];
         args.L = Tcl_GetString(objv[2]);
+        args.LObj = objv[2];
         
         if (objc > 3) {
             int upper_int;
@@ -1628,8 +1699,10 @@ CholeskySolveArgs ParseCholeskySolveArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-b" || param == "-B") {
                 args.B = Tcl_GetString(objv[i + 1]);
+                args.BObj = objv[i + 1];
             } else if (param == "-l" || param == "-L") {
                 args.L = Tcl_GetString(objv[i + 1]);
+                args.LObj = objv[i + 1];
             } else if (param == "-upper") {
                 int upper_int;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &upper_int) != TCL_OK) {
@@ -1654,25 +1727,26 @@ int TensorCholeskySolve_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
     try {
         CholeskySolveArgs args = ParseCholeskySolveArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.B) == tensor_storage.end()) {
+        torch::Tensor* B_tensor = FindTensorFromObj(args.BObj);
+        if (B_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid B tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.L) == tensor_storage.end()) {
+        torch::Tensor* L_tensor = FindTensorFromObj(args.LObj);
+        if (L_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid L tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto B = tensor_storage[args.B];
-        auto L = tensor_storage[args.L];
+        auto B = *B_tensor;
+        auto L = *L_tensor;
 
         auto output = torch::cholesky_solve(B, L, args.upper);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1685,6 +1759,9 @@ struct LUSolveArgs {
     std::string B;
     std::string LU_data;
     std::string LU_pivots;
+    Tcl_Obj* BObj = nullptr;
+    Tcl_Obj* LU_dataObj = nullptr;
+    Tcl_Obj* LU_pivotsObj = nullptr;
     
     bool IsValid() const {
         return !B.empty() && !LU_data.empty() && !LU_pivots.empty();
@@ -1705,8 +1782,11 @@ LUSolveArgs ParseLUSolveArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             throw std::runtime_error("Usage: torch::lu_solve B LU_data LU_pivots");
         }
         args.B = Tcl_GetString(objv[1]);
+        args.BObj = objv[1];
         args.LU_data = Tcl_GetString(objv[2]);
+        args.LU_dataObj = objv[2];
         args.LU_pivots = Tcl_GetString(objv[3]);
+        args.LU_pivotsObj = objv[3];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1718,10 +1798,13 @@ LUSolveArgs ParseLUSolveArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             
             if (param == "-B" || param == "-b") {
                 args.B = Tcl_GetString(objv[i + 1]);
+                args.BObj = objv[i + 1];
             } else if (param == "-LU_data" || param == "-luData") {
                 args.LU_data = Tcl_GetString(objv[i + 1]);
+                args.LU_dataObj = objv[i + 1];
             } else if (param == "-LU_pivots" || param == "-luPivots") {
                 args.LU_pivots = Tcl_GetString(objv[i + 1]);
+                args.LU_pivotsObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -B, -b, -LU_data, -luData, -LU_pivots, -luPivots");
             }
@@ -1740,31 +1823,33 @@ int TensorLUSolve_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         LUSolveArgs args = ParseLUSolveArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.B) == tensor_storage.end()) {
+        torch::Tensor* B_tensor = FindTensorFromObj(args.BObj);
+        if (B_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid B tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.LU_data) == tensor_storage.end()) {
+        torch::Tensor* LU_data_tensor = FindTensorFromObj(args.LU_dataObj);
+        if (LU_data_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid LU_data tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.LU_pivots) == tensor_storage.end()) {
+        torch::Tensor* LU_pivots_tensor = FindTensorFromObj(args.LU_pivotsObj);
+        if (LU_pivots_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid LU_pivots tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto B = tensor_storage[args.B];
-        auto LU_data = tensor_storage[args.LU_data];
-        auto LU_pivots = tensor_storage[args.LU_pivots];
+        auto B = *B_tensor;
+        auto LU_data = *LU_data_tensor;
+        auto LU_pivots = *LU_pivots_tensor;
 
         auto output = torch::lu_solve(B, LU_data, LU_pivots);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
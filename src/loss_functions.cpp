@@ -4,6 +4,8 @@
 struct MSELossArgs {
     std::string input;
     std::string target;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
     std::string reduction = "mean";
     
     bool IsValid() const {
@@ -17,8 +19,14 @@ MSELossArgs ParseMSELossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
         if (objc >= 4) args.reduction = Tcl_GetString(objv[3]);
     } else {
         // Named parameter syntax
@@ -32,8 +40,10 @@ MSELossArgs ParseMSELossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else {
@@ -62,17 +72,19 @@ int MSELoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
     try {
         MSELossArgs args = ParseMSELossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         // Parse reduction parameter
         at::Reduction::Reduction reduction = at::Reduction::Mean;
@@ -86,10 +98,9 @@ int MSELoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         
         torch::Tensor loss = torch::mse_loss(input, target, reduction);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = loss;
+        std::string result_handle = StoreTensor(loss);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -103,6 +114,9 @@ struct CrossEntropyLossArgs {
     std::string input;
     std::string target;
     std::string weight = "none";
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
     std::string reduction = "mean";
     
     bool IsValid() const {
@@ -116,9 +130,18 @@ CrossEntropyLossArgs ParseCrossEntropyLossArgs(Tcl_Interp* interp, int objc, Tcl
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.weight = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
+        if (objc >= 4) {
+            args.weight = Tcl_GetString(objv[3]);
+            args.weightObj = objv[3];
+        }
         if (objc >= 5) args.reduction = Tcl_GetString(objv[4]);
     } else {
         // Named parameter syntax
@@ -132,10 +155,13 @@ CrossEntropyLossArgs ParseCrossEntropyLossArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = value;
+                args.weightObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else {
@@ -164,24 +190,26 @@ int CrossEntropyLoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     try {
         CrossEntropyLossArgs args = ParseCrossEntropyLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         torch::Tensor weight;
         at::Reduction::Reduction reduction = at::Reduction::Mean;
         
         // Parse optional weight parameter
-        if (args.weight != "none" && tensor_storage.find(args.weight) != tensor_storage.end()) {
-            weight = tensor_storage[args.weight];
+        if (args.weight != "none" && FindTensorFromObj(args.weightObj) != nullptr) {
+            weight = *FindTensorFromObj(args.weightObj);
         }
         
         // Parse reduction parameter
@@ -200,10 +228,9 @@ int CrossEntropyLoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
             loss = torch::cross_entropy_loss(input, target, {}, reduction);
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = loss;
+        std::string result_handle = StoreTensor(loss);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -217,6 +244,9 @@ struct NLLLossArgs {
     std::string input;
     std::string target;
     std::string weight = "none";
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
     std::string reduction = "mean";
     
     bool IsValid() const {
@@ -230,9 +260,18 @@ NLLLossArgs ParseNLLLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.weight = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
+        if (objc >= 4) {
+            args.weight = Tcl_GetString(objv[3]);
+            args.weightObj = objv[3];
+        }
         if (objc >= 5) args.reduction = Tcl_GetString(objv[4]);
     } else {
         // Named parameter syntax
@@ -246,10 +285,13 @@ NLLLossArgs ParseNLLLossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = value;
+                args.weightObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else {
@@ -278,24 +320,26 @@ int NLLLoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
     try {
         NLLLossArgs args = ParseNLLLossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         torch::Tensor weight;
         at::Reduction::Reduction reduction = at::Reduction::Mean;
         
         // Parse optional weight parameter
-        if (args.weight != "none" && tensor_storage.find(args.weight) != tensor_storage.end()) {
-            weight = tensor_storage[args.weight];
+        if (args.weight != "none" && FindTensorFromObj(args.weightObj) != nullptr) {
+            weight = *FindTensorFromObj(args.weightObj);
         }
         
         // Parse reduction parameter
@@ -314,10 +358,9 @@ int NLLLoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
             loss = torch::nll_loss(input, target, {}, reduction);
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = loss;
+        std::string result_handle = StoreTensor(loss);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -331,6 +374,9 @@ struct BCELossArgs {
     std::string input;
     std::string target;
     std::string weight = "none";
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* targetObj = nullptr;
+    Tcl_Obj* weightObj = nullptr;
     std::string reduction = "mean";
     
     bool IsValid() const {
@@ -344,9 +390,18 @@ BCELossArgs ParseBCELossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc >= 2) args.input = Tcl_GetString(objv[1]);
-        if (objc >= 3) args.target = Tcl_GetString(objv[2]);
-        if (objc >= 4) args.weight = Tcl_GetString(objv[3]);
+        if (objc >= 2) {
+            args.input = Tcl_GetString(objv[1]);
+            args.inputObj = objv[1];
+        }
+        if (objc >= 3) {
+            args.target = Tcl_GetString(objv[2]);
+            args.targetObj = objv[2];
+        }
+        if (objc >= 4) {
+            args.weight = Tcl_GetString(objv[3]);
+            args.weightObj = objv[3];
+        }
         if (objc >= 5) args.reduction = Tcl_GetString(objv[4]);
     } else {
         // Named parameter syntax
@@ -360,10 +415,13 @@ BCELossArgs ParseBCELossArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-target") {
                 args.target = value;
+                args.targetObj = objv[i + 1];
             } else if (param == "-weight") {
                 args.weight = value;
+                args.weightObj = objv[i + 1];
             } else if (param == "-reduction") {
                 args.reduction = value;
             } else {
@@ -392,24 +450,26 @@ int BCELoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
     try {
         BCELossArgs args = ParseBCELossArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.target) == tensor_storage.end()) {
+        torch::Tensor* target_tensor = FindTensorFromObj(args.targetObj);
+        if (target_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid target tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
-        auto& target = tensor_storage[args.target];
+        auto& input = *input_tensor;
+        auto& target = *target_tensor;
         
         torch::Tensor weight;
         at::Reduction::Reduction reduction = at::Reduction::Mean;
         
         // Parse optional weight parameter
-        if (args.weight != "none" && tensor_storage.find(args.weight) != tensor_storage.end()) {
-            weight = tensor_storage[args.weight];
+        if (args.weight != "none" && FindTensorFromObj(args.weightObj) != nullptr) {
+            weight = *FindTensorFromObj(args.weightObj);
         }
         
         // Parse reduction parameter
@@ -428,10 +488,9 @@ int BCELoss_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
             loss = torch::binary_cross_entropy(input, target, {}, reduction);
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = loss;
+        std::string result_handle = StoreTensor(loss);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
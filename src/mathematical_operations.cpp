@@ -3,6 +3,7 @@
 // Parameter structure for sin command
 struct TensorSinArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -23,6 +24,7 @@ TensorSinArgs ParseTensorSinArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::sin tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -34,6 +36,7 @@ TensorSinArgs ParseTensorSinArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -55,13 +58,13 @@ static int TensorUnaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     }
 
     try {
-        std::string name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(name) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(objv[1]);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[name];
+        auto& tensor = *input;
         torch::Tensor result;
         
         if (strcmp(op, "sin") == 0) {
@@ -127,10 +130,9 @@ static int TensorUnaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
             return TCL_ERROR;
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -146,20 +148,19 @@ static int TensorBinaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
     }
 
     try {
-        std::string name1 = Tcl_GetString(objv[1]);
-        std::string name2 = Tcl_GetString(objv[2]);
-        
-        if (tensor_storage.find(name1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(objv[1]);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(name2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(objv[2]);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[name1];
-        auto& tensor2 = tensor_storage[name2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result;
         
         if (strcmp(op, "atan2") == 0) {
@@ -201,10 +202,9 @@ static int TensorBinaryOp(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
             return TCL_ERROR;
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -218,19 +218,22 @@ int TensorSin_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         // Parse arguments using dual syntax
         TensorSinArgs args = ParseTensorSinArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Sin, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.sin();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -241,6 +244,7 @@ int TensorSin_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for cos command
 struct TensorCosArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -261,6 +265,7 @@ TensorCosArgs ParseTensorCosArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::cos tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -272,6 +277,7 @@ TensorCosArgs ParseTensorCosArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -290,19 +296,22 @@ int TensorCos_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         // Parse arguments using dual syntax
         TensorCosArgs args = ParseTensorCosArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Cos, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.cos();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -313,6 +322,7 @@ int TensorCos_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for tan command
 struct TensorTanArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     bool IsValid() const { return !input.empty(); }
 };
 
@@ -328,6 +338,7 @@ TensorTanArgs ParseTensorTanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::tan tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -337,6 +348,7 @@ TensorTanArgs ParseTensorTanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -352,15 +364,15 @@ int TensorTan_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     (void)cd;
     try {
         TensorTanArgs args = ParseTensorTanArgs(interp, objc, objv);
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.tan();
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -371,6 +383,7 @@ int TensorTan_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for asin command
 struct TensorAsinArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -394,6 +407,7 @@ TensorAsinArgs ParseTensorAsinArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::asin tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -405,6 +419,7 @@ TensorAsinArgs ParseTensorAsinArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -424,18 +439,18 @@ int TensorAsin_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
         // Parse arguments using dual syntax
         TensorAsinArgs args = ParseTensorAsinArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.asin();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -446,6 +461,7 @@ int TensorAsin_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for acos command
 struct TensorAcosArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -462,6 +478,7 @@ TensorAcosArgs ParseTensorAcosArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::acos tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -474,6 +491,7 @@ TensorAcosArgs ParseTensorAcosArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -491,18 +509,18 @@ int TensorAcos_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorAcosArgs args = ParseTensorAcosArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.acos();
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -513,6 +531,7 @@ int TensorAcos_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for atan command
 struct TensorAtanArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -529,6 +548,7 @@ TensorAtanArgs ParseTensorAtanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::atan tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -540,6 +560,7 @@ TensorAtanArgs ParseTensorAtanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -559,18 +580,18 @@ int TensorAtan_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
         // Parse arguments using dual syntax
         TensorAtanArgs args = ParseTensorAtanArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.atan();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -582,6 +603,8 @@ int TensorAtan_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 struct TensorAtan2Args {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -605,7 +628,9 @@ TensorAtan2Args ParseTensorAtan2Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::atan2 y x");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -617,8 +642,10 @@ TensorAtan2Args ParseTensorAtan2Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-y" || param == "-input1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-x" || param == "-input2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -y, -x, -input1, -input2");
             }
@@ -638,23 +665,24 @@ int TensorAtan2_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         TensorAtan2Args args = ParseTensorAtan2Args(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid y tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid x tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& y_tensor = tensor_storage[args.input1];
-        auto& x_tensor = tensor_storage[args.input2];
+        auto& y_tensor = *input1;
+        auto& x_tensor = *input2;
         torch::Tensor result = torch::atan2(y_tensor, x_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -665,6 +693,7 @@ int TensorAtan2_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for sinh command
 struct TensorSinhArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -685,6 +714,7 @@ TensorSinhArgs ParseTensorSinhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::sinh tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -696,6 +726,7 @@ TensorSinhArgs ParseTensorSinhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -715,18 +746,18 @@ int TensorSinh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
         // Parse arguments using dual syntax
         TensorSinhArgs args = ParseTensorSinhArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.sinh();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -737,6 +768,7 @@ int TensorSinh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for cosh command
 struct TensorCoshArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -757,6 +789,7 @@ TensorCoshArgs ParseTensorCoshArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::cosh tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -768,6 +801,7 @@ TensorCoshArgs ParseTensorCoshArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -787,18 +821,18 @@ int TensorCosh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
         // Parse arguments using dual syntax
         TensorCoshArgs args = ParseTensorCoshArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.cosh();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -809,6 +843,7 @@ int TensorCosh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for asinh command
 struct TensorAsinhArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -832,6 +867,7 @@ TensorAsinhArgs ParseTensorAsinhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::asinh tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -843,6 +879,7 @@ TensorAsinhArgs ParseTensorAsinhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -862,18 +899,18 @@ int TensorAsinh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         TensorAsinhArgs args = ParseTensorAsinhArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.asinh();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -884,6 +921,7 @@ int TensorAsinh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for acosh command
 struct TensorAcoshArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -907,6 +945,7 @@ TensorAcoshArgs ParseTensorAcoshArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::acosh tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -918,6 +957,7 @@ TensorAcoshArgs ParseTensorAcoshArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -937,18 +977,18 @@ int TensorAcosh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         TensorAcoshArgs args = ParseTensorAcoshArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.acosh();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -959,6 +999,7 @@ int TensorAcosh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for tensor_atanh command
 struct TensorAtanhArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -975,6 +1016,7 @@ TensorAtanhArgs ParseTensorAtanhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::atanh tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -987,6 +1029,7 @@ TensorAtanhArgs ParseTensorAtanhArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1004,18 +1047,18 @@ int TensorAtanh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorAtanhArgs args = ParseTensorAtanhArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.atanh();
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(result_handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1026,6 +1069,7 @@ int TensorAtanh_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for deg2rad command
 struct TensorDeg2radArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1046,6 +1090,7 @@ TensorDeg2radArgs ParseTensorDeg2radArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::deg2rad tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1056,6 +1101,7 @@ TensorDeg2radArgs ParseTensorDeg2radArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1073,18 +1119,18 @@ int TensorDeg2rad_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         TensorDeg2radArgs args = ParseTensorDeg2radArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.deg2rad();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1095,6 +1141,7 @@ int TensorDeg2rad_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for rad2deg command
 struct TensorRad2degArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1115,6 +1162,7 @@ TensorRad2degArgs ParseTensorRad2degArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::rad2deg tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1125,6 +1173,7 @@ TensorRad2degArgs ParseTensorRad2degArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1142,18 +1191,18 @@ int TensorRad2deg_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         TensorRad2degArgs args = ParseTensorRad2degArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.rad2deg();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1164,6 +1213,7 @@ int TensorRad2deg_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for exp2 command
 struct TensorExp2Args {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1180,6 +1230,7 @@ TensorExp2Args ParseTensorExp2Args(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::exp2 tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1190,6 +1241,7 @@ TensorExp2Args ParseTensorExp2Args(Tcl_Interp* interp, int objc, Tcl_Obj* const
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1208,18 +1260,18 @@ int TensorExp2_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorExp2Args args = ParseTensorExp2Args(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::exp2(tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1230,6 +1282,7 @@ int TensorExp2_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for exp10 command
 struct TensorExp10Args {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1246,6 +1299,7 @@ TensorExp10Args ParseTensorExp10Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::exp10 tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1256,6 +1310,7 @@ TensorExp10Args ParseTensorExp10Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1273,18 +1328,18 @@ int TensorExp10_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorExp10Args args = ParseTensorExp10Args(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::pow(10.0, tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1295,6 +1350,7 @@ int TensorExp10_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Dual syntax support for torch::expm1
 struct TensorExpm1Args {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1311,6 +1367,7 @@ TensorExpm1Args ParseTensorExpm1Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1323,6 +1380,7 @@ TensorExpm1Args ParseTensorExpm1Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1341,20 +1399,20 @@ int TensorExpm1_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         TensorExpm1Args args = ParseTensorExpm1Args(interp, objc, objv);
         
         // Validate tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Perform expm1 operation
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::expm1(tensor);
         
         // Store result
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1365,6 +1423,7 @@ int TensorExpm1_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for log2
 struct TensorLog2Args {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1381,6 +1440,7 @@ TensorLog2Args ParseTensorLog2Args(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::log2 tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1392,6 +1452,7 @@ TensorLog2Args ParseTensorLog2Args(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1416,18 +1477,18 @@ int TensorLog2_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorLog2Args args = ParseTensorLog2Args(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.log2();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1438,6 +1499,7 @@ int TensorLog2_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for log10
 struct TensorLog10Args {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1454,6 +1516,7 @@ TensorLog10Args ParseTensorLog10Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::log10 tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1465,6 +1528,7 @@ TensorLog10Args ParseTensorLog10Args(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1489,18 +1553,18 @@ int TensorLog10_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorLog10Args args = ParseTensorLog10Args(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.log10();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1511,6 +1575,7 @@ int TensorLog10_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Tensor log1p (log(1+x)) Args structure
 struct TensorLog1pArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1527,6 +1592,7 @@ TensorLog1pArgs ParseTensorLog1pArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::log1p tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1538,6 +1604,7 @@ TensorLog1pArgs ParseTensorLog1pArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1562,18 +1629,18 @@ int TensorLog1p_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorLog1pArgs args = ParseTensorLog1pArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.log1p();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1585,6 +1652,8 @@ int TensorLog1p_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct TensorPowArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -1608,7 +1677,9 @@ TensorPowArgs ParseTensorPowArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::pow base exponent");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1620,8 +1691,10 @@ TensorPowArgs ParseTensorPowArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-base" || param == "-input1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-exponent" || param == "-input2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -base, -exponent");
             }
@@ -1641,23 +1714,24 @@ int TensorPow_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         // Parse arguments using dual syntax
         TensorPowArgs args = ParseTensorPowArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid base tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid exponent tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& base_tensor = tensor_storage[args.input1];
-        auto& exponent_tensor = tensor_storage[args.input2];
+        auto& base_tensor = *input1;
+        auto& exponent_tensor = *input2;
         torch::Tensor result = base_tensor.pow(exponent_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1668,6 +1742,7 @@ int TensorPow_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for rsqrt
 struct RsqrtArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1693,6 +1768,7 @@ RsqrtArgs ParseRsqrtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         
         // Parse required parameter
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1704,6 +1780,7 @@ RsqrtArgs ParseRsqrtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1722,19 +1799,22 @@ int TensorRsqrt_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         // Parse arguments using dual syntax
         RsqrtArgs args = ParseRsqrtArgs(interp, objc, objv);
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Rsqrt, {args.input})) {
+            return TCL_OK;
+        }
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.rsqrt();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1745,6 +1825,7 @@ int TensorRsqrt_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for square command
 typedef struct {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     bool IsValid() const { return !input.empty(); }
 } TensorSquareArgs;
 
@@ -1760,6 +1841,7 @@ static TensorSquareArgs ParseTensorSquareArgs(Tcl_Interp* interp, int objc, Tcl_
             throw std::runtime_error("Wrong number of positional arguments. Expected: torch::square tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1770,6 +1852,7 @@ static TensorSquareArgs ParseTensorSquareArgs(Tcl_Interp* interp, int objc, Tcl_
             std::string value = Tcl_GetString(objv[i + 1]);
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1785,15 +1868,18 @@ int TensorSquare_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
     (void)cd;
     try {
         TensorSquareArgs args = ParseTensorSquareArgs(interp, objc, objv);
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        if (LazyModeEnabled() && LazyRecord(interp, LazyOp::Square, {args.input})) {
+            return TCL_OK;
+        }
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.square();
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1805,6 +1891,7 @@ int TensorSquare_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for floor command
 struct TensorFloorArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1825,6 +1912,7 @@ TensorFloorArgs ParseTensorFloorArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Wrong number of positional arguments. Expected: torch::floor tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1837,6 +1925,7 @@ TensorFloorArgs ParseTensorFloorArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1856,18 +1945,17 @@ int TensorFloor_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorFloorArgs args = ParseTensorFloorArgs(interp, objc, objv);
         
-        if (args.input.empty() || tensor_storage.find(args.input) == tensor_storage.end()) {
+        if (args.input.empty() || FindTensorFromObj(args.inputObj) == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *FindTensorFromObj(args.inputObj);
         torch::Tensor result = tensor.floor();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1878,6 +1966,7 @@ int TensorFloor_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for ceil command
 struct TensorCeilArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1898,6 +1987,7 @@ TensorCeilArgs ParseTensorCeilArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Wrong number of positional arguments. Expected: torch::ceil tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1910,6 +2000,7 @@ TensorCeilArgs ParseTensorCeilArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1929,18 +2020,18 @@ int TensorCeil_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorCeilArgs args = ParseTensorCeilArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.ceil();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1951,6 +2042,7 @@ int TensorCeil_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for trunc command
 struct TensorTruncArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1971,6 +2063,7 @@ TensorTruncArgs ParseTensorTruncArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::trunc tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1982,6 +2075,7 @@ TensorTruncArgs ParseTensorTruncArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -2001,18 +2095,18 @@ int TensorTrunc_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         TensorTruncArgs args = ParseTensorTruncArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.trunc();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -2028,6 +2122,8 @@ int TensorTrunc_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct TensorNeArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -2048,7 +2144,9 @@ TensorNeArgs ParseTensorNeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Error in ne: Usage: torch::ne tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2060,8 +2158,10 @@ TensorNeArgs ParseTensorNeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Error in ne: Unknown parameter: " + param + ". Valid parameters are: -input1, -tensor1, -input2, -tensor2");
             }
@@ -2082,25 +2182,26 @@ int TensorNe_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         TensorNeArgs args = ParseTensorNeArgs(interp, objc, objv);
         
         // Validate tensors exist
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Error in ne: Invalid tensor name for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Error in ne: Invalid tensor name for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Perform operation
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.ne(tensor2);
         
         // Store result and return
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2112,6 +2213,8 @@ int TensorNe_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 struct TensorLtArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -2132,7 +2235,9 @@ TensorLtArgs ParseTensorLtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Usage: torch::lt tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2144,8 +2249,10 @@ TensorLtArgs ParseTensorLtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input1, -tensor1, -input2, -tensor2");
             }
@@ -2165,24 +2272,25 @@ int TensorLt_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         // Parse arguments using dual syntax
         TensorLtArgs args = ParseTensorLtArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.lt(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2194,6 +2302,8 @@ int TensorLt_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 struct TensorLeArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -2214,7 +2324,9 @@ TensorLeArgs ParseTensorLeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Usage: torch::le tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2226,8 +2338,10 @@ TensorLeArgs ParseTensorLeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input1, -tensor1, -input2, -tensor2");
             }
@@ -2247,24 +2361,25 @@ int TensorLe_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         // Parse arguments using dual syntax
         TensorLeArgs args = ParseTensorLeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.le(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2276,6 +2391,8 @@ int TensorLe_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 struct TensorGtArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -2296,7 +2413,9 @@ TensorGtArgs ParseTensorGtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Usage: torch::gt tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2308,8 +2427,10 @@ TensorGtArgs ParseTensorGtArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input1, -tensor1, -input2, -tensor2");
             }
@@ -2329,24 +2450,25 @@ int TensorGt_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         // Parse arguments using dual syntax
         TensorGtArgs args = ParseTensorGtArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.gt(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2363,6 +2485,7 @@ int TensorGe_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for isnan command
 struct TensorIsnanArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -2383,6 +2506,7 @@ TensorIsnanArgs ParseTensorIsnanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::isnan tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2394,6 +2518,7 @@ TensorIsnanArgs ParseTensorIsnanArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input/-tensor");
             }
@@ -2420,18 +2545,18 @@ int TensorIsnan_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax parser
         TensorIsnanArgs args = ParseTensorIsnanArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.isnan();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2442,6 +2567,7 @@ int TensorIsnan_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for isinf command
 struct TensorIsinfArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -2462,6 +2588,7 @@ TensorIsinfArgs ParseTensorIsinfArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::isinf tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2473,6 +2600,7 @@ TensorIsinfArgs ParseTensorIsinfArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input/-tensor");
             }
@@ -2499,18 +2627,18 @@ int TensorIsinf_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax parser
         TensorIsinfArgs args = ParseTensorIsinfArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.isinf();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2521,6 +2649,7 @@ int TensorIsinf_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for isfinite command
 struct TensorIsfiniteArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -2541,6 +2670,7 @@ TensorIsfiniteArgs ParseTensorIsfiniteArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             throw std::runtime_error("Usage: torch::isfinite tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2552,6 +2682,7 @@ TensorIsfiniteArgs ParseTensorIsfiniteArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input/-tensor");
             }
@@ -2578,18 +2709,18 @@ int TensorIsfinite_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
         // Parse arguments using dual syntax parser
         TensorIsfiniteArgs args = ParseTensorIsfiniteArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.isfinite();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2603,6 +2734,8 @@ int TensorIsfinite_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
 struct TensorIscloseArgs {
     std::string input;          // first tensor (required)
     std::string other;          // second tensor (required)
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     double rtol = 1e-05;        // relative tolerance (default: 1e-05)
     double atol = 1e-08;        // absolute tolerance (default: 1e-08)
     bool equal_nan = false;     // whether to consider NaN values as equal (default: false)
@@ -2622,7 +2755,9 @@ TensorIscloseArgs ParseTensorIscloseArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.other = Tcl_GetString(objv[2]);
+        args.otherObj = objv[2];
         
         if (objc >= 4) {
             if (Tcl_GetDoubleFromObj(interp, objv[3], &args.rtol) != TCL_OK) {
@@ -2660,8 +2795,10 @@ TensorIscloseArgs ParseTensorIscloseArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input" || param == "-tensor1") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-other" || param == "-tensor2") {
                 args.other = Tcl_GetString(objv[i + 1]);
+                args.otherObj = objv[i + 1];
             } else if (param == "-rtol" || param == "-relativeTolerance") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.rtol) != TCL_OK) {
                     throw std::runtime_error("Invalid rtol: must be positive number");
@@ -2709,26 +2846,27 @@ int TensorIsclose_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
         // Parse arguments using dual syntax parser
         TensorIscloseArgs args = ParseTensorIscloseArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other = FindTensorFromObj(args.otherObj);
+        if (other == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for other"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
-        auto& other_tensor = tensor_storage[args.other];
+        auto& input_tensor = *input;
+        auto& other_tensor = *other;
         
         // Use PyTorch's isclose with tolerance parameters
         torch::Tensor result = torch::isclose(input_tensor, other_tensor, args.rtol, args.atol, args.equal_nan);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2741,6 +2879,8 @@ int TensorIsclose_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 struct TensorLogicalAndArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -2757,7 +2897,9 @@ TensorLogicalAndArgs ParseTensorLogicalAndArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::logical_and tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2769,8 +2911,10 @@ TensorLogicalAndArgs ParseTensorLogicalAndArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -2795,24 +2939,25 @@ int TensorLogicalAnd_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
     try {
         TensorLogicalAndArgs args = ParseTensorLogicalAndArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.logical_and(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -2823,6 +2968,8 @@ int TensorLogicalAnd_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct TensorLogicalOrArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -2838,7 +2985,9 @@ TensorLogicalOrArgs ParseTensorLogicalOrArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Wrong number of positional arguments. Expected: torch::logical_or input1 input2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2851,8 +3000,10 @@ TensorLogicalOrArgs ParseTensorLogicalOrArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -2875,24 +3026,25 @@ int TensorLogicalOr_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* co
 
         TensorLogicalOrArgs args = ParseTensorLogicalOrArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& input1_tensor = tensor_storage[args.input1];
-        auto& input2_tensor = tensor_storage[args.input2];
+        auto& input1_tensor = *input1;
+        auto& input2_tensor = *input2;
         torch::Tensor result = torch::logical_or(input1_tensor, input2_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in logical_or: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -2902,6 +3054,7 @@ int TensorLogicalOr_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* co
 
 struct TensorLogicalNotArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -2917,6 +3070,7 @@ TensorLogicalNotArgs ParseTensorLogicalNotArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Wrong number of positional arguments. Expected: torch::logical_not input");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -2929,6 +3083,7 @@ TensorLogicalNotArgs ParseTensorLogicalNotArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -2951,18 +3106,18 @@ int TensorLogicalNot_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 
         TensorLogicalNotArgs args = ParseTensorLogicalNotArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::Tensor result = torch::logical_not(input_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in logical_not: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -2973,6 +3128,8 @@ int TensorLogicalNot_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct TensorLogicalXorArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -2988,7 +3145,9 @@ TensorLogicalXorArgs ParseTensorLogicalXorArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Wrong number of positional arguments. Expected: torch::logical_xor input1 input2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -3001,8 +3160,10 @@ TensorLogicalXorArgs ParseTensorLogicalXorArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -3025,24 +3186,25 @@ int TensorLogicalXor_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 
         TensorLogicalXorArgs args = ParseTensorLogicalXorArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor handle for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& input1_tensor = tensor_storage[args.input1];
-        auto& input2_tensor = tensor_storage[args.input2];
+        auto& input1_tensor = *input1;
+        auto& input2_tensor = *input2;
         torch::Tensor result = torch::logical_xor(input1_tensor, input2_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in logical_xor: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -3054,6 +3216,8 @@ int TensorLogicalXor_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct TensorBitwiseAndArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -3074,7 +3238,9 @@ TensorBitwiseAndArgs ParseTensorBitwiseAndArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::bitwise_and tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -3087,8 +3253,10 @@ TensorBitwiseAndArgs ParseTensorBitwiseAndArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input" || param == "-tensor1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-other" || param == "-tensor2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -other, -tensor1, -tensor2");
             }
@@ -3108,23 +3276,24 @@ int TensorBitwiseAnd_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
         // Parse arguments using dual syntax
         TensorBitwiseAndArgs args = ParseTensorBitwiseAndArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.bitwise_and(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3136,6 +3305,8 @@ int TensorBitwiseAnd_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct TensorBitwiseOrArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -3156,7 +3327,9 @@ TensorBitwiseOrArgs ParseTensorBitwiseOrArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::bitwise_or tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -3169,8 +3342,10 @@ TensorBitwiseOrArgs ParseTensorBitwiseOrArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input" || param == "-tensor1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-other" || param == "-tensor2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -other, -tensor1, -tensor2");
             }
@@ -3190,23 +3365,24 @@ int TensorBitwiseOr_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* co
         // Parse arguments using dual syntax
         TensorBitwiseOrArgs args = ParseTensorBitwiseOrArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.bitwise_or(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3217,6 +3393,7 @@ int TensorBitwiseOr_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* co
 // Parameter structure for bitwise_not command
 struct TensorBitwiseNotArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -3237,6 +3414,7 @@ TensorBitwiseNotArgs ParseTensorBitwiseNotArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::bitwise_not tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -3249,6 +3427,7 @@ TensorBitwiseNotArgs ParseTensorBitwiseNotArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -3268,18 +3447,18 @@ int TensorBitwiseNot_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
         // Parse arguments using dual syntax
         TensorBitwiseNotArgs args = ParseTensorBitwiseNotArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.bitwise_not();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3291,6 +3470,8 @@ int TensorBitwiseNot_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct TensorBitwiseXorArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -3311,7 +3492,9 @@ TensorBitwiseXorArgs ParseTensorBitwiseXorArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::bitwise_xor tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -3324,8 +3507,10 @@ TensorBitwiseXorArgs ParseTensorBitwiseXorArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input" || param == "-tensor1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-other" || param == "-tensor2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -other, -tensor1, -tensor2");
             }
@@ -3345,23 +3530,24 @@ int TensorBitwiseXor_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
         // Parse arguments using dual syntax
         TensorBitwiseXorArgs args = ParseTensorBitwiseXorArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.bitwise_xor(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3373,6 +3559,8 @@ int TensorBitwiseXor_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct TensorBitwiseLeftShiftArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -3393,7 +3581,9 @@ TensorBitwiseLeftShiftArgs ParseTensorBitwiseLeftShiftArgs(Tcl_Interp* interp, i
             throw std::runtime_error("Usage: torch::bitwise_left_shift tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -3406,8 +3596,10 @@ TensorBitwiseLeftShiftArgs ParseTensorBitwiseLeftShiftArgs(Tcl_Interp* interp, i
             
             if (param == "-input" || param == "-tensor1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-other" || param == "-tensor2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -other, -tensor1, -tensor2");
             }
@@ -3427,23 +3619,24 @@ int TensorBitwiseLeftShift_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_
         // Parse arguments using dual syntax
         TensorBitwiseLeftShiftArgs args = ParseTensorBitwiseLeftShiftArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.bitwise_left_shift(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3455,6 +3648,8 @@ int TensorBitwiseLeftShift_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_
 struct TensorBitwiseRightShiftArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -3475,7 +3670,9 @@ TensorBitwiseRightShiftArgs ParseTensorBitwiseRightShiftArgs(Tcl_Interp* interp,
             throw std::runtime_error("Usage: torch::bitwise_right_shift tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -3488,8 +3685,10 @@ TensorBitwiseRightShiftArgs ParseTensorBitwiseRightShiftArgs(Tcl_Interp* interp,
             
             if (param == "-input" || param == "-tensor1") {
                 args.input1 = value;
+                args.input1Obj = objv[i + 1];
             } else if (param == "-other" || param == "-tensor2") {
                 args.input2 = value;
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -other, -tensor1, -tensor2");
             }
@@ -3509,23 +3708,24 @@ int TensorBitwiseRightShift_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl
         // Parse arguments using dual syntax
         TensorBitwiseRightShiftArgs args = ParseTensorBitwiseRightShiftArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid first tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid second tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.bitwise_right_shift(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3539,6 +3739,7 @@ int TensorBitwiseRightShift_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl
 // =====================
 struct TensorMeanDimArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     bool keepdim = false;
     
@@ -3560,6 +3761,7 @@ TensorMeanDimArgs ParseTensorMeanDimArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Invalid number of arguments");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value");
         }
@@ -3583,6 +3785,7 @@ TensorMeanDimArgs ParseTensorMeanDimArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value");
@@ -3607,15 +3810,15 @@ TensorMeanDimArgs ParseTensorMeanDimArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
 int TensorMeanDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         TensorMeanDimArgs args = ParseTensorMeanDimArgs(interp, objc, objv);
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.mean(args.dim, args.keepdim);
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3629,6 +3832,7 @@ int TensorMeanDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 // Parameter structure for std_dim command
 struct TensorStdDimArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     bool unbiased = true;
     bool keepdim = false;
@@ -3652,6 +3856,7 @@ TensorStdDimArgs ParseTensorStdDimArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             throw std::runtime_error("Usage: torch::std_dim tensor dim ?unbiased? ?keepdim?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value");
         }
@@ -3680,6 +3885,7 @@ TensorStdDimArgs ParseTensorStdDimArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value");
@@ -3713,18 +3919,18 @@ int TensorStdDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorStdDimArgs args = ParseTensorStdDimArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.std(args.dim, args.unbiased, args.keepdim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -3739,6 +3945,7 @@ int TensorStdDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // =====================
 struct TensorMedianDimArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     bool keepdim = false;
     
@@ -3760,6 +3967,7 @@ TensorMedianDimArgs ParseTensorMedianDimArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Invalid number of arguments");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value");
         }
@@ -3783,6 +3991,7 @@ TensorMedianDimArgs ParseTensorMedianDimArgs(Tcl_Interp* interp, int objc, Tcl_O
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value");
@@ -3808,19 +4017,19 @@ int TensorMedianDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorMedianDimArgs args = ParseTensorMedianDimArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto result_tuple = tensor.median(args.dim, args.keepdim);
         torch::Tensor result = std::get<0>(result_tuple);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -3834,6 +4043,7 @@ int TensorMedianDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 
 struct TensorKthvalueArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int k;
     int dim;
     bool keepdim = false;
@@ -3853,6 +4063,7 @@ TensorKthvalueArgs ParseTensorKthvalueArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.k) != TCL_OK) {
             throw std::runtime_error("Invalid k value. Expected integer.");
@@ -3879,6 +4090,7 @@ TensorKthvalueArgs ParseTensorKthvalueArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-k") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.k) != TCL_OK) {
                     throw std::runtime_error("Invalid k value. Expected integer.");
@@ -3910,19 +4122,19 @@ int TensorKthvalue_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorKthvalueArgs args = ParseTensorKthvalueArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto result_tuple = tensor.kthvalue(args.k, args.dim, args.keepdim);
         torch::Tensor result = std::get<0>(result_tuple);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_STATIC);
@@ -3936,6 +4148,7 @@ int TensorKthvalue_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 
 struct TensorCumsumArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     
     bool IsValid() const {
@@ -3953,6 +4166,7 @@ TensorCumsumArgs ParseTensorCumsumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -3967,6 +4181,7 @@ TensorCumsumArgs ParseTensorCumsumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -3988,18 +4203,18 @@ int TensorCumsum_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorCumsumArgs args = ParseTensorCumsumArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.cumsum(args.dim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_STATIC);
@@ -4013,6 +4228,7 @@ int TensorCumsum_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
 struct TensorCumprodArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     
     bool IsValid() const {
@@ -4030,6 +4246,7 @@ TensorCumprodArgs ParseTensorCumprodArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -4044,6 +4261,7 @@ TensorCumprodArgs ParseTensorCumprodArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -4065,18 +4283,18 @@ int TensorCumprod_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorCumprodArgs args = ParseTensorCumprodArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.cumprod(args.dim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_STATIC);
@@ -4090,6 +4308,7 @@ int TensorCumprod_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 
 struct TensorCummaxArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     
     bool IsValid() const {
@@ -4107,6 +4326,7 @@ TensorCummaxArgs ParseTensorCummaxArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -4121,6 +4341,7 @@ TensorCummaxArgs ParseTensorCummaxArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -4142,19 +4363,19 @@ int TensorCummax_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorCummaxArgs args = ParseTensorCummaxArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto result_tuple = tensor.cummax(args.dim);
         torch::Tensor result = std::get<0>(result_tuple);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_STATIC);
@@ -4168,6 +4389,7 @@ int TensorCummax_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
 struct TensorCumminArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     
     bool IsValid() const {
@@ -4185,6 +4407,7 @@ TensorCumminArgs ParseTensorCumminArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -4199,6 +4422,7 @@ TensorCumminArgs ParseTensorCumminArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value. Expected integer.");
@@ -4220,19 +4444,19 @@ int TensorCummin_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorCumminArgs args = ParseTensorCumminArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         auto result_tuple = tensor.cummin(args.dim);
         torch::Tensor result = std::get<0>(result_tuple);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_STATIC);
@@ -4246,6 +4470,7 @@ int TensorCummin_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
 struct TensorDiffArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int n = 1;      // number of times to apply diff
     int dim = -1;   // dimension along which to compute diff
     
@@ -4264,6 +4489,7 @@ TensorDiffArgs ParseTensorDiffArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.n) != TCL_OK) {
@@ -4286,6 +4512,7 @@ TensorDiffArgs ParseTensorDiffArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-n") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.n) != TCL_OK) {
                     throw std::runtime_error("Invalid n value. Expected integer.");
@@ -4311,18 +4538,18 @@ int TensorDiff_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         TensorDiffArgs args = ParseTensorDiffArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::diff(tensor, args.n, args.dim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_STATIC);
@@ -4333,6 +4560,7 @@ int TensorDiff_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for gradient command
 struct TensorGradientArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<double> spacing;  // Optional spacing parameter
     int dim = -1;                 // Dimension along which to compute gradient (-1 means infer)
     
@@ -4352,6 +4580,7 @@ TensorGradientArgs ParseTensorGradientArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse optional spacing (currently not fully implemented in LibTorch, skip for now)
         if (objc > 2) {
@@ -4375,6 +4604,7 @@ TensorGradientArgs ParseTensorGradientArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim" || param == "-dimension") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim parameter: must be integer");
@@ -4399,21 +4629,21 @@ int TensorGradient_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorGradientArgs args = ParseTensorGradientArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Implement basic gradient using diff (approximation)
         // For true gradient computation, would need proper LibTorch gradient support
         torch::Tensor result = torch::diff(tensor, 1, args.dim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -4425,6 +4655,8 @@ int TensorGradient_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct TensorEqArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
     
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -4445,7 +4677,9 @@ TensorEqArgs ParseTensorEqArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Usage: torch::eq tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -4457,8 +4691,10 @@ TensorEqArgs ParseTensorEqArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input1/-tensor1, -input2/-tensor2");
             }
@@ -4478,24 +4714,25 @@ int TensorEq_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         TensorEqArgs args = ParseTensorEqArgs(interp, objc, objv);
         
         // Look up tensors from storage
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.eq(tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -4506,6 +4743,7 @@ int TensorEq_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for frac
 struct TensorFracArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -4522,6 +4760,7 @@ TensorFracArgs ParseTensorFracArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::frac input_tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -4534,6 +4773,7 @@ TensorFracArgs ParseTensorFracArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -4559,18 +4799,18 @@ int TensorFrac_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
     try {
         TensorFracArgs args = ParseTensorFracArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.frac();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -4582,6 +4822,8 @@ int TensorFrac_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const o
 struct TensorGeArgs {
     std::string input1;
     std::string input2;
+    Tcl_Obj* input1Obj = nullptr;
+    Tcl_Obj* input2Obj = nullptr;
 
     bool IsValid() const {
         return !input1.empty() && !input2.empty();
@@ -4601,7 +4843,9 @@ TensorGeArgs ParseTensorGeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("Usage: torch::ge tensor1 tensor2");
         }
         args.input1 = Tcl_GetString(objv[1]);
+        args.input1Obj = objv[1];
         args.input2 = Tcl_GetString(objv[2]);
+        args.input2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -4612,8 +4856,10 @@ TensorGeArgs ParseTensorGeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 
             if (param == "-input1" || param == "-tensor1") {
                 args.input1 = Tcl_GetString(objv[i + 1]);
+                args.input1Obj = objv[i + 1];
             } else if (param == "-input2" || param == "-tensor2") {
                 args.input2 = Tcl_GetString(objv[i + 1]);
+                args.input2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input1/-tensor1, -input2/-tensor2");
             }
@@ -4632,23 +4878,24 @@ int TensorGe_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorGeArgs args = ParseTensorGeArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input1) == tensor_storage.end()) {
+        torch::Tensor* input1 = FindTensorFromObj(args.input1Obj);
+        if (input1 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.input2) == tensor_storage.end()) {
+        torch::Tensor* input2 = FindTensorFromObj(args.input2Obj);
+        if (input2 == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto& tensor1 = tensor_storage[args.input1];
-        auto& tensor2 = tensor_storage[args.input2];
+        auto& tensor1 = *input1;
+        auto& tensor2 = *input2;
         torch::Tensor result = tensor1.ge(tensor2);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -4659,6 +4906,7 @@ int TensorGe_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for round command
 struct TensorRoundArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -4679,6 +4927,7 @@ TensorRoundArgs ParseTensorRoundArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::round tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         bool has_input = false;
@@ -4692,6 +4941,7 @@ TensorRoundArgs ParseTensorRoundArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
                 has_input = true;
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
@@ -4711,18 +4961,18 @@ int TensorRound_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorRoundArgs args = ParseTensorRoundArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::round(input);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -4736,6 +4986,8 @@ int TensorRound_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct TensorAllcloseArgs {
     std::string input;          // first tensor (required)
     std::string other;          // second tensor (required)
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     double rtol = 1e-05;        // relative tolerance (default: 1e-05)
     double atol = 1e-08;        // absolute tolerance (default: 1e-08)
     bool equal_nan = false;     // whether to consider NaN values as equal (default: false)
@@ -4755,7 +5007,9 @@ TensorAllcloseArgs ParseTensorAllcloseArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.other = Tcl_GetString(objv[2]);
+        args.otherObj = objv[2];
         
         if (objc >= 4) {
             if (Tcl_GetDoubleFromObj(interp, objv[3], &args.rtol) != TCL_OK) {
@@ -4792,8 +5046,10 @@ TensorAllcloseArgs ParseTensorAllcloseArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input" || param == "-tensor1") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-other" || param == "-tensor2") {
                 args.other = Tcl_GetString(objv[i + 1]);
+                args.otherObj = objv[i + 1];
             } else if (param == "-rtol" || param == "-relativeTolerance") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.rtol) != TCL_OK) {
                     throw std::runtime_error("Invalid rtol: must be positive number");
@@ -4841,18 +5097,20 @@ int TensorAllclose_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
         // Parse arguments using dual syntax parser
         TensorAllcloseArgs args = ParseTensorAllcloseArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for input"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other = FindTensorFromObj(args.otherObj);
+        if (other == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name for other"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
-        auto& other_tensor = tensor_storage[args.other];
+        auto& input_tensor = *input;
+        auto& other_tensor = *other;
         
         // Use PyTorch's allclose with tolerance parameters
         bool result = torch::allclose(input_tensor, other_tensor, args.rtol, args.atol, args.equal_nan);
@@ -4870,6 +5128,7 @@ int TensorAllclose_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* con
 // =====================
 struct TensorVarDimArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     bool unbiased = true;
     bool keepdim = false;
@@ -4890,6 +5149,7 @@ TensorVarDimArgs ParseTensorVarDimArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value");
@@ -4920,6 +5180,7 @@ TensorVarDimArgs ParseTensorVarDimArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value");
@@ -4953,18 +5214,18 @@ int TensorVarDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorVarDimArgs args = ParseTensorVarDimArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = tensor.var(args.dim, args.unbiased, args.keepdim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -5,9 +5,9 @@
 #include <chrono>
 
 // Forward declarations of global variables
-extern std::unordered_map<std::string, torch::Tensor> tensor_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::nn::Module>> module_storage;
-extern std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
+extern thread_local HandleTable<torch::Tensor> tensor_storage;
+extern thread_local std::unordered_map<std::string, ModuleRef> module_storage;
+extern thread_local std::unordered_map<std::string, std::shared_ptr<torch::optim::Optimizer>> optimizer_storage;
 
 // Storage for checkpoint metadata
 struct CheckpointMetadata {
@@ -20,7 +20,7 @@ struct CheckpointMetadata {
     std::unordered_map<std::string, double> metrics;
 };
 
-std::unordered_map<std::string, CheckpointMetadata> checkpoint_metadata;
+thread_local std::unordered_map<std::string, CheckpointMetadata> checkpoint_metadata;
 
 extern "C" {
 
@@ -32,6 +32,8 @@ extern "C" {
 struct SaveCheckpointArgs {
     std::string model;
     std::string optimizer;
+    Tcl_Obj* modelObj = nullptr;
+    Tcl_Obj* optimizerObj = nullptr;
     std::string filename;
     int epoch = 0;
     double loss = 0.0;
@@ -57,7 +59,9 @@ SaveCheckpointArgs ParseSaveCheckpointArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             throw std::runtime_error("wrong # args: should be \"torch::save_checkpoint model optimizer filename ?epoch? ?loss? ?lr?\"");
         }
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
         args.optimizer = Tcl_GetString(objv[2]);
+        args.optimizerObj = objv[2];
         args.filename = Tcl_GetString(objv[3]);
         
         if (objc >= 5) {
@@ -88,8 +92,10 @@ SaveCheckpointArgs ParseSaveCheckpointArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-model") {
                 args.model = Tcl_GetString(objv[i + 1]);
+                args.modelObj = objv[i + 1];
             } else if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else if (param == "-filename" || param == "-file") {
                 args.filename = Tcl_GetString(objv[i + 1]);
             } else if (param == "-epoch") {
@@ -125,15 +131,15 @@ int Torch_SaveCheckpoint_Cmd(ClientData clientData, Tcl_Interp *interp, int objc
         SaveCheckpointArgs args = ParseSaveCheckpointArgs(interp, objc, objv);
         
         // Find model and optimizer
-        auto model_it = module_storage.find(args.model);
-        auto optimizer_it = optimizer_storage.find(args.optimizer);
+        ModuleRef* model_entry = FindModuleFromObj(args.modelObj);
+        std::shared_ptr<torch::optim::Optimizer>* optimizer_entry = FindOptimizerFromObj(args.optimizerObj);
         
-        if (model_it == module_storage.end()) {
+        if (model_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
         
-        if (optimizer_it == optimizer_storage.end()) {
+        if (optimizer_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Optimizer not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -142,10 +148,10 @@ int Torch_SaveCheckpoint_Cmd(ClientData clientData, Tcl_Interp *interp, int objc
         torch::serialize::OutputArchive archive;
         
         // Save model state dict
-        model_it->second->save(archive);
+        (*model_entry)->save(archive);
         
         // Save optimizer state dict
-        optimizer_it->second->save(archive);
+        (*optimizer_entry)->save(archive);
         
         // Save additional metadata
         archive.write("epoch", torch::tensor(args.epoch));
@@ -191,6 +197,8 @@ struct LoadCheckpointArgs {
     std::string filename;
     std::string model;
     std::string optimizer;
+    Tcl_Obj* modelObj = nullptr;
+    Tcl_Obj* optimizerObj = nullptr;
     
     bool IsValid() const {
         return !filename.empty() && !model.empty() && !optimizer.empty();
@@ -208,7 +216,9 @@ LoadCheckpointArgs ParseLoadCheckpointArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         args.filename = Tcl_GetString(objv[1]);
         args.model = Tcl_GetString(objv[2]);
+        args.modelObj = objv[2];
         args.optimizer = Tcl_GetString(objv[3]);
+        args.optimizerObj = objv[3];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -222,8 +232,10 @@ LoadCheckpointArgs ParseLoadCheckpointArgs(Tcl_Interp* interp, int objc, Tcl_Obj
                 args.filename = Tcl_GetString(objv[i + 1]);
             } else if (param == "-model") {
                 args.model = Tcl_GetString(objv[i + 1]);
+                args.modelObj = objv[i + 1];
             } else if (param == "-optimizer") {
                 args.optimizer = Tcl_GetString(objv[i + 1]);
+                args.optimizerObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -filename/-file, -model, -optimizer");
             }
@@ -244,19 +256,17 @@ int Torch_LoadCheckpoint_Cmd(ClientData clientData, Tcl_Interp *interp, int objc
         LoadCheckpointArgs args = ParseLoadCheckpointArgs(interp, objc, objv);
         
         std::string filename = args.filename;
-        std::string model_name = args.model;
-        std::string optimizer_name = args.optimizer;
         
         // Find model and optimizer
-        auto model_it = module_storage.find(model_name);
-        auto optimizer_it = optimizer_storage.find(optimizer_name);
+        ModuleRef* model = FindModuleFromObj(args.modelObj);
+        std::shared_ptr<torch::optim::Optimizer>* optimizer = FindOptimizerFromObj(args.optimizerObj);
         
-        if (model_it == module_storage.end()) {
+        if (model == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
         
-        if (optimizer_it == optimizer_storage.end()) {
+        if (optimizer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Optimizer not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -266,10 +276,10 @@ int Torch_LoadCheckpoint_Cmd(ClientData clientData, Tcl_Interp *interp, int objc
         archive.load_from(filename);
         
         // Load model state dict
-        model_it->second->load(archive);
+        (*model)->load(archive);
         
         // Load optimizer state dict
-        optimizer_it->second->load(archive);
+        (*optimizer)->load(archive);
         
         // Try to load metadata
         torch::Tensor epoch_tensor, loss_tensor, lr_tensor;
@@ -437,6 +447,7 @@ int Torch_GetCheckpointInfo_Cmd(ClientData clientData, Tcl_Interp *interp, int o
 
 struct SaveStateDictArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
     std::string filename;
     
     bool IsValid() const {
@@ -459,6 +470,7 @@ SaveStateDictArgs ParseSaveStateDictArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("");  // Empty error message since we use Tcl_WrongNumArgs
         }
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
         args.filename = Tcl_GetString(objv[2]);
     } else {
         // Named parameter syntax
@@ -472,6 +484,7 @@ SaveStateDictArgs ParseSaveStateDictArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-model") {
                 args.model = value;
+                args.modelObj = objv[i + 1];
             } else if (param == "-filename" || param == "-file") {
                 args.filename = value;
             } else {
@@ -493,15 +506,15 @@ int Torch_SaveStateDict_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
     try {
         SaveStateDictArgs args = ParseSaveStateDictArgs(interp, objc, objv);
         
-        auto model_it = module_storage.find(args.model);
-        if (model_it == module_storage.end()) {
+        ModuleRef* model_entry = FindModuleFromObj(args.modelObj);
+        if (model_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
         // Save only the model state dict (parameters)
         torch::serialize::OutputArchive archive;
-        model_it->second->save(archive);
+        (*model_entry)->save(archive);
         archive.save_to(args.filename);
         
         std::string result = "Model state dict saved to: " + args.filename;
@@ -523,6 +536,7 @@ int Torch_SaveStateDict_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
 
 struct LoadStateDictArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
     std::string filename;
     
     bool IsValid() const {
@@ -540,6 +554,7 @@ LoadStateDictArgs ParseLoadStateDictArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::load_state_dict model filename");
         }
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
         args.filename = Tcl_GetString(objv[2]);
     } else {
         // Named parameter syntax
@@ -553,6 +568,7 @@ LoadStateDictArgs ParseLoadStateDictArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-model") {
                 args.model = value;
+                args.modelObj = objv[i + 1];
             } else if (param == "-filename" || param == "-file") {
                 args.filename = value;
             } else {
@@ -574,8 +590,8 @@ int Torch_LoadStateDict_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
     try {
         LoadStateDictArgs args = ParseLoadStateDictArgs(interp, objc, objv);
         
-        auto model_it = module_storage.find(args.model);
-        if (model_it == module_storage.end()) {
+        ModuleRef* model_entry = FindModuleFromObj(args.modelObj);
+        if (model_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
@@ -583,7 +599,7 @@ int Torch_LoadStateDict_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
         // Load only the model state dict (parameters)
         torch::serialize::InputArchive archive;
         archive.load_from(args.filename);
-        model_it->second->load(archive);
+        (*model_entry)->load(archive);
         
         std::string result = "Model state dict loaded from: " + args.filename;
         Tcl_SetResult(interp, const_cast<char*>(result.c_str()), TCL_VOLATILE);
@@ -605,6 +621,7 @@ int Torch_LoadStateDict_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
 
 struct FreezeModelArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
     
     bool IsValid() const {
         return !model.empty();
@@ -620,6 +637,7 @@ FreezeModelArgs ParseFreezeModelArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Wrong number of arguments for positional syntax. Expected: torch::freeze_model model");
         }
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
     } else {
         // Named parameter syntax: torch::freeze_model -model model
         if (objc < 2) {
@@ -636,6 +654,7 @@ FreezeModelArgs ParseFreezeModelArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-model") {
                 args.model = value;
+                args.modelObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -655,14 +674,14 @@ int Torch_FreezeModel_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, T
     try {
         FreezeModelArgs args = ParseFreezeModelArgs(interp, objc, objv);
         
-        auto model_it = module_storage.find(args.model);
-        if (model_it == module_storage.end()) {
+        ModuleRef* model_entry = FindModuleFromObj(args.modelObj);
+        if (model_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
         // Freeze all parameters
-        for (auto& param : model_it->second->parameters()) {
+        for (auto& param : (*model_entry)->parameters()) {
             param.set_requires_grad(false);
         }
         
@@ -681,6 +700,7 @@ int Torch_FreezeModel_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, T
 
 struct UnfreezeModelArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
 
     bool IsValid() const {
         return !model.empty();
@@ -696,6 +716,7 @@ UnfreezeModelArgs ParseUnfreezeModelArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Wrong number of arguments for positional syntax. Expected: torch::unfreeze_model model");
         }
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
     } else {
         // Named parameter syntax: torch::unfreeze_model -model model
         if (objc < 2) {
@@ -712,6 +733,7 @@ UnfreezeModelArgs ParseUnfreezeModelArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
 
             if (param == "-model") {
                 args.model = value;
+                args.modelObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -731,14 +753,14 @@ int Torch_UnfreezeModel_Cmd(ClientData clientData, Tcl_Interp *interp, int objc,
     try {
         UnfreezeModelArgs args = ParseUnfreezeModelArgs(interp, objc, objv);
 
-        auto model_it = module_storage.find(args.model);
-        if (model_it == module_storage.end()) {
+        ModuleRef* model_entry = FindModuleFromObj(args.modelObj);
+        if (model_entry == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Model not found"), TCL_STATIC);
             return TCL_ERROR;
         }
 
         // Unfreeze all parameters
-        for (auto& param : model_it->second->parameters()) {
+        for (auto& param : (*model_entry)->parameters()) {
             param.set_requires_grad(true);
         }
 
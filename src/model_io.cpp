@@ -3,6 +3,7 @@
 // Parameter structure for save_state command
 struct SaveStateArgs {
     std::string module;
+    Tcl_Obj* moduleObj = nullptr;
     std::string filename;
     
     bool IsValid() const {
@@ -26,6 +27,7 @@ SaveStateArgs ParseSaveStateArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("");  // Empty error message since we use Tcl_WrongNumArgs
         }
         args.module = Tcl_GetString(objv[1]);
+        args.moduleObj = objv[1];
         args.filename = Tcl_GetString(objv[2]);
     } else {
         // Named parameter syntax
@@ -39,6 +41,7 @@ SaveStateArgs ParseSaveStateArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-module") {
                 args.module = value;
+                args.moduleObj = objv[i + 1];
             } else if (param == "-filename" || param == "-file") {
                 args.filename = value;
             } else {
@@ -60,12 +63,13 @@ int SaveState_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         SaveStateArgs args = ParseSaveStateArgs(interp, objc, objv);
         
-        if (module_storage.find(args.module) == module_storage.end()) {
+        ModuleRef* module_ptr = FindModuleFromObj(args.moduleObj);
+        if (module_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid module name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& module = module_storage[args.module];
+        auto& module = *module_ptr;
         torch::save(module, args.filename);
         
         Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
@@ -82,6 +86,7 @@ int SaveState_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for load_state command
 struct LoadStateArgs {
     std::string module;
+    Tcl_Obj* moduleObj = nullptr;
     std::string filename;
     
     bool IsValid() const {
@@ -100,6 +105,7 @@ LoadStateArgs ParseLoadStateArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::load_state module filename");
         }
         args.module = Tcl_GetString(objv[1]);
+        args.moduleObj = objv[1];
         args.filename = Tcl_GetString(objv[2]);
     } else {
         // Named parameter syntax
@@ -113,6 +119,7 @@ LoadStateArgs ParseLoadStateArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-module") {
                 args.module = value;
+                args.moduleObj = objv[i + 1];
             } else if (param == "-filename" || param == "-file") {
                 args.filename = value;
             } else {
@@ -134,12 +141,13 @@ int LoadState_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         LoadStateArgs args = ParseLoadStateArgs(interp, objc, objv);
         
-        if (module_storage.find(args.module) == module_storage.end()) {
+        ModuleRef* module_ptr = FindModuleFromObj(args.moduleObj);
+        if (module_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid module name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& module = module_storage[args.module];
+        auto& module = *module_ptr;
         torch::load(module, args.filename);
         
         Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
@@ -0,0 +1,187 @@
+#include "libtorchtcl.h"
+#include <mutex>
+#include <shared_mutex>
+
+// Models published for every interpreter thread of the process. Handle
+// tables are per thread; this map is the one place modules cross threads.
+// Lookups take a shared lock and hand out the same module, so weights are
+// never copied and forward passes on several threads run side by side.
+static std::unordered_map<std::string, ModuleRef> model_registry;
+static std::shared_mutex model_registry_mutex;
+
+// ============================================================================
+// torch::registry_publish
+// ============================================================================
+
+// Parameter structure for registry_publish command
+struct RegistryPublishArgs {
+    std::string name;
+    Tcl_Obj* model = nullptr;
+
+    bool IsValid() const {
+        return !name.empty() && model != nullptr;
+    }
+};
+
+// Parse dual syntax: name model | -name string -model layer
+static RegistryPublishArgs ParseRegistryPublishArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    RegistryPublishArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 3) {
+            throw std::runtime_error("Usage: torch::registry_publish name model");
+        }
+        args.name = Tcl_GetString(objv[1]);
+        args.model = objv[2];
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-name") {
+                args.name = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-model") {
+                args.model = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -name, -model");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: name and model");
+    }
+
+    return args;
+}
+
+// torch::registry_publish - Make a model visible to every interpreter thread
+// under a name, replacing any model published under it before
+int RegistryPublish_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        RegistryPublishArgs args = ParseRegistryPublishArgs(interp, objc, objv);
+
+        auto* model = FindModuleFromObj(args.model);
+        if (model == nullptr) {
+            throw std::runtime_error(std::string("Invalid model: ") + Tcl_GetString(args.model));
+        }
+
+        {
+            std::unique_lock<std::shared_mutex> lock(model_registry_mutex);
+            model_registry[args.name] = *model;
+        }
+        Tcl_SetObjResult(interp, Tcl_NewStringObj(args.name.c_str(), -1));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::registry_lookup / torch::registry_remove
+// ============================================================================
+
+// Parameter structure for the commands that take a published name
+struct RegistryNameArgs {
+    std::string name;
+
+    bool IsValid() const {
+        return !name.empty();
+    }
+};
+
+// Parse dual syntax: name | -name string
+static RegistryNameArgs ParseRegistryNameArgs(const char* command, int objc, Tcl_Obj* const objv[]) {
+    RegistryNameArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error(std::string("Usage: ") + command + " name");
+        }
+        args.name = Tcl_GetString(objv[1]);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-name") {
+                args.name = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -name");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: name");
+    }
+
+    return args;
+}
+
+// torch::registry_lookup - Store a published model in this thread's handle
+// table and return the new handle; the module itself is shared
+int RegistryLookup_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        RegistryNameArgs args = ParseRegistryNameArgs("torch::registry_lookup", objc, objv);
+
+        ModuleRef model;
+        {
+            std::shared_lock<std::shared_mutex> lock(model_registry_mutex);
+            auto it = model_registry.find(args.name);
+            if (it != model_registry.end()) {
+                model = it->second;
+            }
+        }
+        if (!model) {
+            throw std::runtime_error("No model is published as " + args.name);
+        }
+
+        std::string handle = GetNextHandle("shared");
+        module_storage[handle] = model;
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// torch::registry_remove - Withdraw a published model. Handles already looked
+// up keep it alive. Returns whether the name was published.
+int RegistryRemove_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        RegistryNameArgs args = ParseRegistryNameArgs("torch::registry_remove", objc, objv);
+
+        ModuleRef removed;
+        {
+            std::unique_lock<std::shared_mutex> lock(model_registry_mutex);
+            auto it = model_registry.find(args.name);
+            if (it != model_registry.end()) {
+                removed = std::move(it->second);
+                model_registry.erase(it);
+            }
+        }
+        Tcl_SetObjResult(interp, Tcl_NewBooleanObj(removed != nullptr));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -22,6 +22,7 @@ static torch::Device GetModuleDevice(std::shared_ptr<torch::nn::Module> module)
 // Parameter structure for layer_cpu command
 struct LayerCpuArgs {
     std::string layer;
+    Tcl_Obj* layerObj = nullptr;
     
     bool IsValid() const {
         return !layer.empty();
@@ -39,6 +40,7 @@ LayerCpuArgs ParseLayerCpuArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.layer = Tcl_GetString(objv[1]);
+        args.layerObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -51,6 +53,7 @@ LayerCpuArgs ParseLayerCpuArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-layer" || param == "-input") {
                 args.layer = value;
+                args.layerObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -67,6 +70,7 @@ LayerCpuArgs ParseLayerCpuArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for layer_cuda command
 struct LayerCudaArgs {
     std::string layer;
+    Tcl_Obj* layerObj = nullptr;
     
     bool IsValid() const {
         return !layer.empty();
@@ -84,6 +88,7 @@ LayerCudaArgs ParseLayerCudaArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.layer = Tcl_GetString(objv[1]);
+        args.layerObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -96,6 +101,7 @@ LayerCudaArgs ParseLayerCudaArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-layer" || param == "-input") {
                 args.layer = value;
+                args.layerObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -112,6 +118,7 @@ LayerCudaArgs ParseLayerCudaArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for layer_device command
 struct LayerDeviceArgs {
     std::string layer;
+    Tcl_Obj* layerObj = nullptr;
     
     bool IsValid() const {
         return !layer.empty();
@@ -129,6 +136,7 @@ LayerDeviceArgs ParseLayerDeviceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.layer = Tcl_GetString(objv[1]);
+        args.layerObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -141,6 +149,7 @@ LayerDeviceArgs ParseLayerDeviceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-layer" || param == "-input") {
                 args.layer = value;
+                args.layerObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -157,6 +166,7 @@ LayerDeviceArgs ParseLayerDeviceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for layer_to command
 struct LayerToArgs {
     std::string layer;
+    Tcl_Obj* layerObj = nullptr;
     std::string device;
     
     bool IsValid() const {
@@ -174,6 +184,7 @@ LayerToArgs ParseLayerToArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             throw std::runtime_error("Usage: torch::layer_to layer device");
         }
         args.layer = Tcl_GetString(objv[1]);
+        args.layerObj = objv[1];
         args.device = Tcl_GetString(objv[2]);
     } else {
         // Named parameter syntax
@@ -187,6 +198,7 @@ LayerToArgs ParseLayerToArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             
             if (param == "-layer") {
                 args.layer = value;
+                args.layerObj = objv[i + 1];
             } else if (param == "-device") {
                 args.device = value;
             } else {
@@ -205,6 +217,7 @@ LayerToArgs ParseLayerToArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
 // Parameter structure for parameters_to command
 struct ParametersToArgs {
     std::string parameters;  // parameter list (list of tensor names)
+    Tcl_Obj* parametersObj = nullptr;
     std::string device = "cpu";  // target device
     
     bool IsValid() const {
@@ -223,6 +236,7 @@ ParametersToArgs ParseParametersToArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.parameters = Tcl_GetString(objv[1]);
+        args.parametersObj = objv[1];
         
         if (objc > 2) {
             args.device = Tcl_GetString(objv[2]);
@@ -238,6 +252,7 @@ ParametersToArgs ParseParametersToArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-parameters" || param == "-params") {
                 args.parameters = Tcl_GetString(objv[i + 1]);
+                args.parametersObj = objv[i + 1];
             } else if (param == "-device") {
                 args.device = Tcl_GetString(objv[i + 1]);
             } else {
@@ -264,7 +279,8 @@ int LayerTo_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         std::string device_str = args.device;
         
         // Check if layer exists
-        if (module_storage.find(layer_name) == module_storage.end()) {
+        ModuleRef* layer = FindModuleFromObj(args.layerObj);
+        if (layer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid layer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -273,7 +289,7 @@ int LayerTo_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         torch::Device device = GetDevice(device_str.c_str());
         
         // Move the module to the device
-        auto& module = module_storage[layer_name];
+        auto& module = *layer;
         if (!MoveModuleToDevice(module, device)) {
             Tcl_SetResult(interp, const_cast<char*>("Failed to move layer to device"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -299,13 +315,14 @@ int LayerDevice_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj
         LayerDeviceArgs args = ParseLayerDeviceArgs(interp, objc, objv);
         
         // Check if layer exists
-        if (module_storage.find(args.layer) == module_storage.end()) {
+        ModuleRef* layer = FindModuleFromObj(args.layerObj);
+        if (layer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid layer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Get the device of the module
-        auto& module = module_storage[args.layer];
+        auto& module = *layer;
         torch::Device device = GetModuleDevice(module);
         
         // Convert device to string
@@ -335,7 +352,8 @@ int LayerCuda_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         LayerCudaArgs args = ParseLayerCudaArgs(interp, objc, objv);
         
         // Check if layer exists
-        if (module_storage.find(args.layer) == module_storage.end()) {
+        ModuleRef* layer = FindModuleFromObj(args.layerObj);
+        if (layer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid layer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
@@ -347,7 +365,7 @@ int LayerCuda_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         // Move the module to CUDA
-        auto& module = module_storage[args.layer];
+        auto& module = *layer;
         if (!MoveModuleToDevice(module, torch::kCUDA)) {
             Tcl_SetResult(interp, const_cast<char*>("Failed to move layer to CUDA"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -373,13 +391,14 @@ int LayerCpu_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
         LayerCpuArgs args = ParseLayerCpuArgs(interp, objc, objv);
         
         // Check if layer exists
-        if (module_storage.find(args.layer) == module_storage.end()) {
+        ModuleRef* layer = FindModuleFromObj(args.layerObj);
+        if (layer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid layer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Move the module to CPU
-        auto& module = module_storage[args.layer];
+        auto& module = *layer;
         if (!MoveModuleToDevice(module, torch::kCPU)) {
             Tcl_SetResult(interp, const_cast<char*>("Failed to move layer to CPU"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -404,9 +423,11 @@ int ParametersTo_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         ParametersToArgs args = ParseParametersToArgs(interp, objc, objv);
         
         // Parse parameters list
-        Tcl_Obj* param_list_obj = Tcl_NewStringObj(args.parameters.c_str(), -1);
+        Tcl_Obj* param_list_obj = args.parametersObj;
         int param_count;
-        Tcl_ListObjLength(interp, param_list_obj, &param_count);
+        if (Tcl_ListObjLength(interp, param_list_obj, &param_count) != TCL_OK) {
+            return TCL_ERROR;
+        }
         
         // Get target device
         torch::Device device(args.device);
@@ -415,15 +436,14 @@ int ParametersTo_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
         for (int i = 0; i < param_count; i++) {
             Tcl_Obj* param_obj;
             Tcl_ListObjIndex(interp, param_list_obj, i, &param_obj);
-            std::string param_name = Tcl_GetString(param_obj);
-            
-            if (tensor_storage.find(param_name) == tensor_storage.end()) {
-                Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + param_name).c_str()), TCL_VOLATILE);
+            torch::Tensor* param = FindTensorFromObj(param_obj);
+            if (param == nullptr) {
+                Tcl_SetResult(interp, const_cast<char*>(("Invalid parameter tensor: " + std::string(Tcl_GetString(param_obj))).c_str()), TCL_VOLATILE);
                 return TCL_ERROR;
             }
             
             // Move tensor to device
-            tensor_storage[param_name] = tensor_storage[param_name].to(device);
+            *param = param->to(device);
         }
         
         Tcl_SetResult(interp, const_cast<char*>("ok"), TCL_STATIC);
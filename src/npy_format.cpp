@@ -0,0 +1,177 @@
+#include "libtorchtcl.h"
+#include <cstring>
+
+// Helpers for the NumPy .npy format (version 1.0 to 3.0):
+//   "\x93NUMPY" major minor header_len header(dict literal, space padded, '\n') data
+// Only little-endian (or byte-sized) element types are supported, matching
+// the hosts LibTorch runs on.
+
+static const unsigned char kNpyMagic[] = {0x93, 'N', 'U', 'M', 'P', 'Y'};
+
+bool IsNpyData(const unsigned char* buf, size_t len) {
+    return len >= sizeof(kNpyMagic) && std::memcmp(buf, kNpyMagic, sizeof(kNpyMagic)) == 0;
+}
+
+// Map a NumPy type string such as "<f4" or "|u1" to a scalar type
+static c10::ScalarType NpyDescrToScalarType(const std::string& descr) {
+    if (descr.size() < 3) {
+        throw std::runtime_error("Unsupported .npy dtype: " + descr);
+    }
+    char order = descr[0];
+    std::string code = descr.substr(1);
+    if (order == '>' && code != "i1" && code != "u1" && code != "b1") {
+        throw std::runtime_error("Big-endian .npy data is not supported: " + descr);
+    }
+    if (code == "f2") return torch::kFloat16;
+    if (code == "f4") return torch::kFloat32;
+    if (code == "f8") return torch::kFloat64;
+    if (code == "i1") return torch::kInt8;
+    if (code == "i2") return torch::kInt16;
+    if (code == "i4") return torch::kInt32;
+    if (code == "i8") return torch::kInt64;
+    if (code == "u1") return torch::kUInt8;
+    if (code == "b1") return torch::kBool;
+    throw std::runtime_error("Unsupported .npy dtype: " + descr);
+}
+
+static std::string ScalarTypeToNpyDescr(c10::ScalarType dtype) {
+    switch (dtype) {
+        case torch::kFloat16: return "<f2";
+        case torch::kFloat32: return "<f4";
+        case torch::kFloat64: return "<f8";
+        case torch::kInt8:    return "|i1";
+        case torch::kInt16:   return "<i2";
+        case torch::kInt32:   return "<i4";
+        case torch::kInt64:   return "<i8";
+        case torch::kUInt8:   return "|u1";
+        case torch::kBool:    return "|b1";
+        default:
+            throw std::runtime_error(std::string("Unsupported dtype for .npy: ") + c10::toString(dtype));
+    }
+}
+
+// Value following 'key': in the header dict, with surrounding spaces removed
+static std::string NpyHeaderField(const std::string& header, const std::string& key) {
+    size_t pos = header.find("'" + key + "'");
+    if (pos == std::string::npos) {
+        throw std::runtime_error("Malformed .npy header: missing " + key);
+    }
+    pos = header.find(':', pos);
+    if (pos == std::string::npos) {
+        throw std::runtime_error("Malformed .npy header: missing value for " + key);
+    }
+    pos = header.find_first_not_of(' ', pos + 1);
+    if (pos == std::string::npos) {
+        throw std::runtime_error("Malformed .npy header: missing value for " + key);
+    }
+
+    size_t end;
+    if (header[pos] == '(') {
+        end = header.find(')', pos);
+        if (end == std::string::npos) {
+            throw std::runtime_error("Malformed .npy header: unterminated shape");
+        }
+        return header.substr(pos, end - pos + 1);
+    }
+    if (header[pos] == '\'' || header[pos] == '"') {
+        end = header.find(header[pos], pos + 1);
+        if (end == std::string::npos) {
+            throw std::runtime_error("Malformed .npy header: unterminated string");
+        }
+        return header.substr(pos + 1, end - pos - 1);
+    }
+    end = header.find_first_of(",}", pos);
+    return header.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+}
+
+// Version 1.0 stores the header length in 2 bytes, 2.0 and 3.0 in 4
+static size_t NpyPrefixSize(const unsigned char* buf, size_t len) {
+    if (!IsNpyData(buf, len) || len < 10) {
+        throw std::runtime_error("Not a .npy file");
+    }
+    unsigned major = buf[6];
+    if (major == 1) {
+        return 10;
+    }
+    if (major == 2 || major == 3) {
+        if (len < 12) {
+            throw std::runtime_error("Truncated .npy header");
+        }
+        return 12;
+    }
+    throw std::runtime_error("Unsupported .npy version " + std::to_string(major));
+}
+
+size_t NpyHeaderSize(const unsigned char* buf, size_t len) {
+    size_t prefix = NpyPrefixSize(buf, len);
+    size_t header_len = static_cast<size_t>(buf[8]) | (static_cast<size_t>(buf[9]) << 8);
+    if (prefix == 12) {
+        header_len |= (static_cast<size_t>(buf[10]) << 16) | (static_cast<size_t>(buf[11]) << 24);
+    }
+    return prefix + header_len;
+}
+
+NpyHeader ParseNpyHeader(const unsigned char* buf, size_t len) {
+    size_t prefix = NpyPrefixSize(buf, len);
+    size_t total = NpyHeaderSize(buf, len);
+    if (total > len) {
+        throw std::runtime_error("Truncated .npy header");
+    }
+    size_t header_len = total - prefix;
+
+    std::string header(reinterpret_cast<const char*>(buf + prefix), header_len);
+
+    NpyHeader result;
+    result.dtype = NpyDescrToScalarType(NpyHeaderField(header, "descr"));
+    result.fortran_order = NpyHeaderField(header, "fortran_order") == "True";
+    result.data_offset = prefix + header_len;
+
+    std::string shape = NpyHeaderField(header, "shape");
+    for (size_t pos = 1; pos < shape.size();) {
+        size_t next = shape.find_first_of(",)", pos);
+        std::string item = shape.substr(pos, next - pos);
+        item.erase(0, item.find_first_not_of(' '));
+        if (!item.empty()) {
+            result.shape.push_back(std::stoll(item));
+        }
+        if (next == std::string::npos || shape[next] == ')') {
+            break;
+        }
+        pos = next + 1;
+    }
+
+    return result;
+}
+
+std::string BuildNpyHeader(c10::ScalarType dtype, const std::vector<int64_t>& shape) {
+    std::string dict = "{'descr': '" + ScalarTypeToNpyDescr(dtype) + "', 'fortran_order': False, 'shape': (";
+    for (size_t i = 0; i < shape.size(); i++) {
+        dict += std::to_string(shape[i]);
+        if (i + 1 < shape.size() || shape.size() == 1) {
+            dict += ",";
+        }
+        if (i + 1 < shape.size()) {
+            dict += " ";
+        }
+    }
+    dict += "), }";
+
+    // Pad with spaces so the data starts on a 64-byte boundary
+    size_t prefix = 10;
+    size_t total = prefix + dict.size() + 1;
+    size_t padded = (total + 63) / 64 * 64;
+    dict.append(padded - total, ' ');
+    dict += '\n';
+
+    if (dict.size() > 0xffff) {
+        throw std::runtime_error("Shape too large for a .npy header");
+    }
+
+    std::string out(reinterpret_cast<const char*>(kNpyMagic), sizeof(kNpyMagic));
+    out += static_cast<char>(1);
+    out += static_cast<char>(0);
+    out += static_cast<char>(dict.size() & 0xff);
+    out += static_cast<char>((dict.size() >> 8) & 0xff);
+    out += dict;
+    return out;
+}
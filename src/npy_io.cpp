@@ -0,0 +1,886 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Reads len bytes at absolute offset off of the source into dst
+using NpyReadFn = std::function<void(void* dst, size_t len, uint64_t off)>;
+
+// Open .npy row readers created by torch::npy_open
+struct NpyReader {
+    int fd = -1;
+    std::string path;
+    NpyHeader header;
+    int64_t chunk = 1024;
+    int64_t next_row = 0;
+
+    ~NpyReader() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+};
+
+thread_local std::unordered_map<std::string, std::shared_ptr<NpyReader>> npy_reader_storage;
+
+bool NpyReaderHandleExists(const std::string& handle) {
+    return npy_reader_storage.find(handle) != npy_reader_storage.end();
+}
+
+bool ReleaseNpyReaderHandle(const std::string& handle) {
+    return npy_reader_storage.erase(handle) > 0;
+}
+
+size_t NpyReaderHandleCount() {
+    return npy_reader_storage.size();
+}
+
+static int OpenForRead(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open \"" + path + "\": " + std::strerror(errno));
+    }
+    return fd;
+}
+
+static void ReadFully(int fd, void* dst, size_t len, uint64_t off, const std::string& path) {
+    char* out = static_cast<char*>(dst);
+    while (len > 0) {
+        ssize_t n = pread(fd, out, len, static_cast<off_t>(off));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            throw std::runtime_error("Unexpected end of file in \"" + path + "\"");
+        }
+        out += n;
+        len -= static_cast<size_t>(n);
+        off += static_cast<uint64_t>(n);
+    }
+}
+
+static NpyReadFn FileReader(int fd, const std::string& path) {
+    return [fd, path](void* dst, size_t len, uint64_t off) { ReadFully(fd, dst, len, off, path); };
+}
+
+// Parse the header of a .npy stream that starts at base. The returned
+// data_offset is absolute.
+static NpyHeader ReadNpyHeader(const NpyReadFn& read, uint64_t base, uint64_t available) {
+    unsigned char prefix[NpyHeaderPrefixMax];
+    if (available < 10) {
+        throw std::runtime_error("Not a .npy file");
+    }
+    size_t prefix_len = available < sizeof(prefix) ? static_cast<size_t>(available) : sizeof(prefix);
+    read(prefix, prefix_len, base);
+
+    size_t total = NpyHeaderSize(prefix, prefix_len);
+    if (total > available) {
+        throw std::runtime_error("Truncated .npy header");
+    }
+
+    std::vector<unsigned char> buf(total);
+    read(buf.data(), total, base);
+    NpyHeader header = ParseNpyHeader(buf.data(), total);
+    header.data_offset += base;
+
+    uint64_t nbytes = c10::elementSize(header.dtype);
+    for (int64_t dim : header.shape) {
+        nbytes *= static_cast<uint64_t>(dim);
+    }
+    if (header.data_offset - base + nbytes > available) {
+        throw std::runtime_error("Truncated .npy data");
+    }
+    return header;
+}
+
+// Read rows [row0, row0 + count) along the first dimension into a new
+// contiguous tensor. C-order rows are one contiguous read; Fortran-order rows
+// are one run per trailing-element column, gathered in reversed-dimension
+// order and permuted back.
+static torch::Tensor ReadNpyRows(const NpyReadFn& read, const NpyHeader& header, int64_t row0, int64_t count) {
+    auto options = torch::TensorOptions().dtype(header.dtype);
+    size_t element_size = c10::elementSize(header.dtype);
+
+    if (header.shape.empty()) {
+        torch::Tensor scalar = torch::empty({}, options);
+        read(scalar.data_ptr(), element_size, header.data_offset);
+        return scalar;
+    }
+
+    std::vector<int64_t> shape = header.shape;
+    int64_t rows = shape[0];
+    shape[0] = count;
+    int64_t row_elements = 1;
+    for (size_t i = 1; i < shape.size(); i++) {
+        row_elements *= shape[i];
+    }
+    if (count == 0 || row_elements == 0) {
+        return torch::empty(shape, options);
+    }
+
+    if (!header.fortran_order || shape.size() == 1) {
+        torch::Tensor out = torch::empty(shape, options);
+        read(out.data_ptr(), static_cast<size_t>(count * row_elements) * element_size,
+             header.data_offset + static_cast<uint64_t>(row0 * row_elements) * element_size);
+        return out;
+    }
+
+    std::vector<int64_t> reversed(shape.rbegin(), shape.rend());
+    torch::Tensor gathered = torch::empty(reversed, options);
+    char* dst = static_cast<char*>(gathered.data_ptr());
+    size_t run = static_cast<size_t>(count) * element_size;
+    if (count == rows) {
+        read(dst, run * static_cast<size_t>(row_elements), header.data_offset);
+    } else {
+        for (int64_t j = 0; j < row_elements; j++) {
+            read(dst + static_cast<size_t>(j) * run, run,
+                 header.data_offset + static_cast<uint64_t>(j * rows + row0) * element_size);
+        }
+    }
+
+    std::vector<int64_t> dims(shape.size());
+    for (size_t i = 0; i < dims.size(); i++) {
+        dims[i] = static_cast<int64_t>(dims.size() - 1 - i);
+    }
+    return gathered.permute(dims).contiguous();
+}
+
+static int64_t NpyRowCount(const NpyHeader& header) {
+    return header.shape.empty() ? 1 : header.shape[0];
+}
+
+static void WriteFully(int fd, const void* src, size_t len, const std::string& path) {
+    const char* in = static_cast<const char*>(src);
+    while (len > 0) {
+        ssize_t n = write(fd, in, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            throw std::runtime_error("Failed to write \"" + path + "\": " + std::strerror(errno));
+        }
+        in += n;
+        len -= static_cast<size_t>(n);
+    }
+}
+
+// ============================================================================
+// .npz (zip) directory
+// ============================================================================
+
+struct NpzMember {
+    std::string name;                // without the .npy suffix
+    uint16_t method = 0;             // 0 stored, 8 deflated
+    uint64_t compressed_size = 0;
+    uint64_t size = 0;
+    uint64_t data_offset = 0;        // absolute offset of the member data
+};
+
+static uint16_t Le16(const unsigned char* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t Le32(const unsigned char* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static uint64_t Le64(const unsigned char* p) {
+    return static_cast<uint64_t>(Le32(p)) | (static_cast<uint64_t>(Le32(p + 4)) << 32);
+}
+
+// List the members of a zip archive from its central directory, following
+// the zip64 records numpy writes for large arrays
+static std::vector<NpzMember> ReadNpzDirectory(int fd, uint64_t file_size, const std::string& path) {
+    const uint64_t eocd_size = 22;
+    if (file_size < eocd_size) {
+        throw std::runtime_error("Not a .npz file: \"" + path + "\"");
+    }
+
+    uint64_t tail_len = std::min<uint64_t>(file_size, eocd_size + 0xffff);
+    std::vector<unsigned char> tail(static_cast<size_t>(tail_len));
+    ReadFully(fd, tail.data(), tail.size(), file_size - tail_len, path);
+
+    int64_t eocd = -1;
+    for (int64_t i = static_cast<int64_t>(tail_len - eocd_size); i >= 0; i--) {
+        if (Le32(&tail[static_cast<size_t>(i)]) == 0x06054b50) {
+            eocd = i;
+            break;
+        }
+    }
+    if (eocd < 0) {
+        throw std::runtime_error("Not a .npz file: \"" + path + "\"");
+    }
+
+    const unsigned char* e = &tail[static_cast<size_t>(eocd)];
+    uint64_t entries = Le16(e + 10);
+    uint64_t dir_size = Le32(e + 12);
+    uint64_t dir_offset = Le32(e + 16);
+
+    if (entries == 0xffff || dir_size == 0xffffffffu || dir_offset == 0xffffffffu) {
+        // Zip64 end of central directory locator sits just before the EOCD
+        uint64_t eocd_abs = file_size - tail_len + static_cast<uint64_t>(eocd);
+        if (eocd_abs < 20) {
+            throw std::runtime_error("Corrupt .npz file: \"" + path + "\"");
+        }
+        unsigned char locator[20];
+        ReadFully(fd, locator, sizeof(locator), eocd_abs - 20, path);
+        if (Le32(locator) != 0x07064b50) {
+            throw std::runtime_error("Corrupt .npz file: \"" + path + "\"");
+        }
+        unsigned char record[56];
+        ReadFully(fd, record, sizeof(record), Le64(locator + 8), path);
+        if (Le32(record) != 0x06064b50) {
+            throw std::runtime_error("Corrupt .npz file: \"" + path + "\"");
+        }
+        entries = Le64(record + 32);
+        dir_size = Le64(record + 40);
+        dir_offset = Le64(record + 48);
+    }
+    if (dir_offset + dir_size > file_size) {
+        throw std::runtime_error("Corrupt .npz file: \"" + path + "\"");
+    }
+
+    std::vector<unsigned char> dir(static_cast<size_t>(dir_size));
+    ReadFully(fd, dir.data(), dir.size(), dir_offset, path);
+
+    std::vector<NpzMember> members;
+    size_t pos = 0;
+    for (uint64_t n = 0; n < entries; n++) {
+        if (pos + 46 > dir.size() || Le32(&dir[pos]) != 0x02014b50) {
+            throw std::runtime_error("Corrupt .npz directory: \"" + path + "\"");
+        }
+        const unsigned char* c = &dir[pos];
+        NpzMember member;
+        member.method = Le16(c + 10);
+        member.compressed_size = Le32(c + 20);
+        member.size = Le32(c + 24);
+        size_t name_len = Le16(c + 28);
+        size_t extra_len = Le16(c + 30);
+        size_t comment_len = Le16(c + 32);
+        uint64_t local_offset = Le32(c + 42);
+        if (pos + 46 + name_len + extra_len + comment_len > dir.size()) {
+            throw std::runtime_error("Corrupt .npz directory: \"" + path + "\"");
+        }
+        member.name.assign(reinterpret_cast<const char*>(c + 46), name_len);
+
+        // Zip64 extended information holds the fields saturated above, in order
+        const unsigned char* extra = c + 46 + name_len;
+        for (size_t x = 0; x + 4 <= extra_len;) {
+            uint16_t id = Le16(extra + x);
+            uint16_t len = Le16(extra + x + 2);
+            if (id == 0x0001) {
+                const unsigned char* f = extra + x + 4;
+                const unsigned char* f_end = f + len;
+                if (member.size == 0xffffffffu && f + 8 <= f_end) { member.size = Le64(f); f += 8; }
+                if (member.compressed_size == 0xffffffffu && f + 8 <= f_end) { member.compressed_size = Le64(f); f += 8; }
+                if (local_offset == 0xffffffffu && f + 8 <= f_end) { local_offset = Le64(f); }
+            }
+            x += 4 + len;
+        }
+
+        unsigned char local[30];
+        ReadFully(fd, local, sizeof(local), local_offset, path);
+        if (Le32(local) != 0x04034b50) {
+            throw std::runtime_error("Corrupt .npz member \"" + member.name + "\" in \"" + path + "\"");
+        }
+        member.data_offset = local_offset + 30 + Le16(local + 26) + Le16(local + 28);
+        if (member.data_offset + member.compressed_size > file_size) {
+            throw std::runtime_error("Truncated .npz member \"" + member.name + "\" in \"" + path + "\"");
+        }
+
+        if (member.name.size() > 4 && member.name.compare(member.name.size() - 4, 4, ".npy") == 0) {
+            member.name.resize(member.name.size() - 4);
+        }
+        members.push_back(member);
+        pos += 46 + name_len + extra_len + comment_len;
+    }
+
+    return members;
+}
+
+// Decompress a deflated member with Tcl's built-in zlib
+static std::vector<unsigned char> InflateNpzMember(Tcl_Interp* interp, int fd, const NpzMember& member,
+                                                   const std::string& path) {
+    if (member.compressed_size > static_cast<uint64_t>(INT_MAX) || member.size > static_cast<uint64_t>(INT_MAX)) {
+        throw std::runtime_error("Compressed .npz member \"" + member.name + "\" is too large to inflate");
+    }
+
+    std::vector<unsigned char> compressed(static_cast<size_t>(member.compressed_size));
+    ReadFully(fd, compressed.data(), compressed.size(), member.data_offset, path);
+
+    Tcl_ZlibStream stream;
+    if (Tcl_ZlibStreamInit(interp, TCL_ZLIB_STREAM_INFLATE, TCL_ZLIB_FORMAT_RAW, 0, nullptr, &stream) != TCL_OK) {
+        throw std::runtime_error("Failed to initialise zlib");
+    }
+    Tcl_Obj* input = Tcl_NewByteArrayObj(compressed.data(), static_cast<int>(compressed.size()));
+    Tcl_IncrRefCount(input);
+    Tcl_Obj* output = Tcl_NewObj();
+    Tcl_IncrRefCount(output);
+    int rc = Tcl_ZlibStreamPut(stream, input, TCL_ZLIB_FINALIZE);
+    if (rc == TCL_OK) {
+        rc = Tcl_ZlibStreamGet(stream, output, -1);
+    }
+    Tcl_ZlibStreamClose(stream);
+    Tcl_DecrRefCount(input);
+
+    int length = 0;
+    unsigned char* bytes = Tcl_GetByteArrayFromObj(output, &length);
+    std::vector<unsigned char> result(bytes, bytes + length);
+    Tcl_DecrRefCount(output);
+    if (rc != TCL_OK || static_cast<uint64_t>(length) != member.size) {
+        throw std::runtime_error("Corrupt compressed .npz member \"" + member.name + "\" in \"" + path + "\"");
+    }
+    Tcl_ResetResult(interp);
+    return result;
+}
+
+// ============================================================================
+// torch::npy_load
+// ============================================================================
+
+// Parameter structure for npy_load command
+struct NpyLoadArgs {
+    std::string path;
+    std::string device = "cpu";
+
+    bool IsValid() const {
+        return !path.empty();
+    }
+};
+
+// Parse dual syntax: path ?device? | -path path ?-device device?
+static NpyLoadArgs ParseNpyLoadArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp; // Suppress unused parameter warning
+    NpyLoadArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 3) {
+            throw std::runtime_error("Usage: torch::npy_load path ?device?");
+        }
+        args.path = Tcl_GetString(objv[1]);
+        if (objc == 3) {
+            args.device = Tcl_GetString(objv[2]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-path" || param == "-file") {
+                args.path = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-device") {
+                args.device = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -path, -device");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Usage: torch::npy_load path ?device? | torch::npy_load -path path ?-device device?");
+    }
+
+    return args;
+}
+
+// torch::npy_load - Read a whole .npy file into a tensor
+int NpyLoad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        NpyLoadArgs args = ParseNpyLoadArgs(interp, objc, objv);
+
+        int fd = OpenForRead(args.path);
+        torch::Tensor tensor;
+        try {
+            struct stat st;
+            if (fstat(fd, &st) != 0) {
+                throw std::runtime_error("Failed to stat \"" + args.path + "\": " + std::strerror(errno));
+            }
+            NpyReadFn read = FileReader(fd, args.path);
+            NpyHeader header = ReadNpyHeader(read, 0, static_cast<uint64_t>(st.st_size));
+            tensor = ReadNpyRows(read, header, 0, NpyRowCount(header));
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+
+        if (args.device != "cpu") {
+            tensor = tensor.to(GetDevice(args.device.c_str()));
+        }
+
+        std::string handle = StoreTensor(tensor);
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::npy_save
+// ============================================================================
+
+// Parameter structure for npy_save command
+struct NpySaveArgs {
+    std::string path;
+    std::string input;
+    Tcl_Obj* inputObj = nullptr;
+
+    bool IsValid() const {
+        return !path.empty() && !input.empty();
+    }
+};
+
+// Parse dual syntax: path tensor | -path path -input tensor
+static NpySaveArgs ParseNpySaveArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp; // Suppress unused parameter warning
+    NpySaveArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 3) {
+            throw std::runtime_error("Usage: torch::npy_save path tensor");
+        }
+        args.path = Tcl_GetString(objv[1]);
+        args.input = Tcl_GetString(objv[2]);
+        args.inputObj = objv[2];
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-path" || param == "-file") {
+                args.path = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-input" || param == "-tensor") {
+                args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -path, -input");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: path and input tensor");
+    }
+
+    return args;
+}
+
+// torch::npy_save - Write a tensor as a C-order .npy file
+int NpySave_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        NpySaveArgs args = ParseNpySaveArgs(interp, objc, objv);
+
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
+            throw std::runtime_error("Invalid tensor name: " + args.input);
+        }
+
+        torch::Tensor tensor = input->detach();
+        if (!tensor.device().is_cpu()) {
+            tensor = tensor.cpu();
+        }
+        tensor = tensor.contiguous();
+
+        std::string header = BuildNpyHeader(tensor.scalar_type(), tensor.sizes().vec());
+
+        int fd = open(args.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to create \"" + args.path + "\": " + std::strerror(errno));
+        }
+        try {
+            WriteFully(fd, header.data(), header.size(), args.path);
+            WriteFully(fd, tensor.data_ptr(), static_cast<size_t>(tensor.numel()) * tensor.element_size(), args.path);
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        if (close(fd) != 0) {
+            throw std::runtime_error("Failed to write \"" + args.path + "\": " + std::strerror(errno));
+        }
+
+        Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::npz_load
+// ============================================================================
+
+// Parameter structure for npz_load command
+struct NpzLoadArgs {
+    std::string path;
+    std::vector<std::string> keys;   // empty means every member
+    std::string device = "cpu";
+
+    bool IsValid() const {
+        return !path.empty();
+    }
+};
+
+// Parse dual syntax: path ?keys? ?device? | -path path ?-keys list? ?-device device?
+static NpzLoadArgs ParseNpzLoadArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    NpzLoadArgs args;
+
+    auto parse_keys = [&](Tcl_Obj* obj) {
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, obj, &count, &items) != TCL_OK) {
+            throw std::runtime_error("Invalid keys list");
+        }
+        for (int k = 0; k < count; k++) {
+            args.keys.push_back(Tcl_GetString(items[k]));
+        }
+    };
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 4) {
+            throw std::runtime_error("Usage: torch::npz_load path ?keys? ?device?");
+        }
+        args.path = Tcl_GetString(objv[1]);
+        if (objc > 2) {
+            parse_keys(objv[2]);
+        }
+        if (objc > 3) {
+            args.device = Tcl_GetString(objv[3]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-path" || param == "-file") {
+                args.path = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-keys") {
+                parse_keys(objv[i + 1]);
+            } else if (param == "-device") {
+                args.device = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -path, -keys, -device");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Usage: torch::npz_load path ?keys? ?device? | torch::npz_load -path path ?-keys list? ?-device device?");
+    }
+
+    return args;
+}
+
+// torch::npz_load - Read the arrays of an .npz archive into a dict of
+// name -> tensor handle. Stored members are read in place; deflated ones
+// (numpy.savez_compressed) are inflated in memory first.
+int NpzLoad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        NpzLoadArgs args = ParseNpzLoadArgs(interp, objc, objv);
+
+        std::vector<std::pair<std::string, torch::Tensor>> loaded;
+        int fd = OpenForRead(args.path);
+        try {
+            struct stat st;
+            if (fstat(fd, &st) != 0) {
+                throw std::runtime_error("Failed to stat \"" + args.path + "\": " + std::strerror(errno));
+            }
+            std::vector<NpzMember> members = ReadNpzDirectory(fd, static_cast<uint64_t>(st.st_size), args.path);
+
+            std::vector<const NpzMember*> selected;
+            if (args.keys.empty()) {
+                for (const auto& member : members) {
+                    selected.push_back(&member);
+                }
+            } else {
+                for (const auto& key : args.keys) {
+                    const NpzMember* found = nullptr;
+                    for (const auto& member : members) {
+                        if (member.name == key) {
+                            found = &member;
+                            break;
+                        }
+                    }
+                    if (found == nullptr) {
+                        throw std::runtime_error("No array named \"" + key + "\" in \"" + args.path + "\"");
+                    }
+                    selected.push_back(found);
+                }
+            }
+
+            for (const NpzMember* member : selected) {
+                torch::Tensor tensor;
+                if (member->method == 0) {
+                    NpyReadFn read = FileReader(fd, args.path);
+                    NpyHeader header = ReadNpyHeader(read, member->data_offset, member->size);
+                    tensor = ReadNpyRows(read, header, 0, NpyRowCount(header));
+                } else if (member->method == 8) {
+                    std::vector<unsigned char> data = InflateNpzMember(interp, fd, *member, args.path);
+                    NpyReadFn read = [&data](void* dst, size_t len, uint64_t off) {
+                        std::memcpy(dst, data.data() + off, len);
+                    };
+                    NpyHeader header = ReadNpyHeader(read, 0, data.size());
+                    tensor = ReadNpyRows(read, header, 0, NpyRowCount(header));
+                } else {
+                    throw std::runtime_error("Unsupported compression method " + std::to_string(member->method) +
+                                             " for \"" + member->name + "\" in \"" + args.path + "\"");
+                }
+                loaded.emplace_back(member->name, tensor);
+            }
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+
+        torch::Device device = GetDevice(args.device.c_str());
+        Tcl_Obj* result = Tcl_NewDictObj();
+        for (auto& entry : loaded) {
+            torch::Tensor tensor = args.device != "cpu" ? entry.second.to(device) : entry.second;
+            std::string handle = StoreTensor(tensor);
+            Tcl_DictObjPut(interp, result, Tcl_NewStringObj(entry.first.c_str(), -1), NewHandleObj(handle));
+        }
+
+        Tcl_SetObjResult(interp, result);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// Chunked row readers: torch::npy_open / npy_next / npy_close
+// ============================================================================
+
+// Parameter structure for npy_open command
+struct NpyOpenArgs {
+    std::string path;
+    int64_t chunk = 1024;            // rows per block
+    std::string key;                 // member of an .npz archive
+
+    bool IsValid() const {
+        return !path.empty() && chunk > 0;
+    }
+};
+
+// Parse dual syntax: path ?chunk? ?key? | -path path ?-chunk rows? ?-key name?
+static NpyOpenArgs ParseNpyOpenArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    NpyOpenArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 4) {
+            throw std::runtime_error("Usage: torch::npy_open path ?chunk? ?key?");
+        }
+        args.path = Tcl_GetString(objv[1]);
+        if (objc > 2) {
+            args.chunk = GetInt64FromObj(interp, objv[2]);
+        }
+        if (objc > 3) {
+            args.key = Tcl_GetString(objv[3]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-path" || param == "-file") {
+                args.path = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-chunk" || param == "-chunkSize" || param == "-chunk_size") {
+                args.chunk = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-key") {
+                args.key = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -path, -chunk, -key");
+            }
+        }
+    }
+
+    if (args.path.empty()) {
+        throw std::runtime_error("Usage: torch::npy_open path ?chunk? ?key? | torch::npy_open -path path ?-chunk rows? ?-key name?");
+    }
+    if (!args.IsValid()) {
+        throw std::runtime_error("Chunk size must be positive");
+    }
+
+    return args;
+}
+
+// torch::npy_open - Open a .npy file (or an uncompressed .npz member) for
+// reading in blocks of rows; only one block is in memory at a time
+int NpyOpen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        NpyOpenArgs args = ParseNpyOpenArgs(interp, objc, objv);
+
+        auto reader = std::make_shared<NpyReader>();
+        reader->fd = OpenForRead(args.path);
+        reader->path = args.path;
+        reader->chunk = args.chunk;
+
+        struct stat st;
+        if (fstat(reader->fd, &st) != 0) {
+            throw std::runtime_error("Failed to stat \"" + args.path + "\": " + std::strerror(errno));
+        }
+        uint64_t file_size = static_cast<uint64_t>(st.st_size);
+        NpyReadFn read = FileReader(reader->fd, args.path);
+
+        if (args.key.empty()) {
+            reader->header = ReadNpyHeader(read, 0, file_size);
+        } else {
+            std::vector<NpzMember> members = ReadNpzDirectory(reader->fd, file_size, args.path);
+            const NpzMember* found = nullptr;
+            for (const auto& member : members) {
+                if (member.name == args.key) {
+                    found = &member;
+                    break;
+                }
+            }
+            if (found == nullptr) {
+                throw std::runtime_error("No array named \"" + args.key + "\" in \"" + args.path + "\"");
+            }
+            if (found->method != 0) {
+                throw std::runtime_error("Array \"" + args.key + "\" is compressed and cannot be streamed; use torch::npz_load");
+            }
+            reader->header = ReadNpyHeader(read, found->data_offset, found->size);
+        }
+
+        std::string handle = GetNextHandle("npy_reader");
+        npy_reader_storage[handle] = reader;
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for npy_next command
+struct NpyNextArgs {
+    std::string reader;
+
+    bool IsValid() const {
+        return !reader.empty();
+    }
+};
+
+// Parse dual syntax: reader | -reader reader
+static NpyNextArgs ParseNpyNextArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[], const char* command) {
+    (void)interp; // Suppress unused parameter warning
+    NpyNextArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error(std::string("Usage: ") + command + " reader");
+        }
+        args.reader = Tcl_GetString(objv[1]);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-reader") {
+                args.reader = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -reader");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: reader");
+    }
+
+    return args;
+}
+
+// torch::npy_next - Next block of up to chunk rows as a tensor handle, or an
+// empty string once every row has been returned
+int NpyNext_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        NpyNextArgs args = ParseNpyNextArgs(interp, objc, objv, "torch::npy_next");
+
+        auto it = npy_reader_storage.find(args.reader);
+        if (it == npy_reader_storage.end()) {
+            throw std::runtime_error("Invalid reader handle: " + args.reader);
+        }
+        NpyReader& reader = *it->second;
+
+        int64_t rows = NpyRowCount(reader.header);
+        if (reader.next_row >= rows) {
+            Tcl_ResetResult(interp);
+            return TCL_OK;
+        }
+
+        int64_t count = std::min(reader.chunk, rows - reader.next_row);
+        torch::Tensor block = ReadNpyRows(FileReader(reader.fd, reader.path), reader.header, reader.next_row, count);
+        reader.next_row += count;
+
+        std::string handle = StoreTensor(block);
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// torch::npy_close - Close a reader (equivalent to torch::release)
+int NpyClose_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        NpyNextArgs args = ParseNpyNextArgs(interp, objc, objv, "torch::npy_close");
+
+        if (!NpyReaderHandleExists(args.reader)) {
+            throw std::runtime_error("Invalid reader handle: " + args.reader);
+        }
+        ReleaseHandle(args.reader);
+
+        Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
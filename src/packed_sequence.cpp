@@ -0,0 +1,231 @@
+#include "libtorchtcl.h"
+
+using torch::nn::utils::rnn::PackedSequence;
+
+// Packed sequences hold a batch of variable-length sequences without their
+// padding, so recurrent layers run only the valid steps of each sequence
+thread_local std::unordered_map<std::string, PackedSequence> packed_sequence_storage;
+
+bool PackedSequenceHandleExists(const std::string& handle) {
+    return packed_sequence_storage.find(handle) != packed_sequence_storage.end();
+}
+
+bool ReleasePackedSequenceHandle(const std::string& handle) {
+    return packed_sequence_storage.erase(handle) > 0;
+}
+
+size_t PackedSequenceHandleCount() {
+    return packed_sequence_storage.size();
+}
+
+PackedSequence* FindPackedSequence(const std::string& handle) {
+    auto it = packed_sequence_storage.find(handle);
+    return it == packed_sequence_storage.end() ? nullptr : &it->second;
+}
+
+std::string StorePackedSequence(const PackedSequence& sequence) {
+    std::string handle = GetNextHandle("packed");
+    packed_sequence_storage.emplace(handle, sequence);
+    return handle;
+}
+
+// ============================================================================
+// torch::pack_padded_sequence
+// ============================================================================
+
+// Parameter structure for pack_padded_sequence command
+struct PackPaddedSequenceArgs {
+    Tcl_Obj* input = nullptr;
+    Tcl_Obj* lengths = nullptr;
+    bool batchFirst = false;
+    bool enforceSorted = true;
+
+    bool IsValid() const {
+        return input != nullptr && lengths != nullptr;
+    }
+};
+
+// Parse dual syntax: input lengths ?batchFirst? ?enforceSorted? |
+// -input tensor -lengths lengths ?-batchFirst bool? ?-enforceSorted bool?
+static PackPaddedSequenceArgs ParsePackPaddedSequenceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    PackPaddedSequenceArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 3 || objc > 5) {
+            throw std::runtime_error("Usage: torch::pack_padded_sequence input lengths ?batchFirst? ?enforceSorted?");
+        }
+        args.input = objv[1];
+        args.lengths = objv[2];
+        if (objc > 3) {
+            args.batchFirst = GetBoolFromObj(interp, objv[3]);
+        }
+        if (objc > 4) {
+            args.enforceSorted = GetBoolFromObj(interp, objv[4]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-input") {
+                args.input = objv[i + 1];
+            } else if (param == "-lengths") {
+                args.lengths = objv[i + 1];
+            } else if (param == "-batchFirst" || param == "-batch_first") {
+                args.batchFirst = GetBoolFromObj(interp, objv[i + 1]);
+            } else if (param == "-enforceSorted" || param == "-enforce_sorted") {
+                args.enforceSorted = GetBoolFromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -lengths, -batchFirst, -enforceSorted");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: input and lengths");
+    }
+
+    return args;
+}
+
+// torch::pack_padded_sequence - Pack a padded batch of sequences given their
+// lengths, as a tensor handle or a list of integers
+int PackPaddedSequence_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        PackPaddedSequenceArgs args = ParsePackPaddedSequenceArgs(interp, objc, objv);
+
+        torch::Tensor* input = FindTensorFromObj(args.input);
+        if (input == nullptr) {
+            throw std::runtime_error(std::string("Invalid input tensor: ") + Tcl_GetString(args.input));
+        }
+
+        torch::Tensor lengths;
+        if (torch::Tensor* tensor = FindTensorFromObj(args.lengths)) {
+            lengths = *tensor;
+        } else {
+            lengths = torch::tensor(GetIntVectorFromObj(interp, args.lengths), torch::kInt64);
+        }
+        // Lengths are read on the host whatever the device of the input
+        lengths = lengths.to(torch::kCPU, torch::kInt64);
+
+        PackedSequence packed = torch::nn::utils::rnn::pack_padded_sequence(
+            *input, lengths, args.batchFirst, args.enforceSorted);
+
+        Tcl_SetObjResult(interp, NewHandleObj(StorePackedSequence(packed)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::pad_packed_sequence
+// ============================================================================
+
+// Parameter structure for pad_packed_sequence command
+struct PadPackedSequenceArgs {
+    std::string sequence;
+    bool batchFirst = false;
+    double paddingValue = 0.0;
+    int64_t totalLength = -1;        // longest sequence by default
+
+    bool IsValid() const {
+        return !sequence.empty();
+    }
+};
+
+// Parse dual syntax: sequence ?batchFirst? ?paddingValue? ?totalLength? |
+// -sequence packed ?-batchFirst bool? ?-paddingValue x? ?-totalLength n?
+static PadPackedSequenceArgs ParsePadPackedSequenceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    PadPackedSequenceArgs args;
+
+    auto get_double = [&](Tcl_Obj* obj) {
+        double value;
+        if (Tcl_GetDoubleFromObj(interp, obj, &value) != TCL_OK) {
+            throw std::runtime_error("Invalid paddingValue value");
+        }
+        return value;
+    };
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 5) {
+            throw std::runtime_error("Usage: torch::pad_packed_sequence sequence ?batchFirst? ?paddingValue? ?totalLength?");
+        }
+        args.sequence = Tcl_GetString(objv[1]);
+        if (objc > 2) {
+            args.batchFirst = GetBoolFromObj(interp, objv[2]);
+        }
+        if (objc > 3) {
+            args.paddingValue = get_double(objv[3]);
+        }
+        if (objc > 4) {
+            args.totalLength = GetInt64FromObj(interp, objv[4]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-sequence" || param == "-input") {
+                args.sequence = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-batchFirst" || param == "-batch_first") {
+                args.batchFirst = GetBoolFromObj(interp, objv[i + 1]);
+            } else if (param == "-paddingValue" || param == "-padding_value") {
+                args.paddingValue = get_double(objv[i + 1]);
+            } else if (param == "-totalLength" || param == "-total_length") {
+                args.totalLength = GetInt64FromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -sequence, -batchFirst, -paddingValue, -totalLength");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: sequence");
+    }
+
+    return args;
+}
+
+// torch::pad_packed_sequence - Inverse of pack_padded_sequence; returns
+// {padded lengths}
+int PadPackedSequence_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        PadPackedSequenceArgs args = ParsePadPackedSequenceArgs(interp, objc, objv);
+
+        PackedSequence* packed = FindPackedSequence(args.sequence);
+        if (packed == nullptr) {
+            throw std::runtime_error("Invalid packed sequence: " + args.sequence);
+        }
+
+        c10::optional<int64_t> total_length;
+        if (args.totalLength >= 0) {
+            total_length = args.totalLength;
+        }
+        auto result = torch::nn::utils::rnn::pad_packed_sequence(
+            *packed, args.batchFirst, args.paddingValue, total_length);
+
+        std::string padded = ReserveTensorHandle().Fill(std::get<0>(result));
+        std::string lengths = ReserveTensorHandle().Fill(std::get<1>(result));
+
+        Tcl_Obj* items[2] = {NewHandleObj(padded), NewHandleObj(lengths)};
+        Tcl_SetObjResult(interp, Tcl_NewListObj(2, items));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
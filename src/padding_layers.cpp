@@ -5,6 +5,7 @@
 // Parameter structure for reflection_pad1d command
 struct ReflectionPad1dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> padding;
     
     bool IsValid() const {
@@ -26,6 +27,7 @@ ReflectionPad1dArgs ParseReflectionPad1dArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::reflection_pad1d tensor padding");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse padding values
         int listLen;
@@ -55,6 +57,7 @@ ReflectionPad1dArgs ParseReflectionPad1dArgs(Tcl_Interp* interp, int objc, Tcl_O
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-padding") {
                 // Parse padding values
                 int listLen;
@@ -94,18 +97,18 @@ int ReflectionPad1D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         ReflectionPad1dArgs args = ParseReflectionPad1dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result = torch::reflection_pad1d(tensor, args.padding);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -116,6 +119,7 @@ int ReflectionPad1D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 // Parameter structure for reflection_pad2d command
 struct ReflectionPad2DArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> padding;
     
     bool IsValid() const {
@@ -137,6 +141,7 @@ ReflectionPad2DArgs ParseReflectionPad2DArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::reflection_pad2d tensor padding");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse padding values
         int listLen;
@@ -169,6 +174,7 @@ ReflectionPad2DArgs ParseReflectionPad2DArgs(Tcl_Interp* interp, int objc, Tcl_O
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-padding" || param == "-pad") {
                 // Parse padding values
                 int listLen;
@@ -215,12 +221,13 @@ int ReflectionPad2D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         ReflectionPad2DArgs args = ParseReflectionPad2DArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Check tensor dimensions
         if (tensor.dim() != 4) {
@@ -236,10 +243,9 @@ int ReflectionPad2D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         
         torch::Tensor result = torch::reflection_pad2d(tensor, args.padding);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -250,6 +256,7 @@ int ReflectionPad2D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 // Parameter structure for reflection_pad3d command
 struct ReflectionPad3DArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> padding;
     
     bool IsValid() const {
@@ -271,6 +278,7 @@ ReflectionPad3DArgs ParseReflectionPad3DArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::reflection_pad3d tensor padding");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse padding values
         int listLen;
@@ -306,6 +314,7 @@ ReflectionPad3DArgs ParseReflectionPad3DArgs(Tcl_Interp* interp, int objc, Tcl_O
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
                 has_input = true;
             } else if (param == "-padding" || param == "-pad") {
                 // Parse padding values
@@ -357,12 +366,13 @@ int ReflectionPad3D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         ReflectionPad3DArgs args = ParseReflectionPad3DArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Check tensor dimensions
         if (tensor.dim() != 5) {
@@ -371,10 +381,9 @@ int ReflectionPad3D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         
         torch::Tensor result = torch::reflection_pad3d(tensor, args.padding);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -385,6 +394,7 @@ int ReflectionPad3D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 // Parameter structure for replication_pad1d command
 struct ReplicationPad1DArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> padding;
     
     bool IsValid() const {
@@ -406,6 +416,7 @@ ReplicationPad1DArgs ParseReplicationPad1DArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::replication_pad1d tensor padding");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse padding values
         int listLen;
@@ -441,6 +452,7 @@ ReplicationPad1DArgs ParseReplicationPad1DArgs(Tcl_Interp* interp, int objc, Tcl
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
                 has_input = true;
             } else if (param == "-padding" || param == "-pad") {
                 // Parse padding values
@@ -493,12 +505,13 @@ int ReplicationPad1D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     try {
         ReplicationPad1DArgs args = ParseReplicationPad1DArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Check tensor dimensions
         if (tensor.dim() != 3) {
@@ -507,10 +520,9 @@ int ReplicationPad1D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
         
         torch::Tensor result = torch::replication_pad1d(tensor, args.padding);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -521,6 +533,7 @@ int ReplicationPad1D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
 // Parameter structure for replication_pad2d command
 struct ReplicationPad2DArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> padding;
     
     bool IsValid() const {
@@ -542,6 +555,7 @@ ReplicationPad2DArgs ParseReplicationPad2DArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::replication_pad2d tensor padding");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse padding values
         int listLen;
@@ -577,6 +591,7 @@ ReplicationPad2DArgs ParseReplicationPad2DArgs(Tcl_Interp* interp, int objc, Tcl
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
                 has_input = true;
             } else if (param == "-padding" || param == "-pad") {
                 // Parse padding values
@@ -629,12 +644,13 @@ int ReplicationPad2D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     try {
         ReplicationPad2DArgs args = ParseReplicationPad2DArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Check tensor dimensions
         if (tensor.dim() != 4) {
@@ -643,10 +659,9 @@ int ReplicationPad2D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
         
         torch::Tensor result = torch::replication_pad2d(tensor, args.padding);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -657,6 +672,7 @@ int ReplicationPad2D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
 // Parameter structure for replication_pad3d command
 struct ReplicationPad3DArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> padding;
     
     bool IsValid() const {
@@ -678,6 +694,7 @@ ReplicationPad3DArgs ParseReplicationPad3DArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::replication_pad3d tensor padding");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse padding values
         int listLen;
@@ -713,6 +730,7 @@ ReplicationPad3DArgs ParseReplicationPad3DArgs(Tcl_Interp* interp, int objc, Tcl
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
                 has_input = true;
             } else if (param == "-padding" || param == "-pad") {
                 // Parse padding values
@@ -764,12 +782,13 @@ int ReplicationPad3D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     try {
         ReplicationPad3DArgs args = ParseReplicationPad3DArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Check tensor dimensions
         if (tensor.dim() != 5) {
@@ -778,10 +797,9 @@ int ReplicationPad3D_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
         
         torch::Tensor result = torch::replication_pad3d(tensor, args.padding);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
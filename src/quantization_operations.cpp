@@ -13,13 +13,13 @@ int TensorQuantizePerTensor_Cmd(ClientData clientData, Tcl_Interp* interp, int o
     }
 
     try {
-        std::string input_name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(input_name) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(objv[1]);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[input_name];
+        auto input = *input_tensor;
         
         double scale;
         if (Tcl_GetDoubleFromObj(interp, objv[2], &scale) != TCL_OK) {
@@ -34,9 +34,8 @@ int TensorQuantizePerTensor_Cmd(ClientData clientData, Tcl_Interp* interp, int o
         c10::ScalarType dtype = GetScalarType(Tcl_GetString(objv[4]));
         auto output = torch::quantize_per_tensor(input, scale, zero_point, dtype);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -53,27 +52,27 @@ int TensorQuantizePerChannel_Cmd(ClientData clientData, Tcl_Interp* interp, int
     }
 
     try {
-        std::string input_name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(input_name) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(objv[1]);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[input_name];
+        auto input = *input_tensor;
         
-        std::string scales_name = Tcl_GetString(objv[2]);
-        if (tensor_storage.find(scales_name) == tensor_storage.end()) {
+        torch::Tensor* scales_tensor = FindTensorFromObj(objv[2]);
+        if (scales_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid scales tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto scales = tensor_storage[scales_name];
+        auto scales = *scales_tensor;
         
-        std::string zero_points_name = Tcl_GetString(objv[3]);
-        if (tensor_storage.find(zero_points_name) == tensor_storage.end()) {
+        torch::Tensor* zero_points_tensor = FindTensorFromObj(objv[3]);
+        if (zero_points_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid zero_points tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto zero_points = tensor_storage[zero_points_name];
+        auto zero_points = *zero_points_tensor;
         
         int axis;
         if (Tcl_GetIntFromObj(interp, objv[4], &axis) != TCL_OK) {
@@ -83,9 +82,8 @@ int TensorQuantizePerChannel_Cmd(ClientData clientData, Tcl_Interp* interp, int
         c10::ScalarType dtype = GetScalarType(Tcl_GetString(objv[5]));
         auto output = torch::quantize_per_channel(input, scales, zero_points, axis, dtype);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -96,6 +94,7 @@ int TensorQuantizePerChannel_Cmd(ClientData clientData, Tcl_Interp* interp, int
 // Parameter structure for dequantize command
 struct DequantizeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -117,6 +116,7 @@ DequantizeArgs ParseDequantizeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -127,6 +127,7 @@ DequantizeArgs ParseDequantizeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -147,17 +148,17 @@ int TensorDequantize_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     try {
         DequantizeArgs args = ParseDequantizeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::dequantize(input);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -168,6 +169,7 @@ int TensorDequantize_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
 // Parameter structure for fake_quantize_per_tensor command
 struct FakeQuantizePerTensorArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double scale = 1.0;
     int zero_point = 0;
     int quant_min = -128;
@@ -193,6 +195,7 @@ FakeQuantizePerTensorArgs ParseFakeQuantizePerTensorArgs(Tcl_Interp* interp, int
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.scale) != TCL_OK) {
             throw std::runtime_error("Invalid scale value. Expected double.");
@@ -224,6 +227,7 @@ FakeQuantizePerTensorArgs ParseFakeQuantizePerTensorArgs(Tcl_Interp* interp, int
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-scale") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.scale) != TCL_OK) {
                     throw std::runtime_error("Invalid scale value. Expected double.");
@@ -260,17 +264,17 @@ int TensorFakeQuantizePerTensor_Cmd(ClientData clientData, Tcl_Interp* interp, i
         FakeQuantizePerTensorArgs args = ParseFakeQuantizePerTensorArgs(interp, objc, objv);
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         auto output = torch::fake_quantize_per_tensor_affine(input, args.scale, args.zero_point, args.quant_min, args.quant_max);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -283,6 +287,9 @@ struct FakeQuantizePerChannelArgs {
     std::string input;
     std::string scales;
     std::string zero_points;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* scalesObj = nullptr;
+    Tcl_Obj* zero_pointsObj = nullptr;
     int axis = 0;
     int quant_min = -128;
     int quant_max = 127;
@@ -302,8 +309,11 @@ FakeQuantizePerChannelArgs ParseFakeQuantizePerChannelArgs(Tcl_Interp* interp, i
     if (objc >= 5 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.scales = Tcl_GetString(objv[2]);
+        args.scalesObj = objv[2];
         args.zero_points = Tcl_GetString(objv[3]);
+        args.zero_pointsObj = objv[3];
         
         if (Tcl_GetIntFromObj(interp, objv[4], &args.axis) != TCL_OK) {
             throw std::runtime_error("Invalid axis value");
@@ -331,10 +341,13 @@ FakeQuantizePerChannelArgs ParseFakeQuantizePerChannelArgs(Tcl_Interp* interp, i
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-scales") {
                 args.scales = Tcl_GetString(objv[i + 1]);
+                args.scalesObj = objv[i + 1];
             } else if (param == "-zero_points" || param == "-zeroPoints") {
                 args.zero_points = Tcl_GetString(objv[i + 1]);
+                args.zero_pointsObj = objv[i + 1];
             } else if (param == "-axis") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.axis) != TCL_OK) {
                     throw std::runtime_error("Invalid axis value");
@@ -365,20 +378,23 @@ int TensorFakeQuantizePerChannel_Cmd(ClientData clientData, Tcl_Interp* interp,
     try {
         FakeQuantizePerChannelArgs args = ParseFakeQuantizePerChannelArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             throw std::runtime_error("Invalid input tensor");
         }
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         
-        if (tensor_storage.find(args.scales) == tensor_storage.end()) {
+        torch::Tensor* scales_tensor = FindTensorFromObj(args.scalesObj);
+        if (scales_tensor == nullptr) {
             throw std::runtime_error("Invalid scales tensor");
         }
-        auto scales = tensor_storage[args.scales];
+        auto scales = *scales_tensor;
         
-        if (tensor_storage.find(args.zero_points) == tensor_storage.end()) {
+        torch::Tensor* zero_points_tensor = FindTensorFromObj(args.zero_pointsObj);
+        if (zero_points_tensor == nullptr) {
             throw std::runtime_error("Invalid zero_points tensor");
         }
-        auto zero_points = tensor_storage[args.zero_points];
+        auto zero_points = *zero_points_tensor;
         
         int axis = args.axis;
         int quant_min = args.quant_min;
@@ -386,9 +402,8 @@ int TensorFakeQuantizePerChannel_Cmd(ClientData clientData, Tcl_Interp* interp,
 
         auto output = torch::fake_quantize_per_channel_affine(input, scales, zero_points, axis, quant_min, quant_max);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -401,6 +416,7 @@ int TensorFakeQuantizePerChannel_Cmd(ClientData clientData, Tcl_Interp* interp,
 // ============================================================================
 struct IntReprArgs {
     std::string input;      // quantized tensor handle
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -417,6 +433,7 @@ IntReprArgs ParseIntReprArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -428,6 +445,7 @@ IntReprArgs ParseIntReprArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -450,16 +468,16 @@ int TensorIntRepr_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_O
         IntReprArgs args = ParseIntReprArgs(interp, objc, objv);
         
         // Get input tensor from the parsed arguments
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             throw std::runtime_error("Invalid quantized tensor: " + args.input);
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::int_repr(input);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in int_repr: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -476,13 +494,13 @@ int TensorQScale_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
     }
 
     try {
-        std::string input_name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(input_name) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(objv[1]);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[input_name];
+        auto input = *input_tensor;
         if (!input.is_quantized()) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -507,13 +525,13 @@ int TensorQZeroPoint_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     }
 
     try {
-        std::string input_name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(input_name) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(objv[1]);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[input_name];
+        auto input = *input_tensor;
         if (!input.is_quantized()) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -538,13 +556,13 @@ int TensorQPerChannelScales_Cmd(ClientData clientData, Tcl_Interp* interp, int o
     }
 
     try {
-        std::string input_name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(input_name) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(objv[1]);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[input_name];
+        auto input = *input_tensor;
         if (!input.is_quantized()) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -552,9 +570,8 @@ int TensorQPerChannelScales_Cmd(ClientData clientData, Tcl_Interp* interp, int o
 
         auto output = input.q_per_channel_scales();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
@@ -571,13 +588,13 @@ int TensorQPerChannelZeroPoints_Cmd(ClientData clientData, Tcl_Interp* interp, i
     }
 
     try {
-        std::string input_name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(input_name) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(objv[1]);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[input_name];
+        auto input = *input_tensor;
         if (!input.is_quantized()) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -585,9 +602,8 @@ int TensorQPerChannelZeroPoints_Cmd(ClientData clientData, Tcl_Interp* interp, i
 
         auto output = input.q_per_channel_zero_points();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
@@ -604,13 +620,13 @@ int TensorQPerChannelAxis_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
     }
 
     try {
-        std::string input_name = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(input_name) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(objv[1]);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[input_name];
+        auto input = *input_tensor;
         if (!input.is_quantized()) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
@@ -630,6 +646,8 @@ int TensorQPerChannelAxis_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
 struct QuantizedAddArgs {
     std::string tensor1;
     std::string tensor2;
+    Tcl_Obj* tensor1Obj = nullptr;
+    Tcl_Obj* tensor2Obj = nullptr;
     double scale;
     int zero_point;
     double alpha = 1.0;  // Default alpha value
@@ -649,7 +667,9 @@ QuantizedAddArgs ParseQuantizedAddArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             throw std::runtime_error("Usage: torch::quantized_add tensor1 tensor2 scale zero_point ?alpha?");
         }
         args.tensor1 = Tcl_GetString(objv[1]);
+        args.tensor1Obj = objv[1];
         args.tensor2 = Tcl_GetString(objv[2]);
+        args.tensor2Obj = objv[2];
         
         if (Tcl_GetDoubleFromObj(interp, objv[3], &args.scale) != TCL_OK) {
             throw std::runtime_error("Invalid scale value");
@@ -673,8 +693,10 @@ QuantizedAddArgs ParseQuantizedAddArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-tensor1") {
                 args.tensor1 = Tcl_GetString(objv[i + 1]);
+                args.tensor1Obj = objv[i + 1];
             } else if (param == "-tensor2") {
                 args.tensor2 = Tcl_GetString(objv[i + 1]);
+                args.tensor2Obj = objv[i + 1];
             } else if (param == "-scale") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.scale) != TCL_OK) {
                     throw std::runtime_error("Invalid scale value");
@@ -712,24 +734,25 @@ int TensorQuantizedAdd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
     try {
         QuantizedAddArgs args = ParseQuantizedAddArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor1) == tensor_storage.end()) {
+        torch::Tensor* tensor1_tensor = FindTensorFromObj(args.tensor1Obj);
+        if (tensor1_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.tensor2) == tensor_storage.end()) {
+        torch::Tensor* tensor2_tensor = FindTensorFromObj(args.tensor2Obj);
+        if (tensor2_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto tensor1 = tensor_storage[args.tensor1];
-        auto tensor2 = tensor_storage[args.tensor2];
+        auto tensor1 = *tensor1_tensor;
+        auto tensor2 = *tensor2_tensor;
 
         // Use standard add for quantized tensors - PyTorch handles the quantization internally
         auto output = torch::add(tensor1, tensor2, args.alpha);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -741,6 +764,8 @@ int TensorQuantizedAdd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
 struct QuantizedMulArgs {
     std::string tensor1;
     std::string tensor2;
+    Tcl_Obj* tensor1Obj = nullptr;
+    Tcl_Obj* tensor2Obj = nullptr;
     double scale;
     int zero_point;
     
@@ -759,7 +784,9 @@ QuantizedMulArgs ParseQuantizedMulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             throw std::runtime_error("Usage: torch::quantized_mul tensor1 tensor2 scale zero_point");
         }
         args.tensor1 = Tcl_GetString(objv[1]);
+        args.tensor1Obj = objv[1];
         args.tensor2 = Tcl_GetString(objv[2]);
+        args.tensor2Obj = objv[2];
         
         if (Tcl_GetDoubleFromObj(interp, objv[3], &args.scale) != TCL_OK) {
             throw std::runtime_error("Invalid scale value");
@@ -778,8 +805,10 @@ QuantizedMulArgs ParseQuantizedMulArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-tensor1") {
                 args.tensor1 = Tcl_GetString(objv[i + 1]);
+                args.tensor1Obj = objv[i + 1];
             } else if (param == "-tensor2") {
                 args.tensor2 = Tcl_GetString(objv[i + 1]);
+                args.tensor2Obj = objv[i + 1];
             } else if (param == "-scale") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.scale) != TCL_OK) {
                     throw std::runtime_error("Invalid scale value");
@@ -813,24 +842,25 @@ int TensorQuantizedMul_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
     try {
         QuantizedMulArgs args = ParseQuantizedMulArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor1) == tensor_storage.end()) {
+        torch::Tensor* tensor1_tensor = FindTensorFromObj(args.tensor1Obj);
+        if (tensor1_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.tensor2) == tensor_storage.end()) {
+        torch::Tensor* tensor2_tensor = FindTensorFromObj(args.tensor2Obj);
+        if (tensor2_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto tensor1 = tensor_storage[args.tensor1];
-        auto tensor2 = tensor_storage[args.tensor2];
+        auto tensor1 = *tensor1_tensor;
+        auto tensor2 = *tensor2_tensor;
 
         // Use standard mul for quantized tensors - PyTorch handles the quantization internally
         auto output = torch::mul(tensor1, tensor2);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -841,6 +871,7 @@ int TensorQuantizedMul_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
 // Parameter structure for quantized_relu
 struct QuantizedReluArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -857,6 +888,7 @@ QuantizedReluArgs ParseQuantizedReluArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::quantized_relu quantized_tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -868,6 +900,7 @@ QuantizedReluArgs ParseQuantizedReluArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -893,18 +926,18 @@ int TensorQuantizedRelu_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
     try {
         QuantizedReluArgs args = ParseQuantizedReluArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid quantized tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         // Use standard relu for quantized tensors - PyTorch handles the quantization internally  
         auto output = torch::relu(input);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -233,6 +233,7 @@ int TensorSetRngState_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
 // Dual-syntax argument structure & parser
 struct BernoulliArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double p = -1.0;  // Use -1 to indicate not provided (use input tensor probabilities)
     std::string generator = "";  // Optional generator
 
@@ -253,6 +254,7 @@ BernoulliArgs ParseBernoulliArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
 
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
 
         if (objc > 2) {
             args.p = GetDoubleFromObj(interp, objv[2]);
@@ -278,6 +280,7 @@ BernoulliArgs ParseBernoulliArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
                 has_input = true;
             } else if (param == "-p" || param == "-probability") {
                 args.p = GetDoubleFromObj(interp, objv[i + 1]);
@@ -306,11 +309,12 @@ int TensorBernoulli_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         BernoulliArgs args = ParseBernoulliArgs(interp, objc, objv);
 
         // Validate tensor existence
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             throw std::runtime_error("Invalid input tensor name: " + args.input);
         }
 
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         
         torch::Tensor result;
         
@@ -338,6 +342,7 @@ int TensorBernoulli_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 // Parameter structure for torch::multinomial command
 struct MultinomialArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int num_samples = 0;
     bool replacement = true;
     
@@ -353,6 +358,7 @@ MultinomialArgs ParseMultinomialArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
     if (objc >= 3 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.num_samples = GetIntFromObj(interp, objv[2]);
         if (objc >= 4) {
             args.replacement = GetBoolFromObj(interp, objv[3]);
@@ -366,6 +372,7 @@ MultinomialArgs ParseMultinomialArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (strcmp(option, "-input") == 0) {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (strcmp(option, "-numSamples") == 0 || strcmp(option, "-num_samples") == 0) {
                 args.num_samples = GetIntFromObj(interp, objv[i + 1]);
             } else if (strcmp(option, "-replacement") == 0) {
@@ -393,12 +400,13 @@ int TensorMultinomial_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, T
         }
         
         // Validate tensor existence
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input = tensor_storage[args.input];
+        auto& input = *input_tensor;
         auto result = torch::multinomial(input, args.num_samples, args.replacement);
         return SetTensorResult(interp, result);
     } catch (const std::exception& e) {
@@ -538,10 +546,9 @@ int TensorNormal_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Ob
             result = torch::randn(args.size, options) * args.std + args.mean;
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -934,10 +941,9 @@ int TensorPoisson_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_O
         auto lam_tensor = torch::full(args.size, args.lambda, options);
         auto result = torch::poisson(lam_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -23,6 +23,11 @@ public:
         c10::optional<std::tuple<torch::Tensor, torch::Tensor>> hx = c10::nullopt) {
         return lstm->forward(input, hx);
     }
+
+    // Packed input skips the padding steps of shorter sequences
+    torch::nn::utils::rnn::PackedSequence forward_packed(const torch::nn::utils::rnn::PackedSequence& input) {
+        return std::get<0>(lstm->forward_with_packed_input(input));
+    }
 };
 
 // Concrete GRU implementation
@@ -52,6 +57,10 @@ public:
             return gru->forward(input);
         }
     }
+
+    torch::nn::utils::rnn::PackedSequence forward_packed(const torch::nn::utils::rnn::PackedSequence& input) {
+        return std::get<0>(gru->forward_with_packed_input(input));
+    }
 };
 
 // Concrete RNN implementation
@@ -87,8 +96,75 @@ public:
             return rnn->forward(input);
         }
     }
+
+    torch::nn::utils::rnn::PackedSequence forward_packed(const torch::nn::utils::rnn::PackedSequence& input) {
+        return std::get<0>(rnn->forward_with_packed_input(input));
+    }
 };
 
+// Packed forward pass used by torch::layer_forward. Returns false if module
+// is not a recurrent layer.
+bool RecurrentLayerForwardPacked(const std::shared_ptr<torch::nn::Module>& module,
+                                 const torch::nn::utils::rnn::PackedSequence& input,
+                                 torch::nn::utils::rnn::PackedSequence& output) {
+    if (auto lstm = std::dynamic_pointer_cast<ConcreteLSTM>(module)) {
+        output = lstm->forward_packed(input);
+    } else if (auto gru = std::dynamic_pointer_cast<ConcreteGRU>(module)) {
+        output = gru->forward_packed(input);
+    } else if (auto rnn = std::dynamic_pointer_cast<ConcreteRNN>(module)) {
+        output = rnn->forward_packed(input);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+template<typename Layer>
+static RecurrentLayerShape ShapeOf(const Layer& layer, bool hasCell) {
+    const auto& options = layer->options_base;
+    RecurrentLayerShape shape;
+    shape.numLayers = options.num_layers();
+    shape.hiddenSize = options.hidden_size();
+    shape.hasCell = hasCell;
+    shape.batchFirst = options.batch_first();
+    shape.bidirectional = options.bidirectional();
+    return shape;
+}
+
+// Layout of the hidden state, for torch::rnn_stream_open. Returns false if
+// module is not a recurrent layer.
+bool GetRecurrentLayerShape(const std::shared_ptr<torch::nn::Module>& module, RecurrentLayerShape& shape) {
+    if (auto lstm = std::dynamic_pointer_cast<ConcreteLSTM>(module)) {
+        shape = ShapeOf(lstm->lstm, true);
+    } else if (auto gru = std::dynamic_pointer_cast<ConcreteGRU>(module)) {
+        shape = ShapeOf(gru->gru, false);
+    } else if (auto rnn = std::dynamic_pointer_cast<ConcreteRNN>(module)) {
+        shape = ShapeOf(rnn->rnn, false);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Forward pass from an explicit state, for torch::rnn_stream_step. h (and c
+// for LSTM layers) are replaced by the final state.
+torch::Tensor RecurrentLayerForwardState(const std::shared_ptr<torch::nn::Module>& module,
+                                         const torch::Tensor& input, torch::Tensor& h, torch::Tensor& c) {
+    torch::Tensor output;
+    if (auto lstm = std::dynamic_pointer_cast<ConcreteLSTM>(module)) {
+        auto result = lstm->forward(input, std::make_tuple(h, c));
+        output = std::get<0>(result);
+        std::tie(h, c) = std::get<1>(result);
+    } else if (auto gru = std::dynamic_pointer_cast<ConcreteGRU>(module)) {
+        std::tie(output, h) = gru->forward(input, h);
+    } else if (auto rnn = std::dynamic_pointer_cast<ConcreteRNN>(module)) {
+        std::tie(output, h) = rnn->forward(input, h);
+    } else {
+        throw std::runtime_error("Not a recurrent layer");
+    }
+    return output;
+}
+
 // Parameter structure for LSTM
 struct LSTMArgs {
     int input_size = 0;      // Initialize to 0 for proper validation
@@ -225,7 +301,7 @@ int LSTM_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Store and return handle
         std::string handle = StoreModule("lstm", lstm);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -369,7 +445,7 @@ int GRU_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Store and return handle
         std::string handle = StoreModule("gru", gru);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -514,7 +590,7 @@ int RNNTanh_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         // Store and return handle
         std::string handle = StoreModule("rnn", rnn);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
@@ -670,7 +746,7 @@ int RNNRelu_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         // Store and return handle
         std::string handle = StoreModule("rnn", rnn);
         
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
         
     } catch (const std::exception& e) {
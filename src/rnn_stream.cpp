@@ -0,0 +1,325 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <unordered_set>
+
+// The state of every stream of one layer, in slots along dimension 1. A step
+// gathers the slots of the sessions it advances with one index_select and
+// scatters the new state back with one index_copy_, however many streams
+// take part. The pool owns the layer, so its address identifies the pool
+// for as long as the pool exists.
+struct RnnStatePool {
+    std::shared_ptr<torch::nn::Module> model;
+    RecurrentLayerShape shape;
+    torch::Tensor h;                 // [numLayers, capacity, hiddenSize]
+    torch::Tensor c;                 // cell state of LSTM layers, undefined otherwise
+    std::vector<int64_t> free_slots;
+
+    int64_t Capacity() const { return h.size(1); }
+
+    // Slots for a new stream, zeroed; the pool doubles when it runs out
+    std::vector<int64_t> Acquire(int64_t count) {
+        if (static_cast<int64_t>(free_slots.size()) < count) {
+            int64_t old_capacity = Capacity();
+            int64_t capacity = std::max(old_capacity * 2, old_capacity + count);
+            auto grow = [&](const torch::Tensor& state) {
+                torch::Tensor added = torch::zeros({shape.numLayers, capacity - old_capacity, shape.hiddenSize}, state.options());
+                return torch::cat({state, added}, 1);
+            };
+            h = grow(h);
+            if (shape.hasCell) {
+                c = grow(c);
+            }
+            for (int64_t slot = capacity - 1; slot >= old_capacity; slot--) {
+                free_slots.push_back(slot);
+            }
+        }
+
+        std::vector<int64_t> slots(free_slots.end() - count, free_slots.end());
+        free_slots.resize(free_slots.size() - count);
+        torch::Tensor index = torch::tensor(slots, torch::TensorOptions().dtype(torch::kInt64).device(h.device()));
+        h.index_fill_(1, index, 0);
+        if (shape.hasCell) {
+            c.index_fill_(1, index, 0);
+        }
+        return slots;
+    }
+
+    void Release(const std::vector<int64_t>& slots) {
+        free_slots.insert(free_slots.end(), slots.begin(), slots.end());
+    }
+};
+
+// A recurrent stream holds the hidden state of one or more independent
+// sessions of an LSTM, GRU or RNN layer between calls, on the device of the
+// layer, so a model can be fed one timestep at a time
+struct RnnStream {
+    std::shared_ptr<RnnStatePool> pool;
+    std::vector<int64_t> slots;      // one per session
+    torch::Tensor index;             // slots as an int64 tensor on the state's device
+
+    RnnStream() = default;
+    RnnStream(RnnStream&&) = default;
+    RnnStream& operator=(RnnStream&&) = default;
+    ~RnnStream() {
+        if (pool) {
+            pool->Release(slots);
+        }
+    }
+
+    int64_t Sessions() const { return static_cast<int64_t>(slots.size()); }
+};
+
+thread_local std::unordered_map<std::string, RnnStream> rnn_stream_storage;
+
+// Pools of this thread by layer. Entries of pools whose streams are all gone
+// expire; a live entry keeps its layer, so the key cannot be reused meanwhile.
+static thread_local std::unordered_map<const torch::nn::Module*, std::weak_ptr<RnnStatePool>> rnn_state_pools;
+
+bool RnnStreamHandleExists(const std::string& handle) {
+    return rnn_stream_storage.find(handle) != rnn_stream_storage.end();
+}
+
+bool ReleaseRnnStreamHandle(const std::string& handle) {
+    return rnn_stream_storage.erase(handle) > 0;
+}
+
+size_t RnnStreamHandleCount() {
+    return rnn_stream_storage.size();
+}
+
+// ============================================================================
+// torch::rnn_stream_open
+// ============================================================================
+
+// Parameter structure for rnn_stream_open command
+struct RnnStreamOpenArgs {
+    Tcl_Obj* model = nullptr;
+    int64_t batchSize = 1;           // independent sessions in the stream
+
+    bool IsValid() const {
+        return model != nullptr && batchSize > 0;
+    }
+};
+
+// Parse dual syntax: model ?batchSize? | -model layer ?-batchSize int?
+static RnnStreamOpenArgs ParseRnnStreamOpenArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    RnnStreamOpenArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 2 || objc > 3) {
+            throw std::runtime_error("Usage: torch::rnn_stream_open model ?batchSize?");
+        }
+        args.model = objv[1];
+        if (objc > 2) {
+            args.batchSize = GetInt64FromObj(interp, objv[2]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-model") {
+                args.model = objv[i + 1];
+            } else if (param == "-batchSize" || param == "-batch_size") {
+                args.batchSize = GetInt64FromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -model, -batchSize");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing or invalid: model and positive batchSize");
+    }
+
+    return args;
+}
+
+// torch::rnn_stream_open - Start a stream of batchSize sessions with a zero
+// state allocated on the device and dtype of the layer
+int RnnStreamOpen_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        RnnStreamOpenArgs args = ParseRnnStreamOpenArgs(interp, objc, objv);
+
+        auto* model = FindModuleFromObj(args.model);
+        if (model == nullptr) {
+            throw std::runtime_error(std::string("Invalid model: ") + Tcl_GetString(args.model));
+        }
+
+        std::shared_ptr<RnnStatePool> pool = rnn_state_pools[model->get()].lock();
+        if (!pool) {
+            pool = std::make_shared<RnnStatePool>();
+            pool->model = *model;
+            if (!GetRecurrentLayerShape(pool->model, pool->shape)) {
+                throw std::runtime_error("torch::rnn_stream_open needs an LSTM, GRU or RNN layer");
+            }
+            if (pool->shape.bidirectional) {
+                throw std::runtime_error("Cannot stream a bidirectional layer: its backward pass needs the whole sequence");
+            }
+
+            auto options = pool->model->parameters().front().options().requires_grad(false);
+            std::vector<int64_t> state_shape = {pool->shape.numLayers, 0, pool->shape.hiddenSize};
+            pool->h = torch::zeros(state_shape, options);
+            if (pool->shape.hasCell) {
+                pool->c = torch::zeros(state_shape, options);
+            }
+            for (auto it = rnn_state_pools.begin(); it != rnn_state_pools.end();) {
+                it = it->second.expired() ? rnn_state_pools.erase(it) : std::next(it);
+            }
+            rnn_state_pools[model->get()] = pool;
+        }
+
+        torch::NoGradGuard no_grad;
+        RnnStream stream;
+        stream.slots = pool->Acquire(args.batchSize);
+        stream.index = torch::tensor(stream.slots, torch::TensorOptions().dtype(torch::kInt64).device(pool->h.device()));
+        stream.pool = std::move(pool);
+
+        std::string handle = GetNextHandle("stream");
+        rnn_stream_storage.emplace(handle, std::move(stream));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::rnn_stream_step
+// ============================================================================
+
+// Parameter structure for rnn_stream_step command
+struct RnnStreamStepArgs {
+    Tcl_Obj* streams = nullptr;      // one stream handle or a list of them
+    Tcl_Obj* input = nullptr;
+
+    bool IsValid() const {
+        return streams != nullptr && input != nullptr;
+    }
+};
+
+// Parse dual syntax: stream input | -stream handles -input tensor
+static RnnStreamStepArgs ParseRnnStreamStepArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    RnnStreamStepArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 3) {
+            throw std::runtime_error("Usage: torch::rnn_stream_step stream input");
+        }
+        args.streams = objv[1];
+        args.input = objv[2];
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-stream" || param == "-streams") {
+                args.streams = objv[i + 1];
+            } else if (param == "-input") {
+                args.input = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -stream, -input");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: stream and input");
+    }
+
+    return args;
+}
+
+// torch::rnn_stream_step - Advance one or more streams of the same layer by
+// the timesteps in input. The sessions of all streams are gathered from the
+// layer's state pool, run in a single forward pass and scattered back.
+int RnnStreamStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        RnnStreamStepArgs args = ParseRnnStreamStepArgs(interp, objc, objv);
+
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, args.streams, &count, &items) != TCL_OK || count == 0) {
+            throw std::runtime_error("Expected a stream handle or a list of stream handles");
+        }
+        std::vector<RnnStream*> streams;
+        std::unordered_set<RnnStream*> seen;
+        int64_t sessions = 0;
+        for (int i = 0; i < count; ++i) {
+            auto it = rnn_stream_storage.find(Tcl_GetString(items[i]));
+            if (it == rnn_stream_storage.end()) {
+                throw std::runtime_error(std::string("Invalid stream: ") + Tcl_GetString(items[i]));
+            }
+            if (!streams.empty() && it->second.pool != streams.front()->pool) {
+                throw std::runtime_error("Streams stepped together must share one layer");
+            }
+            if (!seen.insert(&it->second).second) {
+                throw std::runtime_error(std::string("Stream listed more than once: ") + Tcl_GetString(items[i]));
+            }
+            streams.push_back(&it->second);
+            sessions += it->second.Sessions();
+        }
+        RnnStatePool& pool = *streams.front()->pool;
+        const RecurrentLayerShape& shape = pool.shape;
+
+        torch::Tensor* input = FindTensorFromObj(args.input);
+        if (input == nullptr) {
+            throw std::runtime_error(std::string("Invalid input tensor: ") + Tcl_GetString(args.input));
+        }
+        if (input->dim() != 2 && input->dim() != 3) {
+            throw std::runtime_error("Input must be [batch, features] for one timestep, or a 3-D sequence in the layer's layout");
+        }
+
+        // A 2-D input is a single timestep
+        int64_t time_dim = shape.batchFirst ? 1 : 0;
+        torch::Tensor x = input->dim() == 2 ? input->unsqueeze(time_dim) : *input;
+        int64_t batch = x.size(shape.batchFirst ? 0 : 1);
+        if (batch != sessions) {
+            throw std::runtime_error("Input batch of " + std::to_string(batch) + " does not match the " +
+                                     std::to_string(sessions) + " sessions of the streams");
+        }
+
+        torch::NoGradGuard no_grad;
+        torch::Tensor index;
+        if (streams.size() == 1) {
+            index = streams.front()->index;
+        } else {
+            std::vector<torch::Tensor> indices;
+            for (RnnStream* stream : streams) {
+                indices.push_back(stream->index);
+            }
+            index = torch::cat(indices);
+        }
+
+        torch::Tensor h = pool.h.index_select(1, index);
+        torch::Tensor c = shape.hasCell ? pool.c.index_select(1, index) : torch::Tensor();
+        torch::Tensor output = RecurrentLayerForwardState(pool.model, x, h, c);
+        if (input->dim() == 2) {
+            output = output.squeeze(time_dim);
+        }
+
+        pool.h.index_copy_(1, index, h);
+        if (shape.hasCell) {
+            pool.c.index_copy_(1, index, c);
+        }
+
+        return SetTensorResult(interp, output);
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
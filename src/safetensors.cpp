@@ -0,0 +1,700 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// safetensors layout:
+//   u64 header_size (little-endian) | JSON header | data
+// The header maps each tensor name to {"dtype", "shape", "data_offsets"},
+// where the offsets are relative to the start of the data section, plus an
+// optional "__metadata__" object of string values.
+
+// ============================================================================
+// Minimal JSON reader for the header
+// ============================================================================
+
+struct JsonValue {
+    enum class Kind { Null, Bool, Number, String, Array, Object };
+    Kind kind = Kind::Null;
+    bool boolean = false;
+    double number = 0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::vector<std::pair<std::string, JsonValue>> object;
+
+    const JsonValue* Get(const std::string& key) const {
+        for (const auto& entry : object) {
+            if (entry.first == key) {
+                return &entry.second;
+            }
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    JsonParser(const char* begin, const char* end) : p_(begin), end_(end) {}
+
+    JsonValue ParseDocument() {
+        JsonValue value = ParseValue(0);
+        SkipSpace();
+        if (p_ != end_) {
+            Fail("trailing characters");
+        }
+        return value;
+    }
+
+private:
+    [[noreturn]] void Fail(const std::string& what) {
+        throw std::runtime_error("Malformed safetensors header: " + what);
+    }
+
+    void SkipSpace() {
+        while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r')) {
+            p_++;
+        }
+    }
+
+    void Expect(char c) {
+        SkipSpace();
+        if (p_ == end_ || *p_ != c) {
+            Fail(std::string("expected '") + c + "'");
+        }
+        p_++;
+    }
+
+    bool Consume(const char* word) {
+        size_t len = std::strlen(word);
+        if (static_cast<size_t>(end_ - p_) >= len && std::memcmp(p_, word, len) == 0) {
+            p_ += len;
+            return true;
+        }
+        return false;
+    }
+
+    JsonValue ParseValue(int depth) {
+        if (depth > 16) {
+            Fail("nesting too deep");
+        }
+        SkipSpace();
+        if (p_ == end_) {
+            Fail("unexpected end");
+        }
+
+        JsonValue value;
+        if (*p_ == '{') {
+            value.kind = JsonValue::Kind::Object;
+            p_++;
+            SkipSpace();
+            if (p_ != end_ && *p_ == '}') {
+                p_++;
+                return value;
+            }
+            while (true) {
+                SkipSpace();
+                std::string key = ParseString();
+                Expect(':');
+                value.object.emplace_back(std::move(key), ParseValue(depth + 1));
+                SkipSpace();
+                if (p_ != end_ && *p_ == ',') {
+                    p_++;
+                    continue;
+                }
+                Expect('}');
+                return value;
+            }
+        }
+        if (*p_ == '[') {
+            value.kind = JsonValue::Kind::Array;
+            p_++;
+            SkipSpace();
+            if (p_ != end_ && *p_ == ']') {
+                p_++;
+                return value;
+            }
+            while (true) {
+                value.array.push_back(ParseValue(depth + 1));
+                SkipSpace();
+                if (p_ != end_ && *p_ == ',') {
+                    p_++;
+                    continue;
+                }
+                Expect(']');
+                return value;
+            }
+        }
+        if (*p_ == '"') {
+            value.kind = JsonValue::Kind::String;
+            value.string = ParseString();
+            return value;
+        }
+        if (Consume("true")) {
+            value.kind = JsonValue::Kind::Bool;
+            value.boolean = true;
+            return value;
+        }
+        if (Consume("false")) {
+            value.kind = JsonValue::Kind::Bool;
+            return value;
+        }
+        if (Consume("null")) {
+            return value;
+        }
+
+        // Numbers; the header only holds integers below 2^53
+        char* stop = nullptr;
+        std::string digits(p_, static_cast<size_t>(std::min<ptrdiff_t>(end_ - p_, 32)));
+        value.number = std::strtod(digits.c_str(), &stop);
+        if (stop == digits.c_str()) {
+            Fail("unexpected character");
+        }
+        value.kind = JsonValue::Kind::Number;
+        p_ += stop - digits.c_str();
+        return value;
+    }
+
+    std::string ParseString() {
+        if (p_ == end_ || *p_ != '"') {
+            Fail("expected string");
+        }
+        p_++;
+        std::string out;
+        while (p_ != end_ && *p_ != '"') {
+            char c = *p_++;
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (p_ == end_) {
+                break;
+            }
+            char e = *p_++;
+            switch (e) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u': {
+                    if (end_ - p_ < 4) {
+                        Fail("bad escape");
+                    }
+                    unsigned code = static_cast<unsigned>(std::stoul(std::string(p_, 4), nullptr, 16));
+                    p_ += 4;
+                    // Encode as UTF-8; surrogate pairs are not needed for tensor names
+                    if (code < 0x80) {
+                        out += static_cast<char>(code);
+                    } else if (code < 0x800) {
+                        out += static_cast<char>(0xc0 | (code >> 6));
+                        out += static_cast<char>(0x80 | (code & 0x3f));
+                    } else {
+                        out += static_cast<char>(0xe0 | (code >> 12));
+                        out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                        out += static_cast<char>(0x80 | (code & 0x3f));
+                    }
+                    break;
+                }
+                default: out += e; break;
+            }
+        }
+        if (p_ == end_) {
+            Fail("unterminated string");
+        }
+        p_++;
+        return out;
+    }
+
+    const char* p_;
+    const char* end_;
+};
+
+static std::string JsonQuote(const std::string& text) {
+    std::string out = "\"";
+    for (unsigned char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += static_cast<char>(c);
+        } else if (c < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += static_cast<char>(c);
+        }
+    }
+    return out + "\"";
+}
+
+// ============================================================================
+// Format helpers
+// ============================================================================
+
+static const char* ScalarTypeToSafetensorsDtype(c10::ScalarType dtype) {
+    switch (dtype) {
+        case torch::kFloat64:  return "F64";
+        case torch::kFloat32:  return "F32";
+        case torch::kFloat16:  return "F16";
+        case torch::kBFloat16: return "BF16";
+        case torch::kInt64:    return "I64";
+        case torch::kInt32:    return "I32";
+        case torch::kInt16:    return "I16";
+        case torch::kInt8:     return "I8";
+        case torch::kUInt8:    return "U8";
+        case torch::kBool:     return "BOOL";
+        default:
+            throw std::runtime_error(std::string("Unsupported dtype for safetensors: ") + c10::toString(dtype));
+    }
+}
+
+static c10::ScalarType SafetensorsDtypeToScalarType(const std::string& dtype) {
+    if (dtype == "F64") return torch::kFloat64;
+    if (dtype == "F32") return torch::kFloat32;
+    if (dtype == "F16") return torch::kFloat16;
+    if (dtype == "BF16") return torch::kBFloat16;
+    if (dtype == "I64") return torch::kInt64;
+    if (dtype == "I32") return torch::kInt32;
+    if (dtype == "I16") return torch::kInt16;
+    if (dtype == "I8") return torch::kInt8;
+    if (dtype == "U8") return torch::kUInt8;
+    if (dtype == "BOOL") return torch::kBool;
+    throw std::runtime_error("Unsupported safetensors dtype: " + dtype);
+}
+
+// Parameters and buffers of a module by qualified name, the same names
+// PyTorch's state_dict uses
+static std::map<std::string, torch::Tensor> ModuleStateTensors(const std::shared_ptr<torch::nn::Module>& module) {
+    std::map<std::string, torch::Tensor> tensors;
+    for (const auto& item : module->named_parameters(true)) {
+        tensors[item.key()] = item.value();
+    }
+    for (const auto& item : module->named_buffers(true)) {
+        tensors[item.key()] = item.value();
+    }
+    return tensors;
+}
+
+// A read-only file mapping shared by every tensor bound to it
+struct SafetensorsMapping {
+    void* base = MAP_FAILED;
+    size_t length = 0;
+
+    ~SafetensorsMapping() {
+        if (base != MAP_FAILED) {
+            munmap(base, length);
+        }
+    }
+};
+
+struct SafetensorsEntry {
+    c10::ScalarType dtype;
+    std::vector<int64_t> shape;
+    uint64_t begin = 0;              // absolute file offsets
+    uint64_t end = 0;
+};
+
+// Parse the header of a mapped file into name -> entry, validating offsets
+static std::map<std::string, SafetensorsEntry> ParseSafetensorsHeader(const unsigned char* data, size_t length,
+                                                                       const std::string& path) {
+    if (length < 8) {
+        throw std::runtime_error("Not a safetensors file: \"" + path + "\"");
+    }
+    uint64_t header_size = 0;
+    for (int i = 7; i >= 0; i--) {
+        header_size = (header_size << 8) | data[i];
+    }
+    if (header_size > length - 8 || header_size > (100u << 20)) {
+        throw std::runtime_error("Not a safetensors file: \"" + path + "\"");
+    }
+
+    const char* json = reinterpret_cast<const char*>(data + 8);
+    JsonValue header = JsonParser(json, json + header_size).ParseDocument();
+    if (header.kind != JsonValue::Kind::Object) {
+        throw std::runtime_error("Malformed safetensors header: not an object");
+    }
+
+    uint64_t data_start = 8 + header_size;
+    std::map<std::string, SafetensorsEntry> entries;
+    for (const auto& item : header.object) {
+        if (item.first == "__metadata__") {
+            continue;
+        }
+        const JsonValue* dtype = item.second.Get("dtype");
+        const JsonValue* shape = item.second.Get("shape");
+        const JsonValue* offsets = item.second.Get("data_offsets");
+        if (dtype == nullptr || shape == nullptr || offsets == nullptr ||
+            dtype->kind != JsonValue::Kind::String || shape->kind != JsonValue::Kind::Array ||
+            offsets->kind != JsonValue::Kind::Array || offsets->array.size() != 2) {
+            throw std::runtime_error("Malformed safetensors entry: " + item.first);
+        }
+
+        SafetensorsEntry entry;
+        entry.dtype = SafetensorsDtypeToScalarType(dtype->string);
+        uint64_t numel = 1;
+        for (const auto& dim : shape->array) {
+            if (dim.kind != JsonValue::Kind::Number || dim.number < 0) {
+                throw std::runtime_error("Malformed safetensors shape: " + item.first);
+            }
+            entry.shape.push_back(static_cast<int64_t>(dim.number));
+            numel *= static_cast<uint64_t>(dim.number);
+        }
+        entry.begin = data_start + static_cast<uint64_t>(offsets->array[0].number);
+        entry.end = data_start + static_cast<uint64_t>(offsets->array[1].number);
+        if (entry.end < entry.begin || entry.end > length ||
+            entry.end - entry.begin != numel * c10::elementSize(entry.dtype)) {
+            throw std::runtime_error("Invalid data offsets for safetensors entry: " + item.first);
+        }
+        entries[item.first] = entry;
+    }
+    return entries;
+}
+
+// ============================================================================
+// torch::save_safetensors
+// ============================================================================
+
+// Parameter structure for save_safetensors command
+struct SaveSafetensorsArgs {
+    std::string module;
+    Tcl_Obj* moduleObj = nullptr;
+    std::string filename;
+    std::vector<std::pair<std::string, std::string>> metadata;
+
+    bool IsValid() const {
+        return !module.empty() && !filename.empty();
+    }
+};
+
+// Parse dual syntax: module filename ?metadata? |
+// -module module -filename file ?-metadata dict?
+static SaveSafetensorsArgs ParseSaveSafetensorsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    SaveSafetensorsArgs args;
+
+    auto parse_metadata = [&](Tcl_Obj* obj) {
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, obj, &count, &items) != TCL_OK || count % 2 != 0) {
+            throw std::runtime_error("Metadata must be a dict of strings");
+        }
+        for (int k = 0; k < count; k += 2) {
+            args.metadata.emplace_back(Tcl_GetString(items[k]), Tcl_GetString(items[k + 1]));
+        }
+    };
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 3 || objc > 4) {
+            throw std::runtime_error("Usage: torch::save_safetensors module filename ?metadata?");
+        }
+        args.module = Tcl_GetString(objv[1]);
+        args.moduleObj = objv[1];
+        args.filename = Tcl_GetString(objv[2]);
+        if (objc == 4) {
+            parse_metadata(objv[3]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-module" || param == "-model") {
+                args.module = Tcl_GetString(objv[i + 1]);
+                args.moduleObj = objv[i + 1];
+            } else if (param == "-filename" || param == "-file") {
+                args.filename = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-metadata") {
+                parse_metadata(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -module, -filename, -metadata");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: module and filename");
+    }
+
+    return args;
+}
+
+// torch::save_safetensors - Write a module's parameters and buffers in the
+// safetensors format
+int SaveSafetensors_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        SaveSafetensorsArgs args = ParseSaveSafetensorsArgs(interp, objc, objv);
+
+        ModuleRef* module = FindModuleFromObj(args.moduleObj);
+        if (module == nullptr) {
+            throw std::runtime_error("Invalid module name");
+        }
+
+        std::map<std::string, torch::Tensor> tensors = ModuleStateTensors(*module);
+
+        // Entries are laid out back to back in name order
+        std::string json = "{\"__metadata__\":{\"format\":\"pt\"";
+        for (const auto& entry : args.metadata) {
+            if (entry.first != "format") {
+                json += "," + JsonQuote(entry.first) + ":" + JsonQuote(entry.second);
+            }
+        }
+        json += "}";
+
+        std::vector<torch::Tensor> payload;
+        uint64_t offset = 0;
+        for (auto& item : tensors) {
+            torch::Tensor tensor = item.second.detach();
+            if (!tensor.device().is_cpu()) {
+                tensor = tensor.cpu();
+            }
+            tensor = tensor.contiguous();
+            uint64_t nbytes = static_cast<uint64_t>(tensor.numel()) * tensor.element_size();
+
+            json += "," + JsonQuote(item.first) + ":{\"dtype\":\"" + ScalarTypeToSafetensorsDtype(tensor.scalar_type()) +
+                    "\",\"shape\":[";
+            for (int64_t d = 0; d < tensor.dim(); d++) {
+                json += (d > 0 ? "," : "") + std::to_string(tensor.size(d));
+            }
+            json += "],\"data_offsets\":[" + std::to_string(offset) + "," + std::to_string(offset + nbytes) + "]}";
+
+            offset += nbytes;
+            payload.push_back(tensor);
+        }
+        json += "}";
+        // Pad so the data section starts 8-byte aligned
+        json.append((8 - json.size() % 8) % 8, ' ');
+
+        unsigned char size_bytes[8];
+        uint64_t header_size = json.size();
+        for (int i = 0; i < 8; i++) {
+            size_bytes[i] = static_cast<unsigned char>(header_size >> (8 * i));
+        }
+
+        FILE* file = std::fopen(args.filename.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("Failed to create \"" + args.filename + "\": " + std::strerror(errno));
+        }
+        bool ok = std::fwrite(size_bytes, 1, 8, file) == 8 &&
+                  std::fwrite(json.data(), 1, json.size(), file) == json.size();
+        for (size_t i = 0; ok && i < payload.size(); i++) {
+            size_t nbytes = static_cast<size_t>(payload[i].numel()) * payload[i].element_size();
+            ok = nbytes == 0 || std::fwrite(payload[i].data_ptr(), 1, nbytes, file) == nbytes;
+        }
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok) {
+            throw std::runtime_error("Failed to write \"" + args.filename + "\"");
+        }
+
+        Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::load_safetensors
+// ============================================================================
+
+// Parameter structure for load_safetensors command
+struct LoadSafetensorsArgs {
+    std::string module;
+    Tcl_Obj* moduleObj = nullptr;
+    std::string filename;
+    std::vector<std::string> keys;   // empty means every tensor in the file
+    bool strict = true;
+    std::string mode = "mmap";
+
+    bool IsValid() const {
+        return !module.empty() && !filename.empty() && (mode == "mmap" || mode == "copy");
+    }
+};
+
+// Parse dual syntax: module filename ?keys? |
+// -module module -filename file ?-keys list? ?-strict bool? ?-mode mmap|copy?
+static LoadSafetensorsArgs ParseLoadSafetensorsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    LoadSafetensorsArgs args;
+
+    auto parse_keys = [&](Tcl_Obj* obj) {
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, obj, &count, &items) != TCL_OK) {
+            throw std::runtime_error("Invalid keys list");
+        }
+        for (int k = 0; k < count; k++) {
+            args.keys.push_back(Tcl_GetString(items[k]));
+        }
+    };
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 3 || objc > 4) {
+            throw std::runtime_error("Usage: torch::load_safetensors module filename ?keys?");
+        }
+        args.module = Tcl_GetString(objv[1]);
+        args.moduleObj = objv[1];
+        args.filename = Tcl_GetString(objv[2]);
+        if (objc == 4) {
+            parse_keys(objv[3]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-module" || param == "-model") {
+                args.module = Tcl_GetString(objv[i + 1]);
+                args.moduleObj = objv[i + 1];
+            } else if (param == "-filename" || param == "-file") {
+                args.filename = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-keys") {
+                parse_keys(objv[i + 1]);
+            } else if (param == "-strict") {
+                args.strict = GetBoolFromObj(interp, objv[i + 1]);
+            } else if (param == "-mode") {
+                args.mode = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -module, -filename, -keys, -strict, -mode");
+            }
+        }
+    }
+
+    if (args.module.empty() || args.filename.empty()) {
+        throw std::runtime_error("Required parameters missing: module and filename");
+    }
+    if (!args.IsValid()) {
+        throw std::runtime_error("Invalid mode: " + args.mode + ". Valid modes are: mmap, copy");
+    }
+
+    return args;
+}
+
+// torch::load_safetensors - Bind tensors from a safetensors file to a
+// module's parameters and buffers. Returns the names that were loaded.
+//
+// The file is mapped private (copy-on-write). In mmap mode a CPU parameter of
+// matching dtype is rebound to a view of the mapping, so nothing is read until
+// the values are used and a page is only copied if it is written, e.g. by an
+// optimizer step. Anything else (other device or dtype, unaligned data, or
+// -mode copy) is copied from the mapping. Only the selected entries are ever
+// touched.
+int LoadSafetensors_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        LoadSafetensorsArgs args = ParseLoadSafetensorsArgs(interp, objc, objv);
+
+        ModuleRef* module = FindModuleFromObj(args.moduleObj);
+        if (module == nullptr) {
+            throw std::runtime_error("Invalid module name");
+        }
+
+        auto mapping = std::make_shared<SafetensorsMapping>();
+        {
+            int fd = open(args.filename.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("Failed to open \"" + args.filename + "\": " + std::strerror(errno));
+            }
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size < 8) {
+                close(fd);
+                throw std::runtime_error("Not a safetensors file: \"" + args.filename + "\"");
+            }
+            mapping->length = static_cast<size_t>(st.st_size);
+            mapping->base = mmap(nullptr, mapping->length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (mapping->base == MAP_FAILED) {
+                throw std::runtime_error("Failed to map \"" + args.filename + "\": " + std::strerror(errno));
+            }
+        }
+        const unsigned char* data = static_cast<const unsigned char*>(mapping->base);
+
+        std::map<std::string, SafetensorsEntry> entries = ParseSafetensorsHeader(data, mapping->length, args.filename);
+        std::map<std::string, torch::Tensor> targets = ModuleStateTensors(*module);
+
+        std::vector<std::string> names = args.keys;
+        if (names.empty()) {
+            for (const auto& entry : entries) {
+                names.push_back(entry.first);
+            }
+            if (args.strict) {
+                for (const auto& target : targets) {
+                    if (entries.find(target.first) == entries.end()) {
+                        throw std::runtime_error("Missing tensor in \"" + args.filename + "\": " + target.first);
+                    }
+                }
+            }
+        }
+
+        // Validate everything before modifying the module
+        std::vector<std::string> loaded;
+        for (const auto& name : names) {
+            auto entry = entries.find(name);
+            if (entry == entries.end()) {
+                throw std::runtime_error("No tensor named \"" + name + "\" in \"" + args.filename + "\"");
+            }
+            auto target = targets.find(name);
+            if (target == targets.end()) {
+                if (args.strict) {
+                    throw std::runtime_error("Unexpected tensor in \"" + args.filename + "\": " + name);
+                }
+                continue;
+            }
+            if (target->second.sizes().vec() != entry->second.shape) {
+                throw std::runtime_error("Shape mismatch for " + name);
+            }
+            loaded.push_back(name);
+        }
+
+        torch::NoGradGuard no_grad;
+        for (const auto& name : loaded) {
+            const SafetensorsEntry& entry = entries[name];
+            torch::Tensor& target = targets[name];
+            void* src = static_cast<char*>(mapping->base) + entry.begin;
+
+            bool aligned = entry.begin % c10::elementSize(entry.dtype) == 0;
+            bool bind = args.mode == "mmap" && aligned && target.device().is_cpu() &&
+                        target.scalar_type() == entry.dtype && entry.end > entry.begin;
+
+            torch::Tensor view;
+            if (aligned) {
+                // Each view holds a reference to the mapping
+                view = torch::from_blob(src, entry.shape, [mapping](void*) {},
+                                        torch::TensorOptions().dtype(entry.dtype));
+            } else {
+                view = torch::empty(entry.shape, torch::TensorOptions().dtype(entry.dtype));
+                std::memcpy(view.data_ptr(), src, entry.end - entry.begin);
+            }
+
+            if (bind) {
+                target.set_data(view);
+            } else {
+                target.copy_(view);
+            }
+        }
+
+        Tcl_Obj* result = Tcl_NewListObj(0, nullptr);
+        for (const auto& name : loaded) {
+            Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj(name.c_str(), -1));
+        }
+        Tcl_SetObjResult(interp, result);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
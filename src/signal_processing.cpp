@@ -3,6 +3,7 @@
 // Parameter structure for tensor_fft
 typedef struct {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int dim = -1; // -1 means use default (last dimension)
     bool hasDim = false;
     
@@ -20,6 +21,7 @@ static TensorFFTArgs ParseTensorFFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* c
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -39,6 +41,7 @@ static TensorFFTArgs ParseTensorFFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* c
             
             if (param == "-tensor" || param == "-input") {
                 args.tensor = value;
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim parameter");
@@ -66,12 +69,13 @@ int TensorFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
     try {
         TensorFFTArgs args = ParseTensorFFTArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         torch::Tensor result;
         
         if (args.hasDim) {
@@ -81,10 +85,9 @@ int TensorFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
             result = torch::fft::fft(tensor);
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -94,6 +97,7 @@ int TensorFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[
 
 typedef struct {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int dim = -1; // -1 means use default (last dimension)
     bool hasDim = false;
     
@@ -111,6 +115,7 @@ static TensorIFFTArgs ParseTensorIFFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -130,6 +135,7 @@ static TensorIFFTArgs ParseTensorIFFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-tensor") {
                 args.tensor = value;
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim parameter");
@@ -157,12 +163,13 @@ int TensorIFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         TensorIFFTArgs args = ParseTensorIFFTArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         torch::Tensor result;
         
         if (args.hasDim) {
@@ -172,10 +179,9 @@ int TensorIFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             result = torch::fft::ifft(tensor);
         }
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -185,6 +191,7 @@ int TensorIFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 
 typedef struct {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::vector<int64_t> dims;
     bool hasDims = false;
     bool IsValid() const { return !tensor.empty(); }
@@ -199,6 +206,7 @@ static TensorFFT2DArgs ParseTensorFFT2DArgs(Tcl_Interp* interp, int objc, Tcl_Ob
             throw std::runtime_error("Invalid number of arguments");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         if (objc == 3) {
             args.dims = TclListToShape(interp, objv[2]);
             if (args.dims.size() != 2) {
@@ -215,6 +223,7 @@ static TensorFFT2DArgs ParseTensorFFT2DArgs(Tcl_Interp* interp, int objc, Tcl_Ob
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dims") {
                 args.dims = TclListToShape(interp, objv[i + 1]);
                 if (args.dims.size() != 2) {
@@ -239,11 +248,12 @@ int TensorFFT2D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     }
     try {
         TensorFFT2DArgs args = ParseTensorFFT2DArgs(interp, objc, objv);
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         torch::Tensor result;
         if (args.hasDims) {
             result = torch::fft::fft2(tensor, c10::nullopt, args.dims);
@@ -251,9 +261,8 @@ int TensorFFT2D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
             // Default to last two dimensions
             result = torch::fft::fft2(tensor);
         }
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        std::string result_handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -263,6 +272,7 @@ int TensorFFT2D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 
 typedef struct {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     std::vector<int64_t> dims;
     bool hasDims = false;
     bool IsValid() const { return !tensor.empty(); }
@@ -277,6 +287,7 @@ static TensorIFFT2DArgs ParseTensorIFFT2DArgs(Tcl_Interp* interp, int objc, Tcl_
             throw std::runtime_error("Invalid number of arguments");
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         if (objc == 3) {
             args.dims = TclListToShape(interp, objv[2]);
             if (args.dims.size() != 2) {
@@ -293,6 +304,7 @@ static TensorIFFT2DArgs ParseTensorIFFT2DArgs(Tcl_Interp* interp, int objc, Tcl_
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-dims") {
                 args.dims = TclListToShape(interp, objv[i + 1]);
                 if (args.dims.size() != 2) {
@@ -317,11 +329,12 @@ int TensorIFFT2D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     }
     try {
         TensorIFFT2DArgs args = ParseTensorIFFT2DArgs(interp, objc, objv);
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         torch::Tensor result;
         if (args.hasDims) {
             result = torch::fft::ifft2(tensor, c10::nullopt, args.dims);
@@ -329,9 +342,8 @@ int TensorIFFT2D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             // Default to last two dimensions
             result = torch::fft::ifft2(tensor);
         }
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        std::string result_handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -362,19 +374,20 @@ static TensorConv1dArgs ParseTensorConv1dArgs(Tcl_Interp* interp, int objc, Tcl_
             Tcl_WrongNumArgs(interp, 1, objv, "input weight ?bias? ?stride? ?padding? ?dilation? ?groups?");
             throw std::runtime_error("Invalid number of arguments");
         }
-        std::string inName = Tcl_GetString(objv[1]);
-        std::string wName  = Tcl_GetString(objv[2]);
-        if (tensor_storage.find(inName) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-        if (tensor_storage.find(wName) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-        args.input  = tensor_storage[inName];
-        args.weight = tensor_storage[wName];
+        torch::Tensor* input = FindTensorFromObj(objv[1]);
+        torch::Tensor* weight = FindTensorFromObj(objv[2]);
+        if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+        if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+        args.input  = *input;
+        args.weight = *weight;
 
         int index = 3;
         if (objc > index) {
             std::string biasName = Tcl_GetString(objv[index]);
             if (biasName != "none" && !biasName.empty()) {
-                if (tensor_storage.find(biasName) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                args.bias = tensor_storage[biasName];
+                torch::Tensor* bias = FindTensorFromObj(objv[index]);
+                if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                args.bias = *bias;
                 args.hasBias = true;
             }
             ++index;
@@ -390,18 +403,19 @@ static TensorConv1dArgs ParseTensorConv1dArgs(Tcl_Interp* interp, int objc, Tcl_
             std::string param = Tcl_GetString(objv[i]);
             Tcl_Obj* valObj = objv[i+1];
             if (param == "-input") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-                args.input = tensor_storage[name];
+                torch::Tensor* input = FindTensorFromObj(valObj);
+                if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+                args.input = *input;
             } else if (param == "-weight") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-                args.weight = tensor_storage[name];
+                torch::Tensor* weight = FindTensorFromObj(valObj);
+                if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+                args.weight = *weight;
             } else if (param == "-bias") {
                 std::string name = Tcl_GetString(valObj);
                 if (name != "none" && !name.empty()) {
-                    if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                    args.bias = tensor_storage[name];
+                    torch::Tensor* bias = FindTensorFromObj(valObj);
+                    if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                    args.bias = *bias;
                     args.hasBias = true;
                 }
             } else if (param == "-stride") {
@@ -431,9 +445,8 @@ int TensorConv1D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         else
             result = torch::conv1d(args.input, args.weight, torch::Tensor(), args.stride, args.padding, args.dilation, args.groups);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -465,19 +478,20 @@ static TensorConvTranspose1dArgs ParseTensorConvTranspose1dArgs(Tcl_Interp* inte
             Tcl_WrongNumArgs(interp, 1, objv, "input weight ?bias? ?stride? ?padding? ?output_padding? ?groups? ?dilation?");
             throw std::runtime_error("Invalid number of arguments");
         }
-        std::string inName = Tcl_GetString(objv[1]);
-        std::string wName  = Tcl_GetString(objv[2]);
-        if (tensor_storage.find(inName) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-        if (tensor_storage.find(wName) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-        args.input  = tensor_storage[inName];
-        args.weight = tensor_storage[wName];
+        torch::Tensor* input = FindTensorFromObj(objv[1]);
+        torch::Tensor* weight = FindTensorFromObj(objv[2]);
+        if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+        if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+        args.input  = *input;
+        args.weight = *weight;
 
         int index = 3;
         if (objc > index) {
             std::string biasName = Tcl_GetString(objv[index]);
             if (biasName != "none" && !biasName.empty()) {
-                if (tensor_storage.find(biasName) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                args.bias = tensor_storage[biasName];
+                torch::Tensor* bias = FindTensorFromObj(objv[index]);
+                if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                args.bias = *bias;
                 args.hasBias = true;
             }
             ++index;
@@ -494,18 +508,19 @@ static TensorConvTranspose1dArgs ParseTensorConvTranspose1dArgs(Tcl_Interp* inte
             std::string param = Tcl_GetString(objv[i]);
             Tcl_Obj* valObj = objv[i+1];
             if (param == "-input") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-                args.input = tensor_storage[name];
+                torch::Tensor* input = FindTensorFromObj(valObj);
+                if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+                args.input = *input;
             } else if (param == "-weight") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-                args.weight = tensor_storage[name];
+                torch::Tensor* weight = FindTensorFromObj(valObj);
+                if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+                args.weight = *weight;
             } else if (param == "-bias") {
                 std::string name = Tcl_GetString(valObj);
                 if (name != "none" && !name.empty()) {
-                    if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                    args.bias = tensor_storage[name];
+                    torch::Tensor* bias = FindTensorFromObj(valObj);
+                    if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                    args.bias = *bias;
                     args.hasBias = true;
                 }
             } else if (param == "-stride") {
@@ -537,9 +552,8 @@ int TensorConvTranspose1D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         else
             result = torch::conv_transpose1d(args.input, args.weight, torch::Tensor(), args.stride, args.padding, args.output_padding, args.groups, args.dilation);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -602,19 +616,20 @@ static TensorConvTranspose2dArgs ParseTensorConvTranspose2dArgs(Tcl_Interp* inte
             Tcl_WrongNumArgs(interp, 1, objv, "input weight ?bias? ?stride? ?padding? ?output_padding? ?groups? ?dilation?");
             throw std::runtime_error("Invalid number of arguments");
         }
-        std::string inName = Tcl_GetString(objv[1]);
-        std::string wName  = Tcl_GetString(objv[2]);
-        if (tensor_storage.find(inName) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-        if (tensor_storage.find(wName) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-        args.input  = tensor_storage[inName];
-        args.weight = tensor_storage[wName];
+        torch::Tensor* input = FindTensorFromObj(objv[1]);
+        torch::Tensor* weight = FindTensorFromObj(objv[2]);
+        if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+        if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+        args.input  = *input;
+        args.weight = *weight;
 
         int index = 3;
         if (objc > index) {
             std::string biasName = Tcl_GetString(objv[index]);
             if (biasName != "none" && !biasName.empty()) {
-                if (tensor_storage.find(biasName) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                args.bias = tensor_storage[biasName];
+                torch::Tensor* bias = FindTensorFromObj(objv[index]);
+                if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                args.bias = *bias;
                 args.hasBias = true;
             }
             ++index;
@@ -631,18 +646,19 @@ static TensorConvTranspose2dArgs ParseTensorConvTranspose2dArgs(Tcl_Interp* inte
             std::string param = Tcl_GetString(objv[i]);
             Tcl_Obj* valObj = objv[i+1];
             if (param == "-input") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid input tensor name");
-                args.input = tensor_storage[name];
+                torch::Tensor* input = FindTensorFromObj(valObj);
+                if (input == nullptr) throw std::runtime_error("Invalid input tensor name");
+                args.input = *input;
             } else if (param == "-weight") {
-                std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid weight tensor name");
-                args.weight = tensor_storage[name];
+                torch::Tensor* weight = FindTensorFromObj(valObj);
+                if (weight == nullptr) throw std::runtime_error("Invalid weight tensor name");
+                args.weight = *weight;
             } else if (param == "-bias") {
                 std::string name = Tcl_GetString(valObj);
                 if (name != "none" && !name.empty()) {
-                    if (tensor_storage.find(name) == tensor_storage.end()) throw std::runtime_error("Invalid bias tensor name");
-                    args.bias = tensor_storage[name];
+                    torch::Tensor* bias = FindTensorFromObj(valObj);
+                    if (bias == nullptr) throw std::runtime_error("Invalid bias tensor name");
+                    args.bias = *bias;
                     args.hasBias = true;
                 }
             } else if (param == "-stride") {
@@ -674,9 +690,8 @@ int TensorConvTranspose2D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         else
             result = torch::conv_transpose2d(args.input, args.weight, torch::Tensor(), args.stride, args.padding, args.output_padding, args.groups, args.dilation);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(result);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -691,6 +706,7 @@ int TensorConvTranspose2D_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for tensor_rfft command
 struct TensorRFFTArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     c10::optional<int64_t> n = c10::nullopt;
     int64_t dim = -1;  // Default to last dimension
     bool has_n = false;
@@ -713,6 +729,7 @@ TensorRFFTArgs ParseTensorRFFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc >= 3) {
             int n_val;
@@ -743,6 +760,7 @@ TensorRFFTArgs ParseTensorRFFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-n") {
                 int n_val;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &n_val) != TCL_OK) {
@@ -774,20 +792,20 @@ int TensorRFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         TensorRFFTArgs args = ParseTensorRFFTArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         torch::Tensor result;
         
         result = torch::fft::rfft(tensor, args.n, args.dim);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -797,6 +815,7 @@ int TensorRFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 
 typedef struct {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     c10::optional<int64_t> n = c10::nullopt;
     int64_t dim = -1;  // Default to last dimension
     bool hasN = false;
@@ -816,6 +835,7 @@ static TensorIRFFTArgs ParseTensorIRFFTArgs(Tcl_Interp* interp, int objc, Tcl_Ob
         }
         
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         
         if (objc >= 3) {
             int n_val;
@@ -846,6 +866,7 @@ static TensorIRFFTArgs ParseTensorIRFFTArgs(Tcl_Interp* interp, int objc, Tcl_Ob
             
             if (param == "-tensor" || param == "-input") {
                 args.tensor = value;
+                args.tensorObj = objv[i + 1];
             } else if (param == "-n") {
                 int n_val;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &n_val) != TCL_OK) {
@@ -877,20 +898,20 @@ int TensorIRFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorIRFFTArgs args = ParseTensorIRFFTArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.tensor];
+        auto& tensor = *tensor_ptr;
         torch::Tensor result;
         
         result = torch::fft::irfft(tensor, args.n, args.dim);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -905,6 +926,7 @@ int TensorIRFFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for tensor_stft command
 struct TensorSTFTArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int n_fft;
     c10::optional<int64_t> hop_length = c10::nullopt;
     c10::optional<int64_t> win_length = c10::nullopt;
@@ -930,6 +952,7 @@ TensorSTFTArgs ParseTensorSTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.n_fft) != TCL_OK) {
             throw std::runtime_error("Invalid n_fft value");
@@ -954,9 +977,9 @@ TensorSTFTArgs ParseTensorSTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         if (objc >= 6) {
-            std::string window_name = Tcl_GetString(objv[5]);
-            if (tensor_storage.find(window_name) != tensor_storage.end()) {
-                args.window = tensor_storage[window_name];
+            torch::Tensor* window = FindTensorFromObj(objv[5]);
+            if (window != nullptr) {
+                args.window = *window;
                 args.has_window = true;
             }
         }
@@ -972,6 +995,7 @@ TensorSTFTArgs ParseTensorSTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-n_fft" || param == "-nfft") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.n_fft) != TCL_OK) {
                     throw std::runtime_error("Invalid n_fft value");
@@ -991,8 +1015,9 @@ TensorSTFTArgs ParseTensorSTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
                 args.win_length = win_val;
                 args.has_win_length = true;
             } else if (param == "-window") {
-                if (tensor_storage.find(value) != tensor_storage.end()) {
-                    args.window = tensor_storage[value];
+                torch::Tensor* window = FindTensorFromObj(objv[i + 1]);
+                if (window != nullptr) {
+                    args.window = *window;
                     args.has_window = true;
                 }
             } else {
@@ -1012,12 +1037,13 @@ int TensorSTFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         TensorSTFTArgs args = ParseTensorSTFTArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Create Hann window if no window provided
         if (!args.has_window && args.has_win_length) {
@@ -1031,10 +1057,9 @@ int TensorSTFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
                                   true, // onesided
                                   true); // return_complex
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1045,6 +1070,7 @@ int TensorSTFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for tensor_istft command
 struct TensorISTFTArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int n_fft;
     c10::optional<int64_t> hop_length = c10::nullopt;
     c10::optional<int64_t> win_length = c10::nullopt;
@@ -1071,6 +1097,7 @@ TensorISTFTArgs ParseTensorISTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.n_fft) != TCL_OK) {
             throw std::runtime_error("Invalid n_fft value");
@@ -1093,9 +1120,9 @@ TensorISTFTArgs ParseTensorISTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         if (objc >= 6) {
-            std::string window_name = Tcl_GetString(objv[5]);
-            if (tensor_storage.find(window_name) != tensor_storage.end()) {
-                args.window = tensor_storage[window_name];
+            torch::Tensor* window = FindTensorFromObj(objv[5]);
+            if (window != nullptr) {
+                args.window = *window;
             }
         }
     } else {
@@ -1110,6 +1137,7 @@ TensorISTFTArgs ParseTensorISTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-n_fft" || param == "-nfft") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.n_fft) != TCL_OK) {
                     throw std::runtime_error("Invalid n_fft value");
@@ -1127,8 +1155,9 @@ TensorISTFTArgs ParseTensorISTFTArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
                 }
                 args.win_length = win_val;
             } else if (param == "-window") {
-                if (tensor_storage.find(value) != tensor_storage.end()) {
-                    args.window = tensor_storage[value];
+                torch::Tensor* window = FindTensorFromObj(objv[i + 1]);
+                if (window != nullptr) {
+                    args.window = *window;
                 }
             } else if (param == "-center") {
                 if (value == "true" || value == "1") {
@@ -1177,12 +1206,13 @@ int TensorISTFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         TensorISTFTArgs args = ParseTensorISTFTArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Create Hann window if no window provided
         if (!args.window.has_value() && args.win_length.has_value()) {
@@ -1194,10 +1224,9 @@ int TensorISTFT_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
         auto result = torch::istft(tensor, args.n_fft, args.hop_length, args.win_length, args.window,
                                    args.center, args.normalized, args.onesided, args.length);
         
-        std::string result_handle = GetNextHandle("tensor");
-        tensor_storage[result_handle] = result;
+        std::string result_handle = StoreTensor(result);
         
-        Tcl_SetResult(interp, const_cast<char*>(result_handle.c_str()), TCL_VOLATILE);
+        Tcl_SetObjResult(interp, NewHandleObj(result_handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -8,6 +8,8 @@
 struct SparseCOOArgs {
     std::string indices;
     std::string values;
+    Tcl_Obj* indicesObj = nullptr;
+    Tcl_Obj* valuesObj = nullptr;
     std::vector<int64_t> size;
     std::string dtype;
     std::string device;
@@ -32,7 +34,9 @@ SparseCOOArgs ParseSparseCOOArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("");  // Empty message since Tcl_WrongNumArgs already set the error
         }
         args.indices = Tcl_GetString(objv[1]);
+        args.indicesObj = objv[1];
         args.values = Tcl_GetString(objv[2]);
+        args.valuesObj = objv[2];
         args.size = TclListToShape(interp, objv[3]);
         
         if (objc >= 5) {
@@ -59,8 +63,10 @@ SparseCOOArgs ParseSparseCOOArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-indices") {
                 args.indices = Tcl_GetString(objv[i + 1]);
+                args.indicesObj = objv[i + 1];
             } else if (param == "-values") {
                 args.values = Tcl_GetString(objv[i + 1]);
+                args.valuesObj = objv[i + 1];
             } else if (param == "-size") {
                 args.size = TclListToShape(interp, objv[i + 1]);
             } else if (param == "-dtype") {
@@ -93,17 +99,19 @@ int TensorSparseCOO_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         SparseCOOArgs args = ParseSparseCOOArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.indices) == tensor_storage.end()) {
+        torch::Tensor* indices_tensor = FindTensorFromObj(args.indicesObj);
+        if (indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.values) == tensor_storage.end()) {
+        torch::Tensor* values_tensor = FindTensorFromObj(args.valuesObj);
+        if (values_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid values tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto indices = tensor_storage[args.indices];
-        auto values = tensor_storage[args.values];
+        auto indices = *indices_tensor;
+        auto values = *values_tensor;
         
         c10::ScalarType dtype = torch::kFloat32;
         if (!args.dtype.empty()) {
@@ -127,9 +135,8 @@ int TensorSparseCOO_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         auto options = torch::TensorOptions().dtype(dtype).device(device).requires_grad(args.requires_grad);
         auto output = torch::sparse_coo_tensor(indices, values, args.size, options);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         if (strlen(e.what()) > 0) {
@@ -144,6 +151,9 @@ struct SparseCSRArgs {
     std::string crow_indices;
     std::string col_indices;
     std::string values;
+    Tcl_Obj* crow_indicesObj = nullptr;
+    Tcl_Obj* col_indicesObj = nullptr;
+    Tcl_Obj* valuesObj = nullptr;
     std::vector<int64_t> size;
     std::string dtype;
     std::string device;
@@ -168,8 +178,11 @@ SparseCSRArgs ParseSparseCSRArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("");  // Empty message since Tcl_WrongNumArgs already set the error
         }
         args.crow_indices = Tcl_GetString(objv[1]);
+        args.crow_indicesObj = objv[1];
         args.col_indices = Tcl_GetString(objv[2]);
+        args.col_indicesObj = objv[2];
         args.values = Tcl_GetString(objv[3]);
+        args.valuesObj = objv[3];
         args.size = TclListToShape(interp, objv[4]);
         
         if (objc >= 6) {
@@ -196,10 +209,13 @@ SparseCSRArgs ParseSparseCSRArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-crow_indices") {
                 args.crow_indices = Tcl_GetString(objv[i + 1]);
+                args.crow_indicesObj = objv[i + 1];
             } else if (param == "-col_indices") {
                 args.col_indices = Tcl_GetString(objv[i + 1]);
+                args.col_indicesObj = objv[i + 1];
             } else if (param == "-values") {
                 args.values = Tcl_GetString(objv[i + 1]);
+                args.valuesObj = objv[i + 1];
             } else if (param == "-size") {
                 args.size = TclListToShape(interp, objv[i + 1]);
             } else if (param == "-dtype") {
@@ -232,22 +248,25 @@ int TensorSparseCSR_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         SparseCSRArgs args = ParseSparseCSRArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.crow_indices) == tensor_storage.end()) {
+        torch::Tensor* crow_indices_tensor = FindTensorFromObj(args.crow_indicesObj);
+        if (crow_indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid crow_indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.col_indices) == tensor_storage.end()) {
+        torch::Tensor* col_indices_tensor = FindTensorFromObj(args.col_indicesObj);
+        if (col_indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid col_indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.values) == tensor_storage.end()) {
+        torch::Tensor* values_tensor = FindTensorFromObj(args.valuesObj);
+        if (values_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid values tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto crow_indices = tensor_storage[args.crow_indices];
-        auto col_indices = tensor_storage[args.col_indices];
-        auto values = tensor_storage[args.values];
+        auto crow_indices = *crow_indices_tensor;
+        auto col_indices = *col_indices_tensor;
+        auto values = *values_tensor;
         
         c10::ScalarType dtype = torch::kFloat32;
         if (!args.dtype.empty()) {
@@ -271,9 +290,8 @@ int TensorSparseCSR_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         auto options = torch::TensorOptions().dtype(dtype).device(device).requires_grad(args.requires_grad);
         auto output = torch::sparse_csr_tensor(crow_indices, col_indices, values, args.size, options);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -286,6 +304,9 @@ struct SparseCSCArgs {
     std::string ccol_indices;
     std::string row_indices;
     std::string values;
+    Tcl_Obj* ccol_indicesObj = nullptr;
+    Tcl_Obj* row_indicesObj = nullptr;
+    Tcl_Obj* valuesObj = nullptr;
     std::vector<int64_t> size;
     std::string dtype;
     std::string device;
@@ -310,8 +331,11 @@ SparseCSCArgs ParseSparseCSCArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("");  // Empty message since Tcl_WrongNumArgs already set the error
         }
         args.ccol_indices = Tcl_GetString(objv[1]);
+        args.ccol_indicesObj = objv[1];
         args.row_indices = Tcl_GetString(objv[2]);
+        args.row_indicesObj = objv[2];
         args.values = Tcl_GetString(objv[3]);
+        args.valuesObj = objv[3];
         args.size = TclListToShape(interp, objv[4]);
         
         if (objc >= 6) {
@@ -338,10 +362,13 @@ SparseCSCArgs ParseSparseCSCArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-ccol_indices") {
                 args.ccol_indices = Tcl_GetString(objv[i + 1]);
+                args.ccol_indicesObj = objv[i + 1];
             } else if (param == "-row_indices") {
                 args.row_indices = Tcl_GetString(objv[i + 1]);
+                args.row_indicesObj = objv[i + 1];
             } else if (param == "-values") {
                 args.values = Tcl_GetString(objv[i + 1]);
+                args.valuesObj = objv[i + 1];
             } else if (param == "-size") {
                 args.size = TclListToShape(interp, objv[i + 1]);
             } else if (param == "-dtype") {
@@ -374,22 +401,25 @@ int TensorSparseCSC_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         SparseCSCArgs args = ParseSparseCSCArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.ccol_indices) == tensor_storage.end()) {
+        torch::Tensor* ccol_indices_tensor = FindTensorFromObj(args.ccol_indicesObj);
+        if (ccol_indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid ccol_indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.row_indices) == tensor_storage.end()) {
+        torch::Tensor* row_indices_tensor = FindTensorFromObj(args.row_indicesObj);
+        if (row_indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid row_indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.values) == tensor_storage.end()) {
+        torch::Tensor* values_tensor = FindTensorFromObj(args.valuesObj);
+        if (values_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid values tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto ccol_indices = tensor_storage[args.ccol_indices];
-        auto row_indices = tensor_storage[args.row_indices];
-        auto values = tensor_storage[args.values];
+        auto ccol_indices = *ccol_indices_tensor;
+        auto row_indices = *row_indices_tensor;
+        auto values = *values_tensor;
         
         c10::ScalarType dtype = torch::kFloat32;
         if (!args.dtype.empty()) {
@@ -408,9 +438,8 @@ int TensorSparseCSC_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
         auto options = torch::TensorOptions().dtype(dtype).device(device).requires_grad(args.requires_grad);
         auto output = torch::sparse_csc_tensor(ccol_indices, row_indices, values, args.size, options);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -421,6 +450,7 @@ int TensorSparseCSC_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 // Parameter structure for sparse_tensor_dense
 struct SparseTensorDenseArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -440,6 +470,7 @@ SparseTensorDenseArgs ParseSparseTensorDenseArgs(Tcl_Interp* interp, int objc, T
             throw std::runtime_error("Usage: torch::sparse_to_dense sparse_tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -451,6 +482,7 @@ SparseTensorDenseArgs ParseSparseTensorDenseArgs(Tcl_Interp* interp, int objc, T
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -476,17 +508,17 @@ int TensorSparseToDense_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
     try {
         SparseTensorDenseArgs args = ParseSparseTensorDenseArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = input.to_dense();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -498,6 +530,8 @@ int TensorSparseToDense_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
 struct SparseAddArgs {
     std::string tensor1;
     std::string tensor2;
+    Tcl_Obj* tensor1Obj = nullptr;
+    Tcl_Obj* tensor2Obj = nullptr;
     double alpha = 1.0;  // Default alpha value
     
     bool IsValid() const {
@@ -518,7 +552,9 @@ SparseAddArgs ParseSparseAddArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("Usage: torch::sparse_add tensor1 tensor2 ?alpha?");
         }
         args.tensor1 = Tcl_GetString(objv[1]);
+        args.tensor1Obj = objv[1];
         args.tensor2 = Tcl_GetString(objv[2]);
+        args.tensor2Obj = objv[2];
         
         if (objc > 3) {
             if (Tcl_GetDoubleFromObj(interp, objv[3], &args.alpha) != TCL_OK) {
@@ -536,8 +572,10 @@ SparseAddArgs ParseSparseAddArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-tensor1") {
                 args.tensor1 = Tcl_GetString(objv[i + 1]);
+                args.tensor1Obj = objv[i + 1];
             } else if (param == "-tensor2") {
                 args.tensor2 = Tcl_GetString(objv[i + 1]);
+                args.tensor2Obj = objv[i + 1];
             } else if (param == "-alpha") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.alpha) != TCL_OK) {
                     throw std::runtime_error("Invalid alpha value");
@@ -567,23 +605,24 @@ int TensorSparseAdd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         SparseAddArgs args = ParseSparseAddArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor1) == tensor_storage.end()) {
+        torch::Tensor* tensor1_tensor = FindTensorFromObj(args.tensor1Obj);
+        if (tensor1_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor1"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.tensor2) == tensor_storage.end()) {
+        torch::Tensor* tensor2_tensor = FindTensorFromObj(args.tensor2Obj);
+        if (tensor2_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor2"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto tensor1 = tensor_storage[args.tensor1];
-        auto tensor2 = tensor_storage[args.tensor2];
+        auto tensor1 = *tensor1_tensor;
+        auto tensor2 = *tensor2_tensor;
 
         auto output = torch::add(tensor1, tensor2, args.alpha);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -595,6 +634,8 @@ int TensorSparseAdd_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 struct SparseMMArgs {
     std::string sparse_tensor;
     std::string dense_tensor;
+    Tcl_Obj* sparse_tensorObj = nullptr;
+    Tcl_Obj* dense_tensorObj = nullptr;
     
     bool IsValid() const {
         return !sparse_tensor.empty() && !dense_tensor.empty();
@@ -615,7 +656,9 @@ SparseMMArgs ParseSparseMMArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             throw std::runtime_error("");  // Empty message since Tcl_WrongNumArgs already set the error
         }
         args.sparse_tensor = Tcl_GetString(objv[1]);
+        args.sparse_tensorObj = objv[1];
         args.dense_tensor = Tcl_GetString(objv[2]);
+        args.dense_tensorObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -627,8 +670,10 @@ SparseMMArgs ParseSparseMMArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-sparse_tensor") {
                 args.sparse_tensor = Tcl_GetString(objv[i + 1]);
+                args.sparse_tensorObj = objv[i + 1];
             } else if (param == "-dense_tensor") {
                 args.dense_tensor = Tcl_GetString(objv[i + 1]);
+                args.dense_tensorObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -654,23 +699,24 @@ int TensorSparseMM_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_
     try {
         SparseMMArgs args = ParseSparseMMArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.sparse_tensor) == tensor_storage.end()) {
+        torch::Tensor* sparse_tensor_tensor = FindTensorFromObj(args.sparse_tensorObj);
+        if (sparse_tensor_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.dense_tensor) == tensor_storage.end()) {
+        torch::Tensor* dense_tensor_tensor = FindTensorFromObj(args.dense_tensorObj);
+        if (dense_tensor_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid dense tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto sparse_tensor = tensor_storage[args.sparse_tensor];
-        auto dense_tensor = tensor_storage[args.dense_tensor];
+        auto sparse_tensor = *sparse_tensor_tensor;
+        auto dense_tensor = *dense_tensor_tensor;
         
         auto output = torch::mm(sparse_tensor, dense_tensor);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -680,6 +726,7 @@ int TensorSparseMM_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_
 
 struct SparseSoftmaxArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     bool dim_provided = false;
     
@@ -701,6 +748,7 @@ SparseSoftmaxArgs ParseSparseSoftmaxArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::sparse_softmax sparse_tensor dim");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value");
@@ -717,6 +765,7 @@ SparseSoftmaxArgs ParseSparseSoftmaxArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value");
@@ -747,17 +796,17 @@ int TensorSparseSoftmax_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
     try {
         SparseSoftmaxArgs args = ParseSparseSoftmaxArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::softmax(input, args.dim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -767,6 +816,7 @@ int TensorSparseSoftmax_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
 
 struct SparseLogSoftmaxArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     bool dim_provided = false;
     
@@ -788,6 +838,7 @@ SparseLogSoftmaxArgs ParseSparseLogSoftmaxArgs(Tcl_Interp* interp, int objc, Tcl
             throw std::runtime_error("Usage: torch::sparse_log_softmax sparse_tensor dim");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dim value");
@@ -804,6 +855,7 @@ SparseLogSoftmaxArgs ParseSparseLogSoftmaxArgs(Tcl_Interp* interp, int objc, Tcl
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value");
@@ -834,17 +886,17 @@ int TensorSparseLogSoftmax_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
     try {
         SparseLogSoftmaxArgs args = ParseSparseLogSoftmaxArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::log_softmax(input, args.dim);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -856,6 +908,8 @@ int TensorSparseLogSoftmax_Cmd(ClientData clientData, Tcl_Interp* interp, int ob
 struct SparseMaskArgs {
     std::string tensor;
     std::string mask;
+    Tcl_Obj* tensorObj = nullptr;
+    Tcl_Obj* maskObj = nullptr;
     
     bool IsValid() const {
         return !tensor.empty() && !mask.empty();
@@ -876,7 +930,9 @@ SparseMaskArgs ParseSparseMaskArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("");  // Empty message since Tcl_WrongNumArgs already set the error
         }
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         args.mask = Tcl_GetString(objv[2]);
+        args.maskObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -888,8 +944,10 @@ SparseMaskArgs ParseSparseMaskArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (param == "-mask") {
                 args.mask = Tcl_GetString(objv[i + 1]);
+                args.maskObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -915,23 +973,24 @@ int TensorSparseMask_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
     try {
         SparseMaskArgs args = ParseSparseMaskArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.mask) == tensor_storage.end()) {
+        torch::Tensor* mask_tensor = FindTensorFromObj(args.maskObj);
+        if (mask_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid mask tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto tensor = tensor_storage[args.tensor];
-        auto mask = tensor_storage[args.mask];
+        auto tensor = *tensor_ptr;
+        auto mask = *mask_tensor;
         
         auto output = tensor.sparse_mask(mask);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -942,6 +1001,7 @@ int TensorSparseMask_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tc
 // Parameter structure for sparse_transpose
 struct SparseTransposeArgs {
     std::string tensor;
+    Tcl_Obj* tensorObj = nullptr;
     int dim0;
     int dim1;
     bool dim0_provided = false;
@@ -959,6 +1019,7 @@ SparseTransposeArgs ParseSparseTransposeArgs(Tcl_Interp* interp, int objc, Tcl_O
     if (objc == 4 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax: sparse_tensor dim0 dim1
         args.tensor = Tcl_GetString(objv[1]);
+        args.tensorObj = objv[1];
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim0) != TCL_OK) {
             throw std::runtime_error("Invalid dim0 value");
         }
@@ -977,6 +1038,7 @@ SparseTransposeArgs ParseSparseTransposeArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (arg == "-tensor") {
                 args.tensor = Tcl_GetString(objv[i + 1]);
+                args.tensorObj = objv[i + 1];
             } else if (arg == "-dim0") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim0) != TCL_OK) {
                     throw std::runtime_error("Invalid dim0 value");
@@ -1020,18 +1082,18 @@ int TensorSparseTranspose_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
     try {
         SparseTransposeArgs args = ParseSparseTransposeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.tensor) == tensor_storage.end()) {
+        torch::Tensor* tensor_ptr = FindTensorFromObj(args.tensorObj);
+        if (tensor_ptr == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.tensor];
+        auto input = *tensor_ptr;
         
         try {
             auto output = input.transpose(args.dim0, args.dim1);
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = output;
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            std::string handle = StoreTensor(output);
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const c10::Error& e) {
             // Convert PyTorch error to our expected error message
@@ -1046,6 +1108,7 @@ int TensorSparseTranspose_Cmd(ClientData clientData, Tcl_Interp* interp, int obj
 
 struct SparseCoalesceArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1065,6 +1128,7 @@ SparseCoalesceArgs ParseSparseCoalesceArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             throw std::runtime_error("Usage: torch::sparse_coalesce sparse_tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1076,6 +1140,7 @@ SparseCoalesceArgs ParseSparseCoalesceArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1101,17 +1166,17 @@ int TensorSparseCoalesce_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
     try {
         SparseCoalesceArgs args = ParseSparseCoalesceArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = input.coalesce();
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1122,6 +1187,7 @@ int TensorSparseCoalesce_Cmd(ClientData clientData, Tcl_Interp* interp, int objc
 // Parameter structure for sparse_reshape
 struct SparseReshapeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> shape;
     
     bool IsValid() const {
@@ -1142,6 +1208,7 @@ SparseReshapeArgs ParseSparseReshapeArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             throw std::runtime_error("Usage: torch::sparse_reshape sparse_tensor shape");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.shape = TclListToShape(interp, objv[2]);
     } else {
         // Named parameter syntax
@@ -1154,6 +1221,7 @@ SparseReshapeArgs ParseSparseReshapeArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-shape") {
                 args.shape = TclListToShape(interp, objv[i + 1]);
             } else {
@@ -1181,12 +1249,13 @@ int TensorSparseReshape_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
     try {
         SparseReshapeArgs args = ParseSparseReshapeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         
         // Calculate total size
         int64_t total_size = 1;
@@ -1211,9 +1280,8 @@ int TensorSparseReshape_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
             auto indices = input._indices();
             auto output = torch::sparse_coo_tensor(indices, values, args.shape);
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = output;
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            std::string handle = StoreTensor(output);
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const c10::Error& e) {
             // Convert PyTorch error to our expected error message
@@ -1232,6 +1300,7 @@ int TensorSparseReshape_Cmd(ClientData clientData, Tcl_Interp* interp, int objc,
 
 struct SparseSumArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = -1;
     bool dim_provided = false;
     
@@ -1253,6 +1322,7 @@ SparseSumArgs ParseSparseSumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             throw std::runtime_error("wrong # args: should be \"torch::sparse_sum sparse_tensor ?dim?\"");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc == 3) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
@@ -1271,6 +1341,7 @@ SparseSumArgs ParseSparseSumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("expected integer but got \"" + std::string(Tcl_GetString(objv[i + 1])) + "\"");
@@ -1300,12 +1371,13 @@ int TensorSparseSum_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     try {
         SparseSumArgs args = ParseSparseSumArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid sparse tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         torch::Tensor output;
         
         try {
@@ -1319,9 +1391,8 @@ int TensorSparseSum_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
                 output = torch::sum(input);
             }
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = output;
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            std::string handle = StoreTensor(output);
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const c10::Error& e) {
             Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -0,0 +1,230 @@
+#include "libtorchtcl.h"
+#include <climits>
+#include <cstring>
+
+// Parameter structure for tensor_from_bytes command
+struct TensorFromBytesArgs {
+    Tcl_Obj* dataObj = nullptr;      // byte array holding the raw elements
+    std::string dtype;               // element type of the bytes
+    std::vector<int64_t> shape;      // optional; 1-D when omitted
+    bool has_shape = false;
+    std::string device = "cpu";
+    bool requiresGrad = false;
+
+    bool IsValid() const {
+        return dataObj != nullptr && !dtype.empty();
+    }
+};
+
+// Whether the first argument starts named syntax. The payload is binary, so
+// only an exact option name counts (data may well begin with '-'), and a
+// pure byte array is never given a string rep just to look at it.
+static bool IsTensorFromBytesOption(Tcl_Obj* obj) {
+    static const Tcl_ObjType* byte_array_type = Tcl_GetObjType("bytearray");
+    if (obj->bytes == nullptr && obj->typePtr != nullptr && obj->typePtr == byte_array_type) {
+        return false;
+    }
+    std::string arg = Tcl_GetString(obj);
+    return arg == "-data" || arg == "-bytes" || arg == "-dtype" || arg == "-shape" || arg == "-device" ||
+           arg == "-requiresGrad" || arg == "-requires_grad";
+}
+
+// Parse dual syntax: bytes dtype ?shape? ?device? ?requires_grad? |
+// -data bytes -dtype dtype ?-shape shape? ?-device device? ?-requiresGrad bool?
+static TensorFromBytesArgs ParseTensorFromBytesArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    TensorFromBytesArgs args;
+
+    if (objc < 2) {
+        throw std::runtime_error("Usage: torch::tensor_from_bytes bytes dtype ?shape? ?device? ?requires_grad? | torch::tensor_from_bytes -data bytes -dtype dtype ?-shape shape?");
+    }
+
+    if (!IsTensorFromBytesOption(objv[1])) {
+        // Positional syntax
+        if (objc < 3 || objc > 6) {
+            throw std::runtime_error("Usage: torch::tensor_from_bytes bytes dtype ?shape? ?device? ?requires_grad?");
+        }
+        args.dataObj = objv[1];
+        args.dtype = Tcl_GetString(objv[2]);
+        if (objc > 3) {
+            args.shape = TclListToShape(interp, objv[3]);
+            args.has_shape = true;
+        }
+        if (objc > 4) {
+            args.device = Tcl_GetString(objv[4]);
+        }
+        if (objc > 5) {
+            args.requiresGrad = GetBoolFromObj(interp, objv[5]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-data" || param == "-bytes") {
+                args.dataObj = objv[i + 1];
+            } else if (param == "-dtype") {
+                args.dtype = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-shape") {
+                args.shape = TclListToShape(interp, objv[i + 1]);
+                args.has_shape = true;
+            } else if (param == "-device") {
+                args.device = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-requiresGrad" || param == "-requires_grad") {
+                args.requiresGrad = GetBoolFromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -data, -dtype, -shape, -device, -requiresGrad");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: data and dtype");
+    }
+
+    return args;
+}
+
+// torch::tensor_from_bytes - Build a tensor from the raw bytes of a Tcl byte
+// array with a single memcpy into freshly allocated storage
+int TensorFromBytes_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        TensorFromBytesArgs args = ParseTensorFromBytesArgs(interp, objc, objv);
+
+        c10::ScalarType dtype = GetScalarType(args.dtype.c_str());
+        int64_t element_size = static_cast<int64_t>(c10::elementSize(dtype));
+
+        int length = 0;
+        unsigned char* bytes = Tcl_GetByteArrayFromObj(args.dataObj, &length);
+
+        std::vector<int64_t> shape = args.shape;
+        if (args.has_shape) {
+            int64_t numel = 1;
+            for (int64_t dim : shape) {
+                if (dim < 0) {
+                    throw std::runtime_error("Shape dimensions must be non-negative");
+                }
+                numel *= dim;
+            }
+            if (numel * element_size != length) {
+                throw std::runtime_error("Byte count " + std::to_string(length) + " does not match shape (expected " +
+                                         std::to_string(numel * element_size) + " bytes)");
+            }
+        } else {
+            if (length % element_size != 0) {
+                throw std::runtime_error("Byte count " + std::to_string(length) + " is not a multiple of the " +
+                                         args.dtype + " element size " + std::to_string(element_size));
+            }
+            shape = {length / element_size};
+        }
+
+        // The byte array may be unaligned and Tcl is free to shimmer it away
+        // later, so the elements are copied once into tensor-owned storage.
+        torch::Tensor tensor = torch::empty(shape, torch::TensorOptions().dtype(dtype));
+        if (length > 0) {
+            std::memcpy(tensor.data_ptr(), bytes, static_cast<size_t>(length));
+        }
+
+        if (args.device != "cpu") {
+            tensor = tensor.to(GetDevice(args.device.c_str()));
+        }
+        if (args.requiresGrad) {
+            tensor.set_requires_grad(true);
+        }
+
+        std::string handle = StoreTensor(tensor);
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for tensor_to_bytes command
+struct TensorToBytesArgs {
+    std::string input;
+    Tcl_Obj* inputObj = nullptr;
+
+    bool IsValid() const {
+        return !input.empty();
+    }
+};
+
+// Parse dual syntax: tensor | -input tensor
+static TensorToBytesArgs ParseTensorToBytesArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp; // Suppress unused parameter warning
+    TensorToBytesArgs args;
+
+    if (objc < 2) {
+        throw std::runtime_error("Usage: torch::tensor_to_bytes tensor | torch::tensor_to_bytes -input tensor");
+    }
+
+    if (Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error("Usage: torch::tensor_to_bytes tensor");
+        }
+        args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-input" || param == "-tensor") {
+                args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: input tensor");
+    }
+
+    return args;
+}
+
+// torch::tensor_to_bytes - Raw element bytes of a tensor in row-major order.
+// Contiguous CPU tensors are copied straight from their storage.
+int TensorToBytes_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        TensorToBytesArgs args = ParseTensorToBytesArgs(interp, objc, objv);
+
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
+            throw std::runtime_error("Invalid tensor name: " + args.input);
+        }
+
+        torch::Tensor tensor = *input;
+        if (!tensor.device().is_cpu()) {
+            tensor = tensor.cpu();
+        }
+        tensor = tensor.contiguous();
+
+        size_t nbytes = static_cast<size_t>(tensor.numel()) * tensor.element_size();
+        if (nbytes > static_cast<size_t>(INT_MAX)) {
+            throw std::runtime_error("Tensor too large for a Tcl byte array");
+        }
+
+        Tcl_SetObjResult(interp, Tcl_NewByteArrayObj(static_cast<const unsigned char*>(tensor.data_ptr()),
+                                                     static_cast<int>(nbytes)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
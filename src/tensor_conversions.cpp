@@ -3,6 +3,7 @@
 // Parameter structure for tensor_to_list command
 struct TensorToListArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -23,6 +24,7 @@ TensorToListArgs ParseTensorToListArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             throw std::runtime_error("Usage: torch::tensor_to_list tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -34,6 +36,7 @@ TensorToListArgs ParseTensorToListArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -54,13 +57,14 @@ int TensorToList_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
         TensorToListArgs args = ParseTensorToListArgs(interp, objc, objv);
         
         // Validate tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Get tensor
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Convert tensor to 1D if needed
         auto flattened = tensor.flatten().contiguous();
@@ -69,9 +69,8 @@ int TensorRandn_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj
         // Create tensor with normal distribution
         torch::Tensor tensor = torch::randn(args.shape, options);
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        std::string handle = StoreTensor(tensor);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -148,9 +147,8 @@ int TensorRand_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         // Create tensor with uniform distribution [0, 1)
         torch::Tensor tensor = torch::rand(args.shape, options);
         // Store and return handle
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
-        Tcl_SetResult(interp, const_cast<char*>(handle.c_str()), TCL_VOLATILE);
+        std::string handle = StoreTensor(tensor);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -160,6 +158,7 @@ int TensorRand_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 
 struct TensorItemArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -175,6 +174,7 @@ TensorItemArgs ParseTensorItemArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::tensor_item tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -187,6 +187,7 @@ TensorItemArgs ParseTensorItemArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-tensor" || param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -208,12 +209,13 @@ int TensorItem_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         TensorItemArgs args = ParseTensorItemArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>(("Invalid tensor name: " + args.input).c_str()), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Check if tensor has exactly one element
         if (tensor.numel() != 1) {
@@ -249,6 +251,7 @@ int TensorItem_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 
 struct TensorNumelArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -264,6 +267,7 @@ TensorNumelArgs ParseTensorNumelArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             throw std::runtime_error("Usage: torch::tensor_numel tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -276,6 +280,7 @@ TensorNumelArgs ParseTensorNumelArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-tensor" || param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -297,12 +302,13 @@ int TensorNumel_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj
         TensorNumelArgs args = ParseTensorNumelArgs(interp, objc, objv);
         
         // Check if tensor exists
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>(("Invalid tensor name: " + args.input).c_str()), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
+        auto& tensor = *input;
         
         // Get number of elements
         int64_t num_elements = tensor.numel();
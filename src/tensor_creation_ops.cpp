@@ -4,6 +4,7 @@
 // Parameter structure for empty_like command
 struct EmptyLikeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::string dtype = "";
     std::string device = "";
     bool requiresGrad = false;
@@ -25,6 +26,7 @@ EmptyLikeArgs ParseEmptyLikeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             args.dtype = Tcl_GetString(objv[2]);
@@ -44,6 +46,7 @@ EmptyLikeArgs ParseEmptyLikeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-dtype") {
                 args.dtype = value;
             } else if (param == "-device") {
@@ -88,12 +91,13 @@ int TensorEmptyLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         EmptyLikeArgs args = ParseEmptyLikeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::TensorOptions options = input_tensor.options();
         
         if (!args.dtype.empty()) {
@@ -110,10 +114,9 @@ int TensorEmptyLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         
         torch::Tensor tensor = torch::empty_like(input_tensor, options);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -141,10 +144,9 @@ int TensorZeros_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -172,10 +174,9 @@ int TensorOnes_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -203,10 +204,9 @@ int TensorEmpty_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -400,10 +400,9 @@ int TensorArange_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             torch::Tensor tensor = torch::arange(start, end, step, torch::TensorOptions().dtype(dtype).device(device));
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = tensor;
+            std::string handle = StoreTensor(tensor);
 
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const std::exception& e) {
             Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -466,10 +465,9 @@ int TensorArange_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             torch::Tensor tensor = torch::arange(start, end, step, torch::TensorOptions().dtype(dtype).device(device));
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = tensor;
+            std::string handle = StoreTensor(tensor);
 
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const std::exception& e) {
             Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -533,10 +531,9 @@ int TensorLinspace_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             torch::Tensor tensor = torch::linspace(start, end, steps, torch::TensorOptions().dtype(dtype).device(device));
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = tensor;
+            std::string handle = StoreTensor(tensor);
 
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const std::exception& e) {
             Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -573,10 +570,9 @@ int TensorLinspace_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             torch::Tensor tensor = torch::linspace(start, end, steps, torch::TensorOptions().dtype(dtype).device(device));
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = tensor;
+            std::string handle = StoreTensor(tensor);
 
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const std::exception& e) {
             Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -644,10 +640,9 @@ int TensorLogspace_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             torch::Tensor tensor = torch::logspace(start, end, steps, base, torch::TensorOptions().dtype(dtype).device(device));
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = tensor;
+            std::string handle = StoreTensor(tensor);
 
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const std::exception& e) {
             Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -691,10 +686,9 @@ int TensorLogspace_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             torch::Tensor tensor = torch::logspace(start, end, steps, base, torch::TensorOptions().dtype(dtype).device(device));
             
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = tensor;
+            std::string handle = StoreTensor(tensor);
 
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
             return TCL_OK;
         } catch (const std::exception& e) {
             Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -715,12 +709,13 @@ int TensorZerosLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::TensorOptions options = input_tensor.options();
         
         // Apply dtype if specified
@@ -753,10 +748,9 @@ int TensorZerosLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -767,6 +761,7 @@ int TensorZerosLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for torch::full_like
 struct FullLikeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     double value = 0.0;
     std::string dtype = "";
     std::string device = "";
@@ -789,6 +784,7 @@ FullLikeArgs ParseFullLikeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetDoubleFromObj(interp, objv[2], &args.value) != TCL_OK) {
             throw std::runtime_error("Invalid value parameter");
         }
@@ -808,6 +804,7 @@ FullLikeArgs ParseFullLikeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-value") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.value) != TCL_OK) {
                     throw std::runtime_error("Invalid value for -value parameter");
@@ -848,12 +845,13 @@ int TensorFullLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::TensorOptions options = input_tensor.options();
         
         // Apply dtype if specified
@@ -876,10 +874,9 @@ int TensorFullLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -899,12 +896,13 @@ int TensorRandLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::TensorOptions options = input_tensor.options();
         
         // Apply dtype if specified
@@ -927,10 +925,9 @@ int TensorRandLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -950,12 +947,13 @@ int TensorRandnLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::TensorOptions options = input_tensor.options();
         
         // Apply dtype if specified
@@ -978,10 +976,9 @@ int TensorRandnLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -992,6 +989,7 @@ int TensorRandnLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for torch::randint_like
 struct RandintLikeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int high = 0;
     int low = 0;
     std::string dtype = "";
@@ -1010,6 +1008,7 @@ RandintLikeArgs ParseRandintLikeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax: torch::randint_like tensor high ?low? ?dtype? ?device?
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc >= 3) {
             int temp_high;
@@ -1054,6 +1053,7 @@ RandintLikeArgs ParseRandintLikeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-high") {
                 args.high = std::stoi(value);
             } else if (param == "-low") {
@@ -1092,12 +1092,13 @@ int TensorRandintLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
         }
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::TensorOptions options = input_tensor.options();
         
         // Apply dtype if specified, otherwise default to int64 for randint
@@ -1123,10 +1124,9 @@ int TensorRandintLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* con
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1146,12 +1146,13 @@ int TensorOnesLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         // Validate input tensor
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& input_tensor = tensor_storage[args.input];
+        auto& input_tensor = *input;
         torch::TensorOptions options = input_tensor.options();
         
         // Apply dtype if specified
@@ -1174,10 +1175,9 @@ int TensorOnesLike_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
             tensor.set_requires_grad(true);
         }
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = tensor;
+        std::string handle = StoreTensor(tensor);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
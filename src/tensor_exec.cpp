@@ -0,0 +1,626 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// torch::exec runs a short program of tensor operations in one command.
+// A program is a Tcl list of statements, each a list {dest op operand ...}.
+// Operands are numbers, registers assigned by an earlier statement, or
+// external tensors named in -inputs (or plain tensor handles). The program is
+// compiled once and the result kept in the Tcl_Obj's internal representation,
+// so a program held in a variable or a proc body is parsed only on first use.
+// Intermediate values never become handles; only the requested outputs do.
+
+enum class ExecOp {
+    // Binary elementwise and matrix operations
+    Add, Sub, Mul, Div, Pow, Maximum, Minimum, Matmul,
+    // Unary operations
+    Neg, Exp, Log, Sqrt, Rsqrt, Abs, Tanh, Sigmoid, Relu, Gelu, Silu, Sin, Cos, Copy,
+    // Operations with integer or real attributes
+    Softmax, LogSoftmax, Sum, Mean, Transpose, Reshape, Clamp,
+    // linear x weight ?bias?
+    Linear
+};
+
+enum class OperandKind { Register, External, Constant };
+
+struct ExecOperand {
+    OperandKind kind;
+    size_t index = 0;           // register or external slot
+    double value = 0.0;         // constant value
+};
+
+struct ExecInstr {
+    ExecOp op;
+    size_t dest;
+    std::vector<ExecOperand> operands;
+    std::vector<int64_t> ints;
+    std::vector<double> reals;
+    std::vector<size_t> release;   // registers whose last use is this statement
+};
+
+struct ExecProgram {
+    std::vector<ExecInstr> instrs;
+    std::vector<std::string> registers;
+    std::vector<std::string> externals;
+    std::unordered_map<std::string, size_t> register_index;
+    // Outputs the release lists were computed for
+    std::vector<size_t> liveness_outputs;
+};
+
+struct ExecOpInfo {
+    ExecOp op;
+    int min_operands;
+    int max_operands;
+};
+
+static const std::unordered_map<std::string, ExecOpInfo>& ExecOpTable() {
+    static const std::unordered_map<std::string, ExecOpInfo> table = {
+        {"add", {ExecOp::Add, 2, 2}},           {"sub", {ExecOp::Sub, 2, 2}},
+        {"mul", {ExecOp::Mul, 2, 2}},           {"div", {ExecOp::Div, 2, 2}},
+        {"pow", {ExecOp::Pow, 2, 2}},           {"maximum", {ExecOp::Maximum, 2, 2}},
+        {"minimum", {ExecOp::Minimum, 2, 2}},   {"matmul", {ExecOp::Matmul, 2, 2}},
+        {"neg", {ExecOp::Neg, 1, 1}},           {"exp", {ExecOp::Exp, 1, 1}},
+        {"log", {ExecOp::Log, 1, 1}},           {"sqrt", {ExecOp::Sqrt, 1, 1}},
+        {"rsqrt", {ExecOp::Rsqrt, 1, 1}},       {"abs", {ExecOp::Abs, 1, 1}},
+        {"tanh", {ExecOp::Tanh, 1, 1}},         {"sigmoid", {ExecOp::Sigmoid, 1, 1}},
+        {"relu", {ExecOp::Relu, 1, 1}},         {"gelu", {ExecOp::Gelu, 1, 1}},
+        {"silu", {ExecOp::Silu, 1, 1}},         {"sin", {ExecOp::Sin, 1, 1}},
+        {"cos", {ExecOp::Cos, 1, 1}},           {"copy", {ExecOp::Copy, 1, 1}},
+        {"softmax", {ExecOp::Softmax, 1, 1}},   {"log_softmax", {ExecOp::LogSoftmax, 1, 1}},
+        {"sum", {ExecOp::Sum, 1, 1}},           {"mean", {ExecOp::Mean, 1, 1}},
+        {"transpose", {ExecOp::Transpose, 1, 1}}, {"reshape", {ExecOp::Reshape, 1, 1}},
+        {"clamp", {ExecOp::Clamp, 1, 1}},       {"linear", {ExecOp::Linear, 2, 3}},
+    };
+    return table;
+}
+
+// Decimal literals only ([+-]digits[.digits][e[+-]digits]); strtod alone
+// would also take inf, nan and hex floats, which could be operand names
+static bool ParseExecNumber(const char* text, double& value) {
+    const char* p = text;
+    if (*p == '+' || *p == '-') {
+        p++;
+    }
+    bool digits = false;
+    while (std::isdigit(static_cast<unsigned char>(*p))) {
+        p++;
+        digits = true;
+    }
+    if (*p == '.') {
+        p++;
+        while (std::isdigit(static_cast<unsigned char>(*p))) {
+            p++;
+            digits = true;
+        }
+    }
+    if (!digits) {
+        return false;
+    }
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        if (*p == '+' || *p == '-') {
+            p++;
+        }
+        if (!std::isdigit(static_cast<unsigned char>(*p))) {
+            return false;
+        }
+        while (std::isdigit(static_cast<unsigned char>(*p))) {
+            p++;
+        }
+    }
+    if (*p != '\0') {
+        return false;
+    }
+    value = std::strtod(text, nullptr);
+    return true;
+}
+
+static int64_t ParseExecInt(const std::string& text, const std::string& what) {
+    try {
+        size_t used = 0;
+        int64_t value = std::stoll(text, &used);
+        if (used == text.size()) {
+            return value;
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::runtime_error(what + " must be an integer, got \"" + text + "\"");
+}
+
+static double ParseExecReal(const std::string& text, const std::string& what) {
+    double value;
+    if (!ParseExecNumber(text.c_str(), value)) {
+        throw std::runtime_error(what + " must be a number, got \"" + text + "\"");
+    }
+    return value;
+}
+
+static std::shared_ptr<ExecProgram> CompileExecProgram(const char* source) {
+    // Split a private copy so the caller's object keeps its own rep
+    Tcl_Obj* copy = Tcl_NewStringObj(source, -1);
+    Tcl_IncrRefCount(copy);
+    auto program = std::make_shared<ExecProgram>();
+    std::unordered_map<std::string, size_t> external_index;
+
+    try {
+        int count;
+        Tcl_Obj** statements;
+        if (Tcl_ListObjGetElements(nullptr, copy, &count, &statements) != TCL_OK) {
+            throw std::runtime_error("Program must be a list of statements");
+        }
+
+        for (int s = 0; s < count; s++) {
+            int nwords;
+            Tcl_Obj** words;
+            if (Tcl_ListObjGetElements(nullptr, statements[s], &nwords, &words) != TCL_OK || nwords < 3) {
+                throw std::runtime_error("Statement " + std::to_string(s + 1) +
+                                         ": expected {dest op operand ...}");
+            }
+            std::string dest = Tcl_GetString(words[0]);
+            std::string name = Tcl_GetString(words[1]);
+            std::string where = "Statement " + std::to_string(s + 1) + " (" + name + ")";
+
+            auto op_it = ExecOpTable().find(name);
+            if (op_it == ExecOpTable().end()) {
+                throw std::runtime_error(where + ": unknown op");
+            }
+            const ExecOpInfo& info = op_it->second;
+
+            ExecInstr instr;
+            instr.op = info.op;
+
+            // Tensor operands come first, attributes after them
+            int nargs = nwords - 2;
+            int ntensors = std::min(nargs, info.max_operands);
+            if (ntensors < info.min_operands) {
+                throw std::runtime_error(where + ": expected at least " +
+                                         std::to_string(info.min_operands) + " operands");
+            }
+            for (int i = 0; i < ntensors; i++) {
+                const char* text = Tcl_GetString(words[2 + i]);
+                ExecOperand operand;
+                double value;
+                auto reg = program->register_index.find(text);
+                if (reg != program->register_index.end()) {
+                    operand.kind = OperandKind::Register;
+                    operand.index = reg->second;
+                } else if (ParseExecNumber(text, value)) {
+                    operand.kind = OperandKind::Constant;
+                    operand.value = value;
+                } else {
+                    auto ext = external_index.find(text);
+                    if (ext == external_index.end()) {
+                        ext = external_index.emplace(text, program->externals.size()).first;
+                        program->externals.push_back(text);
+                    }
+                    operand.kind = OperandKind::External;
+                    operand.index = ext->second;
+                }
+                instr.operands.push_back(operand);
+            }
+
+            std::vector<std::string> attrs;
+            for (int i = 2 + ntensors; i < nwords; i++) {
+                attrs.push_back(Tcl_GetString(words[i]));
+            }
+            switch (info.op) {
+                case ExecOp::Softmax:
+                case ExecOp::LogSoftmax:
+                    if (attrs.size() != 1) {
+                        throw std::runtime_error(where + ": expected {dest " + name + " x dim}");
+                    }
+                    instr.ints.push_back(ParseExecInt(attrs[0], where + ": dim"));
+                    break;
+                case ExecOp::Sum:
+                case ExecOp::Mean:
+                    // No dims reduces over all of them
+                    for (const auto& attr : attrs) {
+                        instr.ints.push_back(ParseExecInt(attr, where + ": dim"));
+                    }
+                    break;
+                case ExecOp::Transpose:
+                    if (attrs.size() != 2) {
+                        throw std::runtime_error(where + ": expected {dest transpose x dim0 dim1}");
+                    }
+                    instr.ints.push_back(ParseExecInt(attrs[0], where + ": dim0"));
+                    instr.ints.push_back(ParseExecInt(attrs[1], where + ": dim1"));
+                    break;
+                case ExecOp::Reshape:
+                    if (attrs.empty()) {
+                        throw std::runtime_error(where + ": expected {dest reshape x size ...}");
+                    }
+                    for (const auto& attr : attrs) {
+                        instr.ints.push_back(ParseExecInt(attr, where + ": size"));
+                    }
+                    break;
+                case ExecOp::Clamp:
+                    if (attrs.size() != 2) {
+                        throw std::runtime_error(where + ": expected {dest clamp x min max}");
+                    }
+                    instr.reals.push_back(ParseExecReal(attrs[0], where + ": min"));
+                    instr.reals.push_back(ParseExecReal(attrs[1], where + ": max"));
+                    break;
+                default:
+                    if (!attrs.empty()) {
+                        throw std::runtime_error(where + ": too many operands");
+                    }
+                    break;
+            }
+
+            // Assigning to an existing register overwrites it in place
+            auto reg = program->register_index.find(dest);
+            if (reg == program->register_index.end()) {
+                reg = program->register_index.emplace(dest, program->registers.size()).first;
+                program->registers.push_back(dest);
+            }
+            instr.dest = reg->second;
+            program->instrs.push_back(std::move(instr));
+        }
+    } catch (...) {
+        Tcl_DecrRefCount(copy);
+        throw;
+    }
+    Tcl_DecrRefCount(copy);
+
+    if (program->instrs.empty()) {
+        throw std::runtime_error("Program has no statements");
+    }
+    return program;
+}
+
+// ============================================================================
+// Compiled program cache
+// ============================================================================
+
+// The internal rep holds a heap-allocated shared_ptr, so duplicates of a
+// program object share one compiled program
+static void FreeProgramIntRep(Tcl_Obj* objPtr);
+static void DupProgramIntRep(Tcl_Obj* srcPtr, Tcl_Obj* dupPtr);
+
+static Tcl_ObjType torchProgramType = {
+    "torchProgram", FreeProgramIntRep, DupProgramIntRep, nullptr, nullptr
+};
+
+static void FreeProgramIntRep(Tcl_Obj* objPtr) {
+    delete static_cast<std::shared_ptr<ExecProgram>*>(objPtr->internalRep.twoPtrValue.ptr1);
+    objPtr->typePtr = nullptr;
+}
+
+static void DupProgramIntRep(Tcl_Obj* srcPtr, Tcl_Obj* dupPtr) {
+    auto* program = static_cast<std::shared_ptr<ExecProgram>*>(srcPtr->internalRep.twoPtrValue.ptr1);
+    dupPtr->internalRep.twoPtrValue.ptr1 = new std::shared_ptr<ExecProgram>(*program);
+    dupPtr->internalRep.twoPtrValue.ptr2 = nullptr;
+    dupPtr->typePtr = &torchProgramType;
+}
+
+// Cache program in objPtr, whatever type the object has meanwhile been
+// shimmered to. The string rep is kept, so it must describe program.
+static void SetExecProgramIntRep(Tcl_Obj* objPtr, const std::shared_ptr<ExecProgram>& program) {
+    if (objPtr->typePtr == &torchProgramType) {
+        *static_cast<std::shared_ptr<ExecProgram>*>(objPtr->internalRep.twoPtrValue.ptr1) = program;
+        return;
+    }
+    Tcl_GetString(objPtr);
+    if (objPtr->typePtr && objPtr->typePtr->freeIntRepProc) {
+        objPtr->typePtr->freeIntRepProc(objPtr);
+    }
+    objPtr->internalRep.twoPtrValue.ptr1 = new std::shared_ptr<ExecProgram>(program);
+    objPtr->internalRep.twoPtrValue.ptr2 = nullptr;
+    objPtr->typePtr = &torchProgramType;
+}
+
+static std::shared_ptr<ExecProgram> GetExecProgramFromObj(Tcl_Obj* objPtr) {
+    if (objPtr->typePtr == &torchProgramType) {
+        return *static_cast<std::shared_ptr<ExecProgram>*>(objPtr->internalRep.twoPtrValue.ptr1);
+    }
+
+    // Compile before touching the old rep, so a bad program leaves it intact
+    std::shared_ptr<ExecProgram> program = CompileExecProgram(Tcl_GetString(objPtr));
+    SetExecProgramIntRep(objPtr, program);
+    return program;
+}
+
+// ============================================================================
+// Execution
+// ============================================================================
+
+// Let go of each intermediate register after its last read, so long
+// programs do not keep every temporary alive until the end
+static void ComputeExecLiveness(ExecProgram& program, const std::vector<size_t>& outputs) {
+    std::vector<size_t> last_use(program.registers.size(), SIZE_MAX);
+    for (size_t i = 0; i < program.instrs.size(); i++) {
+        for (const auto& operand : program.instrs[i].operands) {
+            if (operand.kind == OperandKind::Register) {
+                last_use[operand.index] = i;
+            }
+        }
+    }
+    for (auto& instr : program.instrs) {
+        instr.release.clear();
+    }
+    for (size_t r = 0; r < last_use.size(); r++) {
+        bool is_output = std::find(outputs.begin(), outputs.end(), r) != outputs.end();
+        if (last_use[r] != SIZE_MAX && !is_output) {
+            program.instrs[last_use[r]].release.push_back(r);
+        }
+    }
+    program.liveness_outputs = outputs;
+}
+
+static torch::Tensor RunExecInstr(const ExecInstr& instr, std::vector<torch::Tensor>& operands) {
+    switch (instr.op) {
+        case ExecOp::Add:     return torch::add(operands[0], operands[1]);
+        case ExecOp::Sub:     return torch::sub(operands[0], operands[1]);
+        case ExecOp::Mul:     return torch::mul(operands[0], operands[1]);
+        case ExecOp::Div:     return torch::div(operands[0], operands[1]);
+        case ExecOp::Pow:     return torch::pow(operands[0], operands[1]);
+        case ExecOp::Maximum: return torch::maximum(operands[0], operands[1]);
+        case ExecOp::Minimum: return torch::minimum(operands[0], operands[1]);
+        case ExecOp::Matmul:  return torch::matmul(operands[0], operands[1]);
+        case ExecOp::Neg:     return torch::neg(operands[0]);
+        case ExecOp::Exp:     return torch::exp(operands[0]);
+        case ExecOp::Log:     return torch::log(operands[0]);
+        case ExecOp::Sqrt:    return torch::sqrt(operands[0]);
+        case ExecOp::Rsqrt:   return torch::rsqrt(operands[0]);
+        case ExecOp::Abs:     return torch::abs(operands[0]);
+        case ExecOp::Tanh:    return torch::tanh(operands[0]);
+        case ExecOp::Sigmoid: return torch::sigmoid(operands[0]);
+        case ExecOp::Relu:    return torch::relu(operands[0]);
+        case ExecOp::Gelu:    return torch::gelu(operands[0]);
+        case ExecOp::Silu:    return torch::silu(operands[0]);
+        case ExecOp::Sin:     return torch::sin(operands[0]);
+        case ExecOp::Cos:     return torch::cos(operands[0]);
+        case ExecOp::Copy:    return operands[0].clone();
+        case ExecOp::Softmax:    return torch::softmax(operands[0], instr.ints[0]);
+        case ExecOp::LogSoftmax: return torch::log_softmax(operands[0], instr.ints[0]);
+        case ExecOp::Sum:
+            return instr.ints.empty() ? operands[0].sum() : operands[0].sum(instr.ints);
+        case ExecOp::Mean:
+            return instr.ints.empty() ? operands[0].mean() : operands[0].mean(instr.ints);
+        case ExecOp::Transpose: return operands[0].transpose(instr.ints[0], instr.ints[1]);
+        case ExecOp::Reshape:   return operands[0].reshape(instr.ints);
+        case ExecOp::Clamp:     return torch::clamp(operands[0], instr.reals[0], instr.reals[1]);
+        case ExecOp::Linear:
+            return operands.size() > 2 ? torch::nn::functional::linear(operands[0], operands[1], operands[2])
+                                       : torch::nn::functional::linear(operands[0], operands[1]);
+    }
+    throw std::runtime_error("Unhandled op");
+}
+
+static std::vector<torch::Tensor> RunExecProgram(const ExecProgram& program,
+                                                 const std::vector<torch::Tensor>& externals,
+                                                 const std::vector<size_t>& outputs) {
+    std::vector<torch::Tensor> registers(program.registers.size());
+    std::vector<torch::Tensor> operands;
+
+    for (size_t i = 0; i < program.instrs.size(); i++) {
+        const ExecInstr& instr = program.instrs[i];
+        operands.clear();
+
+        int like = -1;
+        for (const auto& operand : instr.operands) {
+            operands.emplace_back();
+            if (operand.kind == OperandKind::Register) {
+                operands.back() = registers[operand.index];
+                if (!operands.back().defined()) {
+                    throw std::runtime_error("Statement " + std::to_string(i + 1) + ": register " +
+                                             program.registers[operand.index] + " has no value");
+                }
+            } else if (operand.kind == OperandKind::External) {
+                operands.back() = externals[operand.index];
+            } else {
+                continue;
+            }
+            if (like < 0) {
+                like = static_cast<int>(operands.size()) - 1;
+            }
+        }
+        // Next to a tensor operand, constants act like Python scalars: they
+        // are wrapped numbers, so type promotion keeps an integer tensor's
+        // dtype for an integral constant and goes to the default float
+        // dtype for a fractional one, instead of truncating the constant
+        for (size_t k = 0; k < instr.operands.size(); k++) {
+            if (instr.operands[k].kind != OperandKind::Constant) {
+                continue;
+            }
+            double value = instr.operands[k].value;
+            if (like < 0) {
+                operands[k] = torch::scalar_tensor(value);
+                continue;
+            }
+            bool integral = std::trunc(value) == value && std::fabs(value) < 9.2e18;
+            operands[k] = integral
+                ? torch::scalar_tensor(static_cast<int64_t>(value), torch::TensorOptions(torch::kLong).device(operands[like].device()))
+                : torch::scalar_tensor(value, torch::TensorOptions(torch::kDouble).device(operands[like].device()));
+            operands[k].unsafeGetTensorImpl()->set_wrapped_number(true);
+        }
+
+        try {
+            registers[instr.dest] = RunExecInstr(instr, operands);
+        } catch (const c10::Error& e) {
+            throw std::runtime_error("Statement " + std::to_string(i + 1) + " (" +
+                                     program.registers[instr.dest] + "): " + e.what_without_backtrace());
+        }
+        for (size_t r : instr.release) {
+            if (r != instr.dest) {
+                registers[r] = torch::Tensor();
+            }
+        }
+    }
+
+    std::vector<torch::Tensor> results;
+    for (size_t r : outputs) {
+        results.push_back(registers[r]);
+    }
+    return results;
+}
+
+// ============================================================================
+// torch::exec
+// ============================================================================
+
+// Parameter structure for exec command
+struct ExecArgs {
+    Tcl_Obj* program = nullptr;
+    Tcl_Obj* inputs = nullptr;
+    Tcl_Obj* outputs = nullptr;
+
+    bool IsValid() const {
+        return program != nullptr;
+    }
+};
+
+// Parse dual syntax: program ?inputs? ?outputs? |
+// -program program ?-inputs {name tensor ...}? ?-outputs {register ...}?
+static ExecArgs ParseExecArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    ExecArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 4) {
+            throw std::runtime_error("Usage: torch::exec program ?inputs? ?outputs?");
+        }
+        args.program = objv[1];
+        if (objc > 2) {
+            args.inputs = objv[2];
+        }
+        if (objc > 3) {
+            args.outputs = objv[3];
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-program") {
+                args.program = objv[i + 1];
+            } else if (param == "-inputs") {
+                args.inputs = objv[i + 1];
+            } else if (param == "-outputs") {
+                args.outputs = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -program, -inputs, -outputs");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: program");
+    }
+
+    return args;
+}
+
+// Compile the program and bind its inputs; the program itself is run by
+// run, either right away or on a torch::async worker
+AsyncWork PrepareExec(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    ExecArgs args = ParseExecArgs(interp, objc, objv);
+    std::shared_ptr<ExecProgram> program = GetExecProgramFromObj(args.program);
+
+    // Bind external names: -inputs first, then tensor handles of that name
+    std::unordered_map<std::string, Tcl_Obj*> bindings;
+    if (args.inputs != nullptr) {
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, args.inputs, &count, &items) != TCL_OK || count % 2 != 0) {
+            throw std::runtime_error("inputs must be a list of name tensor pairs");
+        }
+        for (int i = 0; i < count; i += 2) {
+            bindings[Tcl_GetString(items[i])] = items[i + 1];
+        }
+    }
+    std::vector<torch::Tensor> externals;
+    externals.reserve(program->externals.size());
+    for (const auto& name : program->externals) {
+        auto bound = bindings.find(name);
+        torch::Tensor* tensor = nullptr;
+        if (bound != bindings.end()) {
+            tensor = FindTensorFromObj(bound->second);
+        } else {
+            auto it = tensor_storage.find(name);
+            if (it != tensor_storage.end()) {
+                tensor = &it->second;
+            }
+        }
+        if (tensor == nullptr) {
+            throw std::runtime_error("Unbound program input: " + name);
+        }
+        externals.push_back(*tensor);
+    }
+
+    // Outputs default to the destination of the last statement
+    std::vector<size_t> outputs;
+    if (args.outputs != nullptr) {
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, args.outputs, &count, &items) != TCL_OK || count == 0) {
+            throw std::runtime_error("outputs must be a non-empty list of registers");
+        }
+        for (int i = 0; i < count; i++) {
+            auto reg = program->register_index.find(Tcl_GetString(items[i]));
+            if (reg == program->register_index.end()) {
+                throw std::runtime_error(std::string("Unknown output register: ") + Tcl_GetString(items[i]));
+            }
+            outputs.push_back(reg->second);
+        }
+    } else {
+        outputs.push_back(program->instrs.back().dest);
+    }
+
+    // Liveness depends on the outputs, so it is redone when they change. A
+    // pending torch::async run may still hold the program, so the new
+    // release lists go on a copy, which replaces the cached one. Binding
+    // the inputs may have shimmered the program object, so the copy is
+    // installed through the setter rather than into the old rep.
+    if (program->liveness_outputs != outputs) {
+        auto updated = std::make_shared<ExecProgram>(*program);
+        ComputeExecLiveness(*updated, outputs);
+        SetExecProgramIntRep(args.program, updated);
+        program = updated;
+    }
+
+    AsyncWork work;
+    work.listResult = outputs.size() > 1;
+    work.run = [program, externals = std::move(externals), outputs]() {
+        return RunExecProgram(*program, externals, outputs);
+    };
+    return work;
+}
+
+// torch::exec - Run a compiled op-list program and return its outputs as
+// tensor handles (a single handle for a single output)
+int Exec_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        AsyncWork work = PrepareExec(interp, objc, objv);
+        std::vector<torch::Tensor> results = work.run();
+
+        if (!work.listResult) {
+            return SetTensorResult(interp, results[0]);
+        }
+        // Reserve every output before storing any of them; a failure while
+        // reserving releases the slots taken so far
+        std::vector<TensorReservation> reservations;
+        reservations.reserve(results.size());
+        for (size_t i = 0; i < results.size(); i++) {
+            reservations.push_back(ReserveTensorHandle());
+        }
+        Tcl_Obj* list = Tcl_NewListObj(0, nullptr);
+        for (size_t i = 0; i < results.size(); i++) {
+            Tcl_ListObjAppendElement(interp, list, NewHandleObj(reservations[i].Fill(results[i])));
+        }
+        Tcl_SetObjResult(interp, list);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -4,11 +4,12 @@
 #include <vector>
 #include <unordered_map>
 
-extern std::unordered_map<std::string, torch::Tensor> tensor_storage;
+extern thread_local HandleTable<torch::Tensor> tensor_storage;
 
 // Parameter structure for tensor_size
 struct TensorSizeArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -28,6 +29,7 @@ TensorSizeArgs ParseTensorSizeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             throw std::runtime_error("Usage: torch::tensor_size tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -39,6 +41,7 @@ TensorSizeArgs ParseTensorSizeArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -64,12 +67,13 @@ int TensorSize_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
     try {
         TensorSizeArgs args = ParseTensorSizeArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto sizes = input.sizes();
         
         // Convert sizes to Tcl list
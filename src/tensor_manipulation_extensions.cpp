@@ -1,8 +1,11 @@
 #include "libtorchtcl.h"
+#include <climits>
+#include <type_traits>
 
 // Parameter structure for flip command
 struct TensorFlipArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> dims;
     
     bool IsValid() const {
@@ -25,6 +28,7 @@ TensorFlipArgs ParseTensorFlipArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse dimensions list
         int listLen;
@@ -51,6 +55,7 @@ TensorFlipArgs ParseTensorFlipArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dims" || param == "-dimensions") {
                 // Parse dimensions list
                 int listLen;
@@ -84,18 +89,18 @@ int TensorFlip_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         TensorFlipArgs args = ParseTensorFlipArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::flip(input, args.dims);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -106,6 +111,7 @@ int TensorFlip_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for roll command
 struct RollArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> shifts;
     std::vector<int64_t> dims;
     
@@ -129,6 +135,7 @@ RollArgs ParseRollArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         // Parse shifts
         int listLen;
@@ -172,6 +179,7 @@ RollArgs ParseRollArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-shifts") {
                 int listLen;
                 Tcl_Obj** listObjv;
@@ -218,12 +226,13 @@ int TensorRoll_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         RollArgs args = ParseRollArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         torch::Tensor output;
 
         if (args.dims.empty()) {
@@ -232,10 +241,9 @@ int TensorRoll_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             output = torch::roll(input, args.shifts, args.dims);
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -246,6 +254,7 @@ int TensorRoll_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for rot90 command
 struct Rot90Args {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int k = 1;
     std::vector<int64_t> dims = {0, 1};
     
@@ -265,6 +274,7 @@ Rot90Args ParseRot90Args(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.k) != TCL_OK) {
@@ -301,6 +311,7 @@ Rot90Args ParseRot90Args(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
                 has_input = true;
             } else if (param == "-k") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.k) != TCL_OK) {
@@ -339,18 +350,18 @@ int TensorRot90_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         Rot90Args args = ParseRot90Args(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::rot90(input, args.k, args.dims);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -362,6 +373,7 @@ int TensorRot90_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 // Parameter structure for narrow_copy command
 struct NarrowCopyArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int dim = 0;
     int start = 0;
     int length = 0;
@@ -382,6 +394,7 @@ NarrowCopyArgs ParseNarrowCopyArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Invalid dimension value");
@@ -405,6 +418,7 @@ NarrowCopyArgs ParseNarrowCopyArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dimension value");
@@ -434,18 +448,18 @@ int TensorNarrowCopy_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         NarrowCopyArgs args = ParseNarrowCopyArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = input.narrow_copy(args.dim, args.start, args.length);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -457,6 +471,8 @@ int TensorNarrowCopy_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 struct TensorTakeAlongDimArgs {
     std::string input;
     std::string indices;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* indicesObj = nullptr;
     int dim = -1;  // -1 means no dimension specified
     
     bool IsValid() const {
@@ -479,7 +495,9 @@ TensorTakeAlongDimArgs ParseTensorTakeAlongDimArgs(Tcl_Interp* interp, int objc,
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.indices = Tcl_GetString(objv[2]);
+        args.indicesObj = objv[2];
         
         if (objc > 3) {
             if (Tcl_GetIntFromObj(interp, objv[3], &args.dim) != TCL_OK) {
@@ -497,8 +515,10 @@ TensorTakeAlongDimArgs ParseTensorTakeAlongDimArgs(Tcl_Interp* interp, int objc,
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-indices") {
                 args.indices = Tcl_GetString(objv[i + 1]);
+                args.indicesObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Invalid dim value");
@@ -521,18 +541,20 @@ int TensorTakeAlongDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
     try {
         TensorTakeAlongDimArgs args = ParseTensorTakeAlongDimArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.indices) == tensor_storage.end()) {
+        torch::Tensor* indices_tensor = FindTensorFromObj(args.indicesObj);
+        if (indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto indices = tensor_storage[args.indices];
+        auto input = *input_tensor;
+        auto indices = *indices_tensor;
 
         torch::Tensor output;
         if (args.dim >= 0) {
@@ -541,10 +563,9 @@ int TensorTakeAlongDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
             output = torch::take_along_dim(input, indices);
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -556,6 +577,8 @@ int TensorTakeAlongDim_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
 struct TensorGatherNdArgs {
     std::string input;
     std::string indices;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* indicesObj = nullptr;
 
     bool IsValid() const {
         return !input.empty() && !indices.empty();
@@ -572,7 +595,9 @@ TensorGatherNdArgs ParseTensorGatherNdArgs(Tcl_Interp* interp, int objc, Tcl_Obj
     if (objc >= 3 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax
         args.input   = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.indices = Tcl_GetString(objv[2]);
+        args.indicesObj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -583,8 +608,10 @@ TensorGatherNdArgs ParseTensorGatherNdArgs(Tcl_Interp* interp, int objc, Tcl_Obj
 
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-indices") {
                 args.indices = Tcl_GetString(objv[i + 1]);
+                args.indicesObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -603,25 +630,26 @@ int TensorGatherNd_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensorGatherNdArgs args = ParseTensorGatherNdArgs(interp, objc, objv);
 
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
-        if (tensor_storage.find(args.indices) == tensor_storage.end()) {
+        torch::Tensor* indices_tensor = FindTensorFromObj(args.indicesObj);
+        if (indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input   = tensor_storage[args.input];
-        auto indices = tensor_storage[args.indices];
+        auto input   = *input_tensor;
+        auto indices = *indices_tensor;
 
         // Simplified gather_nd implementation using index_select
         auto output = input.index_select(0, indices.flatten()).view_as(indices);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -634,6 +662,9 @@ struct ScatterNdArgs {
     std::string input;
     std::string indices;
     std::string updates;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* indicesObj = nullptr;
+    Tcl_Obj* updatesObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !indices.empty() && !updates.empty();
@@ -651,8 +682,11 @@ ScatterNdArgs ParseScatterNdArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.indices = Tcl_GetString(objv[2]);
+        args.indicesObj = objv[2];
         args.updates = Tcl_GetString(objv[3]);
+        args.updatesObj = objv[3];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -665,10 +699,13 @@ ScatterNdArgs ParseScatterNdArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-input") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-indices") {
                 args.indices = value;
+                args.indicesObj = objv[i + 1];
             } else if (param == "-updates") {
                 args.updates = value;
+                args.updatesObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -687,33 +724,35 @@ int TensorScatterNd_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         ScatterNdArgs args = ParseScatterNdArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.indices) == tensor_storage.end()) {
+        torch::Tensor* indices_tensor = FindTensorFromObj(args.indicesObj);
+        if (indices_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid indices tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.updates) == tensor_storage.end()) {
+        torch::Tensor* updates_tensor = FindTensorFromObj(args.updatesObj);
+        if (updates_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid updates tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto indices = tensor_storage[args.indices];
-        auto updates = tensor_storage[args.updates];
+        auto input = *input_tensor;
+        auto indices = *indices_tensor;
+        auto updates = *updates_tensor;
 
         // Simplified scatter_nd implementation
         auto output = input.clone();
         output.scatter_(0, indices, updates);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -724,6 +763,7 @@ int TensorScatterNd_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for meshgrid command
 struct MeshgridArgs {
     std::vector<std::string> tensors;
+    std::vector<Tcl_Obj*> tensorObjs;
     
     bool IsValid() const {
         return !tensors.empty();
@@ -742,6 +782,7 @@ MeshgridArgs ParseMeshgridArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         
         for (int i = 1; i < objc; i++) {
             args.tensors.push_back(Tcl_GetString(objv[i]));
+            args.tensorObjs.push_back(objv[i]);
         }
     } else {
         // Named parameter syntax
@@ -763,6 +804,7 @@ MeshgridArgs ParseMeshgridArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
                 
                 for (int j = 0; j < list_len; j++) {
                     args.tensors.push_back(Tcl_GetString(tensor_list[j]));
+                    args.tensorObjs.push_back(tensor_list[j]);
                 }
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
@@ -783,13 +825,14 @@ int TensorMeshgrid_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         MeshgridArgs args = ParseMeshgridArgs(interp, objc, objv);
         std::vector<torch::Tensor> tensors;
         
-        for (const auto& tensor_name : args.tensors) {
-            if (tensor_storage.find(tensor_name) == tensor_storage.end()) {
+        for (Tcl_Obj* tensor_obj : args.tensorObjs) {
+            torch::Tensor* tensor = FindTensorFromObj(tensor_obj);
+            if (tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
             
-            tensors.push_back(tensor_storage[tensor_name]);
+            tensors.push_back(*tensor);
         }
 
         auto grids = torch::meshgrid(tensors);
@@ -798,10 +841,9 @@ int TensorMeshgrid_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         Tcl_Obj* result_list = Tcl_NewListObj(0, nullptr);
         
         for (const auto& grid : grids) {
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = grid;
+            std::string handle = StoreTensor(grid);
             
-            Tcl_Obj* handle_obj = Tcl_NewStringObj(handle.c_str(), -1);
+            Tcl_Obj* handle_obj = NewHandleObj(handle);
             Tcl_ListObjAppendElement(interp, result_list, handle_obj);
         }
 
@@ -816,6 +858,7 @@ int TensorMeshgrid_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for combinations command
 struct CombinationsArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int r = 2;
     bool with_replacement = false;
     
@@ -835,6 +878,7 @@ CombinationsArgs ParseCombinationsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (objc > 2) {
             if (Tcl_GetIntFromObj(interp, objv[2], &args.r) != TCL_OK) {
@@ -861,6 +905,7 @@ CombinationsArgs ParseCombinationsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = value;
+                args.inputObj = objv[i + 1];
             } else if (param == "-r") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.r) != TCL_OK) {
                     throw std::runtime_error("Invalid -r parameter");
@@ -889,18 +934,18 @@ int TensorCombinations_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
     try {
         auto args = ParseCombinationsArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::combinations(input, args.r, args.with_replacement);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -911,6 +956,7 @@ int TensorCombinations_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
 // Parameter structure for cartesian_prod command
 struct CartesianProdArgs {
     std::vector<std::string> tensors;
+    std::vector<Tcl_Obj*> tensorObjs;
     
     bool IsValid() const {
         return !tensors.empty();
@@ -929,6 +975,7 @@ CartesianProdArgs ParseCartesianProdArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
         // Positional syntax (backward compatibility)
         for (int i = 1; i < objc; i++) {
             args.tensors.push_back(Tcl_GetString(objv[i]));
+            args.tensorObjs.push_back(objv[i]);
         }
     } else {
         // Named parameter syntax
@@ -950,10 +997,12 @@ CartesianProdArgs ParseCartesianProdArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
                     // It's a list
                     for (int j = 0; j < list_length; j++) {
                         args.tensors.push_back(Tcl_GetString(list_elements[j]));
+                        args.tensorObjs.push_back(list_elements[j]);
                     }
                 } else {
                     // It's a single tensor name
                     args.tensors.push_back(value);
+                    args.tensorObjs.push_back(objv[i + 1]);
                 }
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -tensors");
@@ -975,20 +1024,20 @@ int TensorCartesianProd_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
         
         std::vector<torch::Tensor> tensors;
         
-        for (const auto& tensor_name : args.tensors) {
-            if (tensor_storage.find(tensor_name) == tensor_storage.end()) {
+        for (Tcl_Obj* tensor_obj : args.tensorObjs) {
+            torch::Tensor* tensor = FindTensorFromObj(tensor_obj);
+            if (tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            tensors.push_back(tensor_storage[tensor_name]);
+            tensors.push_back(*tensor);
         }
 
         auto output = torch::cartesian_prod(tensors);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1000,6 +1049,8 @@ int TensorCartesianProd_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct TensordotArgs {
     std::string a;
     std::string b;
+    Tcl_Obj* aObj = nullptr;
+    Tcl_Obj* bObj = nullptr;
     std::vector<int64_t> dims;
     
     bool IsValid() const {
@@ -1019,7 +1070,9 @@ static TensordotArgs ParseTensordotArgs(Tcl_Interp* interp, int objc, Tcl_Obj* c
         }
         
         args.a = Tcl_GetString(objv[1]);
+        args.aObj = objv[1];
         args.b = Tcl_GetString(objv[2]);
+        args.bObj = objv[2];
         
         // Parse dims list
         int listLen;
@@ -1046,8 +1099,10 @@ static TensordotArgs ParseTensordotArgs(Tcl_Interp* interp, int objc, Tcl_Obj* c
             
             if (param == "-a") {
                 args.a = Tcl_GetString(objv[i + 1]);
+                args.aObj = objv[i + 1];
             } else if (param == "-b") {
                 args.b = Tcl_GetString(objv[i + 1]);
+                args.bObj = objv[i + 1];
             } else if (param == "-dims") {
                 // Parse dims list
                 int listLen;
@@ -1081,26 +1136,27 @@ int TensorTensordot_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         TensordotArgs args = ParseTensordotArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.a) == tensor_storage.end()) {
+        torch::Tensor* a_tensor = FindTensorFromObj(args.aObj);
+        if (a_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor a"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.b) == tensor_storage.end()) {
+        torch::Tensor* b_tensor = FindTensorFromObj(args.bObj);
+        if (b_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor b"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto a = tensor_storage[args.a];
-        auto b = tensor_storage[args.b];
+        auto a = *a_tensor;
+        auto b = *b_tensor;
 
         // tensordot requires dims_a and dims_b separately
         auto output = torch::tensordot(a, b, args.dims, args.dims);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1112,6 +1168,7 @@ int TensorTensordot_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct EinsumArgs {
     std::string equation;
     std::vector<std::string> tensors;
+    std::vector<Tcl_Obj*> tensorObjs;
     
     bool IsValid() const {
         return !equation.empty() && !tensors.empty();
@@ -1132,6 +1189,7 @@ EinsumArgs ParseEinsumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
         
         for (int i = 2; i < objc; i++) {
             args.tensors.push_back(Tcl_GetString(objv[i]));
+            args.tensorObjs.push_back(objv[i]);
         }
     } else {
         // Named parameter syntax
@@ -1155,10 +1213,12 @@ EinsumArgs ParseEinsumArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
                     // It's a list
                     for (int j = 0; j < list_length; j++) {
                         args.tensors.push_back(Tcl_GetString(list_elements[j]));
+                        args.tensorObjs.push_back(list_elements[j]);
                     }
                 } else {
                     // It's a single tensor name
                     args.tensors.push_back(value);
+                    args.tensorObjs.push_back(objv[i + 1]);
                 }
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -equation, -tensors");
@@ -1180,20 +1240,20 @@ int TensorEinsum_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         
         std::vector<torch::Tensor> tensors;
         
-        for (const auto& tensor_name : args.tensors) {
-            if (tensor_storage.find(tensor_name) == tensor_storage.end()) {
+        for (Tcl_Obj* tensor_obj : args.tensorObjs) {
+            torch::Tensor* tensor = FindTensorFromObj(tensor_obj);
+            if (tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            tensors.push_back(tensor_storage[tensor_name]);
+            tensors.push_back(*tensor);
         }
 
         auto output = torch::einsum(args.equation, tensors);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1207,6 +1267,8 @@ int TensorEinsum_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 struct KronArgs {
     std::string input;
     std::string other;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* otherObj = nullptr;
     
     bool IsValid() const {
         return !input.empty() && !other.empty();
@@ -1223,7 +1285,9 @@ KronArgs ParseKronArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.other = Tcl_GetString(objv[2]);
+        args.otherObj = objv[2];
     } else {
         // Named parameter syntax
         if (objc < 5) {
@@ -1238,8 +1302,10 @@ KronArgs ParseKronArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-other") {
                 args.other = Tcl_GetString(objv[i + 1]);
+                args.otherObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -1258,25 +1324,26 @@ int TensorKron_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         KronArgs args = ParseKronArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.other) == tensor_storage.end()) {
+        torch::Tensor* other_tensor = FindTensorFromObj(args.otherObj);
+        if (other_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid other tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto other = tensor_storage[args.other];
+        auto input = *input_tensor;
+        auto other = *other_tensor;
 
         auto output = torch::kron(input, other);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1287,6 +1354,7 @@ int TensorKron_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for broadcast_tensors command
 struct BroadcastTensorsArgs {
     std::vector<std::string> tensors;
+    std::vector<Tcl_Obj*> tensorObjs;
     
     bool IsValid() const {
         return !tensors.empty();
@@ -1305,6 +1373,7 @@ BroadcastTensorsArgs ParseBroadcastTensorsArgs(Tcl_Interp* interp, int objc, Tcl
         // Positional syntax (backward compatibility)
         for (int i = 1; i < objc; i++) {
             args.tensors.push_back(Tcl_GetString(objv[i]));
+            args.tensorObjs.push_back(objv[i]);
         }
     } else {
         // Named parameter syntax
@@ -1326,10 +1395,12 @@ BroadcastTensorsArgs ParseBroadcastTensorsArgs(Tcl_Interp* interp, int objc, Tcl
                     // It's a list
                     for (int j = 0; j < list_length; j++) {
                         args.tensors.push_back(Tcl_GetString(list_elements[j]));
+                        args.tensorObjs.push_back(list_elements[j]);
                     }
                 } else {
                     // It's a single tensor name
                     args.tensors.push_back(value);
+                    args.tensorObjs.push_back(objv[i + 1]);
                 }
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -tensors");
@@ -1351,12 +1422,13 @@ int TensorBroadcastTensors_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj
         
         std::vector<torch::Tensor> tensors;
         
-        for (const auto& tensor_name : args.tensors) {
-            if (tensor_storage.find(tensor_name) == tensor_storage.end()) {
+        for (Tcl_Obj* tensor_obj : args.tensorObjs) {
+            torch::Tensor* tensor = FindTensorFromObj(tensor_obj);
+            if (tensor == nullptr) {
                 Tcl_SetResult(interp, const_cast<char*>("Invalid tensor"), TCL_VOLATILE);
                 return TCL_ERROR;
             }
-            tensors.push_back(tensor_storage[tensor_name]);
+            tensors.push_back(*tensor);
         }
 
         auto broadcasted = torch::broadcast_tensors(tensors);
@@ -1365,10 +1437,9 @@ int TensorBroadcastTensors_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj
         Tcl_Obj* result_list = Tcl_NewListObj(0, nullptr);
         
         for (const auto& tensor : broadcasted) {
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = tensor;
+            std::string handle = StoreTensor(tensor);
             
-            Tcl_Obj* handle_obj = Tcl_NewStringObj(handle.c_str(), -1);
+            Tcl_Obj* handle_obj = NewHandleObj(handle);
             Tcl_ListObjAppendElement(interp, result_list, handle_obj);
         }
 
@@ -1383,6 +1454,7 @@ int TensorBroadcastTensors_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj
 // Parameter structure for atleast_1d command
 struct TensorAtleast1dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1406,6 +1478,7 @@ TensorAtleast1dArgs ParseTensorAtleast1dArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::atleast_1d tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1417,6 +1490,7 @@ TensorAtleast1dArgs ParseTensorAtleast1dArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -1436,18 +1510,18 @@ int TensorAtleast1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         TensorAtleast1dArgs args = ParseTensorAtleast1dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::atleast_1d(input);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1458,6 +1532,7 @@ int TensorAtleast1d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for atleast_2d command
 struct TensorAtleast2dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1481,6 +1556,7 @@ TensorAtleast2dArgs ParseTensorAtleast2dArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::atleast_2d tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1492,6 +1568,7 @@ TensorAtleast2dArgs ParseTensorAtleast2dArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -1511,18 +1588,18 @@ int TensorAtleast2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         TensorAtleast2dArgs args = ParseTensorAtleast2dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::atleast_2d(input);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1533,6 +1610,7 @@ int TensorAtleast2d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for atleast_3d command
 struct TensorAtleast3dArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     
     bool IsValid() const {
         return !input.empty();
@@ -1556,6 +1634,7 @@ TensorAtleast3dArgs ParseTensorAtleast3dArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::atleast_3d tensor");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1567,6 +1646,7 @@ TensorAtleast3dArgs ParseTensorAtleast3dArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
             }
@@ -1586,18 +1666,18 @@ int TensorAtleast3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         // Parse arguments using dual syntax
         TensorAtleast3dArgs args = ParseTensorAtleast3dArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::atleast_3d(input);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1608,6 +1688,8 @@ int TensorAtleast3d_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for tensor_to_list command
 struct TensorToListArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
+    bool nested = false;  // nest lists to match the tensor's shape
     
     bool IsValid() const {
         return !input.empty();
@@ -1619,15 +1701,19 @@ TensorToListArgs ParseTensorToListArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
     TensorToListArgs args;
     
     if (objc < 2) {
-        throw std::runtime_error("Usage: torch::tensor_to_list tensor | torch::tensor_to_list -input tensor");
+        throw std::runtime_error("Usage: torch::tensor_to_list tensor ?nested? | torch::tensor_to_list -input tensor ?-nested bool?");
     }
     
     if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
         // Positional syntax (backward compatibility)
-        if (objc != 2) {
-            throw std::runtime_error("Usage: torch::tensor_to_list tensor");
+        if (objc > 3) {
+            throw std::runtime_error("Usage: torch::tensor_to_list tensor ?nested?");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
+        if (objc == 3) {
+            args.nested = GetBoolFromObj(interp, objv[2]);
+        }
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1639,8 +1725,11 @@ TensorToListArgs ParseTensorToListArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
+            } else if (param == "-nested") {
+                args.nested = GetBoolFromObj(interp, objv[i + 1]);
             } else {
-                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor, -nested");
             }
         }
     }
@@ -1652,41 +1741,138 @@ TensorToListArgs ParseTensorToListArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
     return args;
 }
 
+// Tcl_Objs for small integers (and bools) created at most once per call, so
+// repeated labels, masks and token ids share a single object.
+class SmallIntObjCache {
+public:
+    SmallIntObjCache() : objs_(kMax - kMin + 1, nullptr) {}
+    ~SmallIntObjCache() {
+        for (Tcl_Obj* obj : objs_) {
+            if (obj != nullptr) {
+                Tcl_DecrRefCount(obj);
+            }
+        }
+    }
+
+    Tcl_Obj* Get(int64_t value) {
+        if (value < kMin || value > kMax) {
+            return Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(value));
+        }
+        Tcl_Obj*& obj = objs_[value - kMin];
+        if (obj == nullptr) {
+            obj = Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(value));
+            Tcl_IncrRefCount(obj);
+        }
+        return obj;
+    }
+
+private:
+    static constexpr int64_t kMin = -128;
+    static constexpr int64_t kMax = 255;
+    std::vector<Tcl_Obj*> objs_;
+};
+
+template <typename T>
+static Tcl_Obj* ElementToObj(T value, SmallIntObjCache& cache) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return cache.Get(value ? 1 : 0);
+    } else if constexpr (std::is_integral_v<T>) {
+        return cache.Get(static_cast<int64_t>(value));
+    } else {
+        return Tcl_NewDoubleObj(static_cast<double>(value));
+    }
+}
+
+// Walk a strided view in row-major order, writing one Tcl_Obj per element
+template <typename T>
+static void CollectStrided(const T* data, c10::IntArrayRef sizes, c10::IntArrayRef strides, size_t dim,
+                           Tcl_Obj**& out, SmallIntObjCache& cache) {
+    if (sizes.empty()) {
+        *out++ = ElementToObj(*data, cache);
+        return;
+    }
+    int64_t count = sizes[dim];
+    int64_t stride = strides[dim];
+    if (dim + 1 == sizes.size()) {
+        for (int64_t i = 0; i < count; ++i) {
+            *out++ = ElementToObj(data[i * stride], cache);
+        }
+    } else {
+        for (int64_t i = 0; i < count; ++i) {
+            CollectStrided(data + i * stride, sizes, strides, dim + 1, out, cache);
+        }
+    }
+}
+
+// Build nested lists matching the shape of a strided view
+template <typename T>
+static Tcl_Obj* NestedStrided(const T* data, c10::IntArrayRef sizes, c10::IntArrayRef strides, size_t dim,
+                              SmallIntObjCache& cache) {
+    int64_t count = sizes[dim];
+    int64_t stride = strides[dim];
+    std::vector<Tcl_Obj*> items(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+        items[i] = dim + 1 == sizes.size()
+            ? ElementToObj(data[i * stride], cache)
+            : NestedStrided(data + i * stride, sizes, strides, dim + 1, cache);
+    }
+    return Tcl_NewListObj(static_cast<int>(count), items.data());
+}
+
+template <typename T>
+static Tcl_Obj* StridedTensorToList(const torch::Tensor& tensor, bool nested) {
+    const T* data = tensor.data_ptr<T>();
+    SmallIntObjCache cache;
+
+    if (nested && tensor.dim() > 0) {
+        return NestedStrided(data, tensor.sizes(), tensor.strides(), 0, cache);
+    }
+
+    // Flat: fill a preallocated array and build the list in one call
+    std::vector<Tcl_Obj*> items(static_cast<size_t>(tensor.numel()));
+    Tcl_Obj** out = items.data();
+    if (tensor.numel() > 0) {
+        CollectStrided(data, tensor.sizes(), tensor.strides(), 0, out, cache);
+    }
+    return Tcl_NewListObj(static_cast<int>(items.size()), items.data());
+}
+
 int TensorToList_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     (void)cd; // Suppress unused parameter warning
     try {
         TensorToListArgs args = ParseTensorToListArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid tensor name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& tensor = tensor_storage[args.input];
-        
-        // Convert tensor to flat array
-        auto flat_tensor = tensor.flatten();
-        
-        // Create TCL list
-        Tcl_Obj* result_list = Tcl_NewListObj(0, nullptr);
+        // Strided CPU views are read in place; only other devices are copied
+        torch::Tensor tensor = *input;
+        if (!tensor.device().is_cpu()) {
+            tensor = tensor.cpu();
+        }
+        if (tensor.numel() > INT_MAX) {
+            throw std::runtime_error("Tensor too large for a Tcl list");
+        }
         
-        // Handle different data types
-        if (tensor.dtype() == torch::kBool) {
-            auto accessor = flat_tensor.accessor<bool, 1>();
-            for (int64_t i = 0; i < flat_tensor.size(0); ++i) {
-                Tcl_ListObjAppendElement(interp, result_list, Tcl_NewBooleanObj(accessor[i]));
-            }
-        } else if (tensor.dtype() == torch::kInt32 || tensor.dtype() == torch::kInt64) {
-            auto accessor = flat_tensor.accessor<int64_t, 1>();
-            for (int64_t i = 0; i < flat_tensor.size(0); ++i) {
-                Tcl_ListObjAppendElement(interp, result_list, Tcl_NewLongObj(accessor[i]));
-            }
-        } else {
-            // Default to float for all other types
-            auto accessor = flat_tensor.accessor<float, 1>();
-            for (int64_t i = 0; i < flat_tensor.size(0); ++i) {
-                Tcl_ListObjAppendElement(interp, result_list, Tcl_NewDoubleObj(accessor[i]));
-            }
+        Tcl_Obj* result_list;
+        switch (tensor.scalar_type()) {
+            case torch::kFloat32:  result_list = StridedTensorToList<float>(tensor, args.nested); break;
+            case torch::kFloat64:  result_list = StridedTensorToList<double>(tensor, args.nested); break;
+            case torch::kFloat16:  result_list = StridedTensorToList<c10::Half>(tensor, args.nested); break;
+            case torch::kBFloat16: result_list = StridedTensorToList<c10::BFloat16>(tensor, args.nested); break;
+            case torch::kInt64:    result_list = StridedTensorToList<int64_t>(tensor, args.nested); break;
+            case torch::kInt32:    result_list = StridedTensorToList<int32_t>(tensor, args.nested); break;
+            case torch::kInt16:    result_list = StridedTensorToList<int16_t>(tensor, args.nested); break;
+            case torch::kInt8:     result_list = StridedTensorToList<int8_t>(tensor, args.nested); break;
+            case torch::kUInt8:    result_list = StridedTensorToList<uint8_t>(tensor, args.nested); break;
+            case torch::kBool:     result_list = StridedTensorToList<bool>(tensor, args.nested); break;
+            default:
+                // Anything else (e.g. complex) goes through float32 as before
+                result_list = StridedTensorToList<float>(tensor.to(torch::kFloat32), args.nested);
+                break;
         }
         
         Tcl_SetObjResult(interp, result_list);
@@ -1700,6 +1886,7 @@ int TensorToList_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const
 // Parameter structure for tensor_select command
 struct TensorSelectArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int64_t dim;
     
     bool IsValid() const {
@@ -1721,6 +1908,7 @@ TensorSelectArgs ParseTensorSelectArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             throw std::runtime_error("Error in tensor_select: Usage: torch::tensor_select tensor dim");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetLongFromObj(interp, objv[2], &args.dim) != TCL_OK) {
             throw std::runtime_error("Error in tensor_select: Invalid dimension index");
         }
@@ -1734,6 +1922,7 @@ TensorSelectArgs ParseTensorSelectArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-dim") {
                 if (Tcl_GetLongFromObj(interp, objv[i + 1], &args.dim) != TCL_OK) {
                     throw std::runtime_error("Error in tensor_select: Invalid dimension index");
@@ -1756,11 +1945,12 @@ int TensorSelect_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         TensorSelectArgs args = ParseTensorSelectArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             throw std::runtime_error("Error in tensor_select: Invalid input tensor");
         }
         
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         
         if (args.dim < 0 || args.dim >= input.dim()) {
             throw std::runtime_error("Error in tensor_select: Dimension index out of range");
@@ -1768,10 +1958,9 @@ int TensorSelect_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         
         auto result = input.select(args.dim, 0);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -0,0 +1,581 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Closes a file descriptor on scope exit; the mapping outlives it
+struct ScopedFd {
+    int fd;
+    explicit ScopedFd(int f) : fd(f) {}
+    ~ScopedFd() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+};
+
+// Live mappings by base address, so flush can tell mapped storage apart from
+// ordinary allocations. Deleters may run on any thread.
+static std::map<uintptr_t, size_t> live_mappings;
+static std::mutex live_mappings_mutex;
+
+static std::string ErrnoMessage(const std::string& what, const std::string& path) {
+    return what + " \"" + path + "\": " + std::strerror(errno);
+}
+
+static int64_t ShapeNumel(const std::vector<int64_t>& shape) {
+    int64_t numel = 1;
+    for (int64_t dim : shape) {
+        if (dim < 0) {
+            throw std::runtime_error("Shape dimensions must be non-negative");
+        }
+        numel *= dim;
+    }
+    return numel;
+}
+
+// Map length bytes of fd and wrap the region starting at data_offset in a
+// tensor. The mapping is released by the tensor's deleter, so views and
+// slices keep it alive and only the pages they touch are ever read.
+static torch::Tensor MapTensor(int fd, size_t length, bool writable_shared, size_t data_offset,
+                               const std::vector<int64_t>& shape, const std::vector<int64_t>& strides,
+                               c10::ScalarType dtype, const std::string& path) {
+    if (length == 0 || ShapeNumel(shape) == 0) {
+        return torch::empty(shape, torch::TensorOptions().dtype(dtype));
+    }
+
+    // Read-only maps are private copy-on-write, so in-place ops on the tensor
+    // never reach the file (and never fault)
+    int flags = writable_shared ? MAP_SHARED : MAP_PRIVATE;
+    void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, fd, 0);
+    if (base == MAP_FAILED) {
+        throw std::runtime_error(ErrnoMessage("Failed to map", path));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(live_mappings_mutex);
+        live_mappings[reinterpret_cast<uintptr_t>(base)] = length;
+    }
+    auto deleter = [base, length](void*) {
+        {
+            std::lock_guard<std::mutex> lock(live_mappings_mutex);
+            live_mappings.erase(reinterpret_cast<uintptr_t>(base));
+        }
+        munmap(base, length);
+    };
+    return torch::from_blob(static_cast<char*>(base) + data_offset, shape, strides, deleter,
+                            torch::TensorOptions().dtype(dtype));
+}
+
+static std::vector<int64_t> ContiguousStrides(const std::vector<int64_t>& shape, bool fortran_order) {
+    std::vector<int64_t> strides(shape.size());
+    int64_t stride = 1;
+    if (fortran_order) {
+        for (size_t i = 0; i < shape.size(); i++) {
+            strides[i] = stride;
+            stride *= std::max<int64_t>(shape[i], 1);
+        }
+    } else {
+        for (size_t i = shape.size(); i-- > 0;) {
+            strides[i] = stride;
+            stride *= std::max<int64_t>(shape[i], 1);
+        }
+    }
+    return strides;
+}
+
+// Map a raw or .npy file as a tensor. dtype may be empty and shape null for
+// .npy files (if given they must match the header); offset < 0 means the
+// start of the data, and is the only value .npy files accept.
+torch::Tensor MapTensorFile(const std::string& path, const std::string& dtype_name,
+                            const std::vector<int64_t>* shape, int64_t offset, bool writable) {
+    ScopedFd file(open(path.c_str(), writable ? O_RDWR : O_RDONLY));
+    if (file.fd < 0) {
+        throw std::runtime_error(ErrnoMessage("Failed to open", path));
+    }
+    struct stat st;
+    if (fstat(file.fd, &st) != 0) {
+        throw std::runtime_error(ErrnoMessage("Failed to stat", path));
+    }
+    size_t file_size = static_cast<size_t>(st.st_size);
+
+    // Peek at the fixed fields of a .npy header; the header itself is read
+    // once its length is known, since version 2.0 and 3.0 headers can be
+    // far larger than any fixed buffer
+    unsigned char head[NpyHeaderPrefixMax];
+    ssize_t head_len = pread(file.fd, head, sizeof(head), 0);
+    if (head_len < 0) {
+        throw std::runtime_error(ErrnoMessage("Failed to read", path));
+    }
+
+    c10::ScalarType dtype;
+    std::vector<int64_t> dims = shape != nullptr ? *shape : std::vector<int64_t>();
+    bool fortran_order = false;
+    size_t data_offset = 0;
+
+    bool is_npy = IsNpyData(head, static_cast<size_t>(head_len));
+    if (is_npy) {
+        if (offset >= 0) {
+            throw std::runtime_error("Offset does not apply to .npy files; the data starts after the header");
+        }
+        size_t header_size = NpyHeaderSize(head, static_cast<size_t>(head_len));
+        if (header_size > file_size) {
+            throw std::runtime_error("Truncated .npy header");
+        }
+        std::vector<unsigned char> header_bytes(header_size);
+        if (pread(file.fd, header_bytes.data(), header_size, 0) != static_cast<ssize_t>(header_size)) {
+            throw std::runtime_error(ErrnoMessage("Failed to read", path));
+        }
+        NpyHeader header = ParseNpyHeader(header_bytes.data(), header_size);
+        dtype = header.dtype;
+        if (!dtype_name.empty() && GetScalarType(dtype_name.c_str()) != dtype) {
+            throw std::runtime_error("dtype " + dtype_name + " does not match the .npy header");
+        }
+        if (shape != nullptr && *shape != header.shape) {
+            throw std::runtime_error("Shape does not match the .npy header");
+        }
+        dims = header.shape;
+        fortran_order = header.fortran_order;
+        data_offset = header.data_offset;
+    } else {
+        if (dtype_name.empty()) {
+            throw std::runtime_error("Required parameter missing: dtype (raw files have no header)");
+        }
+        dtype = GetScalarType(dtype_name.c_str());
+    }
+    if (offset >= 0) {
+        data_offset = static_cast<size_t>(offset);
+    }
+
+    size_t element_size = c10::elementSize(dtype);
+    if (data_offset % element_size != 0) {
+        throw std::runtime_error("Offset must be a multiple of the element size " + std::to_string(element_size));
+    }
+    if (data_offset > file_size) {
+        throw std::runtime_error("Offset is past the end of the file");
+    }
+    if (!is_npy && shape == nullptr) {
+        dims = {static_cast<int64_t>((file_size - data_offset) / element_size)};
+    }
+
+    size_t nbytes = static_cast<size_t>(ShapeNumel(dims)) * element_size;
+    if (data_offset + nbytes > file_size) {
+        throw std::runtime_error("File \"" + path + "\" is too small for the requested shape (" +
+                                 std::to_string(data_offset + nbytes) + " bytes needed, " +
+                                 std::to_string(file_size) + " available)");
+    }
+
+    return MapTensor(file.fd, data_offset + nbytes, writable, data_offset, dims,
+                     ContiguousStrides(dims, fortran_order), dtype, path);
+}
+
+// Parameter structure for tensor_mmap command
+struct TensorMmapArgs {
+    std::string path;
+    std::string dtype;               // required for raw files
+    std::vector<int64_t> shape;
+    bool has_shape = false;
+    int64_t offset = -1;             // byte offset of the first element
+    std::string mode = "r";
+
+    bool IsValid() const {
+        return !path.empty() && (mode == "r" || mode == "rw");
+    }
+};
+
+// Parse dual syntax: path ?dtype? ?shape? ?offset? ?mode? |
+// -path path ?-dtype dtype? ?-shape shape? ?-offset bytes? ?-mode r|rw?
+static TensorMmapArgs ParseTensorMmapArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    TensorMmapArgs args;
+
+    if (objc < 2) {
+        throw std::runtime_error("Usage: torch::tensor_mmap path ?-dtype dtype? ?-shape shape? ?-offset bytes? ?-mode r|rw?");
+    }
+
+    int first = 1;
+    if (Tcl_GetString(objv[1])[0] != '-') {
+        // Positional path, then positional or named options
+        args.path = Tcl_GetString(objv[1]);
+        first = 2;
+        if (objc > 2 && Tcl_GetString(objv[2])[0] != '-') {
+            if (objc > 6) {
+                throw std::runtime_error("Usage: torch::tensor_mmap path ?dtype? ?shape? ?offset? ?mode?");
+            }
+            args.dtype = Tcl_GetString(objv[2]);
+            if (objc > 3) {
+                args.shape = TclListToShape(interp, objv[3]);
+                args.has_shape = true;
+            }
+            if (objc > 4) {
+                args.offset = GetInt64FromObj(interp, objv[4]);
+            }
+            if (objc > 5) {
+                args.mode = Tcl_GetString(objv[5]);
+            }
+            first = objc;
+        }
+    }
+
+    for (int i = first; i < objc; i += 2) {
+        if (i + 1 >= objc) {
+            throw std::runtime_error("Missing value for parameter");
+        }
+
+        std::string param = Tcl_GetString(objv[i]);
+        if (param == "-path") {
+            args.path = Tcl_GetString(objv[i + 1]);
+        } else if (param == "-dtype") {
+            args.dtype = Tcl_GetString(objv[i + 1]);
+        } else if (param == "-shape") {
+            args.shape = TclListToShape(interp, objv[i + 1]);
+            args.has_shape = true;
+        } else if (param == "-offset") {
+            args.offset = GetInt64FromObj(interp, objv[i + 1]);
+        } else if (param == "-mode") {
+            args.mode = Tcl_GetString(objv[i + 1]);
+        } else {
+            throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -path, -dtype, -shape, -offset, -mode");
+        }
+    }
+
+    if (args.path.empty()) {
+        throw std::runtime_error("Required parameter missing: path");
+    }
+    if (!args.IsValid()) {
+        throw std::runtime_error("Invalid mode: " + args.mode + ". Valid modes are: r, rw");
+    }
+    if (args.offset < -1) {
+        throw std::runtime_error("Offset must be non-negative");
+    }
+
+    return args;
+}
+
+// torch::tensor_mmap - Map a raw or .npy file into a tensor without reading it
+int TensorMmap_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        TensorMmapArgs args = ParseTensorMmapArgs(interp, objc, objv);
+
+        torch::Tensor tensor = MapTensorFile(args.path, args.dtype, args.has_shape ? &args.shape : nullptr,
+                                             args.offset, args.mode == "rw");
+
+        std::string handle = StoreTensor(tensor);
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for tensor_mmap_create command
+struct TensorMmapCreateArgs {
+    std::string path;
+    std::string dtype;
+    std::vector<int64_t> shape;
+    bool has_shape = false;
+    std::string format;              // raw or npy; from the extension by default
+
+    bool IsValid() const {
+        return !path.empty() && !dtype.empty() && has_shape;
+    }
+};
+
+// Parse dual syntax: path dtype shape ?format? |
+// -path path -dtype dtype -shape shape ?-format raw|npy?
+static TensorMmapCreateArgs ParseTensorMmapCreateArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    TensorMmapCreateArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 4 || objc > 5) {
+            throw std::runtime_error("Usage: torch::tensor_mmap_create path dtype shape ?format?");
+        }
+        args.path = Tcl_GetString(objv[1]);
+        args.dtype = Tcl_GetString(objv[2]);
+        args.shape = TclListToShape(interp, objv[3]);
+        args.has_shape = true;
+        if (objc == 5) {
+            args.format = Tcl_GetString(objv[4]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-path") {
+                args.path = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-dtype") {
+                args.dtype = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-shape") {
+                args.shape = TclListToShape(interp, objv[i + 1]);
+                args.has_shape = true;
+            } else if (param == "-format") {
+                args.format = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -path, -dtype, -shape, -format");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: path, dtype and shape");
+    }
+    if (args.format.empty()) {
+        bool npy = args.path.size() >= 4 && args.path.compare(args.path.size() - 4, 4, ".npy") == 0;
+        args.format = npy ? "npy" : "raw";
+    }
+    if (args.format != "raw" && args.format != "npy") {
+        throw std::runtime_error("Invalid format: " + args.format + ". Valid formats are: raw, npy");
+    }
+
+    return args;
+}
+
+// torch::tensor_mmap_create - Preallocate a file and map it writable. Writes
+// into the returned tensor go straight to the file.
+int TensorMmapCreate_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        TensorMmapCreateArgs args = ParseTensorMmapCreateArgs(interp, objc, objv);
+        c10::ScalarType dtype = GetScalarType(args.dtype.c_str());
+
+        std::string header;
+        if (args.format == "npy") {
+            header = BuildNpyHeader(dtype, args.shape);
+        }
+        size_t nbytes = static_cast<size_t>(ShapeNumel(args.shape)) * c10::elementSize(dtype);
+        size_t length = header.size() + nbytes;
+
+        ScopedFd file(open(args.path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644));
+        if (file.fd < 0) {
+            throw std::runtime_error(ErrnoMessage("Failed to create", args.path));
+        }
+        if (!header.empty() && pwrite(file.fd, header.data(), header.size(), 0) != static_cast<ssize_t>(header.size())) {
+            throw std::runtime_error(ErrnoMessage("Failed to write header to", args.path));
+        }
+        if (ftruncate(file.fd, static_cast<off_t>(length)) != 0) {
+            throw std::runtime_error(ErrnoMessage("Failed to size", args.path));
+        }
+        // Reserve the blocks up front so a full disk fails here rather than
+        // with SIGBUS halfway through; not every filesystem supports it
+        int rc = posix_fallocate(file.fd, 0, static_cast<off_t>(length));
+        if (rc != 0 && rc != EOPNOTSUPP && rc != EINVAL) {
+            errno = rc;
+            throw std::runtime_error(ErrnoMessage("Failed to preallocate", args.path));
+        }
+
+        torch::Tensor tensor = MapTensor(file.fd, length, true, header.size(), args.shape,
+                                         ContiguousStrides(args.shape, false), dtype, args.path);
+
+        std::string handle = StoreTensor(tensor);
+
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for tensor_mmap_write command
+struct TensorMmapWriteArgs {
+    std::string target;
+    Tcl_Obj* targetObj = nullptr;
+    int64_t row = -1;
+    std::string source;
+    Tcl_Obj* sourceObj = nullptr;
+
+    bool IsValid() const {
+        return !target.empty() && row >= 0 && !source.empty();
+    }
+};
+
+// Parse dual syntax: target row source | -target tensor -row index -source tensor
+static TensorMmapWriteArgs ParseTensorMmapWriteArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    TensorMmapWriteArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 4) {
+            throw std::runtime_error("Usage: torch::tensor_mmap_write target row source");
+        }
+        args.target = Tcl_GetString(objv[1]);
+        args.targetObj = objv[1];
+        args.row = GetInt64FromObj(interp, objv[2]);
+        args.source = Tcl_GetString(objv[3]);
+        args.sourceObj = objv[3];
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-target") {
+                args.target = Tcl_GetString(objv[i + 1]);
+                args.targetObj = objv[i + 1];
+            } else if (param == "-row") {
+                args.row = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-source") {
+                args.source = Tcl_GetString(objv[i + 1]);
+                args.sourceObj = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -target, -row, -source");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: target, row (non-negative) and source");
+    }
+
+    return args;
+}
+
+// torch::tensor_mmap_write - Copy one row or a block of rows into a (mapped)
+// tensor starting at row; returns the index of the next row to write
+int TensorMmapWrite_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        TensorMmapWriteArgs args = ParseTensorMmapWriteArgs(interp, objc, objv);
+
+        torch::Tensor* target = FindTensorFromObj(args.targetObj);
+        if (target == nullptr) {
+            throw std::runtime_error("Invalid target tensor name: " + args.target);
+        }
+        torch::Tensor* source = FindTensorFromObj(args.sourceObj);
+        if (source == nullptr) {
+            throw std::runtime_error("Invalid source tensor name: " + args.source);
+        }
+        if (target->dim() == 0) {
+            throw std::runtime_error("Target tensor must have at least one dimension");
+        }
+
+        torch::Tensor rows = *source;
+        if (rows.dim() == target->dim() - 1) {
+            rows = rows.unsqueeze(0);
+        }
+        if (rows.dim() != target->dim() || rows.sizes().slice(1) != target->sizes().slice(1)) {
+            throw std::runtime_error("Source rows do not match the target's row shape");
+        }
+        int64_t count = rows.size(0);
+        if (args.row + count > target->size(0)) {
+            throw std::runtime_error("Rows " + std::to_string(args.row) + ".." + std::to_string(args.row + count - 1) +
+                                     " are out of range for a target with " + std::to_string(target->size(0)) + " rows");
+        }
+
+        torch::NoGradGuard no_grad;
+        target->narrow(0, args.row, count).copy_(rows);
+
+        Tcl_SetObjResult(interp, Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(args.row + count)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for tensor_mmap_flush command
+struct TensorMmapFlushArgs {
+    std::string input;
+    Tcl_Obj* inputObj = nullptr;
+
+    bool IsValid() const {
+        return !input.empty();
+    }
+};
+
+// Parse dual syntax: tensor | -input tensor
+static TensorMmapFlushArgs ParseTensorMmapFlushArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp; // Suppress unused parameter warning
+    TensorMmapFlushArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 2) {
+            throw std::runtime_error("Usage: torch::tensor_mmap_flush tensor");
+        }
+        args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-input" || param == "-tensor") {
+                args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -input, -tensor");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: input tensor");
+    }
+
+    return args;
+}
+
+// torch::tensor_mmap_flush - Write dirty pages of a mapped tensor to disk
+int TensorMmapFlush_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        TensorMmapFlushArgs args = ParseTensorMmapFlushArgs(interp, objc, objv);
+
+        torch::Tensor* input = FindTensorFromObj(args.inputObj);
+        if (input == nullptr) {
+            throw std::runtime_error("Invalid tensor name: " + args.input);
+        }
+
+        // Find the mapping that holds the tensor's storage; the storage of a
+        // .npy tensor starts just past the header, inside the mapping
+        uintptr_t data = reinterpret_cast<uintptr_t>(input->storage().data());
+        uintptr_t base = 0;
+        size_t length = 0;
+        {
+            std::lock_guard<std::mutex> lock(live_mappings_mutex);
+            auto it = live_mappings.upper_bound(data);
+            if (it != live_mappings.begin()) {
+                --it;
+                if (data < it->first + it->second) {
+                    base = it->first;
+                    length = it->second;
+                }
+            }
+        }
+        if (length == 0) {
+            throw std::runtime_error("Tensor is not backed by a mapped file");
+        }
+        if (msync(reinterpret_cast<void*>(base), length, MS_SYNC) != 0) {
+            throw std::runtime_error(std::string("Failed to flush mapped file: ") + std::strerror(errno));
+        }
+
+        Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -0,0 +1,624 @@
+#include "libtorchtcl.h"
+#include <algorithm>
+#include <torch/script.h>
+#include <torch/csrc/jit/frontend/tracer.h>
+#include <torch/csrc/jit/runtime/graph_executor.h>
+
+// A TorchScript module stored alongside the native modules. Its parameters
+// and buffers are registered on the wrapper (sharing storage with the script
+// module), so layer_parameters, layer_to, model_train/model_eval and the
+// optimizers work on it like on any other module handle.
+class ConcreteScriptModule : public torch::nn::Module {
+public:
+    explicit ConcreteScriptModule(torch::jit::Module module) : script(std::move(module)) {
+        // Registered names may not contain dots
+        auto flat = [](std::string name) {
+            std::replace(name.begin(), name.end(), '.', '_');
+            return name;
+        };
+        for (const auto& parameter : script.named_parameters()) {
+            register_parameter(flat(parameter.name), parameter.value, parameter.value.requires_grad());
+        }
+        for (const auto& buffer : script.named_buffers()) {
+            register_buffer(flat(buffer.name), buffer.value);
+        }
+    }
+
+    void train(bool on = true) override {
+        torch::nn::Module::train(on);
+        script.train(on);
+    }
+
+    torch::jit::IValue run(const std::string& method, std::vector<torch::jit::IValue> inputs) {
+        return script.get_method(method)(std::move(inputs));
+    }
+
+    // Single tensor in, single tensor out; bound by StoreModule for
+    // layer_forward, sequential and the fused training commands
+    torch::Tensor forward(const torch::Tensor& input) {
+        torch::jit::IValue result = run("forward", {input});
+        if (!result.isTensor()) {
+            throw std::runtime_error("TorchScript forward did not return a single tensor; use torch::jit_forward");
+        }
+        return result.toTensor();
+    }
+
+    torch::jit::Module script;
+};
+
+// Convert a TorchScript return value: tensors become handles, tuples and
+// lists become Tcl lists, scalars and strings become plain values
+static Tcl_Obj* IValueToTclObj(const torch::jit::IValue& value) {
+    if (value.isTensor()) {
+        return NewHandleObj(ReserveTensorHandle().Fill(value.toTensor()));
+    }
+    if (value.isTuple() || value.isList() || value.isTensorList()) {
+        Tcl_Obj* list = Tcl_NewListObj(0, nullptr);
+        std::vector<torch::jit::IValue> elements;
+        if (value.isTuple()) {
+            elements = value.toTupleRef().elements().vec();
+        } else {
+            elements = value.toListRef().vec();
+        }
+        for (const auto& element : elements) {
+            Tcl_ListObjAppendElement(nullptr, list, IValueToTclObj(element));
+        }
+        return list;
+    }
+    if (value.isNone()) {
+        return Tcl_NewObj();
+    }
+    if (value.isBool()) {
+        return Tcl_NewBooleanObj(value.toBool());
+    }
+    if (value.isInt()) {
+        return Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(value.toInt()));
+    }
+    if (value.isDouble()) {
+        return Tcl_NewDoubleObj(value.toDouble());
+    }
+    if (value.isString()) {
+        return Tcl_NewStringObj(value.toStringRef().c_str(), -1);
+    }
+    throw std::runtime_error("Unsupported TorchScript return type: " + value.tagKind());
+}
+
+// ============================================================================
+// torch::jit_load
+// ============================================================================
+
+// Parameter structure for jit_load command
+struct JitLoadArgs {
+    std::string path;
+    std::string device;
+    bool freeze = false;
+    bool optimizeForInference = false;
+
+    bool IsValid() const {
+        return !path.empty();
+    }
+};
+
+// Parse dual syntax: path ?device? ?freeze? ?optimizeForInference? |
+// -path file ?-device dev? ?-freeze bool? ?-optimizeForInference bool?
+static JitLoadArgs ParseJitLoadArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    JitLoadArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc > 5) {
+            throw std::runtime_error("Usage: torch::jit_load path ?device? ?freeze? ?optimizeForInference?");
+        }
+        args.path = Tcl_GetString(objv[1]);
+        if (objc > 2) {
+            args.device = Tcl_GetString(objv[2]);
+        }
+        if (objc > 3) {
+            args.freeze = GetBoolFromObj(interp, objv[3]);
+        }
+        if (objc > 4) {
+            args.optimizeForInference = GetBoolFromObj(interp, objv[4]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-path" || param == "-file") {
+                args.path = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-device") {
+                args.device = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-freeze") {
+                args.freeze = GetBoolFromObj(interp, objv[i + 1]);
+            } else if (param == "-optimizeForInference" || param == "-optimize_for_inference") {
+                args.optimizeForInference = GetBoolFromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -path, -device, -freeze, -optimizeForInference");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: path");
+    }
+
+    return args;
+}
+
+// torch::jit_load - Load a TorchScript archive saved with torch.jit.save and
+// return a module handle
+int JitLoad_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        JitLoadArgs args = ParseJitLoadArgs(interp, objc, objv);
+
+        // Profiling and specialization in the graph executor are what make
+        // repeated calls fast; make sure nothing turned them off
+        torch::jit::setGraphExecutorOptimize(true);
+
+        torch::jit::Module module;
+        try {
+            if (args.device.empty()) {
+                module = torch::jit::load(args.path);
+            } else {
+                module = torch::jit::load(args.path, GetDevice(args.device.c_str()));
+            }
+        } catch (const c10::Error& e) {
+            throw std::runtime_error("Failed to load TorchScript module " + args.path + ": " + e.what_without_backtrace());
+        }
+
+        // Freezing inlines parameters and attributes into the graph, so it
+        // only makes sense for inference
+        if (args.freeze || args.optimizeForInference) {
+            module.eval();
+        }
+        if (args.optimizeForInference) {
+            module = torch::jit::optimize_for_inference(module);
+        } else if (args.freeze) {
+            module = torch::jit::freeze(module);
+        }
+
+        auto wrapper = std::make_shared<ConcreteScriptModule>(std::move(module));
+        if (args.freeze || args.optimizeForInference) {
+            wrapper->eval();
+        }
+        Tcl_SetObjResult(interp, NewHandleObj(StoreModule("script", wrapper)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::jit_forward
+// ============================================================================
+
+// Parameter structure for jit_forward command
+struct JitForwardArgs {
+    Tcl_Obj* module = nullptr;
+    Tcl_Obj* inputs = nullptr;
+    std::string method = "forward";
+
+    bool IsValid() const {
+        return module != nullptr && inputs != nullptr;
+    }
+};
+
+// Parse dual syntax: module inputs ?method? |
+// -module handle -inputs {tensor ...} ?-method name?
+static JitForwardArgs ParseJitForwardArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    JitForwardArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 3 || objc > 4) {
+            throw std::runtime_error("Usage: torch::jit_forward module inputs ?method?");
+        }
+        args.module = objv[1];
+        args.inputs = objv[2];
+        if (objc > 3) {
+            args.method = Tcl_GetString(objv[3]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-module" || param == "-model") {
+                args.module = objv[i + 1];
+            } else if (param == "-inputs" || param == "-input") {
+                args.inputs = objv[i + 1];
+            } else if (param == "-method") {
+                args.method = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -module, -inputs, -method");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: module and inputs");
+    }
+
+    return args;
+}
+
+// torch::jit_forward - Call a method of a TorchScript module with any number
+// of tensor or numeric arguments
+int JitForward_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        JitForwardArgs args = ParseJitForwardArgs(interp, objc, objv);
+
+        ModuleRef* module = FindModuleFromObj(args.module);
+        if (module == nullptr) {
+            throw std::runtime_error(std::string("Invalid module: ") + Tcl_GetString(args.module));
+        }
+        auto script = std::dynamic_pointer_cast<ConcreteScriptModule>(*module);
+        if (script == nullptr) {
+            throw std::runtime_error("torch::jit_forward needs a module loaded with torch::jit_load");
+        }
+
+        int count;
+        Tcl_Obj** items;
+        if (Tcl_ListObjGetElements(interp, args.inputs, &count, &items) != TCL_OK) {
+            throw std::runtime_error("inputs must be a list");
+        }
+        std::vector<torch::jit::IValue> inputs;
+        inputs.reserve(count);
+        for (int i = 0; i < count; i++) {
+            Tcl_WideInt integer;
+            double real;
+            if (torch::Tensor* tensor = FindTensorFromObj(items[i])) {
+                inputs.emplace_back(*tensor);
+            } else if (Tcl_GetWideIntFromObj(nullptr, items[i], &integer) == TCL_OK) {
+                inputs.emplace_back(static_cast<int64_t>(integer));
+            } else if (Tcl_GetDoubleFromObj(nullptr, items[i], &real) == TCL_OK) {
+                inputs.emplace_back(real);
+            } else {
+                throw std::runtime_error(std::string("Invalid input: ") + Tcl_GetString(items[i]));
+            }
+        }
+
+        torch::jit::IValue result;
+        try {
+            result = script->run(args.method, std::move(inputs));
+        } catch (const c10::Error& e) {
+            throw std::runtime_error(e.what_without_backtrace());
+        }
+
+        Tcl_SetObjResult(interp, IValueToTclObj(result));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::model_trace
+// ============================================================================
+
+// Record the forward pass of a native module into a TorchScript graph. The
+// module's parameters and buffers become attributes of the new script module
+// so the tracer emits attribute reads for them rather than copies. Once the
+// graph exists those attributes are replaced by detached copies, so the
+// traced module no longer shares storage with the source model.
+static torch::jit::Module TraceNativeModule(const ModuleRef& model,
+                                            const torch::Tensor& example) {
+    torch::jit::Module traced(c10::QualifiedName("__torch__.TracedModel"));
+    // freeze and optimize_for_inference only inline modules that carry it
+    traced.register_attribute("training", c10::BoolType::get(), false);
+
+    std::vector<std::pair<std::string, torch::Tensor>> attributes;
+    for (const auto& parameter : model->named_parameters()) {
+        std::string name = parameter.key();
+        std::replace(name.begin(), name.end(), '.', '_');
+        traced.register_parameter(name, parameter.value(), false);
+        attributes.emplace_back(name, parameter.value());
+    }
+    for (const auto& buffer : model->named_buffers()) {
+        std::string name = buffer.key();
+        std::replace(name.begin(), name.end(), '.', '_');
+        traced.register_buffer(name, buffer.value());
+        attributes.emplace_back(name, buffer.value());
+    }
+
+    torch::NoGradGuard no_grad;
+    auto traced_fn = [&model](torch::jit::Stack inputs) -> torch::jit::Stack {
+        return {ModuleForward(model, inputs[0].toTensor())};
+    };
+    auto no_names = [](const torch::autograd::Variable&) { return std::string(); };
+    auto result = torch::jit::tracer::trace({example}, traced_fn, no_names, true, false, &traced);
+
+    auto forward = traced._ivalue()->compilation_unit()->create_function(
+        c10::QualifiedName(*traced.type()->name(), "forward"), result.first->graph);
+    traced.type()->addMethod(forward);
+
+    for (const auto& attribute : attributes) {
+        traced.setattr(attribute.first, attribute.second.detach().clone());
+    }
+    return traced;
+}
+
+// Parameter structure for model_trace command
+struct ModelTraceArgs {
+    Tcl_Obj* model = nullptr;
+    Tcl_Obj* exampleInput = nullptr;
+    bool optimize = true;
+
+    bool IsValid() const {
+        return model != nullptr && exampleInput != nullptr;
+    }
+};
+
+// Parse dual syntax: model exampleInput ?optimize? |
+// -model handle -exampleInput tensor ?-optimize bool?
+static ModelTraceArgs ParseModelTraceArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    ModelTraceArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 3 || objc > 4) {
+            throw std::runtime_error("Usage: torch::model_trace model exampleInput ?optimize?");
+        }
+        args.model = objv[1];
+        args.exampleInput = objv[2];
+        if (objc > 3) {
+            args.optimize = GetBoolFromObj(interp, objv[3]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-model") {
+                args.model = objv[i + 1];
+            } else if (param == "-exampleInput" || param == "-example_input") {
+                args.exampleInput = objv[i + 1];
+            } else if (param == "-optimize") {
+                args.optimize = GetBoolFromObj(interp, objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -model, -exampleInput, -optimize");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: model and exampleInput");
+    }
+
+    return args;
+}
+
+// torch::model_trace - Trace a module built from Tcl into a frozen TorchScript
+// module and return it as a new module handle
+int ModelTrace_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        ModelTraceArgs args = ParseModelTraceArgs(interp, objc, objv);
+
+        ModuleRef* model = FindModuleFromObj(args.model);
+        if (model == nullptr) {
+            throw std::runtime_error(std::string("Invalid model: ") + Tcl_GetString(args.model));
+        }
+        torch::Tensor* example = FindTensorFromObj(args.exampleInput);
+        if (example == nullptr) {
+            throw std::runtime_error(std::string("Invalid example input: ") + Tcl_GetString(args.exampleInput));
+        }
+
+        // The graph is for inference: trace in eval mode, then restore
+        bool was_training = (*model)->is_training();
+        (*model)->eval();
+        torch::jit::Module traced;
+        try {
+            traced = TraceNativeModule(*model, *example);
+        } catch (const c10::Error& e) {
+            (*model)->train(was_training);
+            throw std::runtime_error(std::string("Tracing failed: ") + e.what_without_backtrace());
+        } catch (...) {
+            (*model)->train(was_training);
+            throw;
+        }
+        (*model)->train(was_training);
+
+        // Freezing inlines the weights as constants and folds them, leaving
+        // no attribute reads in the graph; optimizing adds conv/batch-norm
+        // folding and operator fusion on top
+        torch::jit::setGraphExecutorOptimize(true);
+        traced.eval();
+        if (args.optimize) {
+            traced = torch::jit::optimize_for_inference(traced);
+        } else {
+            traced = torch::jit::freeze(traced);
+        }
+
+        auto wrapper = std::make_shared<ConcreteScriptModule>(std::move(traced));
+        wrapper->eval();
+        Tcl_SetObjResult(interp, NewHandleObj(StoreModule("script", wrapper)));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::jit_save
+// ============================================================================
+
+// Parameter structure for jit_save command
+struct JitSaveArgs {
+    Tcl_Obj* module = nullptr;
+    std::string path;
+
+    bool IsValid() const {
+        return module != nullptr && !path.empty();
+    }
+};
+
+// Parse dual syntax: module path | -module handle -path file
+static JitSaveArgs ParseJitSaveArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    JitSaveArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 3) {
+            throw std::runtime_error("Usage: torch::jit_save module path");
+        }
+        args.module = objv[1];
+        args.path = Tcl_GetString(objv[2]);
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-module" || param == "-model") {
+                args.module = objv[i + 1];
+            } else if (param == "-path" || param == "-file") {
+                args.path = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -module, -path");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: module and path");
+    }
+
+    return args;
+}
+
+// torch::jit_save - Write a TorchScript module (loaded or traced) to a file
+// that torch::jit_load and torch.jit.load can read
+int JitSave_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        JitSaveArgs args = ParseJitSaveArgs(interp, objc, objv);
+
+        ModuleRef* module = FindModuleFromObj(args.module);
+        if (module == nullptr) {
+            throw std::runtime_error(std::string("Invalid module: ") + Tcl_GetString(args.module));
+        }
+        auto script = std::dynamic_pointer_cast<ConcreteScriptModule>(*module);
+        if (script == nullptr) {
+            throw std::runtime_error("torch::jit_save needs a TorchScript module; trace it with torch::model_trace first");
+        }
+
+        try {
+            script->script.save(args.path);
+        } catch (const c10::Error& e) {
+            throw std::runtime_error("Failed to save TorchScript module " + args.path + ": " + e.what_without_backtrace());
+        }
+
+        Tcl_SetResult(interp, const_cast<char*>("OK"), TCL_VOLATILE);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// ============================================================================
+// torch::jit_graph
+// ============================================================================
+
+// Parameter structure for jit_graph command
+struct JitGraphArgs {
+    Tcl_Obj* module = nullptr;
+    std::string method = "forward";
+
+    bool IsValid() const {
+        return module != nullptr && !method.empty();
+    }
+};
+
+// Parse dual syntax: module ?method? | -module handle ?-method name?
+static JitGraphArgs ParseJitGraphArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)interp;
+    JitGraphArgs args;
+
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 2 || objc > 3) {
+            throw std::runtime_error("Usage: torch::jit_graph module ?method?");
+        }
+        args.module = objv[1];
+        if (objc > 2) {
+            args.method = Tcl_GetString(objv[2]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+
+            std::string param = Tcl_GetString(objv[i]);
+            if (param == "-module" || param == "-model") {
+                args.module = objv[i + 1];
+            } else if (param == "-method") {
+                args.method = Tcl_GetString(objv[i + 1]);
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -module, -method");
+            }
+        }
+    }
+
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameter missing: module");
+    }
+
+    return args;
+}
+
+// torch::jit_graph - Return the graph of a TorchScript method as text, for
+// checking what tracing and freezing produced
+int JitGraph_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+
+    try {
+        JitGraphArgs args = ParseJitGraphArgs(interp, objc, objv);
+
+        ModuleRef* module = FindModuleFromObj(args.module);
+        if (module == nullptr) {
+            throw std::runtime_error(std::string("Invalid module: ") + Tcl_GetString(args.module));
+        }
+        auto script = std::dynamic_pointer_cast<ConcreteScriptModule>(*module);
+        if (script == nullptr) {
+            throw std::runtime_error("torch::jit_graph needs a TorchScript module; trace it with torch::model_trace first");
+        }
+
+        auto method = script->script.find_method(args.method);
+        if (!method) {
+            throw std::runtime_error("TorchScript module has no method " + args.method);
+        }
+
+        std::string graph = method->graph()->toString();
+        Tcl_SetObjResult(interp, Tcl_NewStringObj(graph.c_str(), -1));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
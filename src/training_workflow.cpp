@@ -1,8 +1,11 @@
 #include "libtorchtcl.h"
+#include <algorithm>
+#include <chrono>
 
 // Parameter structure for layer_parameters command
 struct LayerParametersArgs {
     std::string layer;
+    Tcl_Obj* layerObj = nullptr;
     
     bool IsValid() const {
         return !layer.empty();
@@ -19,6 +22,7 @@ LayerParametersArgs ParseLayerParametersArgs(Tcl_Interp* interp, int objc, Tcl_O
             throw std::runtime_error("Usage: torch::layer_parameters layer");
         }
         args.layer = Tcl_GetString(objv[1]);
+        args.layerObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -31,6 +35,7 @@ LayerParametersArgs ParseLayerParametersArgs(Tcl_Interp* interp, int objc, Tcl_O
             
             if (param == "-layer") {
                 args.layer = value;
+                args.layerObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -51,28 +56,27 @@ int LayerParameters_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
     
     try {
         LayerParametersArgs args = ParseLayerParametersArgs(interp, objc, objv);
-        std::string layer_name = args.layer;
         
         // Check if layer exists
-        if (module_storage.find(layer_name) == module_storage.end()) {
+        ModuleRef* layer = FindModuleFromObj(args.layerObj);
+        if (layer == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid layer name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& module = module_storage[layer_name];
+        auto& module = *layer;
         
         // Get parameters and store them as tensors
         std::vector<std::string> param_names;
         for (const auto& param : module->parameters()) {
-            std::string param_handle = GetNextHandle("tensor");
-            tensor_storage[param_handle] = param;
+            std::string param_handle = StoreTensor(param);
             param_names.push_back(param_handle);
         }
         
         // Create TCL list of parameter handles
         Tcl_Obj* param_list = Tcl_NewListObj(0, NULL);
         for (const auto& name : param_names) {
-            Tcl_ListObjAppendElement(interp, param_list, Tcl_NewStringObj(name.c_str(), -1));
+            Tcl_ListObjAppendElement(interp, param_list, NewHandleObj(name));
         }
         
         Tcl_SetObjResult(interp, param_list);
@@ -87,6 +91,7 @@ int LayerParameters_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl
 // Parameter structure for model_train command
 struct ModelTrainArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
     
     bool IsValid() const {
         return !model.empty();
@@ -104,6 +109,7 @@ ModelTrainArgs ParseModelTrainArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -115,6 +121,7 @@ ModelTrainArgs ParseModelTrainArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-model") {
                 args.model = Tcl_GetString(objv[i + 1]);
+                args.modelObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -135,12 +142,13 @@ int ModelTrain_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         ModelTrainArgs args = ParseModelTrainArgs(interp, objc, objv);
         
         // Check if model exists
-        if (module_storage.find(args.model) == module_storage.end()) {
+        ModuleRef* model = FindModuleFromObj(args.modelObj);
+        if (model == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid model name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& module = module_storage[args.model];
+        auto& module = *model;
         
         // Set to training mode
         module->train();
@@ -158,6 +166,7 @@ int ModelTrain_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
 // Parameter structure for model_eval command
 struct ModelEvalArgs {
     std::string model;
+    Tcl_Obj* modelObj = nullptr;
     
     bool IsValid() const {
         return !model.empty();
@@ -175,6 +184,7 @@ ModelEvalArgs ParseModelEvalArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
         }
         
         args.model = Tcl_GetString(objv[1]);
+        args.modelObj = objv[1];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -186,6 +196,7 @@ ModelEvalArgs ParseModelEvalArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const ob
             
             if (param == "-model") {
                 args.model = Tcl_GetString(objv[i + 1]);
+                args.modelObj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param);
             }
@@ -207,12 +218,13 @@ int ModelEval_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         ModelEvalArgs args = ParseModelEvalArgs(interp, objc, objv);
         
         // Check if model exists
-        if (module_storage.find(args.model) == module_storage.end()) {
+        ModuleRef* model = FindModuleFromObj(args.modelObj);
+        if (model == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid model name"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        auto& module = module_storage[args.model];
+        auto& module = *model;
         
         // Set to evaluation mode
         module->eval();
@@ -225,4 +237,407 @@ int ModelEval_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj*
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
         return TCL_ERROR;
     }
-} 
\ No newline at end of file
+}
+
+// Loss by name for the fused training commands; "mse" and "mse_loss" are
+// both accepted. Reduction is always mean.
+static torch::Tensor ComputeNamedLoss(const std::string& name, const torch::Tensor& output, const torch::Tensor& target) {
+    std::string loss = name;
+    if (loss.size() > 5 && loss.compare(loss.size() - 5, 5, "_loss") == 0) {
+        loss.erase(loss.size() - 5);
+    }
+
+    if (loss == "mse") {
+        return torch::mse_loss(output, target);
+    } else if (loss == "cross_entropy") {
+        return torch::cross_entropy_loss(output, target);
+    } else if (loss == "nll") {
+        return torch::nll_loss(output, target);
+    } else if (loss == "bce") {
+        return torch::binary_cross_entropy(output, target);
+    } else if (loss == "bce_with_logits") {
+        return torch::binary_cross_entropy_with_logits(output, target);
+    } else if (loss == "l1") {
+        return torch::l1_loss(output, target);
+    } else if (loss == "smooth_l1") {
+        return torch::smooth_l1_loss(output, target);
+    } else if (loss == "huber") {
+        return torch::huber_loss(output, target);
+    }
+    throw std::runtime_error("Unknown loss: " + name + ". Valid losses are: mse, cross_entropy, nll, bce, bce_with_logits, l1, smooth_l1, huber");
+}
+
+// zero_grad, forward, loss, backward, clipping and step, shared by
+// train_step and fit. Returns the detached loss without reading it back.
+static torch::Tensor FusedTrainStep(const ModuleRef& model, torch::optim::Optimizer& optimizer,
+                                    const std::string& loss_name, const torch::Tensor& input, const torch::Tensor& target,
+                                    const std::string& scaler, double clip) {
+    optimizer.zero_grad();
+    torch::Tensor output = ModuleForward(model, input);
+    torch::Tensor loss = ComputeNamedLoss(loss_name, output, target);
+    
+    if (!scaler.empty()) {
+        GradScalerTrainStep(scaler, loss, optimizer, clip);
+    } else {
+        loss.backward();
+        if (clip > 0.0) {
+            std::vector<torch::Tensor> params;
+            for (auto& group : optimizer.param_groups()) {
+                params.insert(params.end(), group.params().begin(), group.params().end());
+            }
+            torch::nn::utils::clip_grad_norm_(params, clip);
+        }
+        optimizer.step();
+    }
+    
+    return loss.detach();
+}
+
+// Parameter structure for train_step command
+struct TrainStepArgs {
+    Tcl_Obj* model = nullptr;
+    Tcl_Obj* optimizer = nullptr;
+    std::string loss;
+    Tcl_Obj* input = nullptr;
+    Tcl_Obj* target = nullptr;
+    std::string scaler;
+    std::string scheduler;
+    double clip = 0.0;               // max gradient norm; 0 disables clipping
+    
+    bool IsValid() const {
+        return model != nullptr && optimizer != nullptr && !loss.empty() &&
+               input != nullptr && target != nullptr && clip >= 0.0;
+    }
+};
+
+// Parse dual syntax for train_step: model optimizer loss input target |
+// -model m -optimizer o -loss name -input x -target y ?-scaler s?
+// ?-scheduler s? ?-clip maxNorm?
+TrainStepArgs ParseTrainStepArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    TrainStepArgs args;
+    
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc != 6) {
+            throw std::runtime_error("Usage: torch::train_step model optimizer loss input target");
+        }
+        
+        args.model = objv[1];
+        args.optimizer = objv[2];
+        args.loss = Tcl_GetString(objv[3]);
+        args.input = objv[4];
+        args.target = objv[5];
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+            
+            std::string param = Tcl_GetString(objv[i]);
+            
+            if (param == "-model") {
+                args.model = objv[i + 1];
+            } else if (param == "-optimizer") {
+                args.optimizer = objv[i + 1];
+            } else if (param == "-loss") {
+                args.loss = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-input") {
+                args.input = objv[i + 1];
+            } else if (param == "-target") {
+                args.target = objv[i + 1];
+            } else if (param == "-scaler") {
+                args.scaler = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-scheduler") {
+                args.scheduler = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-clip") {
+                if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.clip) != TCL_OK) {
+                    throw std::runtime_error("Invalid clip value");
+                }
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -model, -optimizer, -loss, -input, -target, -scaler, -scheduler, -clip");
+            }
+        }
+    }
+    
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: model, optimizer, loss, input and target (clip must be >= 0)");
+    }
+    
+    return args;
+}
+
+// torch::train_step - One fused training iteration: zero_grad, forward, loss,
+// backward, optional clipping, step and scheduler step. Returns the loss as a
+// double and allocates no handles.
+int TrainStep_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+    
+    try {
+        TrainStepArgs args = ParseTrainStepArgs(interp, objc, objv);
+        
+        ModuleRef* model = FindModuleFromObj(args.model);
+        if (model == nullptr) {
+            throw std::runtime_error("Invalid model name");
+        }
+        std::shared_ptr<torch::optim::Optimizer>* optimizer = FindOptimizerFromObj(args.optimizer);
+        if (optimizer == nullptr) {
+            throw std::runtime_error("Invalid optimizer handle");
+        }
+        torch::Tensor* input = FindTensorFromObj(args.input);
+        if (input == nullptr) {
+            throw std::runtime_error("Invalid input tensor");
+        }
+        torch::Tensor* target = FindTensorFromObj(args.target);
+        if (target == nullptr) {
+            throw std::runtime_error("Invalid target tensor");
+        }
+        
+        torch::Tensor loss = FusedTrainStep(*model, **optimizer, args.loss, *input, *target, args.scaler, args.clip);
+        
+        if (!args.scheduler.empty()) {
+            StepLRScheduler(args.scheduler);
+        }
+        
+        Tcl_SetObjResult(interp, Tcl_NewDoubleObj(loss.item<double>()));
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
+
+// Parameter structure for fit command
+struct FitArgs {
+    Tcl_Obj* model = nullptr;
+    Tcl_Obj* optimizer = nullptr;
+    std::string loss;
+    std::string loader;
+    int64_t epochs = 0;
+    Tcl_Obj* callback = nullptr;     // command prefix, called with a metrics dict
+    int64_t every = 0;               // steps between callbacks; 0 = epoch end only
+    std::string scaler;
+    std::string scheduler;
+    double clip = 0.0;
+    
+    bool IsValid() const {
+        return model != nullptr && optimizer != nullptr && !loss.empty() && !loader.empty() &&
+               epochs > 0 && every >= 0 && clip >= 0.0;
+    }
+};
+
+// Parse dual syntax for fit: model optimizer loss loader epochs ?callback? ?every? |
+// -model m -optimizer o -loss name -loader l -epochs n ?-callback cmd?
+// ?-every n? ?-scaler s? ?-scheduler s? ?-clip maxNorm?
+FitArgs ParseFitArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    FitArgs args;
+    
+    if (objc >= 2 && Tcl_GetString(objv[1])[0] != '-') {
+        // Positional syntax
+        if (objc < 6 || objc > 8) {
+            throw std::runtime_error("Usage: torch::fit model optimizer loss loader epochs ?callback? ?every?");
+        }
+        
+        args.model = objv[1];
+        args.optimizer = objv[2];
+        args.loss = Tcl_GetString(objv[3]);
+        args.loader = Tcl_GetString(objv[4]);
+        args.epochs = GetInt64FromObj(interp, objv[5]);
+        if (objc > 6) {
+            args.callback = objv[6];
+        }
+        if (objc > 7) {
+            args.every = GetInt64FromObj(interp, objv[7]);
+        }
+    } else {
+        // Named parameter syntax
+        for (int i = 1; i < objc; i += 2) {
+            if (i + 1 >= objc) {
+                throw std::runtime_error("Missing value for parameter");
+            }
+            
+            std::string param = Tcl_GetString(objv[i]);
+            
+            if (param == "-model") {
+                args.model = objv[i + 1];
+            } else if (param == "-optimizer") {
+                args.optimizer = objv[i + 1];
+            } else if (param == "-loss") {
+                args.loss = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-loader") {
+                args.loader = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-epochs") {
+                args.epochs = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-callback") {
+                args.callback = objv[i + 1];
+            } else if (param == "-every") {
+                args.every = GetInt64FromObj(interp, objv[i + 1]);
+            } else if (param == "-scaler") {
+                args.scaler = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-scheduler") {
+                args.scheduler = Tcl_GetString(objv[i + 1]);
+            } else if (param == "-clip") {
+                if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.clip) != TCL_OK) {
+                    throw std::runtime_error("Invalid clip value");
+                }
+            } else {
+                throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -model, -optimizer, -loss, -loader, -epochs, -callback, -every, -scaler, -scheduler, -clip");
+            }
+        }
+    }
+    
+    if (!args.IsValid()) {
+        throw std::runtime_error("Required parameters missing: model, optimizer, loss, loader and epochs > 0 (every and clip must be >= 0)");
+    }
+    
+    return args;
+}
+
+// Build the metrics dict passed to fit callbacks and returned by fit
+static Tcl_Obj* FitMetrics(const char* event, int64_t epoch, int64_t step, double loss, double samples_per_sec) {
+    Tcl_Obj* dict = Tcl_NewDictObj();
+    Tcl_DictObjPut(NULL, dict, Tcl_NewStringObj("event", -1), Tcl_NewStringObj(event, -1));
+    Tcl_DictObjPut(NULL, dict, Tcl_NewStringObj("epoch", -1), Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(epoch)));
+    Tcl_DictObjPut(NULL, dict, Tcl_NewStringObj("step", -1), Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(step)));
+    Tcl_DictObjPut(NULL, dict, Tcl_NewStringObj("loss", -1), Tcl_NewDoubleObj(loss));
+    Tcl_DictObjPut(NULL, dict, Tcl_NewStringObj("samples_per_sec", -1), Tcl_NewDoubleObj(samples_per_sec));
+    return dict;
+}
+
+// torch::fit - Train for a number of epochs over a dataloader without
+// returning to Tcl between steps. The callback runs every N steps and at
+// each epoch end; returning with -code break stops training early.
+int Fit_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
+    (void)clientData; // Suppress unused parameter warning
+    
+    try {
+        FitArgs args = ParseFitArgs(interp, objc, objv);
+        
+        ModuleRef* model_entry = FindModuleFromObj(args.model);
+        if (model_entry == nullptr) {
+            throw std::runtime_error("Invalid model name");
+        }
+        std::shared_ptr<torch::optim::Optimizer>* optimizer_entry = FindOptimizerFromObj(args.optimizer);
+        if (optimizer_entry == nullptr) {
+            throw std::runtime_error("Invalid optimizer handle");
+        }
+        std::shared_ptr<DataLoader> loader = FindDataLoader(args.loader);
+        if (!loader) {
+            throw std::runtime_error("Invalid dataloader handle: " + args.loader);
+        }
+        // A loader left mid-epoch (by torch::dataloader_next or a loop that
+        // stopped early) would make the first epoch short
+        DataLoaderRestartPartialEpoch(*loader);
+        
+        // Own references, so a callback that releases the handles cannot
+        // free them under the loop
+        ModuleRef model = *model_entry;
+        std::shared_ptr<torch::optim::Optimizer> optimizer = *optimizer_entry;
+        Tcl_Obj* callback = args.callback;
+        
+        // Runs the callback with a metrics dict; TCL_BREAK means stop
+        auto run_callback = [&](Tcl_Obj* metrics) {
+            Tcl_Obj* cmd = Tcl_DuplicateObj(callback);
+            Tcl_IncrRefCount(cmd);
+            Tcl_ListObjAppendElement(interp, cmd, metrics);
+            int code = Tcl_EvalObjEx(interp, cmd, TCL_EVAL_GLOBAL);
+            Tcl_DecrRefCount(cmd);
+            return code;
+        };
+        
+        using Clock = std::chrono::steady_clock;
+        auto seconds_since = [](Clock::time_point from) {
+            return std::max(std::chrono::duration<double>(Clock::now() - from).count(), 1e-9);
+        };
+        
+        model->train();
+        Clock::time_point start = Clock::now();
+        int64_t step = 0;
+        int64_t total_samples = 0;
+        int64_t epochs_done = 0;
+        double last_loss = 0.0;
+        bool stopped = false;
+        int code = TCL_OK;
+        std::vector<torch::Tensor> batch;
+        
+        for (int64_t epoch = 0; epoch < args.epochs && !stopped; epoch++) {
+            Clock::time_point epoch_start = Clock::now();
+            Clock::time_point window_start = epoch_start;
+            // Losses are summed on the device and only read back for callbacks
+            torch::Tensor epoch_sum;
+            torch::Tensor window_sum;
+            int64_t epoch_steps = 0;
+            int64_t window_steps = 0;
+            int64_t epoch_samples = 0;
+            int64_t window_samples = 0;
+            
+            while (DataLoaderNextBatch(*loader, batch)) {
+                if (batch.size() < 2) {
+                    throw std::runtime_error("torch::fit needs a dataloader whose batches hold input and target");
+                }
+                torch::Tensor loss = FusedTrainStep(model, *optimizer, args.loss, batch[0], batch[1], args.scaler, args.clip);
+                epoch_sum = epoch_sum.defined() ? epoch_sum + loss : loss;
+                window_sum = window_sum.defined() ? window_sum + loss : loss;
+                
+                int64_t n = batch[0].dim() > 0 ? batch[0].size(0) : 1;
+                step++;
+                epoch_steps++;
+                window_steps++;
+                epoch_samples += n;
+                window_samples += n;
+                total_samples += n;
+                
+                if (callback != nullptr && args.every > 0 && step % args.every == 0) {
+                    double loss_mean = window_sum.item<double>() / window_steps;
+                    double rate = window_samples / seconds_since(window_start);
+                    code = run_callback(FitMetrics("step", epoch, step, loss_mean, rate));
+                    if (code == TCL_ERROR) {
+                        break;
+                    }
+                    stopped = code == TCL_BREAK;
+                    if (stopped) {
+                        break;
+                    }
+                    window_sum = torch::Tensor();
+                    window_steps = 0;
+                    window_samples = 0;
+                    window_start = Clock::now();
+                }
+            }
+            if (code == TCL_ERROR) {
+                break;
+            }
+            if (epoch_steps > 0) {
+                last_loss = epoch_sum.item<double>() / epoch_steps;
+            }
+            if (stopped) {
+                break;
+            }
+            
+            epochs_done++;
+            if (!args.scheduler.empty()) {
+                StepLRScheduler(args.scheduler);
+            }
+            if (callback != nullptr) {
+                code = run_callback(FitMetrics("epoch", epoch, step, last_loss, epoch_samples / seconds_since(epoch_start)));
+                if (code == TCL_ERROR) {
+                    break;
+                }
+                stopped = code == TCL_BREAK;
+            }
+        }
+        
+        if (code == TCL_ERROR) {
+            Tcl_AddErrorInfo(interp, "\n    (torch::fit callback)");
+            return TCL_ERROR;
+        }
+        
+        Tcl_Obj* result = FitMetrics("done", epochs_done, step, last_loss, total_samples / seconds_since(start));
+        Tcl_DictObjPut(NULL, result, Tcl_NewStringObj("stopped", -1), Tcl_NewBooleanObj(stopped));
+        Tcl_SetObjResult(interp, result);
+        return TCL_OK;
+    } catch (const std::exception& e) {
+        Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
+        return TCL_ERROR;
+    }
+}
@@ -271,10 +271,9 @@ int PositionalEncoding_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* co
         
         torch::Tensor result = torch::dropout(pe, args.dropout, true);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = result;
+        std::string handle = StoreTensor(result);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -5,6 +5,7 @@
 // Parameter structure for pixel_shuffle command
 struct PixelShuffleArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int upscale_factor = 2;  // Default value
     
     bool IsValid() const {
@@ -27,6 +28,7 @@ PixelShuffleArgs ParsePixelShuffleArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.upscale_factor) != TCL_OK) {
             throw std::runtime_error("Invalid upscale_factor parameter");
@@ -42,6 +44,7 @@ PixelShuffleArgs ParsePixelShuffleArgs(Tcl_Interp* interp, int objc, Tcl_Obj* co
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-upscaleFactor" || param == "-upscale_factor" || param == "-factor") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.upscale_factor) != TCL_OK) {
                     throw std::runtime_error("Invalid upscale_factor parameter");
@@ -64,18 +67,18 @@ int PixelShuffle_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
     try {
         PixelShuffleArgs args = ParsePixelShuffleArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::nn::functional::pixel_shuffle(input, args.upscale_factor);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -86,6 +89,7 @@ int PixelShuffle_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const ob
 // Parameter structure for pixel_unshuffle command
 struct PixelUnshuffleArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int downscale_factor = 2;  // Default value
     
     bool IsValid() const {
@@ -108,6 +112,7 @@ PixelUnshuffleArgs ParsePixelUnshuffleArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         
         if (Tcl_GetIntFromObj(interp, objv[2], &args.downscale_factor) != TCL_OK) {
             throw std::runtime_error("Invalid downscale_factor parameter");
@@ -123,6 +128,7 @@ PixelUnshuffleArgs ParsePixelUnshuffleArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-downscaleFactor" || param == "-downscale_factor" || param == "-factor") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.downscale_factor) != TCL_OK) {
                     throw std::runtime_error("Invalid downscale_factor parameter");
@@ -145,18 +151,18 @@ int PixelUnshuffle_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         PixelUnshuffleArgs args = ParsePixelUnshuffleArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
         auto output = torch::nn::functional::pixel_unshuffle(input, args.downscale_factor);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -186,9 +192,9 @@ static UpsampleNearestArgs ParseUpsampleNearestArgs(Tcl_Interp* interp, int objc
         }
         
         std::string inputName = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(inputName) == tensor_storage.end()) 
+        if (FindTensorFromObj(objv[1]) == nullptr) 
             throw std::runtime_error("Invalid input tensor name");
-        args.input = tensor_storage[inputName];
+        args.input = *FindTensorFromObj(objv[1]);
 
         // Parse size list
         int listLen;
@@ -231,9 +237,9 @@ static UpsampleNearestArgs ParseUpsampleNearestArgs(Tcl_Interp* interp, int objc
             
             if (param == "-input") {
                 std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) 
+                if (FindTensorFromObj(valObj) == nullptr) 
                     throw std::runtime_error("Invalid input tensor name");
-                args.input = tensor_storage[name];
+                args.input = *FindTensorFromObj(valObj);
             } else if (param == "-size") {
                 int listLen;
                 Tcl_Obj** listObjv;
@@ -290,10 +296,9 @@ int UpsampleNearest_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 
         auto output = torch::nn::functional::interpolate(args.input, options);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -363,9 +368,9 @@ static UpsampleBilinearArgs ParseUpsampleBilinearArgs(Tcl_Interp* interp, int ob
         }
         
         std::string inputName = Tcl_GetString(objv[1]);
-        if (tensor_storage.find(inputName) == tensor_storage.end()) 
+        if (FindTensorFromObj(objv[1]) == nullptr) 
             throw std::runtime_error("Invalid input tensor name");
-        args.input = tensor_storage[inputName];
+        args.input = *FindTensorFromObj(objv[1]);
 
         // Try to parse as size (integers) first, then as scale factor (doubles)
         std::string sizeOrScale = Tcl_GetString(objv[2]);
@@ -401,9 +406,9 @@ static UpsampleBilinearArgs ParseUpsampleBilinearArgs(Tcl_Interp* interp, int ob
             
             if (param == "-input") {
                 std::string name = Tcl_GetString(valObj);
-                if (tensor_storage.find(name) == tensor_storage.end()) 
+                if (FindTensorFromObj(valObj) == nullptr) 
                     throw std::runtime_error("Invalid input tensor name");
-                args.input = tensor_storage[name];
+                args.input = *FindTensorFromObj(valObj);
             } else if (param == "-output_size" || param == "-size") {
                 args.output_size = ParseSizeList(interp, valObj);
             } else if (param == "-scale_factor") {
@@ -456,9 +461,8 @@ int UpsampleBilinear_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 
         torch::Tensor output = torch::nn::functional::interpolate(args.input, options);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        std::string handle = StoreTensor(output);
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -471,6 +475,7 @@ int UpsampleBilinear_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // ============================================================================
 struct InterpolateArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> size;
     std::string mode = "nearest";      // Default mode
     bool align_corners = false;        // Default align_corners
@@ -493,6 +498,7 @@ InterpolateArgs ParseInterpolateArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.size = ParseSizeList(interp, objv[2]);
         
         if (objc > 3) {
@@ -521,6 +527,7 @@ InterpolateArgs ParseInterpolateArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-size") {
                 args.size = ParseSizeList(interp, objv[i + 1]);
             } else if (param == "-mode") {
@@ -551,11 +558,12 @@ int Interpolate_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         InterpolateArgs args = ParseInterpolateArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             throw std::runtime_error("Invalid input tensor: " + args.input);
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         // Parse mode
         torch::nn::functional::InterpolateFuncOptions::mode_t mode = torch::kNearest;
@@ -592,10 +600,9 @@ int Interpolate_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 
         auto output = torch::nn::functional::interpolate(input, options);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(("Error in interpolate: " + std::string(e.what())).c_str()), TCL_VOLATILE);
@@ -607,6 +614,8 @@ int Interpolate_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 struct GridSampleArgs {
     std::string input;
     std::string grid;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* gridObj = nullptr;
     std::string mode = "bilinear";        // Default interpolation mode
     std::string padding_mode = "zeros";   // Default padding mode
     bool align_corners = false;           // Default align corners
@@ -627,7 +636,9 @@ GridSampleArgs ParseGridSampleArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.grid = Tcl_GetString(objv[2]);
+        args.gridObj = objv[2];
         
         if (objc > 3) {
             args.mode = Tcl_GetString(objv[3]);
@@ -655,8 +666,10 @@ GridSampleArgs ParseGridSampleArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-grid") {
                 args.grid = Tcl_GetString(objv[i + 1]);
+                args.gridObj = objv[i + 1];
             } else if (param == "-mode") {
                 args.mode = Tcl_GetString(objv[i + 1]);
             } else if (param == "-padding_mode" || param == "-paddingMode") {
@@ -685,18 +698,20 @@ int GridSample_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
     try {
         GridSampleArgs args = ParseGridSampleArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.grid) == tensor_storage.end()) {
+        torch::Tensor* grid_tensor = FindTensorFromObj(args.gridObj);
+        if (grid_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid grid tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto grid = tensor_storage[args.grid];
+        auto input = *input_tensor;
+        auto grid = *grid_tensor;
 
         // Parse mode
         torch::nn::functional::GridSampleFuncOptions::mode_t mode = torch::kBilinear;
@@ -727,10 +742,9 @@ int GridSample_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 
         auto output = torch::nn::functional::grid_sample(input, grid, options);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -741,6 +755,7 @@ int GridSample_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // torch::affine_grid - Affine grid generation
 struct AffineGridArgs {
     std::string theta;
+    Tcl_Obj* thetaObj = nullptr;
     std::vector<int64_t> size;
     bool alignCorners = false;
 
@@ -759,6 +774,7 @@ static AffineGridArgs ParseAffineGridArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
         }
         
         args.theta = Tcl_GetString(objv[1]);
+        args.thetaObj = objv[1];
         args.size = ParseSizeList(interp, objv[2]);
         
         if (objc > 3) {
@@ -778,6 +794,7 @@ static AffineGridArgs ParseAffineGridArgs(Tcl_Interp* interp, int objc, Tcl_Obj*
             
             if (option == "-theta") {
                 args.theta = Tcl_GetString(objv[i + 1]);
+                args.thetaObj = objv[i + 1];
             } else if (option == "-size") {
                 args.size = ParseSizeList(interp, objv[i + 1]);
             } else if (option == "-alignCorners" || option == "-align_corners") {
@@ -805,18 +822,18 @@ int AffineGrid_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             return TCL_ERROR;
         }
 
-        if (tensor_storage.find(args.theta) == tensor_storage.end()) {
+        torch::Tensor* theta_tensor = FindTensorFromObj(args.thetaObj);
+        if (theta_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid theta tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto theta = tensor_storage[args.theta];
+        auto theta = *theta_tensor;
         auto output = torch::nn::functional::affine_grid(theta, args.size, args.alignCorners);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -827,6 +844,7 @@ int AffineGrid_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv
 // Parameter structure for channel_shuffle command
 struct ChannelShuffleArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     int groups = 2;  // Default value
     
     bool IsValid() const {
@@ -848,6 +866,7 @@ ChannelShuffleArgs ParseChannelShuffleArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             throw std::runtime_error("Usage: torch::channel_shuffle input groups");
         }
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         if (Tcl_GetIntFromObj(interp, objv[2], &args.groups) != TCL_OK) {
             throw std::runtime_error("Invalid groups parameter");
         }
@@ -862,6 +881,7 @@ ChannelShuffleArgs ParseChannelShuffleArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-groups") {
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &args.groups) != TCL_OK) {
                     throw std::runtime_error("Invalid groups parameter value");
@@ -884,22 +904,22 @@ int ChannelShuffle_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
     try {
         ChannelShuffleArgs args = ParseChannelShuffleArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         // Use tensor operations since channel_shuffle may not be available
         auto output = input.view({input.size(0), args.groups, input.size(1)/args.groups, input.size(2), input.size(3)})
                           .transpose(1, 2).contiguous()
                           .view({input.size(0), input.size(1), input.size(2), input.size(3)});
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -911,6 +931,8 @@ int ChannelShuffle_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
 struct NmsArgs {
     std::string boxes;
     std::string scores;
+    Tcl_Obj* boxesObj = nullptr;
+    Tcl_Obj* scoresObj = nullptr;
     double iouThreshold;
     double scoreThreshold = 0.0;  // Optional, default 0.0
     
@@ -948,7 +970,9 @@ NmsArgs ParseNmsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
         
         // Safe access to positional arguments
         args.boxes = Tcl_GetString(objv[1]);
+        args.boxesObj = objv[1];
         args.scores = Tcl_GetString(objv[2]);
+        args.scoresObj = objv[2];
         
         // Parse iou_threshold
         if (Tcl_GetDoubleFromObj(interp, objv[3], &args.iouThreshold) != TCL_OK) {
@@ -976,9 +1000,11 @@ NmsArgs ParseNmsArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
             
             if (param == "-boxes") {
                 args.boxes = Tcl_GetString(objv[i + 1]);
+                args.boxesObj = objv[i + 1];
                 boxes_set = true;
             } else if (param == "-scores") {
                 args.scores = Tcl_GetString(objv[i + 1]);
+                args.scoresObj = objv[i + 1];
                 scores_set = true;
             } else if (param == "-iouThreshold") {
                 if (Tcl_GetDoubleFromObj(interp, objv[i + 1], &args.iouThreshold) != TCL_OK) {
@@ -1017,19 +1043,21 @@ int NMS_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
         NmsArgs args = ParseNmsArgs(interp, objc, objv);
         
         // Validate tensors exist
-        if (tensor_storage.find(args.boxes) == tensor_storage.end()) {
+        torch::Tensor* boxes_tensor = FindTensorFromObj(args.boxesObj);
+        if (boxes_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid boxes tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.scores) == tensor_storage.end()) {
+        torch::Tensor* scores_tensor = FindTensorFromObj(args.scoresObj);
+        if (scores_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid scores tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
         // Get tensors from storage
-        auto boxes = tensor_storage[args.boxes];
-        auto scores = tensor_storage[args.scores];
+        auto boxes = *boxes_tensor;
+        auto scores = *scores_tensor;
         
         // Validate tensor dimensions
         if (boxes.dim() != 2 || boxes.size(1) != 4) {
@@ -1107,10 +1135,9 @@ int NMS_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
         auto output = torch::tensor(keep_indices, torch::kLong);
         output = sorted_indices.index_select(0, output);
         
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
         
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1122,6 +1149,8 @@ int NMS_Cmd(ClientData cd, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
 struct BoxIouArgs {
     std::string boxes1;
     std::string boxes2;
+    Tcl_Obj* boxes1Obj = nullptr;
+    Tcl_Obj* boxes2Obj = nullptr;
     
     bool IsValid() const {
         return !boxes1.empty() && !boxes2.empty();
@@ -1142,7 +1171,9 @@ BoxIouArgs ParseBoxIouArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
             throw std::runtime_error("Usage: torch::box_iou boxes1 boxes2");
         }
         args.boxes1 = Tcl_GetString(objv[1]);
+        args.boxes1Obj = objv[1];
         args.boxes2 = Tcl_GetString(objv[2]);
+        args.boxes2Obj = objv[2];
     } else {
         // Named parameter syntax
         for (int i = 1; i < objc; i += 2) {
@@ -1155,8 +1186,10 @@ BoxIouArgs ParseBoxIouArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
             
             if (param == "-boxes1" || param == "-input1") {
                 args.boxes1 = value;
+                args.boxes1Obj = objv[i + 1];
             } else if (param == "-boxes2" || param == "-input2") {
                 args.boxes2 = value;
+                args.boxes2Obj = objv[i + 1];
             } else {
                 throw std::runtime_error("Unknown parameter: " + param + ". Valid parameters are: -boxes1, -boxes2, -input1, -input2");
             }
@@ -1176,18 +1209,20 @@ int BoxIoU_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
         // Parse arguments using dual syntax
         BoxIouArgs args = ParseBoxIouArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.boxes1) == tensor_storage.end()) {
+        torch::Tensor* boxes1_tensor = FindTensorFromObj(args.boxes1Obj);
+        if (boxes1_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid boxes1 tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.boxes2) == tensor_storage.end()) {
+        torch::Tensor* boxes2_tensor = FindTensorFromObj(args.boxes2Obj);
+        if (boxes2_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid boxes2 tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto boxes1 = tensor_storage[args.boxes1];
-        auto boxes2 = tensor_storage[args.boxes2];
+        auto boxes1 = *boxes1_tensor;
+        auto boxes2 = *boxes2_tensor;
 
         // Calculate IoU: intersection / union
         auto area1 = (boxes1.select(1, 2) - boxes1.select(1, 0)) * (boxes1.select(1, 3) - boxes1.select(1, 1));
@@ -1203,10 +1238,9 @@ int BoxIoU_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
         auto union_area = area1.unsqueeze(1) + area2.unsqueeze(0) - inter;
         auto iou = inter / union_area;
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = iou;
+        std::string handle = StoreTensor(iou);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, (char*)e.what(), TCL_VOLATILE);
@@ -1218,6 +1252,8 @@ int BoxIoU_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[])
 struct RoIAlignArgs {
     std::string input;
     std::string boxes;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* boxesObj = nullptr;
     std::vector<int64_t> outputSize;
     double spatialScale = 1.0;
     int samplingRatio = -1;
@@ -1243,7 +1279,9 @@ RoIAlignArgs ParseRoIAlignArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.boxes = Tcl_GetString(objv[2]);
+        args.boxesObj = objv[2];
         args.outputSize = ParseSizeList(interp, objv[3]);
         
         if (objc > 4) {
@@ -1275,8 +1313,10 @@ RoIAlignArgs ParseRoIAlignArgs(Tcl_Interp* interp, int objc, Tcl_Obj* const objv
             
             if (param == "-input" || param == "-tensor") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-boxes") {
                 args.boxes = Tcl_GetString(objv[i + 1]);
+                args.boxesObj = objv[i + 1];
             } else if (param == "-outputSize" || param == "-output_size") {
                 args.outputSize = ParseSizeList(interp, objv[i + 1]);
             } else if (param == "-spatialScale" || param == "-spatial_scale") {
@@ -1313,27 +1353,28 @@ int RoIAlign_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
     try {
         RoIAlignArgs args = ParseRoIAlignArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid input tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.boxes) == tensor_storage.end()) {
+        torch::Tensor* boxes_tensor = FindTensorFromObj(args.boxesObj);
+        if (boxes_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid boxes tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto input = tensor_storage[args.input];
-        auto boxes = tensor_storage[args.boxes];
+        auto input = *input_tensor;
+        auto boxes = *boxes_tensor;
 
         // Simplified ROI align using adaptive pooling
         auto options = torch::nn::functional::AdaptiveAvgPool2dFuncOptions(args.outputSize);
         auto output = torch::nn::functional::adaptive_avg_pool2d(input, options);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1345,6 +1386,8 @@ int RoIAlign_Cmd(ClientData clientData, Tcl_Interp* interp, int objc, Tcl_Obj* c
 struct RoiPoolArgs {
     std::string input;
     std::string boxes;
+    Tcl_Obj* inputObj = nullptr;
+    Tcl_Obj* boxesObj = nullptr;
     std::vector<int64_t> outputSize; // length 2
     double spatialScale = 1.0;
 
@@ -1358,14 +1401,14 @@ static RoiPoolArgs ParseRoiPoolArgs(Tcl_Interp* interp,int objc,Tcl_Obj* const o
     if(objc>=2 && Tcl_GetString(objv[1])[0] != '-'){
         // positional: input boxes output_size ?spatial_scale?
         if(objc<4 || objc>5){ Tcl_WrongNumArgs(interp,1,objv,"input boxes output_size ?spatial_scale?"); throw std::runtime_error("Invalid arg count"); }
-        a.input = Tcl_GetString(objv[1]);
-        a.boxes = Tcl_GetString(objv[2]);
+        a.input = Tcl_GetString(objv[1]); a.inputObj = objv[1];
+        a.boxes = Tcl_GetString(objv[2]); a.boxesObj = objv[2];
         a.outputSize = ParseSizeList(interp,objv[3]);
         if(objc>4){ if(Tcl_GetDoubleFromObj(interp,objv[4],&a.spatialScale)!=TCL_OK) throw std::runtime_error("Invalid spatial_scale"); }
     } else {
         for(int i=1;i<objc;i+=2){ if(i+1>=objc) throw std::runtime_error("Missing value for parameter"); std::string p=Tcl_GetString(objv[i]);
-            if(p=="-input"||p=="-tensor") a.input = Tcl_GetString(objv[i+1]);
-            else if(p=="-boxes") a.boxes = Tcl_GetString(objv[i+1]);
+            if(p=="-input"||p=="-tensor") {a.input = Tcl_GetString(objv[i+1]); a.inputObj = objv[i+1];}
+            else if(p=="-boxes") {a.boxes = Tcl_GetString(objv[i+1]); a.boxesObj = objv[i+1];}
             else if(p=="-outputSize"||p=="-output_size") a.outputSize = ParseSizeList(interp,objv[i+1]);
             else if(p=="-spatialScale"||p=="-spatial_scale") {if(Tcl_GetDoubleFromObj(interp,objv[i+1],&a.spatialScale)!=TCL_OK) throw std::runtime_error("Invalid spatialScale");}
             else throw std::runtime_error("Unknown parameter: "+p);
@@ -1379,16 +1422,17 @@ static RoiPoolArgs ParseRoiPoolArgs(Tcl_Interp* interp,int objc,Tcl_Obj* const o
 int RoIPool_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const objv[]) {
     try {
         RoiPoolArgs args = ParseRoiPoolArgs(interp,objc,objv);
-        if(tensor_storage.find(args.input)==tensor_storage.end()) { Tcl_SetResult(interp,const_cast<char*>("Invalid input tensor"),TCL_VOLATILE); return TCL_ERROR; }
-        if(tensor_storage.find(args.boxes)==tensor_storage.end()) { Tcl_SetResult(interp,const_cast<char*>("Invalid boxes tensor"),TCL_VOLATILE); return TCL_ERROR; }
-        auto input = tensor_storage[args.input];
-        auto boxes = tensor_storage[args.boxes];
+        torch::Tensor* input_ptr = FindTensorFromObj(args.inputObj);
+        torch::Tensor* boxes_ptr = FindTensorFromObj(args.boxesObj);
+        if(input_ptr==nullptr) { Tcl_SetResult(interp,const_cast<char*>("Invalid input tensor"),TCL_VOLATILE); return TCL_ERROR; }
+        if(boxes_ptr==nullptr) { Tcl_SetResult(interp,const_cast<char*>("Invalid boxes tensor"),TCL_VOLATILE); return TCL_ERROR; }
+        auto input = *input_ptr;
+        auto boxes = *boxes_ptr;
 
         // Simplified ROI pooling using adaptive max pooling on cropped regions (placeholder)
         auto output = torch::nn::functional::adaptive_max_pool2d(input, torch::nn::functional::AdaptiveMaxPool2dFuncOptions(args.outputSize));
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
         Tcl_SetObjResult(interp,Tcl_NewStringObj(handle.c_str(),-1));
         return TCL_OK;
     } catch(const std::exception &e) {
@@ -1402,6 +1446,9 @@ struct NormalizeImageArgs {
     std::string image;
     std::string mean;
     std::string std;
+    Tcl_Obj* imageObj = nullptr;
+    Tcl_Obj* meanObj = nullptr;
+    Tcl_Obj* stdObj = nullptr;
     bool inplace = false;
     
     bool IsValid() const {
@@ -1424,8 +1471,11 @@ NormalizeImageArgs ParseNormalizeImageArgs(Tcl_Interp* interp, int objc, Tcl_Obj
         }
         
         args.image = Tcl_GetString(objv[1]);
+        args.imageObj = objv[1];
         args.mean = Tcl_GetString(objv[2]);
+        args.meanObj = objv[2];
         args.std = Tcl_GetString(objv[3]);
+        args.stdObj = objv[3];
         
         if (objc > 4) {
             int inplace_int;
@@ -1444,10 +1494,13 @@ NormalizeImageArgs ParseNormalizeImageArgs(Tcl_Interp* interp, int objc, Tcl_Obj
             
             if (param == "-image") {
                 args.image = Tcl_GetString(objv[i + 1]);
+                args.imageObj = objv[i + 1];
             } else if (param == "-mean") {
                 args.mean = Tcl_GetString(objv[i + 1]);
+                args.meanObj = objv[i + 1];
             } else if (param == "-std") {
                 args.std = Tcl_GetString(objv[i + 1]);
+                args.stdObj = objv[i + 1];
             } else if (param == "-inplace") {
                 int inplace_int;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &inplace_int) != TCL_OK) {
@@ -1474,19 +1527,22 @@ int NormalizeImage_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         NormalizeImageArgs args = ParseNormalizeImageArgs(interp, objc, objv);
         
         // Validate tensor existence
-        if (tensor_storage.find(args.image) == tensor_storage.end()) {
+        torch::Tensor* image_tensor = FindTensorFromObj(args.imageObj);
+        if (image_tensor == nullptr) {
             throw std::runtime_error("Invalid image tensor");
         }
-        if (tensor_storage.find(args.mean) == tensor_storage.end()) {
+        torch::Tensor* mean_tensor = FindTensorFromObj(args.meanObj);
+        if (mean_tensor == nullptr) {
             throw std::runtime_error("Invalid mean tensor");
         }
-        if (tensor_storage.find(args.std) == tensor_storage.end()) {
+        torch::Tensor* std_tensor = FindTensorFromObj(args.stdObj);
+        if (std_tensor == nullptr) {
             throw std::runtime_error("Invalid std tensor");
         }
         
-        auto image = tensor_storage[args.image];
-        auto mean = tensor_storage[args.mean];
-        auto std = tensor_storage[args.std];
+        auto image = *image_tensor;
+        auto mean = *mean_tensor;
+        auto std = *std_tensor;
         
         if (args.inplace) {
             // For inplace operation, modify the input tensor directly
@@ -1496,9 +1552,8 @@ int NormalizeImage_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const
         } else {
             // For non-inplace operation, create a new tensor
             auto output = (image - mean) / std;
-            std::string handle = GetNextHandle("tensor");
-            tensor_storage[handle] = output;
-            Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+            std::string handle = StoreTensor(output);
+            Tcl_SetObjResult(interp, NewHandleObj(handle));
         }
         
         return TCL_OK;
@@ -1513,6 +1568,9 @@ struct DenormalizeImageArgs {
     std::string image;
     std::string mean;
     std::string std;
+    Tcl_Obj* imageObj = nullptr;
+    Tcl_Obj* meanObj = nullptr;
+    Tcl_Obj* stdObj = nullptr;
     bool inplace = false;
     
     bool IsValid() const {
@@ -1535,8 +1593,11 @@ DenormalizeImageArgs ParseDenormalizeImageArgs(Tcl_Interp* interp, int objc, Tcl
         }
         
         args.image = Tcl_GetString(objv[1]);
+        args.imageObj = objv[1];
         args.mean = Tcl_GetString(objv[2]);
+        args.meanObj = objv[2];
         args.std = Tcl_GetString(objv[3]);
+        args.stdObj = objv[3];
         
         if (objc > 4) {
             int inplace_int;
@@ -1555,10 +1616,13 @@ DenormalizeImageArgs ParseDenormalizeImageArgs(Tcl_Interp* interp, int objc, Tcl
             std::string param = Tcl_GetString(objv[i]);
             if (param == "-image") {
                 args.image = Tcl_GetString(objv[i + 1]);
+                args.imageObj = objv[i + 1];
             } else if (param == "-mean") {
                 args.mean = Tcl_GetString(objv[i + 1]);
+                args.meanObj = objv[i + 1];
             } else if (param == "-std") {
                 args.std = Tcl_GetString(objv[i + 1]);
+                args.stdObj = objv[i + 1];
             } else if (param == "-inplace") {
                 int inplace_int;
                 if (Tcl_GetIntFromObj(interp, objv[i + 1], &inplace_int) != TCL_OK) {
@@ -1583,24 +1647,27 @@ int DenormalizeImage_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
     try {
         DenormalizeImageArgs args = ParseDenormalizeImageArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.image) == tensor_storage.end()) {
+        torch::Tensor* image_tensor = FindTensorFromObj(args.imageObj);
+        if (image_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid image tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.mean) == tensor_storage.end()) {
+        torch::Tensor* mean_tensor = FindTensorFromObj(args.meanObj);
+        if (mean_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid mean tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
         
-        if (tensor_storage.find(args.std) == tensor_storage.end()) {
+        torch::Tensor* std_tensor = FindTensorFromObj(args.stdObj);
+        if (std_tensor == nullptr) {
             Tcl_SetResult(interp, const_cast<char*>("Invalid std tensor"), TCL_VOLATILE);
             return TCL_ERROR;
         }
 
-        auto image = tensor_storage[args.image];
-        auto mean = tensor_storage[args.mean];
-        auto std = tensor_storage[args.std];
+        auto image = *image_tensor;
+        auto mean = *mean_tensor;
+        auto std = *std_tensor;
 
         torch::Tensor output;
         if (args.inplace) {
@@ -1610,10 +1677,9 @@ int DenormalizeImage_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
             output = (image * std) + mean;
         }
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         Tcl_SetResult(interp, const_cast<char*>(e.what()), TCL_VOLATILE);
@@ -1624,6 +1690,7 @@ int DenormalizeImage_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* cons
 // Parameter structure for resize_image command
 struct ResizeImageArgs {
     std::string input;
+    Tcl_Obj* inputObj = nullptr;
     std::vector<int64_t> size;
     std::string mode = "bilinear";  // Default mode
     bool align_corners = false;      // Default align_corners
@@ -1648,6 +1715,7 @@ ResizeImageArgs ParseResizeImageArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
         }
         
         args.input = Tcl_GetString(objv[1]);
+        args.inputObj = objv[1];
         args.size = ParseSizeList(interp, objv[2]);
         
         if (objc > 3) {
@@ -1672,6 +1740,7 @@ ResizeImageArgs ParseResizeImageArgs(Tcl_Interp* interp, int objc, Tcl_Obj* cons
             
             if (param == "-input" || param == "-tensor" || param == "-image") {
                 args.input = Tcl_GetString(objv[i + 1]);
+                args.inputObj = objv[i + 1];
             } else if (param == "-size") {
                 args.size = ParseSizeList(interp, objv[i + 1]);
             } else if (param == "-mode") {
@@ -1700,11 +1769,12 @@ int ResizeImage_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
     try {
         ResizeImageArgs args = ParseResizeImageArgs(interp, objc, objv);
         
-        if (tensor_storage.find(args.input) == tensor_storage.end()) {
+        torch::Tensor* input_tensor = FindTensorFromObj(args.inputObj);
+        if (input_tensor == nullptr) {
             throw std::runtime_error("Invalid input tensor");
         }
 
-        auto input = tensor_storage[args.input];
+        auto input = *input_tensor;
 
         torch::nn::functional::InterpolateFuncOptions::mode_t mode = torch::kBilinear;
         if (args.mode == "nearest") {
@@ -1729,10 +1799,9 @@ int ResizeImage_Cmd(ClientData, Tcl_Interp* interp, int objc, Tcl_Obj* const obj
 
         auto output = torch::nn::functional::interpolate(input, options);
 
-        std::string handle = GetNextHandle("tensor");
-        tensor_storage[handle] = output;
+        std::string handle = StoreTensor(output);
 
-        Tcl_SetObjResult(interp, Tcl_NewStringObj(handle.c_str(), -1));
+        Tcl_SetObjResult(interp, NewHandleObj(handle));
         return TCL_OK;
     } catch (const std::exception& e) {
         std::string error = e.what();
@@ -0,0 +1,107 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+set a [torch::tensor_create {1 2 3 4} {2 2} float32]
+set b [torch::tensor_create {5 6 7 8} {2 2} float32]
+
+test async-1.1 {async_wait returns the result of the command} {
+    set future [torch::async [list torch::tensor_matmul $a $b]]
+    list [string match "future*" $future] [torch::tensor_to_list [torch::async_wait $future]]
+} {1 {19.0 22.0 43.0 50.0}}
+
+test async-1.2 {Completion sets the variable for vwait} {
+    set ::done ""
+    set future [torch::async -command [list torch::tensorMatmul -input $a -other $b] -variable ::done]
+    vwait ::done
+    list $::done [torch::tensor_to_list [torch::asyncWait -future $future]]
+} {done {19.0 22.0 43.0 50.0}}
+
+test async-1.3 {Completion runs the callback with the future appended} {
+    set ::completed {}
+    proc on_done {tag future} {
+        set ::completed [list $tag [torch::tensor_shape [torch::async_wait $future]]]
+    }
+    set layer [torch::linear 2 3]
+    torch::async [list torch::layer_forward $layer $a] [list on_done forward]
+    vwait ::completed
+    set ::completed
+} {forward {2 3}}
+
+test async-1.4 {Programs run asynchronously and return every output} {
+    set future [torch::async [list torch::exec {{s add x y} {t sum s}} [list x $a y $b] {s t}]]
+    set handles [torch::async_wait $future]
+    list [llength $handles] [expr {[torch::tensor_item [lindex $handles 1]]}]
+} {2 36.0}
+
+test async-1.5 {Several futures complete independently} {
+    set futures {}
+    for {set i 0} {$i < 8} {incr i} {
+        lappend futures [torch::async [list torch::tensor_matmul $a $b]]
+    }
+    set results {}
+    foreach future $futures {
+        lappend results [torch::tensor_to_list [torch::async_wait $future]]
+    }
+    lsort -unique $results
+} {{19.0 22.0 43.0 50.0}}
+
+test async-2.1 {Errors of the computation are raised by async_wait} {
+    set c [torch::tensor_create {1 2 3} float32]
+    set future [torch::async [list torch::tensor_matmul $a $c]]
+    list [catch {torch::async_wait $future} msg] [expr {$msg ne ""}]
+} {1 1}
+
+test async-2.2 {Argument errors are raised right away} {
+    catch {torch::async [list torch::tensor_matmul $a nosuchtensor]} msg
+    set msg
+} {Invalid second tensor name}
+
+test async-2.3 {Unsupported commands are rejected} {
+    catch {torch::async [list torch::tensor_add $a $b]} msg
+    string match "torch::async cannot run torch::tensor_add*" $msg
+} {1}
+
+test async-2.4 {Error: unknown future} {
+    catch {torch::async_wait future999999} msg
+    set msg
+} {Invalid future: future999999}
+
+test async-3.1 {Futures are handles} {
+    set before [torch::handle_count future]
+    set future [torch::async [list torch::tensor_matmul $a $b]]
+    set during [torch::handle_count future]
+    torch::async_wait $future
+    torch::release $future
+    list [expr {$during - $before}] [expr {[torch::handle_count future] - $before}]
+} {1 0}
+
+test async-3.2 {A future released while pending is dropped quietly} {
+    set ::never ""
+    set future [torch::async -command [list torch::tensor_matmul $a $b] -variable ::never]
+    torch::release $future
+    after 200 {set ::timeout 1}
+    vwait ::timeout
+    set ::never
+} {}
+
+test async-3.3 {Results completed inside a scope outlive it} {
+    set future [torch::async [list torch::tensor_matmul $a $b]]
+    torch::scope {
+        torch::async_wait $future
+        list
+    }
+    torch::tensor_shape [torch::async_wait $future]
+} {2 2}
+
+cleanupTests
@@ -0,0 +1,197 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# 10 samples: x row i is {i i}, y is i
+set x [torch::tensor_create {0 0 1 1 2 2 3 3 4 4 5 5 6 6 7 7 8 8 9 9} {10 2} int64]
+set y [torch::tensor_create {0 1 2 3 4 5 6 7 8 9} int64]
+set ds [torch::dataset [list $x $y]]
+
+proc epochLabels {loader} {
+    set labels {}
+    while {[set batch [torch::dataloader_next $loader]] ne ""} {
+        lappend labels {*}[torch::tensor_to_list [lindex $batch 1]]
+    }
+    return $labels
+}
+
+test dataloader-1.1 {Sequential batches with a short last batch} {
+    set loader [torch::dataloader $ds 4]
+    set shapes {}
+    while {[set batch [torch::dataloader_next $loader]] ne ""} {
+        lappend shapes [torch::tensor_shape [lindex $batch 0]]
+    }
+    list [torch::dataloader_len $loader] $shapes
+} {3 {{4 2} {4 2} {2 2}}}
+
+test dataloader-1.2 {Features and labels stay aligned when shuffled} {
+    set loader [torch::dataloader -dataset $ds -batchSize 3 -shuffle 1 -seed 11]
+    set ok 1
+    while {[set batch [torch::dataloader_next $loader]] ne ""} {
+        lassign $batch xb yb
+        foreach {a b} [torch::tensor_to_list $xb] label [torch::tensor_to_list $yb] {
+            if {$a != $label || $b != $label} {set ok 0}
+        }
+    }
+    set ok
+} {1}
+
+test dataloader-1.3 {A shuffled epoch is a permutation} {
+    set loader [torch::dataloader -dataset $ds -batchSize 3 -shuffle 1 -seed 5]
+    lsort -integer [epochLabels $loader]
+} {0 1 2 3 4 5 6 7 8 9}
+
+test dataloader-1.4 {Same seed gives the same order regardless of workers} {
+    set a [torch::dataloader -dataset $ds -batchSize 2 -shuffle 1 -seed 3]
+    set b [torch::dataloader -dataset $ds -batchSize 2 -shuffle 1 -seed 3 -numWorkers 3 -prefetch 2]
+    expr {[epochLabels $a] eq [epochLabels $b]}
+} {1}
+
+test dataloader-1.5 {Epochs continue automatically with a new order} {
+    set loader [torch::dataloader -dataset $ds -batchSize 10 -shuffle 1 -seed 9]
+    set first [epochLabels $loader]
+    set second [epochLabels $loader]
+    list [expr {[lsort -integer $second] eq [lsort -integer $first]}] [expr {$first ne $second}]
+} {1 1}
+
+test dataloader-1.6 {Reset replays an epoch} {
+    set loader [torch::dataloader -dataset $ds -batchSize 4 -shuffle 1 -seed 21 -numWorkers 2]
+    set first [epochLabels $loader]
+    torch::dataloader_next $loader
+    list [torch::dataloaderReset -loader $loader -epoch 0] [expr {[epochLabels $loader] eq $first}]
+} {0 1}
+
+test dataloader-1.7 {dropLast} {
+    set loader [torch::dataloader -dataset $ds -batchSize 4 -dropLast 1]
+    list [torch::dataloaderLen -loader $loader] [llength [epochLabels $loader]]
+} {2 8}
+
+test dataloader-1.8 {Single-source datasets return a plain handle} {
+    set loader [torch::dataloader [torch::dataset [list $y]] 5 0 2]
+    torch::tensor_to_list [torch::dataloaderNext -loader $loader]
+} {0 1 2 3 4}
+
+test dataloader-1.9 {Releasing a loader with workers} {
+    set before [torch::handle_count dataloader]
+    set loader [torch::dataloader -dataset $ds -batchSize 1 -numWorkers 4 -prefetch 4]
+    torch::dataloader_next $loader
+    torch::release $loader
+    expr {[torch::handle_count dataloader] - $before}
+} {0}
+
+# Padded sequences: sample i has length i % 4 + 1, padded to 4 steps; the
+# value at each valid step is the sample index, padding is -1
+set seqValues {}
+set seqLengths {}
+for {set i 0} {$i < 12} {incr i} {
+    set len [expr {$i % 4 + 1}]
+    lappend seqLengths $len
+    for {set t 0} {$t < 4} {incr t} {
+        lappend seqValues [expr {$t < $len ? $i : -1}]
+    }
+}
+set seq [torch::tensor_create $seqValues {12 4} int64]
+set seqLens [torch::tensor_create $seqLengths int64]
+set seqDs [torch::dataset [list $seq $y]]
+
+test dataloader-3.1 {Bucketed batches hold similar lengths and are trimmed} {
+    set loader [torch::dataloader -dataset [torch::dataset [list $seq]] -batchSize 3 -lengths $seqLens]
+    set result {}
+    while {[set batch [torch::dataloader_next $loader]] ne ""} {
+        lassign $batch xb lb
+        lappend result [torch::tensor_to_list $lb] [lindex [torch::tensor_shape $xb] 1]
+    }
+    set result
+} {{4 4 4} 4 {3 3 3} 3 {2 2 2} 2 {1 1 1} 1}
+
+test dataloader-3.2 {Trimmed rows keep only valid steps} {
+    set loader [torch::dataloader -dataset [torch::dataset [list $seq]] -batchSize 3 -lengths $seqLens]
+    torch::dataloader_next $loader
+    torch::dataloader_next $loader
+    torch::dataloader_next $loader
+    lassign [torch::dataloader_next $loader] xb
+    lsort -integer [torch::tensor_to_list $xb]
+} {0 4 8}
+
+test dataloader-3.3 {Shuffled buckets cover every sample once, sorted within batches} {
+    set loader [torch::dataloader -dataset $seqDs -batchSize 5 -shuffle 1 -seed 4 -lengths $seqLens -bucketSize 2 -numWorkers 2]
+    set labels {}
+    set sorted 1
+    while {[set batch [torch::dataloader_next $loader]] ne ""} {
+        lassign $batch xb yb lb
+        set lens [torch::tensor_to_list $lb]
+        if {$lens ne [lsort -integer -decreasing $lens]} {set sorted 0}
+        lappend labels {*}[torch::tensor_to_list $yb]
+    }
+    list $sorted [lsort -integer $labels]
+} {1 {0 1 2 3 4 5 6 7 8 9 10 11}}
+
+test dataloader-3.4 {Bucketed batches pack directly} {
+    set features [torch::tensor_reshape [torch::tensor_to $seq cpu float32] {12 4 1}]
+    set loader [torch::dataloader -dataset [torch::dataset [list $features]] -batchSize 4 -shuffle 1 -seed 1 -lengths $seqLens]
+    lassign [torch::dataloader_next $loader] xb lb
+    set packed [torch::pack_padded_sequence $xb $lb 1]
+    string match "packed*" $packed
+} {1}
+
+test dataloader-3.5 {Lengths must match the dataset} {
+    catch {torch::dataloader -dataset $seqDs -lengths [torch::tensor_create {1 2} int64]} msg
+    set msg
+} {lengths must be a 1-D tensor with one entry per sample}
+
+test dataloader-3.6 {Lengths longer than the padding} {
+    catch {torch::dataloader -dataset $seqDs -lengths [torch::full {12} 5 int64]} msg
+    set msg
+} {lengths must lie between 0 and the padded length 4}
+
+test dataloader-3.7 {Only the named sequence sources are trimmed} {
+    set mask [torch::ones {12 4} int64]
+    set ds [torch::dataset [list $seq $mask $seq]]
+    set loader [torch::dataloader -dataset $ds -batchSize 3 -lengths $seqLens -sequence_sources {0 2}]
+    torch::dataloader_next $loader
+    lassign [torch::dataloader_next $loader] a m b
+    list [torch::tensor_shape $a] [torch::tensor_shape $m] [torch::tensor_shape $b]
+} {{3 3} {3 4} {3 3}}
+
+test dataloader-3.8 {Sequence sources must share the padded length} {
+    set ds [torch::dataset [list $seq [torch::zeros {12 5} int64]]]
+    catch {torch::dataloader -dataset $ds -lengths $seqLens -sequenceSources {0 1}} msg
+    set msg
+} {Sequence source 1 has 5 steps in dimension 1, expected 4}
+
+test dataloader-3.9 {Sequence source indices are checked} {
+    catch {torch::dataloader -dataset $seqDs -lengths $seqLens -sequenceSources {0 5}} msg
+    set msg
+} {Sequence source 5 is out of range for a dataset with 2 sources}
+
+test dataloader-2.1 {Invalid dataset} {
+    catch {torch::dataloader nosuch} msg
+    set msg
+} {Invalid dataset handle: nosuch}
+
+test dataloader-2.2 {Invalid batch size} {
+    catch {torch::dataloader -dataset $ds -batchSize 0} msg
+    set msg
+} {batchSize, prefetch and bucketSize must be positive and numWorkers non-negative}
+
+test dataloader-2.3 {Invalid loader} {
+    catch {torch::dataloader_next nosuch} msg
+    set msg
+} {Invalid dataloader handle: nosuch}
+
+test dataloader-2.4 {Unknown parameter} {
+    catch {torch::dataloader -dataset $ds -bogus 1} msg
+    string match "Unknown parameter: -bogus*" $msg
+} {1}
+
+cleanupTests
@@ -0,0 +1,72 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+test dataset-1.1 {Dataset from tensors} {
+    set x [torch::zeros {10 3}]
+    set y [torch::zeros {10}]
+    torch::dataset_size [torch::dataset [list $x $y]]
+} {10}
+
+test dataset-1.2 {Named syntax and camelCase size} {
+    set ds [torch::dataset -tensors [list [torch::ones {7 2}]]]
+    torch::datasetSize -dataset $ds
+} {7}
+
+test dataset-1.3 {Record file source} {
+    set path [file join [temporaryDirectory] records.bin]
+    set f [open $path wb]
+    puts -nonewline $f [binary format i12 {0 1 2 3 4 5 6 7 8 9 10 11}]
+    close $f
+    set ds [torch::dataset -files [list [list $path int32 {3}]]]
+    set loader [torch::dataloader $ds 4]
+    list [torch::dataset_size $ds] [torch::tensor_to_list [torch::dataloader_next $loader]]
+} {4 {0 1 2 3 4 5 6 7 8 9 10 11}}
+
+test dataset-1.4 {Dataset keeps its tensors after the handles are freed} {
+    set x [torch::ones {4 2}]
+    set ds [torch::dataset [list $x]]
+    torch::tensor_free $x
+    torch::dataset_size $ds
+} {4}
+
+test dataset-1.5 {Released like other handles} {
+    set before [torch::handle_count dataset]
+    set ds [torch::dataset [list [torch::ones {2}]]]
+    torch::release $ds
+    expr {[torch::handle_count dataset] - $before}
+} {0}
+
+test dataset-2.1 {Mismatched sizes} {
+    catch {torch::dataset [list [torch::ones {4 2}] [torch::ones {5}]]} msg
+    set msg
+} {All dataset sources must have the same size in dimension 0}
+
+test dataset-2.2 {Invalid tensor} {
+    catch {torch::dataset {nosuch}} msg
+    set msg
+} {Invalid tensor name: nosuch}
+
+test dataset-2.3 {Record file with a partial record} {
+    set path [file join [temporaryDirectory] partial.bin]
+    set f [open $path wb]
+    puts -nonewline $f [binary format i5 {0 1 2 3 4}]
+    close $f
+    catch {torch::dataset -files [list [list $path int32 {2}]]}
+} {1}
+
+test dataset-2.4 {No sources} {
+    catch {torch::dataset -tensors {}}
+} {1}
+
+cleanupTests
@@ -0,0 +1,91 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+set a [torch::tensor_create {1 2 3} float32]
+set b [torch::tensor_create {4 5 6} float32]
+
+test exec-1.1 {Chained elementwise ops with constants} {
+    set r [torch::exec {{t add x y} {t mul t 2} {t sub t 1}} [list x $a y $b]]
+    torch::tensor_to_list $r
+} {9.0 13.0 17.0}
+
+test exec-1.2 {Unbound names resolve as tensor handles} {
+    set r [torch::exec [list [list s add $a $b]]]
+    torch::tensor_to_list $r
+} {5.0 7.0 9.0}
+
+test exec-1.3 {Named syntax with several outputs} {
+    set handles [torch::exec -program {{s mul x x} {t sum s}} -inputs [list x $a] -outputs {s t}]
+    list [llength $handles] [torch::tensor_to_list [lindex $handles 0]] [expr {[torch::tensor_item [lindex $handles 1]]}]
+} {2 {1.0 4.0 9.0} 14.0}
+
+test exec-1.4 {Attribute ops} {
+    set m [torch::tensor_create {1 2 3 4 5 6} {2 3} float32]
+    set r [torch::exec {{t transpose m 0 1} {t reshape t 6} {t clamp t 2 5}} [list m $m]]
+    torch::tensor_to_list $r
+} {2.0 4.0 2.0 5.0 3.0 5.0}
+
+test exec-1.5 {Linear matches torch::linear semantics} {
+    set x [torch::tensor_create {1 2} {1 2} float32]
+    set w [torch::tensor_create {1 0 0 1 1 1} {3 2} float32]
+    set bias [torch::tensor_create {0 0 1} float32]
+    set r [torch::exec {{y linear x w b} {y relu y}} [list x $x w $w b $bias]]
+    torch::tensor_to_list $r
+} {1.0 2.0 4.0}
+
+test exec-1.6 {A program object is reused across calls} {
+    set prog {{t add x 1}}
+    set r1 [torch::exec $prog [list x $a]]
+    set r2 [torch::exec $prog [list x $b]]
+    list [torch::tensor_to_list $r1] [torch::tensor_to_list $r2]
+} {{2.0 3.0 4.0} {5.0 6.0 7.0}}
+
+test exec-1.7 {Constants promote like scalars on integer tensors} {
+    set n [torch::tensor_create {1 2 3} int64]
+    set half [torch::exec {{t mul n 0.5}} [list n $n]]
+    set plus [torch::exec {{t add n 1}} [list n $n]]
+    list [torch::tensor_dtype $half] [torch::tensor_to_list $half] \
+         [torch::tensor_dtype $plus] [torch::tensor_to_list $plus]
+} {Float32 {0.5 1.0 1.5} Int64 {2 3 4}}
+
+test exec-1.8 {Program object also used as the inputs list} {
+    # Binding the inputs turns the program object into a list
+    set prog [list [list s neg $a] [list t neg s]]
+    set handles [torch::exec $prog $prog {s t}]
+    set again [torch::exec $prog {} {t}]
+    list [torch::tensor_to_list [lindex $handles 0]] [torch::tensor_to_list $again]
+} {{-1.0 -2.0 -3.0} {1.0 2.0 3.0}}
+
+test exec-1.9 {Only decimal literals are constants} {
+    set r [torch::exec {{t add inf nan} {t mul t 1e1} {t add t -.5}} [list inf $a nan $b]]
+    torch::tensor_to_list $r
+} {49.5 69.5 89.5}
+
+test exec-2.1 {Unknown op} -body {
+    torch::exec {{t frobnicate x}} [list x $a]
+} -returnCodes error -result {Statement 1 (frobnicate): unknown op}
+
+test exec-2.2 {Unbound input} -body {
+    torch::exec {{t add nosuch 1}}
+} -returnCodes error -result {Unbound program input: nosuch}
+
+test exec-2.3 {Unknown output register} -body {
+    torch::exec -program {{t neg x}} -inputs [list x $a] -outputs {u}
+} -returnCodes error -result {Unknown output register: u}
+
+test exec-2.4 {Unknown parameter} -body {
+    torch::exec -program {{t neg x}} -bogus 1
+} -returnCodes error -match glob -result {Unknown parameter: -bogus*}
+
+cleanupTests
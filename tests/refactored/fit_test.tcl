@@ -0,0 +1,110 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# y = 2x on 8 points
+set x [torch::tensor_create {0.0 0.25 0.5 0.75 1.0 1.25 1.5 1.75} {8 1} float32]
+set y [torch::tensor_create {0.0 0.5 1.0 1.5 2.0 2.5 3.0 3.5} {8 1} float32]
+set ds [torch::dataset [list $x $y]]
+
+proc newSetup {} {
+    set model [torch::linear 1 1]
+    set opt [torch::optimizer_sgd [torch::layer_parameters $model] 0.1]
+    set loader [torch::dataloader $::ds 2]
+    return [list $model $opt $loader]
+}
+
+proc record {metrics} {
+    lappend ::events [dict get $metrics event] [dict get $metrics step]
+}
+
+test fit-1.1 {Runs every epoch and reports totals} {
+    lassign [newSetup] model opt loader
+    set result [torch::fit $model $opt mse $loader 3]
+    list [dict get $result epoch] [dict get $result step] [dict get $result stopped]
+} {3 12 0}
+
+test fit-1.2 {Loss decreases over epochs} {
+    lassign [newSetup] model opt loader
+    set first [dict get [torch::fit $model $opt mse $loader 1] loss]
+    set last [dict get [torch::fit $model $opt mse $loader 20] loss]
+    expr {$last < $first}
+} {1}
+
+test fit-1.3 {Callback every N steps and at epoch end} {
+    lassign [newSetup] model opt loader
+    set ::events {}
+    torch::fit -model $model -optimizer $opt -loss mse -loader $loader -epochs 2 -callback record -every 3
+    set ::events
+} {step 3 epoch 4 step 6 step 9 epoch 8}
+
+test fit-1.4 {Callback metrics} {
+    lassign [newSetup] model opt loader
+    set ::metrics {}
+    torch::fit $model $opt mse $loader 1 {apply {{m} {set ::metrics $m}}}
+    list [lsort [dict keys $::metrics]] [expr {[dict get $::metrics samples_per_sec] > 0}]
+} {{epoch event loss samples_per_sec step} 1}
+
+test fit-1.5 {Break stops training early} {
+    lassign [newSetup] model opt loader
+    set result [torch::fit $model $opt mse $loader 10 {apply {{m} {return -code break}}}]
+    list [dict get $result epoch] [dict get $result stopped]
+} {1 1}
+
+test fit-1.6 {Scheduler steps once per epoch} {
+    lassign [newSetup] model opt loader
+    set sched [torch::lr_scheduler_step $opt 1 0.5]
+    torch::fit -model $model -optimizer $opt -loss mse -loader $loader -epochs 2 -scheduler $sched
+    torch::get_lr $opt
+} {0.025}
+
+test fit-1.7 {No handles leak from the loop} {
+    lassign [newSetup] model opt loader
+    set before [torch::handle_count]
+    torch::fit $model $opt mse $loader 2
+    expr {[torch::handle_count] - $before}
+} {0}
+
+test fit-1.8 {A partly consumed loader restarts its epoch} {
+    lassign [newSetup] model opt loader
+    torch::dataloader_next $loader
+    torch::dataloader_next $loader
+    dict get [torch::fit $model $opt mse $loader 1] step
+} {4}
+
+test fit-2.1 {Callback errors propagate} {
+    lassign [newSetup] model opt loader
+    catch {torch::fit $model $opt mse $loader 1 {apply {{m} {error "boom"}}}} msg
+    set msg
+} {boom}
+
+test fit-2.2 {Single-source loader} {
+    set model [torch::linear 1 1]
+    set opt [torch::optimizer_sgd [torch::layer_parameters $model] 0.1]
+    catch {torch::fit $model $opt mse [torch::dataloader [torch::dataset [list $x]] 2] 1} msg
+    set msg
+} {torch::fit needs a dataloader whose batches hold input and target}
+
+test fit-2.3 {Invalid loader} {
+    lassign [newSetup] model opt loader
+    catch {torch::fit $model $opt mse nosuch 1} msg
+    set msg
+} {Invalid dataloader handle: nosuch}
+
+test fit-2.4 {Epochs must be positive} {
+    lassign [newSetup] model opt loader
+    catch {torch::fit $model $opt mse $loader 0} msg
+    string match "Required parameters missing*" $msg
+} {1}
+
+cleanupTests
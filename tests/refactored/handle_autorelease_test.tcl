@@ -0,0 +1,91 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+proc make_temporaries {} {
+    set a [torch::ones {8 8}]
+    set b [torch::tensor_mul $a $a]
+    set s [torch::tensor_sum $b]
+    return [torch::tensor_item $s]
+}
+
+test handle_autorelease-1.1 {Disabled by default} {
+    torch::handle_autorelease
+} {0}
+
+test handle_autorelease-1.2 {Enable and disable} {
+    set on [torch::handle_autorelease 1]
+    set off [torch::handle_autorelease 0]
+    list $on $off
+} {1 0}
+
+test handle_autorelease-2.1 {Proc temporaries are reclaimed on return} {
+    torch::handle_autorelease 1
+    set before [torch::handle_count tensor]
+    make_temporaries
+    set after [torch::handle_count tensor]
+    torch::handle_autorelease 0
+    expr {$after == $before}
+} {1}
+
+test handle_autorelease-2.2 {Handles created while disabled are kept} {
+    torch::handle_autorelease 0
+    set before [torch::handle_count tensor]
+    make_temporaries
+    set after [torch::handle_count tensor]
+    expr {$after - $before}
+} {3}
+
+test handle_autorelease-2.3 {Unset releases the tensor} {
+    torch::handle_autorelease 1
+    set t [torch::zeros {16}]
+    set before [torch::handle_count tensor]
+    unset t
+    set after [torch::handle_count tensor]
+    torch::handle_autorelease 0
+    expr {$before - $after}
+} {1}
+
+test handle_autorelease-2.4 {Shared references keep the tensor alive} {
+    torch::handle_autorelease 1
+    set t [torch::zeros {16}]
+    set keep $t
+    unset t
+    set n [torch::tensor_numel $keep]
+    torch::handle_autorelease 0
+    set n
+} {16}
+
+test handle_autorelease-3.1 {Named syntax and camelCase alias} {
+    set a [torch::handle_autorelease -enabled true]
+    set b [torch::handleAutorelease -enabled false]
+    list $a $b
+} {1 0}
+
+test handle_autorelease-4.1 {Error on invalid boolean} -body {
+    torch::handle_autorelease maybe
+} -returnCodes error -result {Invalid boolean value}
+
+test handle_count-1.1 {Count by kind} {
+    set before [torch::handle_count -kind module]
+    set m [torch::linear 2 2]
+    set after [torch::handleCount module]
+    torch::release $m
+    expr {$after - $before}
+} {1}
+
+test handle_count-1.2 {Error on invalid kind} -body {
+    torch::handle_count widgets
+} -returnCodes error -result {Invalid kind: widgets. Valid kinds are: all, tensor, module, optimizer, scheduler, reader, dataset, dataloader, packed, stream, future, server, reserved}
+
+cleanupTests
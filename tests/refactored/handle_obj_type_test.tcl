@@ -0,0 +1,89 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Cached resolution of tensor handles
+test handle_obj_type-1.1 {Repeated use of the same handle object} {
+    set a [torch::ones {2 2}]
+    set acc [torch::zeros {2 2}]
+    for {set i 0} {$i < 10} {incr i} {
+        set acc [torch::tensor_add $acc $a]
+    }
+    torch::tensor_item [torch::tensor_sum $acc]
+} {40.000000}
+
+test handle_obj_type-1.2 {Handle copied as a plain string still resolves} {
+    set a [torch::ones {3}]
+    set s [string range $a 0 end]
+    llength [torch::tensor_to_list $s]
+} {3}
+
+test handle_obj_type-1.3 {Shimmered handle still resolves} {
+    set a [torch::ones {3}]
+    llength $a
+    llength [torch::tensor_to_list $a]
+} {3}
+
+test handle_obj_type-1.4 {Named syntax uses the cached path too} {
+    set a [torch::ones {2}]
+    set b [torch::ones {2}]
+    torch::tensor_to_list -input [torch::tensor_mul -input $a -other $b]
+} {1.0 1.0}
+
+# Released handles
+test handle_obj_type-2.1 {Freed tensor is rejected by cached objects} {
+    set a [torch::ones {2}]
+    set b [torch::ones {2}]
+    torch::tensor_add $a $b
+    torch::tensor_free $a
+    catch {torch::tensor_add $a $b}
+} {1}
+
+test handle_obj_type-2.2 {Freed tensor is rejected through a string copy} {
+    set a [torch::ones {2}]
+    set s "$a"
+    torch::tensor_to_list $s
+    torch::tensor_free $a
+    catch {torch::tensor_to_list $s} msg
+    set msg
+} {Invalid tensor name}
+
+# Module and optimizer handles
+test handle_obj_type-3.1 {Repeated layer forward through the cached module} {
+    set layer [torch::linear 4 2]
+    set x [torch::ones {1 4}]
+    for {set i 0} {$i < 5} {incr i} {
+        set y [torch::layer_forward $layer $x]
+    }
+    torch::tensor_shape $y
+} {1 2}
+
+test handle_obj_type-3.2 {Freed module is rejected} {
+    set layer [torch::linear 4 2]
+    set x [torch::ones {1 4}]
+    torch::layer_forward $layer $x
+    torch::release $layer
+    catch {torch::layer_forward $layer $x} msg
+    set msg
+} {Invalid layer name}
+
+test handle_obj_type-3.3 {Freed optimizer is rejected} {
+    set layer [torch::linear 4 2]
+    set opt [torch::optimizer_sgd [torch::layer_parameters $layer] 0.01]
+    torch::optimizer_zero_grad $opt
+    torch::release $opt
+    catch {torch::optimizer_step $opt} msg
+    set msg
+} {Invalid optimizer handle}
+
+cleanupTests
@@ -0,0 +1,71 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# TorchScript fixtures are written by PyTorch when it is available
+set scriptFile [file join [temporaryDirectory] jit_load_test.pt]
+testConstraint pytorch [expr {![catch {exec python3 -c {
+import sys, torch
+class Net(torch.nn.Module):
+    def __init__(self):
+        super().__init__()
+        self.fc = torch.nn.Linear(2, 1)
+        with torch.no_grad():
+            self.fc.weight.fill_(1.0)
+            self.fc.bias.fill_(0.5)
+    def forward(self, x):
+        return self.fc(x)
+    @torch.jit.export
+    def pair(self, x, y, k: int):
+        return x + y, x * k
+torch.jit.save(torch.jit.script(Net()), sys.argv[1])
+} $scriptFile}]}]
+
+test jit_load-1.1 {Forward through layer_forward} -constraints pytorch -body {
+    set m [torch::jit_load $scriptFile]
+    set x [torch::tensor_create {1 2} {1 2} float32]
+    torch::tensor_to_list [torch::layer_forward $m $x]
+} -result {3.5}
+
+test jit_load-1.2 {Frozen and optimized modules} -constraints pytorch -body {
+    set m [torch::jitLoad -path $scriptFile -freeze 1 -optimizeForInference 1]
+    set x [torch::tensor_create {2 2} {1 2} float32]
+    torch::tensor_to_list [torch::jit_forward $m [list $x]]
+} -result {4.5}
+
+test jit_load-1.3 {Multiple inputs and tuple outputs} -constraints pytorch -body {
+    set m [torch::jit_load $scriptFile]
+    set a [torch::tensor_create {1 2} float32]
+    set b [torch::tensor_create {3 4} float32]
+    lassign [torch::jitForward -module $m -inputs [list $a $b 3] -method pair] s p
+    list [torch::tensor_to_list $s] [torch::tensor_to_list $p]
+} -result {{4.0 6.0} {3.0 6.0}}
+
+test jit_load-1.4 {Parameters are exposed to the optimizers} -constraints pytorch -body {
+    set m [torch::jit_load $scriptFile]
+    llength [torch::layer_parameters $m]
+} -result {2}
+
+test jit_load-2.1 {Missing file} -body {
+    torch::jit_load /nonexistent/model.pt
+} -returnCodes error -match glob -result {Failed to load TorchScript module /nonexistent/model.pt*}
+
+test jit_load-2.2 {jit_forward rejects native modules} -body {
+    torch::jit_forward [torch::linear 2 1] {}
+} -returnCodes error -result {torch::jit_forward needs a module loaded with torch::jit_load}
+
+test jit_load-2.3 {Unknown parameter} -body {
+    torch::jit_load -path x.pt -bogus 1
+} -returnCodes error -match glob -result {Unknown parameter: -bogus*}
+
+cleanupTests
@@ -113,6 +113,14 @@ test layer_forward-5.3 {Test sequential layer} {
     expr {$shape eq "3 5"}
 } {1}
 
+test layer_forward-5.4 {Normalization and recurrent layers are forwardable} {
+    set bn [torch::batch_norm1d 10]
+    set bn_output [torch::layer_forward $bn $input_tensor]
+    set lstm [torch::lstm 10 6]
+    set lstm_output [torch::layer_forward $lstm [torch::randn -shape {4 3 10}]]
+    list [torch::tensor_shape $bn_output] [torch::tensor_shape $lstm_output]
+} {{3 10} {4 3 6}}
+
 ;# Test 16: Multiple parameter formats work identically
 test layer_forward-6.1 {Multiple parameter formats produce same result} {
     ;# Test that both syntaxes produce the same output shape
@@ -0,0 +1,93 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+set a [torch::tensor_create {1 2 3} float32]
+set b [torch::tensor_create {2 2 2} float32]
+set c [torch::tensor_create {-2 -4 -6} float32]
+
+test lazy_fusion-1.1 {Fused expression matches eager evaluation} {
+    torch::lazy_begin
+    set t [torch::tensor_mul $a $b]
+    set u [torch::tensor_add $t $c]
+    set y [torch::tensor_sigmoid $u]
+    torch::lazy_end
+    torch::tensor_to_list $y
+} {0.5 0.5 0.5}
+
+test lazy_fusion-1.2 {Intermediates are computed when asked for} {
+    torch::lazy_begin
+    set t [torch::tensor_mul $a $b]
+    set y [torch::tensor_relu [torch::tensor_sub $t $b]]
+    torch::lazy_end
+    list [torch::tensor_to_list $y] [torch::tensor_to_list $t]
+} {{0.0 2.0 4.0} {2.0 4.0 6.0}}
+
+test lazy_fusion-1.3 {Pending handles materialize inside the region} {
+    torch::lazyBegin
+    set t [torch::tensor_add $a $a 2]
+    set shape [torch::tensor_shape $t]
+    set values [torch::tensor_to_list $t]
+    torch::lazyEnd
+    list $shape $values
+} {3 {3.0 6.0 9.0}}
+
+test lazy_fusion-1.4 {Scalar operands and unfusable inputs} {
+    set i [torch::tensor_create {1 2 3} int64]
+    torch::lazy_begin
+    set s [torch::tensor_mul $a 0.5]
+    set k [torch::tensor_add $i $i]
+    torch::lazy_end
+    list [torch::tensor_to_list $s] [torch::tensor_to_list $k]
+} {{0.5 1.0 1.5} {2 4 6}}
+
+test lazy_fusion-1.5 {Nested regions evaluate at the outermost end} {
+    torch::lazy_begin
+    torch::lazy_begin
+    set t [torch::tensor_square $a]
+    torch::lazy_end
+    torch::lazy_end
+    torch::tensor_to_list $t
+} {1.0 4.0 9.0}
+
+test lazy_fusion-1.6 {Evaluated handles are ordinary tensors after lazy_end} {
+    set v [torch::tensor_create {1 2 3} float32]
+    torch::lazy_begin
+    set y [torch::tensor_exp [torch::tensor_mul $v 0.0]]
+    torch::lazy_end
+    torch::tensor_mmap_write $v 0 [torch::tensor_create {5 5 5} float32]
+    torch::tensor_to_list $y
+} {1.0 1.0 1.0}
+
+test lazy_fusion-2.1 {lazy_end without lazy_begin} -body {
+    torch::lazy_end
+} -returnCodes error -result {torch::lazy_end called without torch::lazy_begin}
+
+test lazy_fusion-2.2 {Invalid inputs still fail eagerly} -body {
+    torch::lazy_begin
+    catch {torch::tensor_add nosuch $a} msg
+    torch::lazy_end
+    set msg
+} -result {Invalid first tensor name}
+
+test lazy_fusion-2.3 {Inputs modified in place before evaluation are detected} -body {
+    set v [torch::tensor_create {1 2 3} float32]
+    torch::lazy_begin
+    set t [torch::tensor_add $v $v]
+    set y [torch::tensor_relu $t]
+    torch::lazy_end
+    torch::tensor_mmap_write $v 0 [torch::tensor_create {5 5 5} float32]
+    torch::tensor_to_list $t
+} -returnCodes error -result {A tensor read by a pending lazy expression was modified in place before the expression was evaluated}
+
+cleanupTests
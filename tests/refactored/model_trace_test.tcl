@@ -0,0 +1,80 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+test model_trace-1.1 {Traced Sequential matches the eager model} {
+    set seq [torch::sequential [list [torch::linear 4 8] [torch::linear 8 2]]]
+    set x [torch::randn -shape {3 4}]
+    set traced [torch::model_trace $seq $x]
+    torch::allclose [torch::layer_forward $traced $x] [torch::layer_forward $seq $x]
+} {1}
+
+test model_trace-1.2 {Conv and batch norm are folded without changing results} {
+    set seq [torch::sequential [list [torch::conv2d -inChannels 1 -outChannels 2 -kernelSize 3] [torch::batchnorm2d 2]]]
+    torch::model_eval $seq
+    set x [torch::randn -shape {1 1 6 6}]
+    set traced [torch::modelTrace -model $seq -exampleInput $x]
+    set eager [torch::layer_forward $seq $x]
+    list [torch::allclose [torch::layer_forward $traced $x] $eager 1e-4 1e-5] [torch::tensor_shape $eager]
+} {1 {1 2 4 4}}
+
+test model_trace-1.3 {Traced models round-trip through jit_save and jit_load} {
+    set seq [torch::sequential [list [torch::linear 4 2]]]
+    set x [torch::randn -shape {2 4}]
+    set traced [torch::model_trace -model $seq -example_input $x -optimize 0]
+    set path [file join [temporaryDirectory] model_trace_test.pt]
+    torch::jit_save $traced $path
+    set loaded [torch::jit_load $path]
+    file delete $path
+    torch::allclose [torch::layer_forward $loaded $x] [torch::layer_forward $seq $x]
+} {1}
+
+test model_trace-1.4 {The traced graph accepts other batch sizes} {
+    set lin [torch::linear 2 3]
+    set traced [torch::model_trace $lin [torch::randn -shape {1 2}]]
+    torch::tensor_shape [torch::layer_forward $traced [torch::randn -shape {5 2}]]
+} {5 3}
+
+test model_trace-1.5 {Training the source model afterwards leaves the traced model unchanged} {
+    set lin [torch::linear 4 2]
+    set x [torch::randn -shape {3 4}]
+    set traced [torch::model_trace $lin $x]
+    set before [torch::layer_forward $traced $x]
+    set opt [torch::optimizer_sgd [torch::layer_parameters $lin] 0.5]
+    torch::tensor_backward [torch::tensor_sum [torch::layer_forward $lin $x]]
+    torch::optimizer_step $opt
+    list [torch::allclose [torch::layer_forward $traced $x] $before] \
+         [torch::allclose [torch::layer_forward $lin $x] $before]
+} {1 0}
+
+test model_trace-1.6 {Optimized graphs hold the weights as constants} {
+    set seq [torch::sequential [list [torch::linear 4 8] [torch::linear 8 2]]]
+    set x [torch::randn -shape {3 4}]
+    list [string first prim::GetAttr [torch::jit_graph [torch::model_trace $seq $x]]] \
+         [string first prim::GetAttr [torch::jitGraph -module [torch::model_trace $seq $x 0]]]
+} {-1 -1}
+
+test model_trace-2.1 {Invalid model} -body {
+    torch::model_trace nosuch [torch::randn -shape {1 2}]
+} -returnCodes error -result {Invalid model: nosuch}
+
+test model_trace-2.2 {jit_save needs a TorchScript module} -body {
+    torch::jit_save [torch::linear 2 2] x.pt
+} -returnCodes error -result {torch::jit_save needs a TorchScript module; trace it with torch::model_trace first}
+
+test model_trace-2.3 {jit_graph reports missing methods} -body {
+    set traced [torch::model_trace [torch::linear 2 2] [torch::randn -shape {1 2}]]
+    torch::jit_graph $traced nosuch
+} -returnCodes error -result {TorchScript module has no method nosuch}
+
+cleanupTests
@@ -0,0 +1,117 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Minimal version 1.0 .npy writer, independent of the extension
+proc npyBytes {descr shape bytes {fortran False}} {
+    set dict "{'descr': '$descr', 'fortran_order': $fortran, 'shape': ($shape), }"
+    set pad [expr {63 - (10 + [string length $dict]) % 64}]
+    append dict [string repeat " " $pad] "\n"
+    return [binary format a6ccs "\x93NUMPY" 1 0 [string length $dict]]$dict$bytes
+}
+
+proc writeNpy {name args} {
+    set path [file join [temporaryDirectory] $name]
+    set f [open $path wb]
+    puts -nonewline $f [npyBytes {*}$args]
+    close $f
+    return $path
+}
+
+# npy_load
+test npy_load-1.1 {float32 matrix} {
+    set t [torch::npy_load [writeNpy a.npy <f4 "2, 2" [binary format f4 {1 2 3 4}]]]
+    list [torch::tensor_shape $t] [torch::tensor_dtype $t] [torch::tensor_to_list $t]
+} {{2 2} Float32 {1.0 2.0 3.0 4.0}}
+
+test npy_load-1.2 {int64 vector, named syntax} {
+    set t [torch::npy_load -path [writeNpy b.npy <i8 "3," [binary format w3 {-1 0 5}]]]
+    torch::tensor_to_list $t
+} {-1 0 5}
+
+test npy_load-1.3 {uint8 and bool} {
+    set u [torch::npyLoad -path [writeNpy c.npy |u1 "3," [binary format c3 {0 200 255}]]]
+    set b [torch::npy_load [writeNpy d.npy |b1 "2," [binary format c2 {1 0}]]]
+    list [torch::tensor_dtype $u] [torch::tensor_to_list $u] [torch::tensor_dtype $b]
+} {UInt8 {0 200 255} Bool}
+
+test npy_load-1.4 {float16} {
+    # 1.0 and -2.0 as IEEE half precision
+    set t [torch::npy_load [writeNpy e.npy <f2 "2," [binary format s2 {15360 -16384}]]]
+    list [torch::tensor_dtype $t] [torch::tensor_to_list [torch::tensor_to $t cpu float32]]
+} {Float16 {1.0 -2.0}}
+
+test npy_load-1.5 {Fortran order} {
+    set t [torch::npy_load [writeNpy f.npy <i4 "2, 3" [binary format i6 {1 4 2 5 3 6}] True]]
+    list [torch::tensor_shape $t] [torch::tensor_to_list $t]
+} {{2 3} {1 2 3 4 5 6}}
+
+test npy_load-1.6 {Scalar array} {
+    set t [torch::npy_load [writeNpy g.npy <f8 "" [binary format d 2.5]]]
+    list [torch::tensor_shape $t] [torch::tensor_item $t]
+} {{} 2.500000}
+
+# npy_save
+test npy_load-2.1 {Save and load round trip} {
+    set path [file join [temporaryDirectory] rt.npy]
+    set t [torch::tensor_create {1 2 3 4 5 6} {2 3} int32]
+    torch::npy_save $path $t
+    set back [torch::npy_load $path]
+    list [torch::tensor_shape $back] [torch::tensor_dtype $back] [torch::tensor_to_list $back]
+} {{2 3} Int32 {1 2 3 4 5 6}}
+
+test npy_load-2.2 {Saved header matches numpy's layout} {
+    set path [file join [temporaryDirectory] hdr.npy]
+    torch::npySave -path $path -input [torch::tensor_create {1.0 2.0} float32]
+    set f [open $path rb]
+    set data [read $f]
+    close $f
+    list [string length $data] [string match "*'descr': '<f4', 'fortran_order': False, 'shape': (2,), *" $data]
+} {136 1}
+
+test npy_load-2.3 {Non-contiguous tensors are saved in logical order} {
+    set path [file join [temporaryDirectory] perm.npy]
+    set t [torch::tensor_permute [torch::tensor_create {1 2 3 4 5 6} {2 3} int64] {1 0}]
+    torch::npy_save -path $path -input $t
+    torch::tensor_to_list [torch::npy_load $path]
+} {1 4 2 5 3 6}
+
+# Error handling
+test npy_load-3.1 {Not a .npy file} {
+    set path [file join [temporaryDirectory] junk.npy]
+    set f [open $path wb]; puts -nonewline $f "not numpy data"; close $f
+    catch {torch::npy_load $path} msg
+    set msg
+} {Not a .npy file}
+
+test npy_load-3.2 {Big-endian data is rejected} {
+    catch {torch::npy_load [writeNpy be.npy >f4 "1," [binary format R 1.0]]} msg
+    set msg
+} {Big-endian .npy data is not supported: >f4}
+
+test npy_load-3.3 {Truncated data} {
+    catch {torch::npy_load [writeNpy short.npy <f4 "4," [binary format f2 {1 2}]]} msg
+    set msg
+} {Truncated .npy data}
+
+test npy_load-3.4 {bfloat16 cannot be saved} {
+    set t [torch::tensor_to [torch::ones {2}] cpu bfloat16]
+    catch {torch::npy_save [file join [temporaryDirectory] bf.npy] $t}
+} {1}
+
+test npy_load-3.5 {Unknown parameter} {
+    catch {torch::npy_load -path x -bogus 1} msg
+    string match "Unknown parameter: -bogus*" $msg
+} {1}
+
+cleanupTests
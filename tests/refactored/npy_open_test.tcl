@@ -0,0 +1,96 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+proc npyBytes {descr shape bytes {fortran False}} {
+    set dict "{'descr': '$descr', 'fortran_order': $fortran, 'shape': ($shape), }"
+    set pad [expr {63 - (10 + [string length $dict]) % 64}]
+    append dict [string repeat " " $pad] "\n"
+    return [binary format a6ccs "\x93NUMPY" 1 0 [string length $dict]]$dict$bytes
+}
+
+proc writeFile {name data} {
+    set path [file join [temporaryDirectory] $name]
+    set f [open $path wb]
+    puts -nonewline $f $data
+    close $f
+    return $path
+}
+
+# 5 rows of 2 int32 values: row i is {2i 2i+1}
+set cpath [writeFile c.npy [npyBytes <i4 "5, 2" [binary format i10 {0 1 2 3 4 5 6 7 8 9}]]]
+# The same logical array stored in Fortran order
+set fpath [writeFile f.npy [npyBytes <i4 "5, 2" [binary format i10 {0 2 4 6 8 1 3 5 7 9}] True]]
+
+proc readAll {reader} {
+    set blocks {}
+    while {[set t [torch::npy_next $reader]] ne ""} {
+        lappend blocks [list [torch::tensor_shape $t] [torch::tensor_to_list $t]]
+    }
+    return $blocks
+}
+
+test npy_open-1.1 {C-order blocks with a short last block} {
+    set r [torch::npy_open $cpath 2]
+    set blocks [readAll $r]
+    torch::npy_close $r
+    set blocks
+} {{{2 2} {0 1 2 3}} {{2 2} {4 5 6 7}} {{1 2} {8 9}}}
+
+test npy_open-1.2 {Fortran-order blocks match C order} {
+    set r [torch::npy_open -path $fpath -chunk 2]
+    set blocks [readAll $r]
+    torch::npy_close -reader $r
+    set blocks
+} {{{2 2} {0 1 2 3}} {{2 2} {4 5 6 7}} {{1 2} {8 9}}}
+
+test npy_open-1.3 {Chunk larger than the array} {
+    set r [torch::npyOpen -path $cpath -chunk 100]
+    set first [torch::tensor_shape [torch::npyNext -reader $r]]
+    list $first [torch::npy_next $r]
+} {{5 2} {}}
+
+test npy_open-1.4 {Readers are counted and released like other handles} {
+    set before [torch::handle_count reader]
+    set r [torch::npy_open $cpath]
+    set during [torch::handle_count reader]
+    torch::release $r
+    list [expr {$during - $before}] [expr {[torch::handle_count reader] - $before}]
+} {1 0}
+
+test npy_open-1.5 {Scopes close readers} {
+    set before [torch::handle_count reader]
+    torch::scope {
+        torch::npy_open $cpath
+        torch::npy_open $fpath
+    }
+    expr {[torch::handle_count reader] - $before}
+} {0}
+
+test npy_open-2.1 {Closed reader is rejected} {
+    set r [torch::npy_open $cpath]
+    torch::npy_close $r
+    catch {torch::npy_next $r} msg
+    string equal $msg "Invalid reader handle: $r"
+} {1}
+
+test npy_open-2.2 {Chunk must be positive} {
+    catch {torch::npy_open -path $cpath -chunk 0} msg
+    set msg
+} {Chunk size must be positive}
+
+test npy_open-2.3 {Missing file} {
+    catch {torch::npy_open [file join [temporaryDirectory] nope.npy]}
+} {1}
+
+cleanupTests
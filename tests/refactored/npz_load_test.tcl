@@ -0,0 +1,86 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+proc npyBytes {descr shape bytes} {
+    set dict "{'descr': '$descr', 'fortran_order': False, 'shape': ($shape), }"
+    set pad [expr {63 - (10 + [string length $dict]) % 64}]
+    append dict [string repeat " " $pad] "\n"
+    return [binary format a6ccs "\x93NUMPY" 1 0 [string length $dict]]$dict$bytes
+}
+
+# Minimal zip writer; members is a list of name data pairs. method 0 stores,
+# 8 deflates.
+proc writeNpz {name members {method 0}} {
+    set path [file join [temporaryDirectory] $name]
+    set out ""
+    set dir ""
+    foreach {member data} $members {
+        set crc [zlib crc32 $data]
+        set body [expr {$method == 8 ? [zlib deflate $data] : $data}]
+        set offset [string length $out]
+        append out [binary format isssssiiiss 0x04034b50 20 0 $method 0 0 $crc \
+            [string length $body] [string length $data] [string length $member] 0] $member $body
+        append dir [binary format issssssiiisssssii 0x02014b50 20 20 0 $method 0 0 $crc \
+            [string length $body] [string length $data] [string length $member] 0 0 0 0 0 $offset] $member
+    }
+    set count [expr {[llength $members] / 2}]
+    set eocd [binary format issssiis 0x06054b50 0 0 $count $count [string length $dir] [string length $out] 0]
+    set f [open $path wb]
+    puts -nonewline $f $out$dir$eocd
+    close $f
+    return $path
+}
+
+set members [list \
+    x.npy [npyBytes <f4 "2, 2" [binary format f4 {1 2 3 4}]] \
+    y.npy [npyBytes <i8 "3," [binary format w3 {7 8 9}]]]
+
+test npz_load-1.1 {Stored archive loads every member} {
+    set arrays [torch::npz_load [writeNpz a.npz $members]]
+    list [dict keys $arrays] [torch::tensor_to_list [dict get $arrays x]] [torch::tensor_to_list [dict get $arrays y]]
+} {{x y} {1.0 2.0 3.0 4.0} {7 8 9}}
+
+test npz_load-1.2 {Deflated archive} {
+    set arrays [torch::npz_load [writeNpz b.npz $members 8]]
+    list [torch::tensor_shape [dict get $arrays x]] [torch::tensor_to_list [dict get $arrays y]]
+} {{2 2} {7 8 9}}
+
+test npz_load-1.3 {Selected keys in the requested order} {
+    set arrays [torch::npz_load -path [writeNpz c.npz $members] -keys {y x}]
+    dict keys $arrays
+} {y x}
+
+test npz_load-1.4 {CamelCase alias, positional keys} {
+    set arrays [torch::npzLoad [writeNpz d.npz $members] {y}]
+    dict keys $arrays
+} {y}
+
+test npz_load-2.1 {Missing key} {
+    catch {torch::npz_load -path [writeNpz e.npz $members] -keys {z}} msg
+    string match {No array named "z" in *} $msg
+} {1}
+
+test npz_load-2.2 {Not a zip archive} {
+    set path [file join [temporaryDirectory] junk.npz]
+    set f [open $path wb]; puts -nonewline $f [string repeat x 64]; close $f
+    catch {torch::npz_load $path} msg
+    string match {Not a .npz file*} $msg
+} {1}
+
+test npz_load-2.3 {Unknown parameter} {
+    catch {torch::npz_load -path x -bogus 1} msg
+    string match "Unknown parameter: -bogus*" $msg
+} {1}
+
+cleanupTests
@@ -114,4 +114,69 @@ test optimizer_adafactor-5.2 {Multiple parameters} {
     expr {[string match "optimizer*" $opt]}
 } {1}
 
+proc squared_norm {w} {
+    torch::tensor_item [torch::tensor_sum [torch::tensor_mul $w $w]]
+}
+
+proc adafactor_descent {w opt steps} {
+    for {set i 0} {$i < $steps} {incr i} {
+        torch::optimizer_zero_grad $opt
+        torch::tensor_backward [torch::tensor_sum [torch::tensor_mul $w $w]]
+        torch::optimizer_step $opt
+    }
+}
+
+test optimizer_adafactor-5.3 {Factored update decreases the loss of a matrix} {
+    set w [torch::tensor_create -data {1 -2 3 -4 5 -6} -shape {2 3} -dtype float32 -requiresGrad true]
+    set before [squared_norm $w]
+    adafactor_descent $w [torch::optimizer_adafactor -parameters $w -lr 0.1 -scaleParameter 0] 20
+    expr {[squared_norm $w] < $before}
+} {1}
+
+test optimizer_adafactor-5.4 {Relative step sizing with first moment on a vector} {
+    set w [torch::tensor_create -data {1 -2 3 -4} -dtype float32 -requiresGrad true]
+    set before [squared_norm $w]
+    adafactor_descent $w [torch::optimizer_adafactor -parameters $w -beta1 0.9 -warmupInit 0] 20
+    expr {[squared_norm $w] < $before}
+} {1}
+
+test optimizer_adafactor-5.5 {Update clipping caps the RMS of the step} {
+    # The first unclipped update is grad / |grad|, with an RMS of 1
+    set w [torch::tensor_create -data {100 100 100 100} -shape {2 2} -dtype float32 -requiresGrad true]
+    adafactor_descent $w [torch::optimizer_adafactor -parameters $w -lr 0.5 -scaleParameter 0 -clipThreshold 0.5] 1
+    torch::tensor_to_list [torch::tensor_reshape $w {4}]
+} {99.75 99.75 99.75 99.75}
+
+test optimizer_adafactor-5.6 {State and options round-trip through save_checkpoint} {
+    set model [torch::linear 4 3]
+    set opt [torch::optimizer_adafactor -parameters $model -lr 0.05]
+    torch::optimizer_zero_grad $opt
+    torch::tensor_backward [torch::tensor_sum [torch::layer_forward $model [torch::ones -shape {2 4}]]]
+    torch::optimizer_step $opt
+    set filename [file join [temporaryDirectory] adafactor_checkpoint.pt]
+    torch::save_checkpoint $model $opt $filename
+    set restored [torch::optimizer_adafactor -parameters $model -lr 0.01]
+    torch::load_checkpoint $filename $model $restored
+    file delete $filename
+    torch::get_lr $restored
+} {0.05}
+
+test optimizer_adafactor-5.7 {Learning rate schedulers drive the step size} {
+    set w [torch::tensor_create -data {1 2} -dtype float32 -requiresGrad true]
+    set opt [torch::optimizer_adafactor -parameters $w -lr 0.2]
+    set scheduler [torch::lr_scheduler_step $opt 1 0.5]
+    torch::lr_scheduler_step_update $scheduler
+    torch::get_lr $opt
+} {0.1}
+
+test optimizer_adafactor-4.5 {Error on decay rate outside [-1, 0)} -body {
+    set tensor [torch::zeros {5 5} float32]
+    torch::optimizer_adafactor -parameters $tensor -decayRate 0.8
+} -returnCodes error -match glob -result {Invalid decayRate: 0.8*}
+
+test optimizer_adafactor-4.6 {Error on non-numeric positional value} -body {
+    set tensor [torch::zeros {5 5} float32]
+    torch::optimizer_adafactor $tensor 0.01 1e-30 abc
+} -returnCodes error -result {Invalid clipThreshold value}
+
 cleanupTests 
\ No newline at end of file
@@ -114,4 +114,112 @@ test optimizer_lamb-5.2 {Multiple parameters} {
     expr {[string match "optimizer*" $opt]}
 } {1}
 
+proc lamb_steps {params opt steps} {
+    for {set i 0} {$i < $steps} {incr i} {
+        torch::optimizer_zero_grad $opt
+        set loss [torch::tensor_sum [torch::tensor_mul [lindex $params 0] [lindex $params 0]]]
+        foreach p [lrange $params 1 end] {
+            set loss [torch::tensor_add $loss [torch::tensor_sum [torch::tensor_mul $p $p]]]
+        }
+        torch::tensor_backward $loss
+        torch::optimizer_step $opt
+    }
+}
+
+proc lamb_params {} {
+    list [torch::tensor_create -data {1 -2 3 -4 5 -6} -shape {2 3} -dtype float32 -requiresGrad true] \
+         [torch::tensor_create -data {0.5 -0.5} -dtype float32 -requiresGrad true]
+}
+
+test optimizer_lamb-5.3 {Training decreases the loss} {
+    set params [lamb_params]
+    set w [lindex $params 0]
+    set before [torch::tensor_item [torch::tensor_sum [torch::tensor_mul $w $w]]]
+    lamb_steps $params [torch::optimizer_lamb -parameters $params -lr 0.01] 10
+    expr {[torch::tensor_item [torch::tensor_sum [torch::tensor_mul $w $w]]] < $before}
+} {1}
+
+test optimizer_lamb-5.4 {Multi-tensor and per-tensor steps agree} {
+    set batched [lamb_params]
+    set single [lamb_params]
+    lamb_steps $batched [torch::optimizer_lamb -parameters $batched -lr 0.01 -foreach 1] 3
+    lamb_steps $single [torch::optimizer_lamb -parameters $single -lr 0.01 -foreach 0] 3
+    list [torch::allclose [lindex $batched 0] [lindex $single 0] 1e-5 1e-6] \
+         [torch::allclose [lindex $batched 1] [lindex $single 1] 1e-5 1e-6]
+} {1 1}
+
+test optimizer_lamb-5.5 {Trust ratio scales the step by ||w|| / ||update||} {
+    # First step: the update is sign(grad) = {1 1}, so the trust ratio is 5 / sqrt(2)
+    set w [torch::tensor_create -data {3 4} -shape {1 2} -dtype float32 -requiresGrad true]
+    set opt [torch::optimizer_lamb -parameters $w -lr 0.01 -weightDecay 0]
+    torch::tensor_backward [torch::tensor_sum $w]
+    torch::optimizer_step $opt
+    set expected [torch::tensor_create {2.96464466 3.96464466} {1 2} float32]
+    torch::allclose $w $expected 1e-5 1e-6
+} {1}
+
+test optimizer_lamb-5.6 {Bias and norm parameters skip trust ratio and weight decay} {
+    set b [torch::tensor_create -data {3 4} -dtype float32 -requiresGrad true]
+    set opt [torch::optimizer_lamb -parameters $b -lr 0.01]
+    torch::tensor_backward [torch::tensor_sum $b]
+    torch::optimizer_step $opt
+    torch::allclose $b [torch::tensor_create {2.99 3.99} float32] 1e-5 1e-6
+} {1}
+
+test optimizer_lamb-5.7 {Exclusion patterns match module parameter names} {
+    set model [torch::linear 2 2]
+    set weight [lindex [torch::layer_parameters $model] 0]
+    set before [torch::tensor_to_list $weight]
+    set opt [torch::optimizer_lamb -parameters $model -lr 0.01 -weightDecay 0 -excludeBiasAndNorm 0 -exclude {weight}]
+    torch::tensor_backward [torch::tensor_sum [torch::layer_forward $model [torch::ones -shape {2 2}]]]
+    torch::optimizer_step $opt
+    set steps {}
+    foreach old $before new [torch::tensor_to_list $weight] {
+        lappend steps [expr {abs(abs($old - $new) - 0.01) < 1e-5}]
+    }
+    set steps
+} {1 1 1 1}
+
+test optimizer_lamb-5.8 {State and options round-trip through save_checkpoint} {
+    set model [torch::linear 4 3]
+    set opt [torch::optimizer_lamb -parameters $model -lr 0.002]
+    torch::optimizer_zero_grad $opt
+    torch::tensor_backward [torch::tensor_sum [torch::layer_forward $model [torch::ones -shape {2 4}]]]
+    torch::optimizer_step $opt
+    set filename [file join [temporaryDirectory] lamb_checkpoint.pt]
+    torch::save_checkpoint $model $opt $filename
+    set restored [torch::optimizer_lamb -parameters $model -lr 0.01]
+    torch::load_checkpoint $filename $model $restored
+    file delete $filename
+    torch::get_lr $restored
+} {0.002}
+
+test optimizer_lamb-5.9 {Bias correction counts each parameter's own steps} {
+    set a [torch::tensor_create -data {3 4} -dtype float32 -requiresGrad true]
+    set b [torch::tensor_create -data {3 4} -dtype float32 -requiresGrad true]
+    set opt [torch::optimizer_lamb -parameters [list $a $b] -lr 0.01]
+    torch::tensor_backward [torch::tensor_sum $a]
+    torch::optimizer_step $opt
+    torch::optimizer_zero_grad $opt
+    torch::tensor_backward [torch::tensor_sum $b]
+    torch::optimizer_step $opt
+    # b takes its first step, so it moves exactly like a did
+    torch::allclose $b [torch::tensor_create {2.99 3.99} float32] 1e-5 1e-6
+} {1}
+
+test optimizer_lamb-5.10 {Multi-tensor steps handle mixed dtypes} {
+    set results {}
+    foreach foreach {1 0} {
+        set w32 [torch::tensor_create -data {3 4} -shape {1 2} -dtype float32 -requiresGrad true]
+        set w64 [torch::tensor_create -data {1 2} -shape {1 2} -dtype float64 -requiresGrad true]
+        set opt [torch::optimizer_lamb -parameters [list $w32 $w64] -lr 0.01 -foreach $foreach]
+        torch::tensor_backward [torch::tensor_sum $w32]
+        torch::tensor_backward [torch::tensor_sum $w64]
+        torch::optimizer_step $opt
+        lappend results $w32 $w64
+    }
+    lassign $results batched32 batched64 single32 single64
+    list [torch::allclose $batched32 $single32 1e-5 1e-6] [torch::allclose $batched64 $single64 1e-5 1e-6]
+} {1 1}
+
 cleanupTests 
\ No newline at end of file
@@ -0,0 +1,95 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Batch-major padded batch: 3 sequences of lengths 3, 2 and 1, features 1
+set x [torch::tensor_create {1 2 3 4 5 0 6 0 0} {3 3 1} float32]
+
+test pack_padded_sequence-1.1 {Round trip restores the padded batch} {
+    set packed [torch::pack_padded_sequence $x {3 2 1} 1]
+    lassign [torch::pad_packed_sequence $packed 1] padded lengths
+    list [torch::tensor_to_list $padded] [torch::tensor_to_list $lengths]
+} {{1.0 2.0 3.0 4.0 5.0 0.0 6.0 0.0 0.0} {3 2 1}}
+
+test pack_padded_sequence-1.2 {Named syntax with a lengths tensor and unsorted batch} {
+    set lens [torch::tensor_create {1 3 2} int64]
+    set y [torch::tensor_create {6 0 0 1 2 3 4 5 0} {3 3 1} float32]
+    set packed [torch::packPaddedSequence -input $y -lengths $lens -batchFirst 1 -enforceSorted 0]
+    lassign [torch::padPackedSequence -sequence $packed -batchFirst 1] padded lengths
+    list [torch::tensor_to_list $padded] [torch::tensor_to_list $lengths]
+} {{6.0 0.0 0.0 1.0 2.0 3.0 4.0 5.0 0.0} {1 3 2}}
+
+test pack_padded_sequence-1.3 {totalLength and paddingValue} {
+    set packed [torch::pack_padded_sequence $x {3 2 1} 1]
+    lassign [torch::pad_packed_sequence $packed 1 -1.0 4] padded lengths
+    torch::tensor_shape $padded
+} {3 4 1}
+
+test pack_padded_sequence-1.4 {Recurrent layers keep packed input packed} {
+    set packed [torch::pack_padded_sequence $x {3 2 1} 1]
+    set result {}
+    foreach layer [list [torch::lstm 1 4 1 1 1] [torch::gru 1 4 1 1 1] [torch::rnn_tanh 1 4 1 1 1]] {
+        set out [torch::layer_forward $layer $packed]
+        lassign [torch::pad_packed_sequence $out 1] padded lengths
+        lappend result [string match "packed*" $out] [torch::tensor_shape $padded]
+    }
+    set result
+} {1 {3 3 4} 1 {3 3 4} 1 {3 3 4}}
+
+test pack_padded_sequence-1.5 {Padding steps do not affect the valid outputs} {
+    set gru [torch::gru 1 4 1 1 1]
+    set z [torch::tensor_create {1 2 3 4 5 9 6 9 9} {3 3 1} float32]
+    lassign [torch::pad_packed_sequence [torch::layer_forward $gru [torch::pack_padded_sequence $x {3 2 1} 1]] 1] a
+    lassign [torch::pad_packed_sequence [torch::layer_forward $gru [torch::pack_padded_sequence $z {3 2 1} 1]] 1] b
+    expr {[torch::tensor_to_list $a] eq [torch::tensor_to_list $b]}
+} {1}
+
+test pack_padded_sequence-1.6 {Dense input returns the output sequence} {
+    set lstm [torch::lstm 1 4 1 1 1]
+    torch::tensor_shape [torch::layer_forward $lstm $x]
+} {3 3 4}
+
+test pack_padded_sequence-1.7 {Packed handles are counted and released} {
+    set before [torch::handle_count packed]
+    set packed [torch::pack_padded_sequence $x {3 2 1} 1]
+    set during [torch::handle_count packed]
+    torch::release $packed
+    list [expr {$during - $before}] [expr {[torch::handle_count packed] - $before}]
+} {1 0}
+
+test pack_padded_sequence-2.1 {Unsorted lengths are rejected by default} {
+    catch {torch::pack_padded_sequence $x {1 3 2} 1}
+} {1}
+
+test pack_padded_sequence-2.2 {Invalid input tensor} {
+    catch {torch::pack_padded_sequence nosuch {3 2 1}} msg
+    set msg
+} {Invalid input tensor: nosuch}
+
+test pack_padded_sequence-2.3 {Invalid packed sequence} {
+    catch {torch::pad_packed_sequence nosuch} msg
+    set msg
+} {Invalid packed sequence: nosuch}
+
+test pack_padded_sequence-2.4 {Packed input to a non-recurrent layer} {
+    set packed [torch::pack_padded_sequence $x {3 2 1} 1]
+    catch {torch::layer_forward [torch::linear 1 2] $packed} msg
+    set msg
+} {Packed sequences are only accepted by recurrent layers}
+
+test pack_padded_sequence-2.5 {Unknown parameter} {
+    catch {torch::pack_padded_sequence -input $x -lengths {3 2 1} -bogus 1} msg
+    string match "Unknown parameter: -bogus*" $msg
+} {1}
+
+cleanupTests
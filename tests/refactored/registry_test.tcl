@@ -0,0 +1,111 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+testConstraint thread [expr {![catch {package require Thread}]}]
+
+set library [file normalize ../../build/libtorchtcl.so]
+set model [torch::linear 4 2]
+torch::model_eval $model
+set x [torch::tensor_create {1 2 3 4} {1 4} float32]
+
+proc worker {} {
+    set tid [thread::create]
+    thread::send $tid [list load $::library]
+    return $tid
+}
+
+test registry-1.1 {Lookup returns a handle to the same module} {
+    torch::registry_publish encoder $model
+    set shared [torch::registry_lookup encoder]
+    list [string match "shared*" $shared] \
+        [torch::allclose [torch::layer_forward $model $x] [torch::layer_forward $shared $x]]
+} {1 1}
+
+test registry-1.2 {Named syntax and camelCase aliases} {
+    torch::registryPublish -name named -model $model
+    set shared [torch::registryLookup -name named]
+    list [torch::tensor_shape [torch::layer_forward $shared $x]] [torch::registryRemove -name named]
+} {{1 2} 1}
+
+test registry-1.3 {Removed names are gone; looked-up handles stay valid} {
+    torch::registry_publish temporary $model
+    set shared [torch::registry_lookup temporary]
+    set removed [list [torch::registry_remove temporary] [torch::registry_remove temporary]]
+    list $removed [catch {torch::registry_lookup temporary} msg] $msg \
+        [torch::tensor_shape [torch::layer_forward $shared $x]]
+} {{1 0} 1 {No model is published as temporary} {1 2}}
+
+test registry-2.1 {Interpreter threads forward the published model} -constraints thread -body {
+    torch::registry_publish threaded $model
+    set expected [torch::tensor_to_list [torch::layer_forward $model $x]]
+    set tid [worker]
+    set result [thread::send $tid {
+        set m [torch::registry_lookup threaded]
+        set x [torch::tensor_create {1 2 3 4} {1 4} float32]
+        torch::tensor_to_list [torch::layer_forward $m $x]
+    }]
+    thread::release $tid
+    expr {$result eq $expected}
+} -result 1
+
+test registry-2.2 {Handle tables are per interpreter thread} -constraints thread -body {
+    set tid [worker]
+    set result [thread::send $tid [list catch [list torch::tensor_shape $x]]]
+    thread::release $tid
+    set result
+} -result 1
+
+test registry-2.3 {Parallel forward passes on several threads} -constraints thread -body {
+    torch::registry_publish parallel $model
+    set expected [torch::tensor_to_list [torch::layer_forward $model $x]]
+    set threads {}
+    for {set i 0} {$i < 4} {incr i} {
+        set tid [worker]
+        thread::send -async $tid {
+            set m [torch::registry_lookup parallel]
+            set x [torch::tensor_create {1 2 3 4} {1 4} float32]
+            for {set j 0} {$j < 200} {incr j} {
+                set y [torch::layer_forward $m $x]
+            }
+            torch::tensor_to_list $y
+        } ::parallel($tid)
+        lappend threads $tid
+    }
+    set results {}
+    foreach tid $threads {
+        if {![info exists ::parallel($tid)]} {
+            vwait ::parallel($tid)
+        }
+        lappend results [expr {$::parallel($tid) eq $expected}]
+        thread::release $tid
+    }
+    set results
+} -result {1 1 1 1}
+
+test registry-3.1 {Error: unknown name} {
+    catch {torch::registry_lookup nosuchmodel} msg
+    set msg
+} {No model is published as nosuchmodel}
+
+test registry-3.2 {Error: invalid model} {
+    catch {torch::registry_publish broken nosuchhandle} msg
+    set msg
+} {Invalid model: nosuchhandle}
+
+test registry-3.3 {Error: unknown parameter} {
+    catch {torch::registry_publish -name a -layer $model} msg
+    set msg
+} {Unknown parameter: -layer. Valid parameters are: -name, -model}
+
+cleanupTests
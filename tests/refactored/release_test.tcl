@@ -0,0 +1,54 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+test release-1.1 {Release a tensor} {
+    set t [torch::zeros {2 2}]
+    torch::release $t
+} {1}
+
+test release-1.2 {Release module, optimizer and parameters} {
+    set model [torch::linear 4 2]
+    set params [torch::layer_parameters $model]
+    set opt [torch::optimizer_sgd $params 0.01]
+    set before [torch::handle_count]
+    set n [torch::release $opt $model {*}$params]
+    list $n [expr {$before - [torch::handle_count]}]
+} {4 4}
+
+test release-1.3 {Released module can no longer be used} {
+    set model [torch::linear 4 2]
+    torch::release $model
+    catch {torch::layer_forward $model [torch::ones {1 4}]}
+} {1}
+
+test release-1.4 {Unknown handles are ignored} {
+    set t [torch::zeros {2}]
+    torch::release $t no_such_handle $t
+} {1}
+
+test release-2.1 {Named syntax} {
+    set a [torch::zeros {2}]
+    set b [torch::zeros {2}]
+    torch::release -handles [list $a $b]
+} {2}
+
+test release-3.1 {Error on missing arguments} -body {
+    torch::release
+} -returnCodes error -result {Usage: torch::release handle ?handle ...? | torch::release -handles list}
+
+test release-3.2 {Error on unknown parameter} -body {
+    torch::release -tensors foo
+} -returnCodes error -result {Unknown parameter: -tensors. Valid parameters are: -handles}
+
+cleanupTests
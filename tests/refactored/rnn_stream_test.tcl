@@ -0,0 +1,125 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Time-major sequence: 4 steps, 2 sessions, 3 features
+set x [torch::randn -shape {4 2 3}]
+
+test rnn_stream-1.1 {Stepping one timestep at a time matches the full sequence} {
+    set result {}
+    foreach layer [list [torch::lstm 3 5] [torch::gru 3 5] [torch::rnn_tanh 3 5]] {
+        set full [torch::layer_forward $layer $x]
+        set stream [torch::rnn_stream_open $layer 2]
+        set steps {}
+        for {set t 0} {$t < 4} {incr t} {
+            lappend steps [torch::rnn_stream_step $stream [torch::narrow_copy $x 0 $t 1]]
+        }
+        lappend result [torch::allclose $full [torch::tensor_cat $steps 0] 1e-5 1e-6]
+    }
+    set result
+} {1 1 1}
+
+test rnn_stream-1.2 {A 2-D input is a single timestep} {
+    set lstm [torch::lstm 3 5 2]
+    set stream [torch::rnnStreamOpen -model $lstm -batchSize 2]
+    torch::tensor_shape [torch::rnnStreamStep -stream $stream -input [torch::randn -shape {2 3}]]
+} {2 5}
+
+test rnn_stream-1.3 {Batch-first layers keep their layout} {
+    set gru [torch::gru 3 5 1 1 1]
+    set stream [torch::rnn_stream_open $gru 2]
+    torch::tensor_shape [torch::rnn_stream_step $stream [torch::randn -shape {2 1 3}]]
+} {2 1 5}
+
+test rnn_stream-2.1 {Streams stepped together match streams stepped alone} {
+    set lstm [torch::lstm 3 5]
+    set input [torch::randn -shape {2 3}]
+    set first [torch::narrow_copy $input 0 0 1]
+    set second [torch::narrow_copy $input 0 1 1]
+    set a [torch::rnn_stream_open $lstm]
+    set b [torch::rnn_stream_open $lstm]
+    set c [torch::rnn_stream_open $lstm]
+    set d [torch::rnn_stream_open $lstm]
+    for {set t 0} {$t < 3} {incr t} {
+        set alone [torch::tensor_cat [list [torch::rnn_stream_step $a $first] [torch::rnn_stream_step $b $second]] 0]
+        set together [torch::rnn_stream_step -streams [list $c $d] -input $input]
+    }
+    torch::allclose $alone $together 1e-5 1e-6
+} {1}
+
+test rnn_stream-2.2 {Streams keep independent state} {
+    set gru [torch::gru 3 5]
+    set input [torch::randn -shape {1 3}]
+    set a [torch::rnn_stream_open $gru]
+    set b [torch::rnn_stream_open $gru]
+    torch::rnn_stream_step $a $input
+    set fresh [torch::rnn_stream_step $b $input]
+    set advanced [torch::rnn_stream_step $a $input]
+    list [torch::allclose $fresh [torch::rnn_stream_step [torch::rnn_stream_open $gru] $input]] \
+         [torch::allclose $fresh $advanced]
+} {1 0}
+
+test rnn_stream-3.1 {Released streams are counted and freed} {
+    set before [torch::handle_count stream]
+    set stream [torch::rnn_stream_open [torch::lstm 3 5]]
+    set during [torch::handle_count stream]
+    torch::release $stream
+    list [expr {$during - $before}] [expr {[torch::handle_count stream] - $before}]
+} {1 0}
+
+test rnn_stream-3.2 {A stream reusing released state slots starts from zero} {
+    set lstm [torch::lstm 3 5]
+    set input [torch::randn -shape {2 3}]
+    set fresh [torch::rnn_stream_step [torch::rnn_stream_open $lstm 2] $input]
+    set old [torch::rnn_stream_open $lstm 2]
+    torch::rnn_stream_step $old $input
+    torch::rnn_stream_step $old $input
+    torch::release $old
+    torch::allclose [torch::rnn_stream_step [torch::rnn_stream_open $lstm 2] $input] $fresh
+} {1}
+
+test rnn_stream-4.1 {Error: not a recurrent layer} {
+    catch {torch::rnn_stream_open [torch::linear 3 5]} msg
+    set msg
+} {torch::rnn_stream_open needs an LSTM, GRU or RNN layer}
+
+test rnn_stream-4.2 {Error: bidirectional layer} {
+    catch {torch::rnn_stream_open [torch::lstm 3 5 1 1 0 0.0 1]} msg
+    string match "Cannot stream a bidirectional layer*" $msg
+} {1}
+
+test rnn_stream-4.3 {Error: input batch does not match the sessions} {
+    set stream [torch::rnn_stream_open [torch::gru 3 5] 2]
+    catch {torch::rnn_stream_step $stream [torch::randn -shape {3 3}]} msg
+    set msg
+} {Input batch of 3 does not match the 2 sessions of the streams}
+
+test rnn_stream-4.4 {Error: streams of different layers} {
+    set a [torch::rnn_stream_open [torch::gru 3 5]]
+    set b [torch::rnn_stream_open [torch::gru 3 5]]
+    catch {torch::rnn_stream_step [list $a $b] [torch::randn -shape {2 3}]} msg
+    set msg
+} {Streams stepped together must share one layer}
+
+test rnn_stream-4.6 {Error: a stream listed twice} {
+    set stream [torch::rnn_stream_open [torch::gru 3 5]]
+    catch {torch::rnn_stream_step [list $stream $stream] [torch::randn -shape {2 3}]} msg
+    set msg
+} "Stream listed more than once: $stream"
+
+test rnn_stream-4.5 {Error: unknown parameter} {
+    catch {torch::rnn_stream_open -layer foo} msg
+    set msg
+} {Unknown parameter: -layer. Valid parameters are: -model, -batchSize}
+
+cleanupTests
@@ -0,0 +1,136 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+proc tmpPath {name} {
+    return [file join [temporaryDirectory] $name]
+}
+
+proc forward {layer} {
+    torch::tensor_to_list [torch::layer_forward $layer [torch::ones {1 4}]]
+}
+
+# Header as written by save_safetensors
+proc readHeader {path} {
+    set f [open $path rb]
+    binary scan [read $f 8] w size
+    set json [read $f $size]
+    close $f
+    return $json
+}
+
+# save_safetensors
+test safetensors-1.1 {Header lists every parameter} {
+    set layer [torch::linear 4 3]
+    set path [tmpPath lin.safetensors]
+    torch::save_safetensors $layer $path
+    set json [readHeader $path]
+    list [string match {*"weight":{"dtype":"F32","shape":[3,4],"data_offsets":[*} $json] \
+         [string match {*"bias":{"dtype":"F32","shape":[3],*} $json] \
+         [expr {[string length $json] % 8}]
+} {1 1 0}
+
+test safetensors-1.2 {Metadata is stored, named syntax} {
+    set layer [torch::linear 2 2]
+    set path [tmpPath meta.safetensors]
+    torch::saveSafetensors -module $layer -filename $path -metadata {epoch 3}
+    string match {*"__metadata__":{"format":"pt","epoch":"3"}*} [readHeader $path]
+} {1}
+
+# load_safetensors
+test safetensors-2.1 {Round trip restores the outputs} {
+    set src [torch::linear 4 3]
+    set dst [torch::linear 4 3]
+    set path [tmpPath rt.safetensors]
+    torch::save_safetensors $src $path
+    set names [torch::load_safetensors $dst $path]
+    list [lsort $names] [expr {[forward $src] eq [forward $dst]}]
+} {{bias weight} 1}
+
+test safetensors-2.2 {Copy mode} {
+    set src [torch::linear 4 3]
+    set dst [torch::linear 4 3]
+    set path [tmpPath copy.safetensors]
+    torch::save_safetensors $src $path
+    torch::loadSafetensors -module $dst -filename $path -mode copy
+    expr {[forward $src] eq [forward $dst]}
+} {1}
+
+test safetensors-2.3 {Subset of keys} {
+    set src [torch::linear 4 3]
+    set dst [torch::linear 4 3]
+    set path [tmpPath subset.safetensors]
+    torch::save_safetensors $src $path
+    torch::load_safetensors $dst $path {bias}
+} {bias}
+
+test safetensors-2.4 {Loaded parameters can still be trained without touching the file} {
+    set src [torch::linear 4 3]
+    set dst [torch::linear 4 3]
+    set path [tmpPath train.safetensors]
+    torch::save_safetensors $src $path
+    torch::load_safetensors $dst $path
+    set opt [torch::optimizer_sgd [torch::layer_parameters $dst] 0.5]
+    set loss [torch::tensor_sum [torch::layer_forward $dst [torch::ones {1 4}]]]
+    torch::tensor_backward $loss
+    torch::optimizer_step $opt
+    set reloaded [torch::linear 4 3]
+    torch::load_safetensors $reloaded $path
+    list [expr {[forward $src] eq [forward $reloaded]}] [expr {[forward $src] ne [forward $dst]}]
+} {1 1}
+
+# Error handling
+test safetensors-3.1 {Shape mismatch} {
+    set path [tmpPath shape.safetensors]
+    torch::save_safetensors [torch::linear 4 3] $path
+    catch {torch::load_safetensors [torch::linear 4 2] $path} msg
+    set msg
+} {Shape mismatch for bias}
+
+test safetensors-3.2 {Missing tensors in strict mode} {
+    set path [tmpPath strict.safetensors]
+    torch::save_safetensors [torch::linear 4 3 false] $path
+    catch {torch::load_safetensors [torch::linear 4 3] $path} msg
+    string match {Missing tensor in *: bias} $msg
+} {1}
+
+test safetensors-3.3 {Non-strict loads what matches} {
+    set path [tmpPath loose.safetensors]
+    torch::save_safetensors [torch::linear 4 3 false] $path
+    torch::load_safetensors -module [torch::linear 4 3] -filename $path -strict 0
+} {weight}
+
+test safetensors-3.4 {Unknown key} {
+    set path [tmpPath key.safetensors]
+    torch::save_safetensors [torch::linear 4 3] $path
+    catch {torch::load_safetensors [torch::linear 4 3] $path {nope}} msg
+    string match {No tensor named "nope" in *} $msg
+} {1}
+
+test safetensors-3.5 {Not a safetensors file} {
+    set path [tmpPath junk.safetensors]
+    set f [open $path wb]; puts -nonewline $f [string repeat x 32]; close $f
+    catch {torch::load_safetensors [torch::linear 4 3] $path}
+} {1}
+
+test safetensors-3.6 {Invalid module} {
+    catch {torch::save_safetensors nosuch [tmpPath x.safetensors]} msg
+    set msg
+} {Invalid module name}
+
+test safetensors-3.7 {Invalid mode} {
+    catch {torch::load_safetensors -module [torch::linear 2 2] -filename x -mode lazy} msg
+    set msg
+} {Invalid mode: lazy. Valid modes are: mmap, copy}
+
+cleanupTests
@@ -0,0 +1,115 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Positional syntax
+test scope-1.1 {Intermediates are released on exit} {
+    set before [torch::handle_count tensor]
+    torch::scope {
+        set a [torch::ones {2 2}]
+        set b [torch::tensor_add $a $a]
+        torch::tensor_mul $b $b
+        list
+    }
+    expr {[torch::handle_count tensor] - $before}
+} {0}
+
+test scope-1.2 {Result handle escapes} {
+    set before [torch::handle_count tensor]
+    set r [torch::scope {
+        set a [torch::ones {2}]
+        torch::tensor_add $a $a
+    }]
+    list [expr {[torch::handle_count tensor] - $before}] [torch::tensor_to_list $r]
+} {1 {2.0 2.0}}
+
+test scope-1.3 {Handles in a list result escape} {
+    set before [torch::handle_count tensor]
+    set r [torch::scope {
+        set tmp [torch::ones {2}]
+        list [torch::zeros {2}] [torch::ones {3}]
+    }]
+    expr {[torch::handle_count tensor] - $before}
+} {2}
+
+test scope-1.4 {Handles created before the scope are untouched} {
+    set a [torch::ones {2}]
+    torch::scope { torch::tensor_add $a $a; list }
+    torch::tensor_to_list $a
+} {1.0 1.0}
+
+# -keep option
+test scope-2.1 {Keep variables escape} {
+    set before [torch::handle_count tensor]
+    torch::scope {
+        set w [torch::ones {2}]
+        set tmp [torch::zeros {2}]
+    } -keep {w}
+    list [expr {[torch::handle_count tensor] - $before}] [catch {torch::tensor_to_list $tmp}]
+} {1 1}
+
+test scope-2.2 {Keep variable holding a list} {
+    set before [torch::handle_count tensor]
+    torch::scope {
+        set pair [list [torch::ones {2}] [torch::ones {2}]]
+        torch::zeros {2}
+        list
+    } -keep {pair}
+    expr {[torch::handle_count tensor] - $before}
+} {2}
+
+# Named parameter syntax
+test scope-3.1 {Named syntax} {
+    set before [torch::handle_count tensor]
+    torch::scope -keep {out} -body {
+        set tmp [torch::ones {2}]
+        set out [torch::tensor_add $tmp $tmp]
+        list
+    }
+    expr {[torch::handle_count tensor] - $before}
+} {1}
+
+# Nesting and control flow
+test scope-4.1 {Inner escapes are released by the outer scope} {
+    set before [torch::handle_count tensor]
+    torch::scope {
+        set x [torch::scope { torch::ones {2} }]
+        list
+    }
+    expr {[torch::handle_count tensor] - $before}
+} {0}
+
+test scope-4.2 {Errors propagate and handles are released} {
+    set before [torch::handle_count tensor]
+    set code [catch {torch::scope { torch::ones {2}; error boom }} msg]
+    list $code $msg [expr {[torch::handle_count tensor] - $before}]
+} {1 boom 0}
+
+test scope-4.3 {Return from a proc passes through} {
+    proc scope_test_proc {} {
+        torch::scope { return [torch::ones {2}] }
+        return unreachable
+    }
+    torch::tensor_to_list [scope_test_proc]
+} {1.0 1.0}
+
+# Error handling
+test scope-5.1 {Error on missing body} -body {
+    torch::scope
+} -returnCodes error -match glob -result {Usage: torch::scope*}
+
+test scope-5.2 {Error on unknown parameter} -body {
+    torch::scope {list} -bogus 1
+} -returnCodes error -match glob -result {Unknown parameter: -bogus*}
+
+cleanupTests
@@ -53,6 +53,15 @@ test sequential-3.1 {Forward pass through sequential} {
     expr {[string match "tensor*" $output]}
 } {1}
 
+test sequential-3.2 {Forward pass through mixed layer types} {
+    set linear1 [torch::linear 10 20]
+    set bn [torch::batch_norm1d 20]
+    set linear2 [torch::linear 20 5]
+    set seq [torch::sequential [list $linear1 $bn $linear2]]
+    set output [torch::layer_forward $seq [torch::randn -shape {4 10}]]
+    torch::tensor_shape $output
+} {4 5}
+
 # Test error handling
 test sequential-4.1 {Error on invalid module} {
     catch {torch::sequential -modules [list "invalid_module"]} err
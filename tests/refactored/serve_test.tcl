@@ -0,0 +1,97 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+set model [torch::linear 4 2]
+torch::model_eval $model
+
+test serve-1.1 {Coalesced requests get their own rows back} {
+    set server [torch::serve_open $model 8 20000]
+    set inputs {}
+    set futures {}
+    for {set i 0} {$i < 5} {incr i} {
+        set x [torch::randn -shape {1 4}]
+        lappend inputs $x
+        lappend futures [torch::serve_submit $server $x]
+    }
+    set matches {}
+    foreach x $inputs future $futures {
+        set expected [torch::layer_forward $model $x]
+        lappend matches [torch::allclose $expected [torch::async_wait $future] 1e-5 1e-6]
+    }
+    set stats [torch::serve_stats $server]
+    torch::release $server
+    list $matches [dict get $stats requests] [dict get $stats rows] [expr {[dict get $stats batches] < 5}]
+} {{1 1 1 1 1} 5 5 1}
+
+test serve-1.2 {Batches never exceed maxBatch rows} {
+    set server [torch::serveOpen -model $model -maxBatch 2 -maxDelayUs 1000000]
+    set futures {}
+    for {set i 0} {$i < 4} {incr i} {
+        lappend futures [torch::serveSubmit -server $server -input [torch::randn -shape {1 4}]]
+    }
+    foreach future $futures {
+        torch::async_wait $future
+    }
+    set stats [torch::serveStats -server $server]
+    torch::release $server
+    list [dict get $stats batches] [dict get $stats meanBatchRows] [dict get $stats pending]
+} {2 2.0 0}
+
+test serve-1.3 {Multi-row requests and callbacks} {
+    set server [torch::serve_open -model $model -max_batch 16 -max_delay_us 0]
+    set ::shape ""
+    proc served {future} {
+        set ::shape [torch::tensor_shape [torch::async_wait $future]]
+    }
+    torch::serve_submit $server [torch::randn -shape {3 4}] served
+    vwait ::shape
+    torch::release $server
+    set ::shape
+} {3 2}
+
+test serve-1.4 {Latency metrics are reported} {
+    set server [torch::serve_open $model]
+    torch::async_wait [torch::serve_submit $server [torch::randn -shape {1 4}]]
+    set stats [torch::serve_stats $server]
+    torch::release $server
+    list [lsort [dict keys $stats]] [expr {[dict get $stats maxQueueUs] >= [dict get $stats meanQueueUs]}]
+} {{batches maxForwardUs maxQueueUs meanBatchRows meanForwardUs meanQueueUs pending requests rows} 1}
+
+test serve-2.1 {Forward errors are raised by async_wait} {
+    set server [torch::serve_open $model]
+    set future [torch::serve_submit $server [torch::randn -shape {1 3}]]
+    set code [catch {torch::async_wait $future} msg]
+    torch::release $server
+    set code
+} {1}
+
+test serve-2.2 {Closing the server fails queued requests} {
+    set server [torch::serve_open $model 100 10000000]
+    set future [torch::serve_submit $server [torch::randn -shape {1 4}]]
+    torch::release $server
+    catch {torch::async_wait $future} msg
+    set msg
+} {Server was closed before the request ran}
+
+test serve-2.3 {Error: invalid server} {
+    catch {torch::serve_submit server999999 [torch::randn -shape {1 4}]} msg
+    set msg
+} {Invalid server: server999999}
+
+test serve-2.4 {Error: unknown parameter} {
+    catch {torch::serve_open -model $model -batch 4} msg
+    set msg
+} {Unknown parameter: -batch. Valid parameters are: -model, -maxBatch, -maxDelayUs}
+
+cleanupTests
@@ -219,4 +219,32 @@ test tensor_create-33.1 {3D shape tensor} {
     set shape
 } {2 2 2}
 
+# Test 34: Nested lists of any depth
+test tensor_create-34.1 {3D nested list} {
+    set t [torch::tensor_create -data {{{1 2} {3 4}} {{5 6} {7 8}}}]
+    torch::tensor_shape $t
+} {2 2 2}
+
+test tensor_create-34.2 {Nested list with empty rows} {
+    set t [torch::tensor_create -data {{} {}}]
+    torch::tensor_shape $t
+} {2 0}
+
+# Test 35: int64 values keep full precision
+test tensor_create-35.1 {int64 above 2^53} {
+    set t [torch::tensor_create -data {9007199254740993 -9007199254740993} -dtype int64]
+    torch::tensor_to_list $t
+} {9007199254740993 -9007199254740993}
+
+# Test 36: Error handling - ragged nested lists
+test tensor_create-36.1 {Error handling - jagged 3D list} {
+    catch {torch::tensor_create -data {{{1 2} {3 4}} {{5 6} {7}}}} result
+    string match "*Jagged lists are not supported*" $result
+} {1}
+
+test tensor_create-36.2 {Error handling - non-numeric value} {
+    catch {torch::tensor_create -data {{1 2} {3 abc}}} result
+    set result
+} {Invalid numeric value in list}
+
 cleanupTests 
\ No newline at end of file
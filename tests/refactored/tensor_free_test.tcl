@@ -0,0 +1,89 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Positional syntax
+test tensor_free-1.1 {Free a single tensor} {
+    set t [torch::zeros {3 3}]
+    set n [torch::tensor_free $t]
+    list $n [catch {torch::tensor_print $t}]
+} {1 1}
+
+test tensor_free-1.2 {Free several tensors} {
+    set a [torch::ones {2 2}]
+    set b [torch::ones {2 2}]
+    set c [torch::tensor_add $a $b]
+    torch::tensor_free $a $b $c
+} {3}
+
+test tensor_free-1.3 {Handle count drops after free} {
+    set before [torch::handle_count tensor]
+    set t [torch::zeros {4}]
+    torch::tensor_free $t
+    expr {[torch::handle_count tensor] == $before}
+} {1}
+
+# Named parameter syntax
+test tensor_free-2.1 {Named syntax with a list of tensors} {
+    set a [torch::ones {2}]
+    set b [torch::ones {2}]
+    torch::tensor_free -tensors [list $a $b]
+} {2}
+
+# CamelCase alias
+test tensor_free-3.1 {CamelCase alias} {
+    set t [torch::zeros {2}]
+    torch::tensorFree -tensors $t
+} {1}
+
+# Error handling
+test tensor_free-4.1 {Error on missing arguments} -body {
+    torch::tensor_free
+} -returnCodes error -result {Usage: torch::tensor_free handle ?handle ...? | torch::tensor_free -tensors list}
+
+test tensor_free-4.2 {Error on invalid tensor leaves others untouched} -body {
+    set t [torch::zeros {2}]
+    set code [catch {torch::tensor_free $t no_such_tensor} msg]
+    list $code $msg [torch::tensor_numel $t]
+} -result {1 {Invalid tensor name: no_such_tensor} 2}
+
+test tensor_free-4.3 {Error on double free} -body {
+    set t [torch::zeros {2}]
+    torch::tensor_free $t
+    torch::tensor_free $t
+} -returnCodes error -match glob -result {Invalid tensor name: *}
+
+test tensor_free-4.4 {Error on unknown parameter} -body {
+    torch::tensor_free -foo bar
+} -returnCodes error -result {Unknown parameter: -foo. Valid parameters are: -tensors}
+
+# Handle reuse
+test tensor_free-5.1 {Freed handle names are not reused} {
+    set a [torch::zeros {2}]
+    torch::tensor_free $a
+    set b [torch::ones {2}]
+    list [expr {$a ne $b}] [catch {torch::tensor_numel $a}] [regexp {^tensor[0-9]+(_[0-9]+)?$} $b]
+} {1 1 1}
+
+test tensor_free-5.2 {Failed commands leave no tensor slots behind} {
+    set before [list [torch::handle_count tensor] [torch::handle_count reserved]]
+    set x [torch::tensor_create {1 2 3} float32]
+    set y [torch::tensor_create {1 2} float32]
+    catch {torch::tensor_add $x $y}
+    catch {torch::tensor_svd $x}
+    catch {torch::exec {{s add x y} {t mul s 2}} [list x $x y $y] {s t}}
+    torch::tensor_free $x $y
+    expr {[list [torch::handle_count tensor] [torch::handle_count reserved]] eq $before}
+} {1}
+
+cleanupTests
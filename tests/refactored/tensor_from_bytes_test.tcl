@@ -0,0 +1,77 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Positional syntax
+test tensor_from_bytes-1.1 {1-D float32 from bytes} {
+    set t [torch::tensor_from_bytes [binary format f3 {1.0 2.0 3.0}] float32]
+    torch::tensor_to_list $t
+} {1.0 2.0 3.0}
+
+test tensor_from_bytes-1.2 {Shape is applied} {
+    set t [torch::tensor_from_bytes [binary format i6 {1 2 3 4 5 6}] int32 {2 3}]
+    list [torch::tensor_shape $t] [torch::tensor_dtype $t]
+} {{2 3} Int32}
+
+test tensor_from_bytes-1.3 {float64 values} {
+    set t [torch::tensor_from_bytes [binary format d2 {0.5 -1.25}] float64]
+    torch::tensor_to_list $t
+} {0.5 -1.25}
+
+test tensor_from_bytes-1.4 {Payload starting with a '-' byte is positional} {
+    set bytes [binary format cu4 {0x2D 0x00 0x80 0x3F}]
+    binary scan $bytes f expected
+    set t [torch::tensor_from_bytes $bytes float32]
+    list [torch::tensor_shape $t] [expr {[torch::tensor_item $t] == $expected}]
+} {1 1}
+
+# Named parameter syntax
+test tensor_from_bytes-2.1 {Named syntax} {
+    set t [torch::tensor_from_bytes -data [binary format w2 {7 -8}] -dtype int64 -shape {2}]
+    torch::tensor_to_list $t
+} {7 -8}
+
+test tensor_from_bytes-2.2 {CamelCase alias} {
+    set t [torch::tensorFromBytes -data [binary format f1 2.5] -dtype float32]
+    torch::tensor_to_list $t
+} {2.5}
+
+# Round trip
+test tensor_from_bytes-3.1 {Round trip through tensor_to_bytes} {
+    set a [torch::tensor_create {1.5 2.5 3.5 4.5} float32]
+    set b [torch::tensor_from_bytes [torch::tensor_to_bytes $a] float32 {2 2}]
+    list [torch::tensor_shape $b] [torch::tensor_to_list $b]
+} {{2 2} {1.5 2.5 3.5 4.5}}
+
+# Error handling
+test tensor_from_bytes-4.1 {Error on byte count mismatch} -body {
+    torch::tensor_from_bytes [binary format f3 {1 2 3}] float32 {2 2}
+} -returnCodes error -result {Byte count 12 does not match shape (expected 16 bytes)}
+
+test tensor_from_bytes-4.2 {Error on partial element} -body {
+    torch::tensor_from_bytes [binary format c3 {1 2 3}] float32
+} -returnCodes error -match glob -result {Byte count 3 is not a multiple*}
+
+test tensor_from_bytes-4.3 {Error on unknown dtype} -body {
+    torch::tensor_from_bytes [binary format f1 1] complex7
+} -returnCodes error -result {Unknown scalar type: complex7}
+
+test tensor_from_bytes-4.4 {Error on missing arguments} -body {
+    torch::tensor_from_bytes
+} -returnCodes error -match glob -result {Usage: torch::tensor_from_bytes*}
+
+test tensor_from_bytes-4.5 {Error on unknown parameter} -body {
+    torch::tensor_from_bytes -data abc -dtype uint8 -foo 1
+} -returnCodes error -match glob -result {Unknown parameter: -foo*}
+
+cleanupTests
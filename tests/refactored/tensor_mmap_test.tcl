@@ -0,0 +1,156 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+proc writeBinary {name bytes} {
+    set path [file join [temporaryDirectory] $name]
+    set f [open $path wb]
+    puts -nonewline $f $bytes
+    close $f
+    return $path
+}
+
+# Minimal version 1.0 .npy writer, independent of the extension
+proc writeNpy {name descr shape bytes {fortran False}} {
+    set dict "{'descr': '$descr', 'fortran_order': $fortran, 'shape': ($shape), }"
+    set pad [expr {63 - (10 + [string length $dict]) % 64}]
+    append dict [string repeat " " $pad] "\n"
+    set header [binary format a6ccs "\x93NUMPY" 1 0 [string length $dict]]
+    return [writeBinary $name $header$dict$bytes]
+}
+
+# Version 2.0 .npy writer with the header padded to at least minHeader bytes
+proc writeNpy2 {name descr shape bytes minHeader} {
+    set dict "{'descr': '$descr', 'fortran_order': False, 'shape': ($shape), }"
+    set len [expr {max($minHeader, [string length $dict] + 1)}]
+    set len [expr {$len + (64 - (12 + $len) % 64) % 64}]
+    set dict [format %-*s [expr {$len - 1}] $dict]\n
+    set header [binary format a6cci "\x93NUMPY" 2 0 [string length $dict]]
+    return [writeBinary $name $header$dict$bytes]
+}
+
+# Raw files
+test tensor_mmap-1.1 {Raw file maps as 1-D by default} {
+    set path [writeBinary raw1.bin [binary format f4 {1.0 2.0 3.0 4.0}]]
+    torch::tensor_to_list [torch::tensor_mmap $path float32]
+} {1.0 2.0 3.0 4.0}
+
+test tensor_mmap-1.2 {Raw file with shape} {
+    set path [writeBinary raw2.bin [binary format i6 {1 2 3 4 5 6}]]
+    set t [torch::tensor_mmap $path int32 {2 3}]
+    list [torch::tensor_shape $t] [torch::tensor_to_list $t]
+} {{2 3} {1 2 3 4 5 6}}
+
+test tensor_mmap-1.3 {Offset skips leading bytes} {
+    set path [writeBinary raw3.bin [binary format i4 {99 7 8 9}]]
+    torch::tensor_to_list [torch::tensor_mmap $path int32 {3} 4]
+} {7 8 9}
+
+# Named parameter syntax
+test tensor_mmap-2.1 {Named syntax} {
+    set path [writeBinary raw4.bin [binary format d2 {0.5 -1.5}]]
+    torch::tensor_to_list [torch::tensor_mmap -path $path -dtype float64]
+} {0.5 -1.5}
+
+test tensor_mmap-2.2 {CamelCase alias} {
+    set path [writeBinary raw5.bin [binary format w2 {10 20}]]
+    torch::tensor_to_list [torch::tensorMmap -path $path -dtype int64 -shape {2}]
+} {10 20}
+
+test tensor_mmap-2.3 {Positional path with named options} {
+    set path [writeBinary raw6.bin [binary format s3 {1 2 3}]]
+    torch::tensor_to_list [torch::tensor_mmap $path -dtype int16 -offset 2]
+} {2 3}
+
+# .npy files
+test tensor_mmap-3.1 {.npy header supplies dtype and shape} {
+    set path [writeNpy a.npy <f4 "2, 2" [binary format f4 {1 2 3 4}]]
+    set t [torch::tensor_mmap $path]
+    list [torch::tensor_shape $t] [torch::tensor_dtype $t] [torch::tensor_to_list $t]
+} {{2 2} Float32 {1.0 2.0 3.0 4.0}}
+
+test tensor_mmap-3.2 {Fortran order keeps the logical layout} {
+    set path [writeNpy f.npy <i4 "2, 3" [binary format i6 {1 4 2 5 3 6}] True]
+    torch::tensor_to_list [torch::tensor_mmap $path]
+} {1 2 3 4 5 6}
+
+test tensor_mmap-3.3 {Mismatched dtype is rejected} {
+    set path [writeNpy b.npy <f4 "2," [binary format f2 {1 2}]]
+    catch {torch::tensor_mmap -path $path -dtype int32} msg
+    set msg
+} {dtype int32 does not match the .npy header}
+
+test tensor_mmap-3.4 {Version 2.0 header longer than 4 KB} {
+    set path [writeNpy2 big.npy <i4 "3," [binary format i3 {7 8 9}] 10000]
+    torch::tensor_to_list [torch::tensor_mmap $path]
+} {7 8 9}
+
+test tensor_mmap-3.5 {Offset is rejected for .npy files} {
+    set path [writeNpy c.npy <f4 "2," [binary format f2 {1 2}]]
+    catch {torch::tensor_mmap -path $path -offset 0} msg
+    set msg
+} {Offset does not apply to .npy files; the data starts after the header}
+
+# Modes
+test tensor_mmap-4.1 {Read mode does not modify the file} {
+    set path [writeBinary ro.bin [binary format f2 {1.0 2.0}]]
+    set t [torch::tensor_mmap $path float32]
+    torch::tensor_mmap_write $t 0 [torch::zeros {2}]
+    torch::tensor_free $t
+    torch::tensor_to_list [torch::tensor_mmap $path float32]
+} {1.0 2.0}
+
+test tensor_mmap-4.2 {rw mode writes through to the file} {
+    set path [writeBinary rw.bin [binary format f2 {1.0 2.0}]]
+    set t [torch::tensor_mmap -path $path -dtype float32 -mode rw]
+    torch::tensor_mmap_write $t 1 [torch::tensor_create {5.0} float32]
+    torch::tensor_mmap_flush $t
+    set f [open $path rb]
+    binary scan [read $f] f2 values
+    close $f
+    set values
+} {1.0 5.0}
+
+# Error handling
+test tensor_mmap-5.1 {Missing file} {
+    catch {torch::tensor_mmap [file join [temporaryDirectory] missing.bin] float32}
+} {1}
+
+test tensor_mmap-5.2 {Raw file needs a dtype} {
+    set path [writeBinary raw7.bin [binary format f1 1.0]]
+    catch {torch::tensor_mmap -path $path} msg
+    set msg
+} {Required parameter missing: dtype (raw files have no header)}
+
+test tensor_mmap-5.3 {File too small for shape} {
+    set path [writeBinary raw8.bin [binary format f2 {1 2}]]
+    catch {torch::tensor_mmap $path float32 {3}}
+} {1}
+
+test tensor_mmap-5.4 {Unaligned offset} {
+    set path [writeBinary raw9.bin [binary format f2 {1 2}]]
+    catch {torch::tensor_mmap -path $path -dtype float32 -offset 2} msg
+    set msg
+} {Offset must be a multiple of the element size 4}
+
+test tensor_mmap-5.5 {Invalid mode} {
+    set path [writeBinary raw10.bin [binary format f1 1]]
+    catch {torch::tensor_mmap -path $path -dtype float32 -mode w}
+} {1}
+
+test tensor_mmap-5.6 {Unknown parameter} {
+    catch {torch::tensor_mmap -path x -bogus 1} msg
+    string match "Unknown parameter: -bogus*" $msg
+} {1}
+
+cleanupTests
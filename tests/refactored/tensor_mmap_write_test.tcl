@@ -0,0 +1,89 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+proc tmpPath {name} {
+    return [file join [temporaryDirectory] $name]
+}
+
+# tensor_mmap_create
+test tensor_mmap_write-1.1 {Created raw file starts zeroed and has the right size} {
+    set path [tmpPath out1.bin]
+    set t [torch::tensor_mmap_create $path float32 {2 3}]
+    list [torch::tensor_shape $t] [file size $path] [torch::tensor_to_list $t]
+} {{2 3} 24 {0.0 0.0 0.0 0.0 0.0 0.0}}
+
+test tensor_mmap_write-1.2 {.npy extension selects the npy format} {
+    set path [tmpPath out2.npy]
+    set t [torch::tensor_mmap_create -path $path -dtype int64 -shape {4}]
+    torch::tensor_mmap_write $t 0 [torch::tensor_create {1 2 3 4} int64]
+    torch::tensor_mmap_flush $t
+    torch::tensor_free $t
+    set back [torch::tensor_mmap $path]
+    list [file size $path] [torch::tensor_dtype $back] [torch::tensor_to_list $back]
+} {160 Int64 {1 2 3 4}}
+
+test tensor_mmap_write-1.3 {CamelCase alias and explicit format} {
+    set path [tmpPath out3.dat]
+    set t [torch::tensorMmapCreate -path $path -dtype float64 -shape {2} -format npy]
+    set f [open $path rb]
+    set magic [read $f 6]
+    close $f
+    string range $magic 1 end
+} {NUMPY}
+
+# tensor_mmap_write
+test tensor_mmap_write-2.1 {Appending rows returns the next index} {
+    set path [tmpPath out4.bin]
+    set t [torch::tensor_mmap_create $path float32 {4 2}]
+    set next [torch::tensor_mmap_write $t 0 [torch::ones {2 2}]]
+    set next [torch::tensor_mmap_write -target $t -row $next -source [torch::tensor_create {7.0 8.0} float32]]
+    list $next [torch::tensor_to_list $t]
+} {3 {1.0 1.0 1.0 1.0 7.0 8.0 0.0 0.0}}
+
+test tensor_mmap_write-2.2 {Rows past the end are rejected} {
+    set t [torch::tensor_mmap_create [tmpPath out5.bin] float32 {2 2}]
+    catch {torch::tensor_mmap_write $t 1 [torch::ones {2 2}]}
+} {1}
+
+test tensor_mmap_write-2.3 {Row shape mismatch is rejected} {
+    set t [torch::tensor_mmap_create [tmpPath out6.bin] float32 {2 2}]
+    catch {torch::tensor_mmap_write $t 0 [torch::ones {3}]} msg
+    set msg
+} {Source rows do not match the target's row shape}
+
+test tensor_mmap_write-2.4 {Data survives remapping} {
+    set path [tmpPath out7.bin]
+    set t [torch::tensor_mmap_create $path int32 {3}]
+    torch::tensor_mmap_write $t 0 [torch::tensor_create {5 6 7} int32]
+    torch::tensor_free $t
+    torch::tensor_to_list [torch::tensor_mmap $path int32]
+} {5 6 7}
+
+# tensor_mmap_flush
+test tensor_mmap_write-3.1 {Flush returns OK} {
+    set t [torch::tensor_mmap_create [tmpPath out8.bin] float32 {8}]
+    torch::tensorMmapFlush -input $t
+} {OK}
+
+test tensor_mmap_write-3.2 {Flushing an ordinary tensor is an error} {
+    catch {torch::tensor_mmap_flush [torch::ones {1024}]} msg
+    set msg
+} {Tensor is not backed by a mapped file}
+
+test tensor_mmap_write-3.3 {Invalid handle} {
+    catch {torch::tensor_mmap_flush nosuch} msg
+    set msg
+} {Invalid tensor name: nosuch}
+
+cleanupTests
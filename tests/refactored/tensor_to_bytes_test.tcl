@@ -0,0 +1,61 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Positional syntax
+test tensor_to_bytes-1.1 {float32 bytes} {
+    set t [torch::tensor_create {1.0 2.0 3.0} float32]
+    set bytes [torch::tensor_to_bytes $t]
+    binary scan $bytes f* values
+    list [string length $bytes] $values
+} {12 {1.0 2.0 3.0}}
+
+test tensor_to_bytes-1.2 {int64 bytes} {
+    set t [torch::tensor_create {5 -6} int64]
+    binary scan [torch::tensor_to_bytes $t] w* values
+    set values
+} {5 -6}
+
+test tensor_to_bytes-1.3 {Non-contiguous tensor is exported in row-major order} {
+    set t [torch::tensor_create {1 2 3 4 5 6} {2 3} int32]
+    set tt [torch::tensor_permute $t {1 0}]
+    binary scan [torch::tensor_to_bytes $tt] i* values
+    set values
+} {1 4 2 5 3 6}
+
+# Named parameter syntax
+test tensor_to_bytes-2.1 {Named syntax} {
+    set t [torch::tensor_create {0.5} float64]
+    binary scan [torch::tensor_to_bytes -input $t] d* values
+    set values
+} {0.5}
+
+test tensor_to_bytes-2.2 {CamelCase alias} {
+    set t [torch::tensor_create {1 0 1} bool]
+    string length [torch::tensorToBytes -tensor $t]
+} {3}
+
+# Error handling
+test tensor_to_bytes-3.1 {Error on invalid tensor} -body {
+    torch::tensor_to_bytes no_such_tensor
+} -returnCodes error -result {Invalid tensor name: no_such_tensor}
+
+test tensor_to_bytes-3.2 {Error on missing arguments} -body {
+    torch::tensor_to_bytes
+} -returnCodes error -match glob -result {Usage: torch::tensor_to_bytes*}
+
+test tensor_to_bytes-3.3 {Error on unknown parameter} -body {
+    torch::tensor_to_bytes -foo bar
+} -returnCodes error -match glob -result {Unknown parameter: -foo*}
+
+cleanupTests
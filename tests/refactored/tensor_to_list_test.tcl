@@ -0,0 +1,74 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# Positional syntax
+test tensor_to_list-1.1 {Flat float32 list} {
+    torch::tensor_to_list [torch::tensor_create {1.5 2.5 3.5} float32]
+} {1.5 2.5 3.5}
+
+test tensor_to_list-1.2 {2-D tensor is flattened by default} {
+    torch::tensor_to_list [torch::tensor_create {1 2 3 4} {2 2} int64]
+} {1 2 3 4}
+
+test tensor_to_list-1.3 {Nested output} {
+    torch::tensor_to_list [torch::tensor_create {1 2 3 4 5 6} {2 3} int64] 1
+} {{1 2 3} {4 5 6}}
+
+test tensor_to_list-1.4 {float64 keeps full precision} {
+    torch::tensor_to_list [torch::tensor_create {0.1} float64]
+} {0.1}
+
+test tensor_to_list-1.5 {int32 values} {
+    torch::tensor_to_list [torch::tensor_create {-7 300} int32]
+} {-7 300}
+
+test tensor_to_list-1.6 {bool values} {
+    torch::tensor_to_list [torch::tensor_create {1 0 1} bool]
+} {1 0 1}
+
+# Strided views
+test tensor_to_list-2.1 {Permuted view is exported in logical order} {
+    set t [torch::tensor_create {1 2 3 4 5 6} {2 3} int64]
+    torch::tensor_to_list [torch::tensor_permute $t {1 0}]
+} {1 4 2 5 3 6}
+
+test tensor_to_list-2.2 {Nested permuted view} {
+    set t [torch::tensor_create {1 2 3 4 5 6} {2 3} int64]
+    torch::tensor_to_list [torch::tensor_permute $t {1 0}] 1
+} {{1 4} {2 5} {3 6}}
+
+# Named parameter syntax
+test tensor_to_list-3.1 {Named syntax} {
+    set t [torch::tensor_create {1 2 3 4} {2 2} int64]
+    torch::tensor_to_list -input $t -nested true
+} {{1 2} {3 4}}
+
+test tensor_to_list-3.2 {CamelCase alias} {
+    torch::tensorToList -tensor [torch::tensor_create {4.0} float32]
+} {4.0}
+
+# Error handling
+test tensor_to_list-4.1 {Error on invalid tensor} -body {
+    torch::tensor_to_list no_such_tensor
+} -returnCodes error -result {Invalid tensor name}
+
+test tensor_to_list-4.2 {Error on missing arguments} -body {
+    torch::tensor_to_list
+} -returnCodes error -match glob -result {Usage: torch::tensor_to_list*}
+
+test tensor_to_list-4.3 {Error on unknown parameter} -body {
+    torch::tensor_to_list -input foo -bar 1
+} -returnCodes error -match glob -result {Unknown parameter: -bar*}
+
+cleanupTests
@@ -0,0 +1,102 @@
+#!/usr/bin/env tclsh
+package require tcltest
+namespace import tcltest::*
+
+# Load extension
+if {[catch {load ../../build/libtorchtcl.so}]} {
+    puts "Failed to load libtorchtcl.so"
+    exit 1
+}
+
+# Test configuration
+configure -testdir [file dirname [info script]]
+configure -verbose {pass fail skip error}
+
+# y = 2x on a handful of points
+set x [torch::tensor_create {0.0 1.0 2.0 3.0} {4 1} float32]
+set y [torch::tensor_create {0.0 2.0 4.0 6.0} {4 1} float32]
+
+proc newModel {} {
+    set model [torch::linear 1 1]
+    set opt [torch::optimizer_sgd [torch::layer_parameters $model] 0.05]
+    return [list $model $opt]
+}
+
+test train_step-1.1 {Positional syntax returns a decreasing loss} {
+    lassign [newModel] model opt
+    set first [torch::train_step $model $opt mse $x $y]
+    for {set i 0} {$i < 50} {incr i} {
+        set last [torch::train_step $model $opt mse $x $y]
+    }
+    expr {[string is double -strict $first] && $last < $first}
+} {1}
+
+test train_step-1.2 {Named syntax and camelCase alias} {
+    lassign [newModel] model opt
+    set loss [torch::trainStep -model $model -optimizer $opt -loss mse_loss -input $x -target $y]
+    string is double -strict $loss
+} {1}
+
+test train_step-1.3 {No handles are allocated} {
+    lassign [newModel] model opt
+    torch::train_step $model $opt mse $x $y
+    set before [torch::handle_count]
+    torch::train_step -model $model -optimizer $opt -loss mse -input $x -target $y -clip 1.0
+    expr {[torch::handle_count] - $before}
+} {0}
+
+test train_step-1.4 {Clipping and a scheduler} {
+    lassign [newModel] model opt
+    set sched [torch::lr_scheduler_step $opt 1 0.5]
+    torch::train_step -model $model -optimizer $opt -loss l1 -input $x -target $y -clip 0.5 -scheduler $sched
+    torch::get_lr $opt
+} {0.025}
+
+test train_step-1.5 {Gradient scaler} {
+    lassign [newModel] model opt
+    set scaler [torch::grad_scaler_new 1024.0]
+    set first [torch::train_step -model $model -optimizer $opt -loss mse -input $x -target $y -scaler $scaler]
+    for {set i 0} {$i < 20} {incr i} {
+        set last [torch::train_step -model $model -optimizer $opt -loss mse -input $x -target $y -scaler $scaler]
+    }
+    expr {$last < $first}
+} {1}
+
+test train_step-1.6 {Cross entropy with class targets} {
+    set model [torch::linear 2 3]
+    set opt [torch::optimizer_adam [torch::layer_parameters $model] 0.01]
+    set xs [torch::tensor_create {1.0 0.0 0.0 1.0} {2 2} float32]
+    set labels [torch::tensor_create {0 2} int64]
+    string is double -strict [torch::train_step $model $opt cross_entropy $xs $labels]
+} {1}
+
+test train_step-2.1 {Unknown loss} {
+    lassign [newModel] model opt
+    catch {torch::train_step $model $opt bogus $x $y} msg
+    string match "Unknown loss: bogus*" $msg
+} {1}
+
+test train_step-2.2 {Invalid model} {
+    lassign [newModel] model opt
+    catch {torch::train_step nosuch $opt mse $x $y} msg
+    set msg
+} {Invalid model name}
+
+test train_step-2.3 {Invalid scaler} {
+    lassign [newModel] model opt
+    catch {torch::train_step -model $model -optimizer $opt -loss mse -input $x -target $y -scaler nosuch} msg
+    set msg
+} {Gradient scaler not found}
+
+test train_step-2.4 {Missing parameters} {
+    catch {torch::train_step -model foo} msg
+    string match "Required parameters missing*" $msg
+} {1}
+
+test train_step-2.5 {Unknown parameter} {
+    lassign [newModel] model opt
+    catch {torch::train_step -model $model -optimizer $opt -loss mse -input $x -target $y -bogus 1} msg
+    string match "Unknown parameter: -bogus*" $msg
+} {1}
+
+cleanupTests